@@ -1,12 +1,35 @@
 #pragma once
 
 #include <StockScraper/Headers/Alpaca.hpp>
+#include <StockScraper/Headers/BarBuilder.hpp>
+#include <StockScraper/Headers/BarCache.hpp>
+#include <StockScraper/Headers/MarketDataProvider.hpp>
+
+#include <filesystem>
+#include <unordered_map>
+
+#include "Strategy.hpp"
 
 namespace StockyBoy {
 	namespace Bots {
 		namespace FivePercentRule {
+			// Where a run gets its data. Bars and quotes can come from different providers, unset ones are Yahoo.
+			struct Providers {
+				StockyBoy::Scraper::MarketDataProvider* bars = nullptr;
+				StockyBoy::Scraper::MarketDataProvider* quotes = nullptr;
+			};
+
 			// Return True if algorithm ran
 			bool Run(const std::string& logPath, StockyBoy::Scraper::Alpaca::Account& account, uint32_t window, float budget);
+			// With `live` set, symbols it tracks are priced from their latest 1m bar instead of a download
+			bool Run(const std::string& logPath, StockyBoy::Scraper::Alpaca::Account& account, const Params& params, float budget,
+				const StockyBoy::Scraper::BarBuilder* live = nullptr, const Providers& providers = {});
+
+			// Rebuilds the universe file at `path` from the cached daily bars. Symbols come from `listing` (a CSV like tickers.csv)
+			// when it exists, else from the file itself, else from the built-in table. `fetched` is what the last scan tried:
+			// label -> whether the refresh went through (outages left out); symbols that keep failing or stay stale are deactivated.
+			StockyBoy::Scraper::Result UpdateUniverse(const StockyBoy::Scraper::BarCache& cache, const std::filesystem::path& path,
+				const std::filesystem::path& listing, const std::unordered_map<std::string, bool>& fetched = {});
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+
+#include <StockScraper/Headers/BarCache.hpp>
+#include <StockScraper/Headers/Screener.hpp>
+
+#include "Strategy.hpp"
+
+namespace StockyBoy {
+	namespace Bots {
+		namespace FivePercentRule {
+			// Daily closes of a whole universe on one shared calendar (the union of every symbol's trading days).
+			// Bar-major like Scraper::CloseMatrix: row d holds every symbol's close on day d, NaN where it has no bar.
+			// Read-only once built, so one History can back any number of replays.
+			class History {
+			private:
+				std::vector<std::string> Labels;
+				std::unordered_map<std::string, uint32_t> Symbols;
+				std::vector<int64_t> Days; // days since the Unix epoch, ascending
+				std::vector<double> Closes;
+
+			public:
+				static History Build(std::span<const std::string> labels, std::span<const Scraper::StockTableView> bars);
+
+				// Maps the cached daily bars of every label, labels with no usable cache file are left out
+				static History Load(const Scraper::BarCache& cache, std::span<const char* const> labels);
+				// Same, over the whole ticker universe (SymbolTable.hpp)
+				static History Load(const Scraper::BarCache& cache);
+
+				std::span<const double> closes(size_t day) const;
+				int64_t day(size_t index) const { return Days[index]; }
+				size_t days() const { return Days.size(); }
+
+				const std::vector<std::string>& labels() const { return Labels; }
+				size_t symbols() const { return Labels.size(); }
+
+				bool Find(const std::string& label, uint32_t& out_Symbol) const;
+			};
+
+			// Serves one History day at a time, as if it were today
+			class ReplayMarket : public MarketData {
+			private:
+				const History& Data;
+				size_t Day = 0;
+
+				std::vector<double> LastClose; // latest known close per symbol, for marking positions on days with no bar
+				Scraper::CloseMatrix Window;
+				std::vector<uint8_t> Hits;
+
+			public:
+				explicit ReplayMarket(const History& history);
+
+				// Days must be visited in ascending order
+				void SetDay(size_t day);
+
+				double lastClose(uint32_t symbol) const { return LastClose[symbol]; }
+
+				size_t universeSize() const override { return Data.symbols(); }
+
+				// Only today's bar counts: no trading a symbol on a day it has no bar
+				bool GetPrice(const std::string& label, float& out_Price) override;
+
+				// Screens the last `depth` calendar rows, so a missing day inside the window means no hit
+				void Scan(const Scraper::Screener& screener, uint32_t depth, std::span<const uint32_t> order, const Tickers& exclude, const OnHit& onHit) override;
+			};
+
+			// Fills instantly at the given price. A sell closes the whole position.
+			class InMemoryPortfolio : public Portfolio {
+			private:
+				double Cash;
+				Tickers Holdings;
+				std::unordered_map<std::string, double> Shares;
+				size_t Buys = 0;
+				size_t Sells = 0;
+
+			public:
+				explicit InMemoryPortfolio(double cash) : Cash(cash) {}
+
+				const Tickers& holdings() const override { return Holdings; }
+				bool GetBalance(float& out_Balance) override;
+
+				std::vector<Scraper::Result> Execute(const std::vector<Trade>& trades) override;
+
+				// Rejected without the cash for it
+				Scraper::Result Buy(const std::string& label, float price, float value);
+				Scraper::Result Sell(const std::string& label, float price);
+
+				// Cash plus every position at the market's latest known close
+				double Equity(const ReplayMarket& market, const History& history) const;
+
+				double cash() const { return Cash; }
+				size_t buys() const { return Buys; }
+				size_t sells() const { return Sells; }
+			};
+
+			struct BacktestConfig {
+				Params params{};
+				float dailyBudget = 50.0f;
+				double startingCash = 1000.0;
+				uint64_t seed = 0; // seeds the daily shuffle, same seed and data give the same run
+			};
+
+			struct BacktestResult {
+				std::vector<int64_t> days;  // session days, days since the Unix epoch
+				std::vector<double> equity; // end-of-session equity
+				double startingCash = 0.0;
+				size_t buys = 0;
+				size_t sells = 0;
+			};
+
+			// Replays Run's session day by day over `history`, at 15:00 UTC each day. Failed orders go to `log` if given.
+			BacktestResult Backtest(const History& history, const BacktestConfig& config, std::ostream* log = nullptr);
+		}
+	}
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <span>
+#include <chrono>
+#include <random>
+#include <string>
+#include <ostream>
+#include <functional>
+#include <unordered_map>
+
+#include <StockScraper/Headers/Alpaca.hpp>
+#include <StockScraper/Headers/Screener.hpp>
+
+// The 5% rule itself, independent of where prices come from, where trades go and what time it is.
+// Run drives it live against Yahoo and Alpaca, the backtester replays it over cached history.
+
+namespace StockyBoy {
+	namespace Bots {
+		namespace FivePercentRule {
+			constexpr float FORGIVENESS = 0.1f;
+			constexpr float TRADE_VALUE = 5.0f; // notional of every buy and sell, in $
+
+			// Knobs of the rule, the defaults are the live bot's
+			struct Params {
+				uint32_t window = 3;              // bars the price change is measured over
+				float buyDrop = 5.0f;             // buy after a drop of at least this many %
+				float sellGain = 5.0f;            // sell once up at least this many % since entry
+				float forgiveness = FORGIVENESS;  // % of slack on both thresholds
+				float tradeValue = TRADE_VALUE;
+			};
+
+			// label -> price
+			using Tickers = std::unordered_map<std::string, float>;
+
+			// --- Time ---
+
+			class Clock {
+			public:
+				virtual ~Clock() = default;
+				virtual std::chrono::system_clock::time_point now() const = 0;
+			};
+
+			class SystemClock : public Clock {
+			public:
+				std::chrono::system_clock::time_point now() const override { return std::chrono::system_clock::now(); }
+			};
+
+			// Stands still until told to move, for replays
+			class ManualClock : public Clock {
+			private:
+				std::chrono::system_clock::time_point Now{};
+
+			public:
+				void Set(std::chrono::system_clock::time_point now) { Now = now; }
+				std::chrono::system_clock::time_point now() const override { return Now; }
+			};
+
+			bool InMarketHours(const Clock& clock);
+			std::string GetTodayString(const Clock& clock);
+
+			// --- Trades ---
+
+			struct Trade {
+				Scraper::Action action;
+				std::string label;
+				float price; // price the decision was made at
+				float value; // notional in $ for buys, a sell closes the whole position
+			};
+
+			class Portfolio {
+			public:
+				virtual ~Portfolio() = default;
+
+				// Open positions, label -> entry price
+				virtual const Tickers& holdings() const = 0;
+				virtual bool GetBalance(float& out_Balance) = 0;
+
+				// One result per trade, in order. holdings() only changes for the trades that went through.
+				virtual std::vector<Scraper::Result> Execute(const std::vector<Trade>& trades) = 0;
+			};
+
+			// --- Prices ---
+
+			class MarketData {
+			public:
+				// Called with each match in scan order, return false to stop the scan
+				using OnHit = std::function<bool(const std::string& label, float price)>;
+
+				virtual ~MarketData() = default;
+
+				virtual size_t universeSize() const = 0;
+
+				// Latest close, false if unknown
+				virtual bool GetPrice(const std::string& label, float& out_Price) = 0;
+
+				// Latest close of every label into out_Prices, labels without one are left out.
+				// Markets that can ask for many symbols in one request override this.
+				virtual void GetPrices(std::span<const std::string> labels, Tickers& out_Prices) {
+					for (const std::string& label : labels) {
+						float price;
+						if (GetPrice(label, price)) out_Prices[label] = price;
+					}
+				}
+
+				// Screens the universe in `order` (indices below universeSize()), skipping `exclude`.
+				// `depth` is how many bars per symbol the screener needs.
+				virtual void Scan(const Scraper::Screener& screener, uint32_t depth, std::span<const uint32_t> order, const Tickers& exclude, const OnHit& onHit) = 0;
+			};
+
+			// --- The rule ---
+
+			float getPercentageChange(float _old, float _new);
+
+			// Matches symbols that dropped at least buyDrop % over `window` bars
+			Scraper::Screener MakeBuyScreener(const Params& params);
+
+			std::vector<uint32_t> getShuffledIndices(uint32_t n, std::mt19937_64& rng);
+
+			struct Session {
+				Params params;
+				float budget;
+				bool checkBalance; // only buy while the balance covers the budget
+			};
+
+			// One trading session: sell holdings up at least sellGain % since entry, buy dips in shuffled order until the budget is spent.
+			// Failed orders are written to `log`.
+			void RunSession(const Session& session, MarketData& market, Portfolio& portfolio, std::mt19937_64& rng, std::ostream& log);
+		}
+	}
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <ostream>
+
+#include "Backtest.hpp"
+
+namespace StockyBoy {
+	namespace Bots {
+		namespace FivePercentRule {
+			// Every combination of the listed values, an empty list keeps the default
+			struct SweepGrid {
+				std::vector<uint32_t> windows;
+				std::vector<float> buyDrops;
+				std::vector<float> sellGains;
+				std::vector<float> forgiveness;
+				std::vector<float> tradeValues;
+
+				std::vector<Params> Expand() const;
+			};
+
+			struct SweepRow {
+				Params params;
+				double totalReturn = 0.0; // final equity / starting cash - 1
+				double maxDrawdown = 0.0; // largest peak-to-trough drop of the equity curve, as a fraction of the peak
+				size_t trades = 0;
+			};
+
+			SweepRow Summarize(const Params& params, const BacktestResult& result);
+
+			// Backtests every Params over the same history, `base` supplies budget, cash and seed.
+			// Runs are spread over a work-stealing pool (`threads` = 0 uses every core). Each run has its own
+			// seeded shuffle, so rows come back in `grid` order with the same values whatever the scheduling.
+			std::vector<SweepRow> Sweep(const History& history, std::span<const Params> grid, const BacktestConfig& base, size_t threads = 0);
+
+			// One CSV line per row, with a header
+			void WriteSweepTable(std::ostream& out, std::span<const SweepRow> rows);
+		}
+	}
+}
@@ -12,11 +12,98 @@ with open(input_csv, newline='', encoding="utf-8") as f:
         if name:
             labels.append(name)
 
+labels = sorted(set(labels))
+
+# --- Minimal perfect hash (hash and displace), must match SymbolTable.hpp ---
+
+MASK = 0xFFFFFFFF
+SEED_STEP = 0x9E3779B9
+
+
+def fnv1a(text):
+    h = 2166136261
+    for byte in text.encode("utf-8"):
+        h ^= byte
+        h = (h * 16777619) & MASK
+    return h
+
+
+def mix(h):
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & MASK
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & MASK
+    h ^= h >> 16
+    return h
+
+
+count = len(labels)
+bucket_count = count // 4 + 1
+assert count < 0xFFFF, "SymbolId is 16 bits"
+
+hashes = [fnv1a(label) for label in labels]
+buckets = [[] for _ in range(bucket_count)]
+for symbol, h in enumerate(hashes):
+    buckets[mix(h) % bucket_count].append(symbol)
+
+seeds = [0] * bucket_count
+slots = [None] * count
+
+# Biggest buckets first, while there is still room; every bucket gets the first seed that puts all its symbols in free slots
+for bucket in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+    members = buckets[bucket]
+    if not members:
+        continue
+    seed = 0
+    while True:
+        taken = [mix(hashes[s] ^ ((seed * SEED_STEP) & MASK)) % count for s in members]
+        if len(set(taken)) == len(taken) and all(slots[t] is None for t in taken):
+            break
+        seed += 1
+        assert seed <= 0xFFFF, "seed doesn't fit in 16 bits, use more buckets"
+    seeds[bucket] = seed
+    for s, t in zip(members, taken):
+        slots[t] = s
+
+# --- Output ---
+
+
+def write_numbers(f, numbers, per_line=16):
+    for i in range(0, len(numbers), per_line):
+        f.write("\t\t\t\t" + ", ".join(str(n) for n in numbers[i:i + per_line]) + ",\n")
+
+
+offsets = [0]
+for label in labels:
+    offsets.append(offsets[-1] + len(label.encode("utf-8")) + 1)
+
 with open(output_hpp, "w", encoding="utf-8") as f:
-    f.write("#pragma once\n")
-    f.write("""#include <vector>\n#include <string>\n#include "pch.h"\n\n""")
-    f.write("inline const std::vector<const char*> TICKER_LABELS = {\n")
+    f.write("#pragma once\n\n")
+    f.write("// Generated by ExtractTickers.py from tickers.csv, don't edit. Use it through SymbolTable.hpp.\n\n")
+    f.write("#include <array>\n#include <cstdint>\n\n")
+    f.write("namespace StockyBoy {\n\tnamespace Bots {\n\t\tnamespace SymbolData {\n")
+    f.write(f"\t\t\tinline constexpr uint32_t COUNT = {count};\n")
+    f.write(f"\t\t\tinline constexpr uint32_t BUCKETS = {bucket_count};\n\n")
+
+    f.write("\t\t\t// Every label in sorted order, each '\\0'-terminated, back to back\n")
+    f.write("\t\t\tinline constexpr char BLOB[] =\n")
     for label in labels:
-        label_escaped = label.replace('"', '\\"')
-        f.write(f'    "{label_escaped}",\n')
-    f.write("};\n")
+        label_escaped = label.replace('\\', '\\\\').replace('"', '\\"')
+        f.write(f'\t\t\t\t"{label_escaped}\\0"\n')
+    f.write("\t\t\t\t;\n\n")
+
+    f.write("\t\t\t// Start of each label in BLOB, plus the end\n")
+    f.write("\t\t\tinline constexpr std::array<uint32_t, COUNT + 1> OFFSETS = {\n")
+    write_numbers(f, offsets)
+    f.write("\t\t\t};\n\n")
+
+    f.write("\t\t\t// Displacement seed of each hash bucket\n")
+    f.write("\t\t\tinline constexpr std::array<uint16_t, BUCKETS> SEEDS = {\n")
+    write_numbers(f, seeds)
+    f.write("\t\t\t};\n\n")
+
+    f.write("\t\t\t// Slot -> symbol id\n")
+    f.write("\t\t\tinline constexpr std::array<uint16_t, COUNT> SLOTS = {\n")
+    write_numbers(f, slots)
+    f.write("\t\t\t};\n")
+    f.write("\t\t}\n\t}\n}\n")
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "ticker_labels.hpp"
+
+// The ticker universe as a compile-time table: dense ids in sorted label order, all labels packed in one blob,
+// and a minimal perfect hash from label to id. Regenerate ticker_labels.hpp with ExtractTickers.py.
+
+namespace StockyBoy {
+	namespace Bots {
+		using SymbolId = uint16_t;
+
+		inline constexpr uint32_t SYMBOL_COUNT = SymbolData::COUNT;
+
+		namespace SymbolData {
+			// Must match fnv1a/mix in ExtractTickers.py
+			constexpr uint32_t Fnv1a(std::string_view text) {
+				uint32_t hash = 2166136261u;
+				for (char c : text) {
+					hash ^= static_cast<uint8_t>(c);
+					hash *= 16777619u;
+				}
+				return hash;
+			}
+
+			constexpr uint32_t Mix(uint32_t hash) {
+				hash ^= hash >> 16;
+				hash *= 0x85EBCA6Bu;
+				hash ^= hash >> 13;
+				hash *= 0xC2B2AE35u;
+				hash ^= hash >> 16;
+				return hash;
+			}
+
+			constexpr uint32_t SEED_STEP = 0x9E3779B9u;
+		}
+
+		constexpr std::string_view SymbolName(SymbolId id) {
+			return std::string_view(SymbolData::BLOB + SymbolData::OFFSETS[id], SymbolData::OFFSETS[id + 1] - SymbolData::OFFSETS[id] - 1);
+		}
+
+		// Same as SymbolName, '\0'-terminated
+		constexpr const char* SymbolCStr(SymbolId id) {
+			return SymbolData::BLOB + SymbolData::OFFSETS[id];
+		}
+
+		// One hash of the label and two table reads, false for labels outside the universe
+		constexpr bool FindSymbol(std::string_view label, SymbolId& out_Id) {
+			using namespace SymbolData;
+
+			const uint32_t hash = Fnv1a(label);
+			const uint32_t seed = SEEDS[Mix(hash) % BUCKETS];
+			const SymbolId id = SLOTS[Mix(hash ^ (seed * SEED_STEP)) % COUNT];
+
+			if (SymbolName(id) != label) return false;
+
+			out_Id = id;
+			return true;
+		}
+
+		static_assert(SYMBOL_COUNT <= UINT16_MAX, "SymbolId is 16 bits");
+	}
+}
@@ -1,6980 +1,7971 @@
 #pragma once
-#include <vector>
-#include <string>
-#include "pch.h"
 
-inline const std::vector<const char*> TICKER_LABELS = {
-    "A",
-    "AA",
-    "AABA",
-    "AAC",
-    "AAL",
-    "AAMC",
-    "AAME",
-    "AAN",
-    "AAOI",
-    "AAON",
-    "AAP",
-    "AAPL",
-    "AAT",
-    "AAU",
-    "AAWW",
-    "AAXJ",
-    "AAXN",
-    "AB",
-    "ABB",
-    "ABBV",
-    "ABC",
-    "ABCB",
-    "ABDC",
-    "ABEO",
-    "ABEOW",
-    "ABEV",
-    "ABG",
-    "ABIL",
-    "ABIO",
-    "ABM",
-    "ABMD",
-    "ABR",
-    "ABR^A",
-    "ABR^B",
-    "ABR^C",
-    "ABT",
-    "ABTX",
-    "ABUS",
-    "AC",
-    "ACA",
-    "ACAD",
-    "ACAM",
-    "ACAMU",
-    "ACAMW",
-    "ACB",
-    "ACBI",
-    "ACC",
-    "ACCO",
-    "ACCP",
-    "ACER",
-    "ACGL",
-    "ACGLO",
-    "ACGLP",
-    "ACH",
-    "ACHC",
-    "ACHN",
-    "ACHV",
-    "ACIA",
-    "ACIU",
-    "ACIW",
-    "ACLS",
-    "ACM",
-    "ACMR",
-    "ACN",
-    "ACNB",
-    "ACOR",
-    "ACP",
-    "ACRE",
-    "ACRS",
-    "ACRX",
-    "ACST",
-    "ACT",
-    "ACTG",
-    "ACTT",
-    "ACTTU",
-    "ACTTW",
-    "ACU",
-    "ACV",
-    "ACWI",
-    "ACWX",
-    "ACY",
-    "ADAP",
-    "ADBE",
-    "ADC",
-    "ADES",
-    "ADI",
-    "ADIL",
-    "ADILW",
-    "ADM",
-    "ADMA",
-    "ADMP",
-    "ADMS",
-    "ADNT",
-    "ADP",
-    "ADPT",
-    "ADRA",
-    "ADRD",
-    "ADRE",
-    "ADRO",
-    "ADRU",
-    "ADS",
-    "ADSK",
-    "ADSW",
-    "ADT",
-    "ADTN",
-    "ADUS",
-    "ADVM",
-    "ADX",
-    "ADXS",
-    "AE",
-    "AEB",
-    "AEE",
-    "AEF",
-    "AEG",
-    "AEGN",
-    "AEH",
-    "AEHR",
-    "AEIS",
-    "AEL",
-    "AEM",
-    "AEMD",
-    "AEO",
-    "AEP",
-    "AEP^B",
-    "AER",
-    "AERI",
-    "AES",
-    "AESE",
-    "AEY",
-    "AEYE",
-    "AEZS",
-    "AFB",
-    "AFC",
-    "AFG",
-    "AFGB",
-    "AFGE",
-    "AFGH",
-    "AFH",
-    "AFHBL",
-    "AFI",
-    "AFIN",
-    "AFINP",
-    "AFL",
-    "AFMD",
-    "AFT",
-    "AFYA",
-    "AG",
-    "AGBA",
-    "AGBAR",
-    "AGBAU",
-    "AGBAW",
-    "AGCO",
-    "AGD",
-    "AGE",
-    "AGEN",
-    "AGFS",
-    "AGFSW",
-    "AGI",
-    "AGIO",
-    "AGLE",
-    "AGM",
-    "AGM^A",
-    "AGM.A",
-    "AGM^C",
-    "AGM^D",
-    "AGMH",
-    "AGN",
-    "AGNC",
-    "AGNCB",
-    "AGNCM",
-    "AGNCN",
-    "AGND",
-    "AGO",
-    "AGO^B",
-    "AGO^E",
-    "AGO^F",
-    "AGR",
-    "AGRO",
-    "AGRX",
-    "AGS",
-    "AGTC",
-    "AGX",
-    "AGYS",
-    "AGZD",
-    "AHC",
-    "AHH",
-    "AHH^A",
-    "AHL^C",
-    "AHL^D",
-    "AHL^E",
-    "AHPI",
-    "AHT",
-    "AHT^D",
-    "AHT^F",
-    "AHT^G",
-    "AHT^H",
-    "AHT^I",
-    "AI",
-    "AIA",
-    "AI^B",
-    "AIC",
-    "AI^C",
-    "AIF",
-    "AIG",
-    "AIG^A",
-    "AIG.WS",
-    "AIHS",
-    "AIM",
-    "AIMC",
-    "AIMT",
-    "AIN",
-    "AINC",
-    "AINV",
-    "AIQ",
-    "AIR",
-    "AIRG",
-    "AIRI",
-    "AIRR",
-    "AIRT",
-    "AIRTP",
-    "AIRTW",
-    "AIT",
-    "AIV",
-    "AIW",
-    "AIZ",
-    "AIZP",
-    "AJG",
-    "AJRD",
-    "AJX",
-    "AJXA",
-    "AKAM",
-    "AKBA",
-    "AKCA",
-    "AKER",
-    "AKG",
-    "AKO.A",
-    "AKO.B",
-    "AKR",
-    "AKRO",
-    "AKRX",
-    "AKS",
-    "AKTS",
-    "AKTX",
-    "AL",
-    "AL^A",
-    "ALAC",
-    "ALACR",
-    "ALACU",
-    "ALACW",
-    "ALB",
-    "ALBO",
-    "ALC",
-    "ALCO",
-    "ALDR",
-    "ALDX",
-    "ALE",
-    "ALEC",
-    "ALEX",
-    "ALG",
-    "ALGN",
-    "ALGR",
-    "ALGRR",
-    "ALGRU",
-    "ALGRW",
-    "ALGT",
-    "ALIM",
-    "ALIT",
-    "ALJJ",
-    "ALK",
-    "ALKS",
-    "ALL",
-    "ALL^A",
-    "ALL^B",
-    "ALL^D.CL",
-    "ALLE",
-    "ALL^E.CL",
-    "ALL^F.CL",
-    "ALL^G",
-    "ALL^H",
-    "ALLK",
-    "ALLO",
-    "ALLT",
-    "ALLY",
-    "ALLY^A",
-    "ALNA",
-    "ALNY",
-    "ALO",
-    "ALOT",
-    "ALPN",
-    "ALP^Q",
-    "ALRM",
-    "ALRN",
-    "ALRS",
-    "ALSK",
-    "ALSN",
-    "ALT",
-    "ALTM",
-    "ALTR",
-    "ALTY",
-    "ALV",
-    "ALX",
-    "ALXN",
-    "ALYA",
-    "AM",
-    "AMAG",
-    "AMAL",
-    "AMAT",
-    "AMBA",
-    "AMBC",
-    "AMBCW",
-    "AMBO",
-    "AMC",
-    "AMCA",
-    "AMCI",
-    "AMCIU",
-    "AMCIW",
-    "AMCR",
-    "AMCX",
-    "AMD",
-    "AME",
-    "AMED",
-    "AMEH",
-    "AMG",
-    "AMGN",
-    "AMH",
-    "AMH^D",
-    "AMH^E",
-    "AMH^F",
-    "AMH^G",
-    "AMH^H",
-    "AMK",
-    "AMKR",
-    "AMN",
-    "AMNB",
-    "AMOT",
-    "AMOV",
-    "AMOV",
-    "AMP",
-    "AMPE",
-    "AMPH",
-    "AMPY",
-    "AMR",
-    "AMRB",
-    "AMRC",
-    "AMRH",
-    "AMRHW",
-    "AMRK",
-    "AMRN",
-    "AMRS",
-    "AMRWW",
-    "AMRX",
-    "AMS",
-    "AMSC",
-    "AMSF",
-    "AMSWA",
-    "AMT",
-    "AMTB",
-    "AMTBB",
-    "AMTD",
-    "AMTX",
-    "AMWD",
-    "AMX",
-    "AMZN",
-    "AN",
-    "ANAB",
-    "ANAT",
-    "ANCN",
-    "ANDA",
-    "ANDAR",
-    "ANDAU",
-    "ANDAW",
-    "ANDE",
-    "ANET",
-    "ANF",
-    "ANFI",
-    "ANGI",
-    "ANGO",
-    "ANH",
-    "ANH^A",
-    "ANH^B",
-    "ANH^C",
-    "ANIK",
-    "ANIP",
-    "ANIX",
-    "ANSS",
-    "ANTE",
-    "ANTM",
-    "ANY",
-    "AOBC",
-    "AOD",
-    "AON",
-    "AOS",
-    "AOSL",
-    "AP",
-    "APA",
-    "APAM",
-    "APD",
-    "APDN",
-    "APDNW",
-    "APEI",
-    "APEN",
-    "APEX",
-    "APH",
-    "APHA",
-    "APLE",
-    "APLS",
-    "APLT",
-    "APM",
-    "APO",
-    "APO^A",
-    "APO^B",
-    "APOG",
-    "APOP",
-    "APOPW",
-    "APPF",
-    "APPN",
-    "APPS",
-    "APRN",
-    "APT",
-    "APTO",
-    "APTS",
-    "APTV",
-    "APTX",
-    "APVO",
-    "APWC",
-    "APY",
-    "APYX",
-    "AQ",
-    "AQB",
-    "AQMS",
-    "AQN",
-    "AQNA",
-    "AQNB",
-    "AQST",
-    "AQUA",
-    "AR",
-    "ARA",
-    "ARAV",
-    "ARAY",
-    "ARC",
-    "ARCB",
-    "ARCC",
-    "ARCE",
-    "ARCH",
-    "ARCO",
-    "ARCT",
-    "ARD",
-    "ARDC",
-    "ARDS",
-    "ARDX",
-    "ARE",
-    "AREC",
-    "ARE^D",
-    "ARES",
-    "ARES^A",
-    "AREX",
-    "ARGD",
-    "ARGO",
-    "ARGX",
-    "ARI",
-    "ARKR",
-    "ARL",
-    "ARLO",
-    "ARLP",
-    "ARMK",
-    "ARMP",
-    "ARNA",
-    "ARNC",
-    "ARNC^",
-    "AROC",
-    "AROW",
-    "ARPO",
-    "ARQL",
-    "ARR",
-    "ARR^B",
-    "ARTL",
-    "ARTLW",
-    "ARTNA",
-    "ARTW",
-    "ARTX",
-    "ARVN",
-    "ARW",
-    "ARWR",
-    "ARYA",
-    "ARYAU",
-    "ARYAW",
-    "ASA",
-    "ASB",
-    "ASB^C",
-    "ASB^D",
-    "ASB^E",
-    "ASC",
-    "ASET",
-    "ASFI",
-    "ASG",
-    "ASGN",
-    "ASH",
-    "ASIX",
-    "ASLN",
-    "ASM",
-    "ASMB",
-    "ASML",
-    "ASNA",
-    "ASND",
-    "ASPN",
-    "ASPS",
-    "ASPU",
-    "ASR",
-    "ASRT",
-    "ASRV",
-    "ASRVP",
-    "ASTC",
-    "ASTE",
-    "ASUR",
-    "ASX",
-    "ASYS",
-    "AT",
-    "ATAI",
-    "ATAX",
-    "ATEC",
-    "ATEN",
-    "ATEST",
-    "ATEST.A",
-    "ATEST.B",
-    "ATEST.C",
-    "ATEX",
-    "ATGE",
-    "ATH",
-    "ATH^A",
-    "ATHE",
-    "ATHM",
-    "ATHX",
-    "ATI",
-    "ATIF",
-    "ATIS",
-    "ATISW",
-    "ATKR",
-    "ATLC",
-    "ATLO",
-    "ATNI",
-    "ATNM",
-    "ATNX",
-    "ATO",
-    "ATOM",
-    "ATOS",
-    "ATR",
-    "ATRA",
-    "ATRC",
-    "ATRI",
-    "ATRO",
-    "ATRS",
-    "ATSG",
-    "ATTO",
-    "ATU",
-    "ATUS",
-    "ATV",
-    "ATVI",
-    "ATXI",
-    "AU",
-    "AUB",
-    "AUBN",
-    "AUDC",
-    "AUG",
-    "AUMN",
-    "AUO",
-    "AUPH",
-    "AUTL",
-    "AUTO",
-    "AUY",
-    "AVA",
-    "AVAL",
-    "AVAV",
-    "AVB",
-    "AVCO",
-    "AVD",
-    "AVDL",
-    "AVDR",
-    "AVEO",
-    "AVGO",
-    "AVGR",
-    "AVH",
-    "AVID",
-    "AVK",
-    "AVLR",
-    "AVNS",
-    "AVNW",
-    "AVP",
-    "AVRO",
-    "AVT",
-    "AVTR",
-    "AVTR^A",
-    "AVX",
-    "AVXL",
-    "AVY",
-    "AVYA",
-    "AWF",
-    "AWI",
-    "AWK",
-    "AWP",
-    "AWR",
-    "AWRE",
-    "AWSM",
-    "AWX",
-    "AX",
-    "AXAS",
-    "AXDX",
-    "AXE",
-    "AXGN",
-    "AXGT",
-    "AXL",
-    "AXLA",
-    "AXNX",
-    "AXO",
-    "AXP",
-    "AXR",
-    "AXS",
-    "AXS^D",
-    "AXS^E",
-    "AXSM",
-    "AXTA",
-    "AXTI",
-    "AXU",
-    "AY",
-    "AYI",
-    "AYR",
-    "AYTU",
-    "AYX",
-    "AZN",
-    "AZO",
-    "AZPN",
-    "AZRE",
-    "AZRX",
-    "AZUL",
-    "AZZ",
-    "B",
-    "BA",
-    "BABA",
-    "BAC",
-    "BAC^A",
-    "BAC^B",
-    "BAC^C",
-    "BAC^E",
-    "BAC^K",
-    "BAC^L",
-    "BAC^M",
-    "BAC^Y",
-    "BAF",
-    "BAH",
-    "BAM",
-    "BANC",
-    "BANC^D",
-    "BANC^E",
-    "BAND",
-    "BANF",
-    "BANFP",
-    "BANR",
-    "BANX",
-    "BAP",
-    "BAS",
-    "BASI",
-    "BATRA",
-    "BATRK",
-    "BAX",
-    "BB",
-    "BBAR",
-    "BBBY",
-    "BBC",
-    "BBCP",
-    "BBD",
-    "BBDC",
-    "BBDO",
-    "BBF",
-    "BBGI",
-    "BBH",
-    "BBI",
-    "BBIO",
-    "BBK",
-    "BBL",
-    "BBN",
-    "BBP",
-    "BBRX",
-    "BBSI",
-    "BBT",
-    "BBT^F",
-    "BBT^G",
-    "BBT^H",
-    "BBU",
-    "BBVA",
-    "BBW",
-    "BBX",
-    "BBY",
-    "BC",
-    "BC^A",
-    "BC^B",
-    "BCBP",
-    "BCC",
-    "BC^C",
-    "BCDA",
-    "BCDAW",
-    "BCE",
-    "BCEI",
-    "BCEL",
-    "BCH",
-    "BCLI",
-    "BCML",
-    "BCNA",
-    "BCO",
-    "BCOM",
-    "BCOR",
-    "BCOV",
-    "BCOW",
-    "BCPC",
-    "BCRH",
-    "BCRX",
-    "BCS",
-    "BCSF",
-    "BCTF",
-    "BCV",
-    "BCV^A",
-    "BCX",
-    "BCYC",
-    "BDC",
-    "BDGE",
-    "BDJ",
-    "BDL",
-    "BDN",
-    "BDR",
-    "BDSI",
-    "BDX",
-    "BDXA",
-    "BE",
-    "BEAT",
-    "BECN",
-    "BEDU",
-    "BELFA",
-    "BELFB",
-    "BEN",
-    "BEP",
-    "BERY",
-    "BEST",
-    "BF.A",
-    "BFAM",
-    "BF.B",
-    "BFC",
-    "BFIN",
-    "BFIT",
-    "BFK",
-    "BFO",
-    "BFRA",
-    "BFS",
-    "BFS^C",
-    "BFS^D",
-    "BFST",
-    "BFY",
-    "BFZ",
-    "BG",
-    "BGB",
-    "BGCP",
-    "BGFV",
-    "BGG",
-    "BGH",
-    "BGI",
-    "BGIO",
-    "BGNE",
-    "BGR",
-    "BGRN",
-    "BGS",
-    "BGSF",
-    "BGT",
-    "BGX",
-    "BGY",
-    "BH",
-    "BH.A",
-    "BHAT",
-    "BHB",
-    "BHC",
-    "BHE",
-    "BHF",
-    "BHFAL",
-    "BHFAP",
-    "BHGE",
-    "BHK",
-    "BHLB",
-    "BHP",
-    "BHR",
-    "BHR^B",
-    "BHR^D",
-    "BHTG",
-    "BHV",
-    "BHVN",
-    "BIB",
-    "BICK",
-    "BID",
-    "BIDU",
-    "BIF",
-    "BIG",
-    "BIIB",
-    "BILI",
-    "BIMI",
-    "BIO",
-    "BIO.B",
-    "BIOC",
-    "BIOL",
-    "BIOS",
-    "BIOX",
-    "BIOX.WS",
-    "BIP",
-    "BIS",
-    "BIT",
-    "BITA",
-    "BIVI",
-    "BJ",
-    "BJRI",
-    "BK",
-    "BK^C",
-    "BKCC",
-    "BKCH",
-    "BKD",
-    "BKE",
-    "BKEP",
-    "BKEPP",
-    "BKH",
-    "BKI",
-    "BKJ",
-    "BKK",
-    "BKN",
-    "BKNG",
-    "BKSC",
-    "BKT",
-    "BKTI",
-    "BKU",
-    "BKYI",
-    "BL",
-    "BLBD",
-    "BLCM",
-    "BLCN",
-    "BLD",
-    "BLDP",
-    "BLDR",
-    "BLE",
-    "BLFS",
-    "BLIN",
-    "BLK",
-    "BLKB",
-    "BLL",
-    "BLMN",
-    "BLNK",
-    "BLNKW",
-    "BLPH",
-    "BLRX",
-    "BLU",
-    "BLUE",
-    "BLW",
-    "BLX",
-    "BMA",
-    "BMCH",
-    "BME",
-    "BMI",
-    "BML^G",
-    "BML^H",
-    "BML^J",
-    "BML^L",
-    "BMLP",
-    "BMO",
-    "BMRA",
-    "BMRC",
-    "BMRN",
-    "BMTC",
-    "BMY",
-    "BND",
-    "BNDW",
-    "BNDX",
-    "BNED",
-    "BNFT",
-    "BNGO",
-    "BNGOW",
-    "BNKL",
-    "BNS",
-    "BNSO",
-    "BNTC",
-    "BNTCW",
-    "BNY",
-    "BOCH",
-    "BOE",
-    "BOH",
-    "BOKF",
-    "BOKFL",
-    "BOLD",
-    "BOMN",
-    "BOOM",
-    "BOOT",
-    "BORR",
-    "BOSC",
-    "BOTJ",
-    "BOTZ",
-    "BOX",
-    "BOXL",
-    "BP",
-    "BPFH",
-    "BPL",
-    "BPMC",
-    "BPMP",
-    "BPMX",
-    "BPOP",
-    "BPOPM",
-    "BPOPN",
-    "BPR",
-    "BPRAP",
-    "BPRN",
-    "BPT",
-    "BPTH",
-    "BPY",
-    "BPYPO",
-    "BPYPP",
-    "BQH",
-    "BR",
-    "BRC",
-    "BREW",
-    "BRFS",
-    "BRG",
-    "BRG^A",
-    "BRG^C",
-    "BRG^D",
-    "BRID",
-    "BRK.A",
-    "BRK.B",
-    "BRKL",
-    "BRKR",
-    "BRKS",
-    "BRN",
-    "BRO",
-    "BROG",
-    "BROGR",
-    "BROGU",
-    "BROGW",
-    "BRPA",
-    "BRPAR",
-    "BRPAU",
-    "BRPAW",
-    "BRPM",
-    "BRPM.U",
-    "BRPM.WS",
-    "BRQS",
-    "BRT",
-    "BRX",
-    "BRY",
-    "BSA",
-    "BSAC",
-    "BSBR",
-    "BSD",
-    "BSE",
-    "BSET",
-    "BSGM",
-    "BSIG",
-    "BSL",
-    "BSM",
-    "BSMX",
-    "BSQR",
-    "BSRR",
-    "BST",
-    "BSTC",
-    "BSTZ",
-    "BSVN",
-    "BSX",
-    "BT",
-    "BTA",
-    "BTAI",
-    "BTE",
-    "BTEC",
-    "BTG",
-    "BTI",
-    "BTN",
-    "BTO",
-    "BTT",
-    "BTU",
-    "BTZ",
-    "BUD",
-    "BUI",
-    "BURG",
-    "BURL",
-    "BUSE",
-    "BV",
-    "BVN",
-    "BVSN",
-    "BVXV",
-    "BVXVW",
-    "BW",
-    "BWA",
-    "BWAY",
-    "BWB",
-    "BWEN",
-    "BWFG",
-    "BWG",
-    "BWL.A",
-    "BWMC",
-    "BWMCU",
-    "BWMCW",
-    "BWXT",
-    "BX",
-    "BXC",
-    "BXG",
-    "BXMT",
-    "BXMX",
-    "BXP",
-    "BXP^B",
-    "BXS",
-    "BY",
-    "BYD",
-    "BYFC",
-    "BYM",
-    "BYND",
-    "BYSI",
-    "BZH",
-    "BZM",
-    "BZUN",
-    "C",
-    "CAAP",
-    "CAAS",
-    "CABO",
-    "CAC",
-    "CACC",
-    "CACG",
-    "CACI",
-    "CADE",
-    "CAE",
-    "CAF",
-    "CAG",
-    "CAH",
-    "CAI",
-    "CAI^A",
-    "CAI^B",
-    "CAJ",
-    "CAKE",
-    "CAL",
-    "CALA",
-    "CALM",
-    "CALX",
-    "CAMP",
-    "CAMT",
-    "CANF",
-    "CANG",
-    "CAPL",
-    "CAPR",
-    "CAR",
-    "CARA",
-    "CARB",
-    "CARE",
-    "CARG",
-    "CARO",
-    "CARS",
-    "CART",
-    "CARV",
-    "CARZ",
-    "CASA",
-    "CASH",
-    "CASI",
-    "CASS",
-    "CASY",
-    "CAT",
-    "CATB",
-    "CATC",
-    "CATH",
-    "CATM",
-    "CATO",
-    "CATS",
-    "CATY",
-    "CB",
-    "CBAN",
-    "CBAT",
-    "CBAY",
-    "CBB",
-    "CBB^B",
-    "CBD",
-    "CBFV",
-    "CBH",
-    "CBIO",
-    "CBL",
-    "CBL^D",
-    "CBL^E",
-    "CBLI",
-    "CBLK",
-    "CBM",
-    "CBMB",
-    "CBMG",
-    "CBNK",
-    "CBO",
-    "CBOE",
-    "CBPO",
-    "CBPX",
-    "CBRE",
-    "CBRL",
-    "CBS",
-    "CBS.A",
-    "CBSH",
-    "CBSHP",
-    "CBT",
-    "CBTX",
-    "CBU",
-    "CBUS",
-    "CBX",
-    "CBZ",
-    "CC",
-    "CCB",
-    "CCBG",
-    "CCC",
-    "CCCL",
-    "CCC.WS",
-    "CCD",
-    "CCEP",
-    "CCF",
-    "CCH",
-    "CCH.U",
-    "CCH.WS",
-    "CCI",
-    "CCI^A",
-    "CCJ",
-    "CCK",
-    "CCL",
-    "CCLP",
-    "CCM",
-    "CCMP",
-    "CCNE",
-    "CCO",
-    "CCOI",
-    "CCR",
-    "CCRC",
-    "CCRN",
-    "CCS",
-    "CCU",
-    "CCX",
-    "CCXI",
-    "CCX.U",
-    "CCX.WS",
-    "CCZ",
-    "CDAY",
-    "CDC",
-    "CDE",
-    "CDEV",
-    "CDK",
-    "CDL",
-    "CDLX",
-    "CDMO",
-    "CDMOP",
-    "CDNA",
-    "CDNS",
-    "CDOR",
-    "CDOR",
-    "CDR",
-    "CDR^B",
-    "CDR^C",
-    "CDTX",
-    "CDW",
-    "CDXC",
-    "CDXS",
-    "CDZI",
-    "CE",
-    "CEA",
-    "CECE",
-    "CECO",
-    "CEE",
-    "CEI",
-    "CEIX",
-    "CEL",
-    "CELC",
-    "CELG",
-    "CELGZ",
-    "CELH",
-    "CELP",
-    "CEM",
-    "CEMI",
-    "CEN",
-    "CENT",
-    "CENTA",
-    "CENX",
-    "CEO",
-    "CEPU",
-    "CEQP",
-    "CEQP^",
-    "CERC",
-    "CERN",
-    "CERS",
-    "CET",
-    "CETV",
-    "CETX",
-    "CETXP",
-    "CETXW",
-    "CEV",
-    "CEVA",
-    "CEY",
-    "CEZ",
-    "CF",
-    "CFA",
-    "CFB",
-    "CFBI",
-    "CFBK",
-    "CFFA",
-    "CFFAU",
-    "CFFAW",
-    "CFFI",
-    "CFFN",
-    "CFG",
-    "CFG^D",
-    "CFMS",
-    "CFO",
-    "CFR",
-    "CFR^A",
-    "CFRX",
-    "CFX",
-    "CFXA",
-    "CG",
-    "CGA",
-    "CGBD",
-    "CGC",
-    "CGEN",
-    "CGIX",
-    "CGNX",
-    "CGO",
-    "CHA",
-    "CHAC",
-    "CHAC.U",
-    "CHAC.WS",
-    "CHAP",
-    "CHCI",
-    "CHCO",
-    "CHCT",
-    "CHD",
-    "CHDN",
-    "CHE",
-    "CHEF",
-    "CHEK",
-    "CHEKW",
-    "CHEKZ",
-    "CHFS",
-    "CHGG",
-    "CHH",
-    "CHI",
-    "CHIC",
-    "CHK",
-    "CHK^D",
-    "CHKP",
-    "CHKR",
-    "CHL",
-    "CHMA",
-    "CHMG",
-    "CHMI",
-    "CHMI^A",
-    "CHMI^B",
-    "CHN",
-    "CHNA",
-    "CHNG",
-    "CHNGU",
-    "CHNR",
-    "CHRA",
-    "CHRS",
-    "CHRW",
-    "CHS",
-    "CHSCL",
-    "CHSCM",
-    "CHSCN",
-    "CHSCO",
-    "CHSCP",
-    "CHSP",
-    "CHT",
-    "CHTR",
-    "CHU",
-    "CHUY",
-    "CHW",
-    "CHWY",
-    "CHY",
-    "CI",
-    "CIA",
-    "CIB",
-    "CIBR",
-    "CID",
-    "CIDM",
-    "CIEN",
-    "CIF",
-    "CIFS",
-    "CIG",
-    "CIG.C",
-    "CIGI",
-    "CIH",
-    "CII",
-    "CIK",
-    "CIL",
-    "CIM",
-    "CIM^A",
-    "CIM^B",
-    "CIM^C",
-    "CIM^D",
-    "CINF",
-    "CINR",
-    "CIO",
-    "CIO^A",
-    "CIR",
-    "CISN",
-    "CIT",
-    "CIVB",
-    "CIVBP",
-    "CIX",
-    "CIZ",
-    "CIZN",
-    "CJ",
-    "C^J",
-    "CJJD",
-    "C^K",
-    "CKH",
-    "CKPT",
-    "CKX",
-    "CL",
-    "CLAR",
-    "CLB",
-    "CLBK",
-    "CLBS",
-    "CLCT",
-    "CLDB",
-    "CLDR",
-    "CLDT",
-    "CLDX",
-    "CLF",
-    "CLFD",
-    "CLGN",
-    "CLGX",
-    "CLH",
-    "CLI",
-    "CLIR",
-    "CLLS",
-    "CLM",
-    "CLMT",
-    "CLNC",
-    "CLNE",
-    "CLNY",
-    "CLNY^B",
-    "CLNY^E",
-    "CLNY^G",
-    "CLNY^H",
-    "CLNY^I",
-    "CLNY^J",
-    "CLOU",
-    "CLPR",
-    "CLPS",
-    "CLR",
-    "CLRB",
-    "CLRBZ",
-    "CLRG",
-    "CLRO",
-    "CLS",
-    "CLSD",
-    "CLSN",
-    "CLUB",
-    "CLVS",
-    "CLW",
-    "CLWT",
-    "CLX",
-    "CLXT",
-    "CM",
-    "CMA",
-    "CMBM",
-    "CMC",
-    "CMCL",
-    "CMCM",
-    "CMCO",
-    "CMCSA",
-    "CMCT",
-    "CMCTP",
-    "CMD",
-    "CME",
-    "CMFNL",
-    "CMG",
-    "CMI",
-    "CMLS",
-    "CMO",
-    "CMO^E",
-    "CMP",
-    "CMPR",
-    "CMRE",
-    "CMRE^B",
-    "CMRE^C",
-    "CMRE^D",
-    "CMRE^E",
-    "CMRX",
-    "CMS",
-    "CMSA",
-    "CMS^B",
-    "CMSC",
-    "CMSD",
-    "CMT",
-    "CMTL",
-    "CMU",
-    "C^N",
-    "CNA",
-    "CNAT",
-    "CNBKA",
-    "CNC",
-    "CNCE",
-    "CNCR",
-    "CNDT",
-    "CNET",
-    "CNF",
-    "CNFR",
-    "CNFRL",
-    "CNHI",
-    "CNI",
-    "CNK",
-    "CNMD",
-    "CNNE",
-    "CNO",
-    "CNOB",
-    "CNP",
-    "CNP^B",
-    "CNQ",
-    "CNR",
-    "CNS",
-    "CNSL",
-    "CNST",
-    "CNTF",
-    "CNTX",
-    "CNTY",
-    "CNX",
-    "CNXM",
-    "CNXN",
-    "CO",
-    "COCP",
-    "CODA",
-    "CODI",
-    "CODI^A",
-    "CODI^B",
-    "CODX",
-    "COE",
-    "COF",
-    "COF^C",
-    "COF^D",
-    "COF^F",
-    "COF^G",
-    "COF^H",
-    "COF^P",
-    "COG",
-    "COHN",
-    "COHR",
-    "COHU",
-    "COKE",
-    "COLB",
-    "COLD",
-    "COLL",
-    "COLM",
-    "COMM",
-    "COMT",
-    "CONE",
-    "CONN",
-    "COO",
-    "COOP",
-    "COP",
-    "COR",
-    "CORE",
-    "CORR",
-    "CORR^A",
-    "CORT",
-    "CORV",
-    "COST",
-    "COT",
-    "COTY",
-    "COUP",
-    "COWN",
-    "COWNL",
-    "COWNZ",
-    "CP",
-    "CPA",
-    "CPAA",
-    "CPAAU",
-    "CPAAW",
-    "CPAC",
-    "CPAH",
-    "CPB",
-    "CPE",
-    "CPF",
-    "CPG",
-    "CPHC",
-    "CPHI",
-    "CPIX",
-    "CPK",
-    "CPL",
-    "CPLG",
-    "CPLP",
-    "CPRI",
-    "CPRT",
-    "CPRX",
-    "CPS",
-    "CPSH",
-    "CPSI",
-    "CPSS",
-    "CPST",
-    "CPT",
-    "CPTA",
-    "CPTAG",
-    "CPTAL",
-    "CPTI",
-    "CQP",
-    "CR",
-    "CRAI",
-    "CRAY",
-    "CRBP",
-    "CRC",
-    "CRCM",
-    "CRD.A",
-    "CRD.B",
-    "CREE",
-    "CREG",
-    "CRESY",
-    "CREX",
-    "CREXW",
-    "CRF",
-    "CRH",
-    "CRHM",
-    "CRI",
-    "CRIS",
-    "CRK",
-    "CRL",
-    "CRM",
-    "CRMD",
-    "CRMT",
-    "CRNT",
-    "CRNX",
-    "CRON",
-    "CROX",
-    "CRR",
-    "CRS",
-    "CRSA",
-    "CRSAU",
-    "CRSAW",
-    "CRSP",
-    "CRT",
-    "CRTO",
-    "CRTX",
-    "CRUS",
-    "CRVL",
-    "CRVS",
-    "CRWD",
-    "CRWS",
-    "CRY",
-    "CRZO",
-    "CS",
-    "C^S",
-    "CSA",
-    "CSB",
-    "CSBR",
-    "CSCO",
-    "CSF",
-    "CSFL",
-    "CSGP",
-    "CSGS",
-    "CSII",
-    "CSIQ",
-    "CSL",
-    "CSLT",
-    "CSML",
-    "CSOD",
-    "CSPI",
-    "CSQ",
-    "CSS",
-    "CSSE",
-    "CSSEP",
-    "CSTE",
-    "CSTL",
-    "CSTM",
-    "CSTR",
-    "CSU",
-    "CSV",
-    "CSWC",
-    "CSWCL",
-    "CSWI",
-    "CSX",
-    "CTAA",
-    "CTA^A",
-    "CTA^B",
-    "CTAC",
-    "CTACU",
-    "CTACW",
-    "CTAS",
-    "CTB",
-    "CTBB",
-    "CTBI",
-    "CTDD",
-    "CTEK",
-    "CTEST",
-    "CTEST.E",
-    "CTEST.G",
-    "CTEST.L",
-    "CTEST.O",
-    "CTEST.S",
-    "CTEST.V",
-    "CTG",
-    "CTHR",
-    "CTIB",
-    "CTIC",
-    "CTK",
-    "CTL",
-    "CTLT",
-    "CTMX",
-    "CTO",
-    "CTR",
-    "CTRA",
-    "CTRC",
-    "CTRE",
-    "CTRM",
-    "CTRN",
-    "CTRP",
-    "CTS",
-    "CTSH",
-    "CTSO",
-    "CTST",
-    "CTT",
-    "CTV",
-    "CTVA",
-    "CTWS",
-    "CTXR",
-    "CTXRW",
-    "CTXS",
-    "CTY",
-    "CTZ",
-    "CUB",
-    "CUBA",
-    "CUBE",
-    "CUBI",
-    "CUBI^C",
-    "CUBI^D",
-    "CUBI^E",
-    "CUBI^F",
-    "CUE",
-    "CUI",
-    "CUK",
-    "CULP",
-    "CUO",
-    "CUR",
-    "CURO",
-    "CUTR",
-    "CUZ",
-    "CVA",
-    "CVBF",
-    "CVCO",
-    "CVCY",
-    "CVE",
-    "CVEO",
-    "CVET",
-    "CVGI",
-    "CVGW",
-    "CVI",
-    "CVIA",
-    "CVLT",
-    "CVLY",
-    "CVM",
-    "CVNA",
-    "CVR",
-    "CVRS",
-    "CVS",
-    "CVTI",
-    "CVU",
-    "CVV",
-    "CVX",
-    "CW",
-    "CWBC",
-    "CWBR",
-    "CWCO",
-    "CWEN",
-    "CWEN.A",
-    "CWH",
-    "CWK",
-    "CWST",
-    "CWT",
-    "CX",
-    "CXDC",
-    "CXE",
-    "CXH",
-    "CXO",
-    "CXP",
-    "CXSE",
-    "CXW",
-    "CY",
-    "CYAD",
-    "CYAN",
-    "CYBE",
-    "CYBR",
-    "CYCC",
-    "CYCCP",
-    "CYCN",
-    "CYD",
-    "CYH",
-    "CYOU",
-    "CYRN",
-    "CYRX",
-    "CYRXW",
-    "CYTK",
-    "CZNC",
-    "CZR",
-    "CZWI",
-    "CZZ",
-    "D",
-    "DAC",
-    "DAIO",
-    "DAKT",
-    "DAL",
-    "DALI",
-    "DAN",
-    "DAR",
-    "DARE",
-    "DAVA",
-    "DAVE",
-    "DAX",
-    "DB",
-    "DBD",
-    "DBI",
-    "DBL",
-    "DBVT",
-    "DBX",
-    "DCAR",
-    "DCF",
-    "DCI",
-    "DCIX",
-    "DCO",
-    "DCOM",
-    "DCP",
-    "DCP^B",
-    "DCP^C",
-    "DCPH",
-    "DCUE",
-    "DD",
-    "DDD",
-    "DDF",
-    "DDIV",
-    "DDMX",
-    "DDMXU",
-    "DDMXW",
-    "DDOC",
-    "DDS",
-    "DDT",
-    "DE",
-    "DEA",
-    "DEAC",
-    "DEACU",
-    "DEACW",
-    "DECK",
-    "DEI",
-    "DELL",
-    "DENN",
-    "DEO",
-    "DERM",
-    "DESP",
-    "DEST",
-    "DEX",
-    "DF",
-    "DFBH",
-    "DFBHU",
-    "DFBHW",
-    "DFFN",
-    "DFIN",
-    "DFNL",
-    "DFP",
-    "DFRG",
-    "DFS",
-    "DFVL",
-    "DFVS",
-    "DG",
-    "DGICA",
-    "DGICB",
-    "DGII",
-    "DGLD",
-    "DGLY",
-    "DGRE",
-    "DGRS",
-    "DGRW",
-    "DGSE",
-    "DGX",
-    "DHF",
-    "DHI",
-    "DHIL",
-    "DHR",
-    "DHR^A",
-    "DHT",
-    "DHX",
-    "DHXM",
-    "DHY",
-    "DIAX",
-    "DIN",
-    "DINT",
-    "DIOD",
-    "DIS",
-    "DISCA",
-    "DISCB",
-    "DISCK",
-    "DISH",
-    "DIT",
-    "DJCO",
-    "DK",
-    "DKL",
-    "DKS",
-    "DKT",
-    "DL",
-    "DLA",
-    "DLB",
-    "DLBS",
-    "DLHC",
-    "DLNG",
-    "DLNG^A",
-    "DLNG^B",
-    "DLPH",
-    "DLPN",
-    "DLPNW",
-    "DLR",
-    "DLR^C",
-    "DLR^G",
-    "DLR^I",
-    "DLR^J",
-    "DLR^K",
-    "DLTH",
-    "DLTR",
-    "DLX",
-    "DMAC",
-    "DMB",
-    "DMF",
-    "DMLP",
-    "DMO",
-    "DMPI",
-    "DMRC",
-    "DMTK",
-    "DMTKW",
-    "DNBF",
-    "DNI",
-    "DNJR",
-    "DNKN",
-    "DNLI",
-    "DNN",
-    "DNOW",
-    "DNP",
-    "DNR",
-    "DO",
-    "DOC",
-    "DOCU",
-    "DOGZ",
-    "DOMO",
-    "DOOO",
-    "DOOR",
-    "DORM",
-    "DOV",
-    "DOVA",
-    "DOW",
-    "DOX",
-    "DOYU",
-    "DPG",
-    "DPHC",
-    "DPHCU",
-    "DPHCW",
-    "DPLO",
-    "DPW",
-    "DPZ",
-    "DQ",
-    "DRAD",
-    "DRADP",
-    "DRD",
-    "DRE",
-    "DRH",
-    "DRI",
-    "DRIO",
-    "DRIOW",
-    "DRIV",
-    "DRMT",
-    "DRNA",
-    "DRQ",
-    "DRRX",
-    "DRUA",
-    "DRYS",
-    "DS",
-    "DS^B",
-    "DS^C",
-    "DS^D",
-    "DSE",
-    "DSGX",
-    "DSKE",
-    "DSKEW",
-    "DSL",
-    "DSLV",
-    "DSM",
-    "DSPG",
-    "DSS",
-    "DSSI",
-    "DSU",
-    "DSWL",
-    "DSX",
-    "DSX^B",
-    "DT",
-    "DTE",
-    "DTEA",
-    "DTF",
-    "DTIL",
-    "DTJ",
-    "DTLA^",
-    "DTQ",
-    "DTSS",
-    "DTUL",
-    "DTUS",
-    "DTV",
-    "DTW",
-    "DTY",
-    "DTYL",
-    "DTYS",
-    "DUC",
-    "DUK",
-    "DUK^A",
-    "DUKB",
-    "DUKH",
-    "DUSA",
-    "DVA",
-    "DVAX",
-    "DVD",
-    "DVLU",
-    "DVN",
-    "DVOL",
-    "DVY",
-    "DWAQ",
-    "DWAS",
-    "DWAT",
-    "DWCR",
-    "DWFI",
-    "DWIN",
-    "DWLD",
-    "DWMC",
-    "DWPP",
-    "DWSH",
-    "DWSN",
-    "DWTR",
-    "DX",
-    "DX^A",
-    "DXB",
-    "DX^B",
-    "DXC",
-    "DXCM",
-    "DXF",
-    "DXGE",
-    "DXJS",
-    "DXLG",
-    "DXPE",
-    "DXR",
-    "DXYN",
-    "DY",
-    "DYAI",
-    "DYNT",
-    "DZSI",
-    "E",
-    "EA",
-    "EAB",
-    "EAD",
-    "EAE",
-    "EAF",
-    "EAI",
-    "EARN",
-    "EARS",
-    "EAST",
-    "EAT",
-    "EB",
-    "EBAY",
-    "EBAYL",
-    "EBF",
-    "EBIX",
-    "EBIZ",
-    "EBMT",
-    "EBR",
-    "EBR.B",
-    "EBS",
-    "EBSB",
-    "EBTC",
-    "EC",
-    "ECA",
-    "ECC",
-    "ECCA",
-    "ECCB",
-    "ECCX",
-    "ECCY",
-    "ECF",
-    "ECF^A",
-    "ECHO",
-    "ECL",
-    "ECOL",
-    "ECOM",
-    "ECOR",
-    "ECOW",
-    "ECPG",
-    "ECT",
-    "ED",
-    "EDAP",
-    "EDD",
-    "EDF",
-    "EDI",
-    "EDIT",
-    "EDN",
-    "EDNT",
-    "EDRY",
-    "EDSA",
-    "EDTX",
-    "EDTXU",
-    "EDTXW",
-    "EDU",
-    "EDUC",
-    "EE",
-    "EEA",
-    "EEFT",
-    "EEI",
-    "EEMA",
-    "EEX",
-    "EFAS",
-    "EFBI",
-    "EFC",
-    "EFF",
-    "EFL",
-    "EFOI",
-    "EFR",
-    "EFSC",
-    "EFT",
-    "EFX",
-    "EGAN",
-    "EGBN",
-    "EGF",
-    "EGHT",
-    "EGHT",
-    "EGI",
-    "EGIF",
-    "EGLE",
-    "EGO",
-    "EGOV",
-    "EGP",
-    "EGRX",
-    "EGY",
-    "EHC",
-    "EHI",
-    "EHR",
-    "EHT",
-    "EHTH",
-    "EIC",
-    "EIDX",
-    "EIG",
-    "EIGI",
-    "EIGR",
-    "EIM",
-    "EIX",
-    "EKSO",
-    "EL",
-    "ELAN",
-    "ELC",
-    "ELF",
-    "ELGX",
-    "ELJ",
-    "ELLO",
-    "ELMD",
-    "ELOX",
-    "ELP",
-    "ELS",
-    "ELSE",
-    "ELTK",
-    "ELU",
-    "ELVT",
-    "ELY",
-    "EMAN",
-    "EMB",
-    "EMCB",
-    "EMCF",
-    "EMCG",
-    "EMCI",
-    "EMD",
-    "EME",
-    "EMF",
-    "EMIF",
-    "EMKR",
-    "EML",
-    "EMMS",
-    "EMN",
-    "EMO",
-    "EMP",
-    "EMR",
-    "EMX",
-    "EMXC",
-    "ENB",
-    "ENBA",
-    "ENBL",
-    "ENDP",
-    "ENFC",
-    "ENG",
-    "ENIA",
-    "ENIC",
-    "ENJ",
-    "ENLC",
-    "ENLV",
-    "ENO",
-    "ENOB",
-    "ENPH",
-    "ENR",
-    "ENR^A",
-    "ENS",
-    "ENSG",
-    "ENSV",
-    "ENT",
-    "ENTA",
-    "ENTG",
-    "ENTX",
-    "ENTXW",
-    "ENV",
-    "ENVA",
-    "ENX",
-    "ENZ",
-    "ENZL",
-    "EOD",
-    "EOG",
-    "EOI",
-    "EOLS",
-    "EOS",
-    "EOT",
-    "EPAM",
-    "EPAY",
-    "EPC",
-    "EP^C",
-    "EPD",
-    "EPIX",
-    "EPM",
-    "EPR",
-    "EPR^C",
-    "EPR^E",
-    "EPR^G",
-    "EPRT",
-    "EPSN",
-    "EPZM",
-    "EQ",
-    "EQBK",
-    "EQC",
-    "EQC^D",
-    "EQH",
-    "EQIX",
-    "EQM",
-    "EQNR",
-    "EQR",
-    "EQRR",
-    "EQS",
-    "EQT",
-    "ERA",
-    "ERC",
-    "ERF",
-    "ERH",
-    "ERI",
-    "ERIC",
-    "ERIE",
-    "ERII",
-    "ERJ",
-    "EROS",
-    "ERYP",
-    "ES",
-    "ESBK",
-    "ESCA",
-    "ESE",
-    "ESEA",
-    "ESG",
-    "ESGD",
-    "ESGE",
-    "ESGG",
-    "ESGR",
-    "ESGRO",
-    "ESGRP",
-    "ESGU",
-    "ESI",
-    "ESLT",
-    "ESNT",
-    "ESP",
-    "ESPR",
-    "ESQ",
-    "ESRT",
-    "ESS",
-    "ESSA",
-    "ESTA",
-    "ESTC",
-    "ESTE",
-    "ESTR",
-    "ESTRW",
-    "ESXB",
-    "ET",
-    "ETB",
-    "ETFC",
-    "ETG",
-    "ETH",
-    "ETI^",
-    "ETJ",
-    "ETM",
-    "ETN",
-    "ETO",
-    "ETON",
-    "ETP^C",
-    "ETP^D",
-    "ETP^E",
-    "ETR",
-    "ETRN",
-    "ETSY",
-    "ETTX",
-    "ETV",
-    "ETW",
-    "ETX",
-    "ETY",
-    "EUFN",
-    "EURN",
-    "EV",
-    "EVA",
-    "EVBG",
-    "EVBN",
-    "EVC",
-    "EVER",
-    "EVF",
-    "EVFM",
-    "EVG",
-    "EVGBC",
-    "EVGN",
-    "EVH",
-    "EVI",
-    "EVK",
-    "EVLMC",
-    "EVLO",
-    "EVM",
-    "EVN",
-    "EVOK",
-    "EVOL",
-    "EVOP",
-    "EVR",
-    "EVRG",
-    "EVRI",
-    "EVSI",
-    "EVSIW",
-    "EVSTC",
-    "EVT",
-    "EVTC",
-    "EVV",
-    "EVY",
-    "EW",
-    "EWBC",
-    "EWJE",
-    "EWJV",
-    "EWZS",
-    "EXAS",
-    "EXC",
-    "EXD",
-    "EXEL",
-    "EXFO",
-    "EXG",
-    "EXK",
-    "EXLS",
-    "EXP",
-    "EXPC",
-    "EXPCU",
-    "EXPD",
-    "EXPE",
-    "EXPI",
-    "EXPO",
-    "EXPR",
-    "EXR",
-    "EXTN",
-    "EXTR",
-    "EYE",
-    "EYEG",
-    "EYEGW",
-    "EYEN",
-    "EYES",
-    "EYESW",
-    "EYPT",
-    "EZPW",
-    "EZT",
-    "F",
-    "FAAR",
-    "FAB",
-    "FAD",
-    "FAF",
-    "FALN",
-    "FAM",
-    "FAMI",
-    "FANG",
-    "FANH",
-    "FARM",
-    "FARO",
-    "FAST",
-    "FAT",
-    "FATE",
-    "FAX",
-    "FB",
-    "F^B",
-    "FBC",
-    "FBHS",
-    "FBIO",
-    "FBIOP",
-    "FBIZ",
-    "FBK",
-    "FBM",
-    "FBMS",
-    "FBNC",
-    "FBP",
-    "FBSS",
-    "FBZ",
-    "FC",
-    "FCA",
-    "FCAL",
-    "FCAN",
-    "FCAP",
-    "FCAU",
-    "FCBC",
-    "FCBP",
-    "FCCO",
-    "FCCY",
-    "FCEF",
-    "FCEL",
-    "FCF",
-    "FCFS",
-    "FCN",
-    "FCNCA",
-    "FCO",
-    "FCPT",
-    "FCSC",
-    "FCT",
-    "FCVT",
-    "FCX",
-    "FDBC",
-    "FDEF",
-    "FDEU",
-    "FDIV",
-    "FDNI",
-    "FDP",
-    "FDS",
-    "FDT",
-    "FDTS",
-    "FDUS",
-    "FDUSL",
-    "FDUSZ",
-    "FDX",
-    "FE",
-    "FEDU",
-    "FEI",
-    "FEIM",
-    "FELE",
-    "FELP",
-    "FEM",
-    "FEMB",
-    "FEMS",
-    "FEN",
-    "FENC",
-    "FENG",
-    "FEO",
-    "FEP",
-    "FET",
-    "FEUZ",
-    "FEX",
-    "FEYE",
-    "FF",
-    "FFA",
-    "FFBC",
-    "FFBW",
-    "FFC",
-    "FFG",
-    "FFHL",
-    "FFIC",
-    "FFIN",
-    "FFIV",
-    "FFNW",
-    "FFWM",
-    "FG",
-    "FGB",
-    "FGBI",
-    "FGEN",
-    "FGM",
-    "FGP",
-    "FG.WS",
-    "FHB",
-    "FHK",
-    "FHL",
-    "FHN",
-    "FHN^A",
-    "FI",
-    "FIBK",
-    "FICO",
-    "FID",
-    "FIF",
-    "FII",
-    "FINS",
-    "FINX",
-    "FIS",
-    "FISI",
-    "FISV",
-    "FIT",
-    "FITB",
-    "FITBI",
-    "FITBP",
-    "FIV",
-    "FIVE",
-    "FIVN",
-    "FIX",
-    "FIXD",
-    "FIXX",
-    "FIZZ",
-    "FJP",
-    "FKLY",
-    "FKO",
-    "FKU",
-    "FL",
-    "FLAG",
-    "FLAT",
-    "FLC",
-    "FLDM",
-    "FLEX",
-    "FLGT",
-    "FLIC",
-    "FLIR",
-    "FLL",
-    "FLLCU",
-    "FLMN",
-    "FLMNW",
-    "FLN",
-    "FLNG",
-    "FLNT",
-    "FLO",
-    "FLOW",
-    "FLR",
-    "FLS",
-    "FLT",
-    "FLUX",
-    "FLWR",
-    "FLWS",
-    "FLXN",
-    "FLXS",
-    "FLY",
-    "FMAO",
-    "FMAX",
-    "FMB",
-    "FMBH",
-    "FMBI",
-    "FMC",
-    "FMCI",
-    "FMCIU",
-    "FMCIW",
-    "FMHI",
-    "FMK",
-    "FMN",
-    "FMNB",
-    "FMO",
-    "FMS",
-    "FMX",
-    "FMY",
-    "FN",
-    "FNB",
-    "FNB^E",
-    "FNCB",
-    "FND",
-    "FNF",
-    "FNHC",
-    "FNJN",
-    "FNK",
-    "FNKO",
-    "FNLC",
-    "FNSR",
-    "FNV",
-    "FNWB",
-    "FNX",
-    "FNY",
-    "FOCS",
-    "FOE",
-    "FOF",
-    "FOLD",
-    "FOMX",
-    "FONR",
-    "FOR",
-    "FORD",
-    "FORK",
-    "FORM",
-    "FORR",
-    "FORTY",
-    "FOSL",
-    "FOX",
-    "FOXA",
-    "FOXF",
-    "FPA",
-    "FPAC",
-    "FPAC.U",
-    "FPAC.WS",
-    "FPAY",
-    "FPAYW",
-    "FPF",
-    "FPH",
-    "FPI",
-    "FPI^B",
-    "FPL",
-    "FPRX",
-    "FPXE",
-    "FPXI",
-    "FR",
-    "FRA",
-    "FRAC",
-    "FRAF",
-    "FRAN",
-    "FRBA",
-    "FRBK",
-    "FRC",
-    "FRC^D",
-    "FRC^F",
-    "FRC^G",
-    "FRC^H",
-    "FRC^I",
-    "FRD",
-    "FRED",
-    "FRGI",
-    "FRME",
-    "FRO",
-    "FRPH",
-    "FRPT",
-    "FRSX",
-    "FRT",
-    "FRTA",
-    "FRT^C",
-    "FSB",
-    "FSBC",
-    "FSBW",
-    "FSCT",
-    "FSD",
-    "FSEA",
-    "FSFG",
-    "FSI",
-    "FSK",
-    "FSLR",
-    "FSLY",
-    "FSM",
-    "FSP",
-    "FSS",
-    "FSTR",
-    "FSV",
-    "FSZ",
-    "FT",
-    "FTA",
-    "FTAC",
-    "FTACU",
-    "FTACW",
-    "FTAG",
-    "FTAI",
-    "FTC",
-    "FTCH",
-    "FTCS",
-    "FTDR",
-    "FTEK",
-    "FTEO",
-    "FTF",
-    "FTFT",
-    "FTGC",
-    "FTHI",
-    "FTI",
-    "FTK",
-    "FTLB",
-    "FTNT",
-    "FTNW",
-    "FTR",
-    "FTRI",
-    "FTS",
-    "FTSI",
-    "FTSL",
-    "FTSM",
-    "FTSV",
-    "FTV",
-    "FTV^A",
-    "FTXD",
-    "FTXG",
-    "FTXH",
-    "FTXL",
-    "FTXN",
-    "FTXO",
-    "FTXR",
-    "FUL",
-    "FULC",
-    "FULT",
-    "FUN",
-    "FUNC",
-    "FUND",
-    "FUSB",
-    "FUV",
-    "FV",
-    "FVC",
-    "FVCB",
-    "FVE",
-    "FVRR",
-    "FWONA",
-    "FWONK",
-    "FWP",
-    "FWRD",
-    "FXNC",
-    "FYC",
-    "FYT",
-    "FYX",
-    "G",
-    "GAB",
-    "GABC",
-    "GAB^D",
-    "GAB^G",
-    "GAB^H",
-    "GAB^J",
-    "GAIA",
-    "GAIN",
-    "GAINL",
-    "GAINM",
-    "GALT",
-    "GAM",
-    "GAM^B",
-    "GARS",
-    "GASS",
-    "GATX",
-    "GBAB",
-    "GBCI",
-    "GBDC",
-    "GBL",
-    "GBLI",
-    "GBLIL",
-    "GBLIZ",
-    "GBLK",
-    "GBR",
-    "GBT",
-    "GBX",
-    "GCAP",
-    "GCBC",
-    "GCI",
-    "GCO",
-    "GCP",
-    "GCV",
-    "GCV^B",
-    "GCVRZ",
-    "GD",
-    "GDDY",
-    "GDEN",
-    "GDI",
-    "GDL",
-    "GDL^C",
-    "GDO",
-    "GDOT",
-    "GDP",
-    "GDS",
-    "GDV",
-    "GDV^A",
-    "GDV^D",
-    "GDV^G",
-    "GDV^H",
-    "GE",
-    "GEC",
-    "GECC",
-    "GECCL",
-    "GECCM",
-    "GECCN",
-    "GEF",
-    "GEF.B",
-    "GEL",
-    "GEMP",
-    "GEN",
-    "GENC",
-    "GENE",
-    "GENY",
-    "GEO",
-    "GEOS",
-    "GER",
-    "GERN",
-    "GES",
-    "GEVO",
-    "GF",
-    "GFED",
-    "GFF",
-    "GFI",
-    "GFN",
-    "GFNCP",
-    "GFNSL",
-    "GFY",
-    "GGAL",
-    "GGB",
-    "GGG",
-    "GGM",
-    "GGN",
-    "GGN^B",
-    "GGO",
-    "GGO^A",
-    "GGT",
-    "GGT^B",
-    "GGT^E",
-    "GGZ",
-    "GGZ^A",
-    "GH",
-    "GHC",
-    "GHDX",
-    "GHG",
-    "GHL",
-    "GHM",
-    "GHSI",
-    "GHY",
-    "GIB",
-    "GIFI",
-    "GIG",
-    "GIG~",
-    "GIGE",
-    "GIGM",
-    "GIG.U",
-    "GIG.WS",
-    "GIII",
-    "GIL",
-    "GILD",
-    "GILT",
-    "GIM",
-    "GIS",
-    "GIX",
-    "GIX~",
-    "GIX.U",
-    "GIX.WS",
-    "GJH",
-    "GJO",
-    "GJP",
-    "GJR",
-    "GJS",
-    "GJT",
-    "GJV",
-    "GKOS",
-    "GL",
-    "GLAC",
-    "GLACR",
-    "GLACU",
-    "GLACW",
-    "GLAD",
-    "GLADD",
-    "GLADN",
-    "GLBS",
-    "GLBZ",
-    "GL^C",
-    "GLDD",
-    "GLDI",
-    "GLG",
-    "GLIBA",
-    "GLIBP",
-    "GLMD",
-    "GLNG",
-    "GLO",
-    "GLOB",
-    "GLOG",
-    "GLOG^A",
-    "GLOP",
-    "GLOP^A",
-    "GLOP^B",
-    "GLOP^C",
-    "GLOW",
-    "GLP",
-    "GLP^A",
-    "GLPG",
-    "GLPI",
-    "GLQ",
-    "GLRE",
-    "GLT",
-    "GLU",
-    "GLU^A",
-    "GLU^B",
-    "GLUU",
-    "GLV",
-    "GLW",
-    "GLYC",
-    "GM",
-    "GMAB",
-    "GMDA",
-    "GME",
-    "GMED",
-    "GMHI",
-    "GMHIU",
-    "GMHIW",
-    "GMLP",
-    "GMLPP",
-    "GMO",
-    "GMRE",
-    "GMRE^A",
-    "GMS",
-    "GMTA",
-    "GMZ",
-    "GNC",
-    "GNCA",
-    "GNE",
-    "GNE^A",
-    "GNFT",
-    "GNK",
-    "GNL",
-    "GNL^A",
-    "GNLN",
-    "GNMA",
-    "GNMK",
-    "GNMX",
-    "GNOM",
-    "GNPX",
-    "GNRC",
-    "GNST",
-    "GNT",
-    "GNT^A",
-    "GNTX",
-    "GNTY",
-    "GNUS",
-    "GNW",
-    "GO",
-    "GOF",
-    "GOGL",
-    "GOGO",
-    "GOL",
-    "GOLD",
-    "GOLD",
-    "GOLF",
-    "GOOD",
-    "GOODM",
-    "GOODO",
-    "GOODP",
-    "GOOG",
-    "GOOGL",
-    "GOOS",
-    "GORO",
-    "GOSS",
-    "GPAQ",
-    "GPAQU",
-    "GPAQW",
-    "GPC",
-    "GPI",
-    "GPJA",
-    "GPK",
-    "GPL",
-    "GPM",
-    "GPMT",
-    "GPN",
-    "GPOR",
-    "GPP",
-    "GPRE",
-    "GPRK",
-    "GPRO",
-    "GPS",
-    "GPX",
-    "GRA",
-    "GRAF",
-    "GRAF.U",
-    "GRAF.WS",
-    "GRAM",
-    "GRBK",
-    "GRC",
-    "GRF",
-    "GRFS",
-    "GRID",
-    "GRIF",
-    "GRIN",
-    "GRMN",
-    "GRNQ",
-    "GROW",
-    "GRPN",
-    "GRP.U",
-    "GRSH",
-    "GRSHU",
-    "GRSHW",
-    "GRTS",
-    "GRUB",
-    "GRVY",
-    "GRX",
-    "GRX^A",
-    "GRX^B",
-    "GS",
-    "GS^A",
-    "GSAH",
-    "GSAH.U",
-    "GSAH.WS",
-    "GSAT",
-    "GSB",
-    "GSBC",
-    "GSBD",
-    "GS^C",
-    "GS^D",
-    "GSH",
-    "GSHD",
-    "GSIT",
-    "GS^J",
-    "GSK",
-    "GS^K",
-    "GSKY",
-    "GSL",
-    "GSL^B",
-    "GSM",
-    "GS^N",
-    "GSS",
-    "GSUM",
-    "GSV",
-    "GSX",
-    "GT",
-    "GTE",
-    "GTES",
-    "GTHX",
-    "GTIM",
-    "GTLS",
-    "GTN",
-    "GTN.A",
-    "GTS",
-    "GTT",
-    "GTX",
-    "GTY",
-    "GTYH",
-    "GULF",
-    "GURE",
-    "GUT",
-    "GUT^A",
-    "GUT^C",
-    "GV",
-    "GVA",
-    "GVP",
-    "GWB",
-    "GWGH",
-    "GWPH",
-    "GWR",
-    "GWRE",
-    "GWRS",
-    "GWW",
-    "GXGX",
-    "GXGXU",
-    "GXGXW",
-    "GYB",
-    "GYC",
-    "GYRO",
-    "H",
-    "HA",
-    "HABT",
-    "HAE",
-    "HAFC",
-    "HAIN",
-    "HAIR",
-    "HAL",
-    "HALL",
-    "HALO",
-    "HARP",
-    "HAS",
-    "HASI",
-    "HAYN",
-    "HBAN",
-    "HBANN",
-    "HBANO",
-    "HBB",
-    "HBCP",
-    "HBI",
-    "HBIO",
-    "HBM",
-    "HBMD",
-    "HBNC",
-    "HBP",
-    "HCA",
-    "HCAC",
-    "HCACU",
-    "HCACW",
-    "HCAP",
-    "HCAPZ",
-    "HCAT",
-    "HCC",
-    "HCCH",
-    "HCCHR",
-    "HCCHU",
-    "HCCHW",
-    "HCCI",
-    "HCFT",
-    "HCHC",
-    "HCI",
-    "HCKT",
-    "HCM",
-    "HCP",
-    "HCR",
-    "HCSG",
-    "HCXY",
-    "HCXZ",
-    "HD",
-    "HDB",
-    "HDS",
-    "HDSN",
-    "HE",
-    "HEAR",
-    "HEBT",
-    "HEES",
-    "HEI",
-    "HEI.A",
-    "HELE",
-    "HEP",
-    "HEPA",
-    "HEQ",
-    "HERD",
-    "HES",
-    "HESM",
-    "HEWG",
-    "HEXO",
-    "HFBL",
-    "HFC",
-    "HFFG",
-    "HFRO",
-    "HFRO^A",
-    "HFWA",
-    "HGH",
-    "HGLB",
-    "HGSH",
-    "HGV",
-    "HHC",
-    "HHHH",
-    "HHHHR",
-    "HHHHU",
-    "HHHHW",
-    "HHR",
-    "HHS",
-    "HHT",
-    "HI",
-    "HIBB",
-    "HIE",
-    "HIFS",
-    "HIG",
-    "HIG^G",
-    "HIHO",
-    "HII",
-    "HIIQ",
-    "HIL",
-    "HIMX",
-    "HIO",
-    "HIW",
-    "HIX",
-    "HJLI",
-    "HJLIW",
-    "HJV",
-    "HKIB",
-    "HL",
-    "HLAL",
-    "HL^B",
-    "HLF",
-    "HLG",
-    "HLI",
-    "HLIO",
-    "HLIT",
-    "HLM^",
-    "HLNE",
-    "HLT",
-    "HLX",
-    "HMC",
-    "HMG",
-    "HMHC",
-    "HMI",
-    "HMLP",
-    "HMLP^A",
-    "HMN",
-    "HMNF",
-    "HMST",
-    "HMSY",
-    "HMTV",
-    "HMY",
-    "HNDL",
-    "HNGR",
-    "HNI",
-    "HNNA",
-    "HNP",
-    "HNRG",
-    "HNW",
-    "HOFT",
-    "HOG",
-    "HOLI",
-    "HOLX",
-    "HOMB",
-    "HOME",
-    "HON",
-    "HONE",
-    "HOOK",
-    "HOPE",
-    "HOS",
-    "HOTH",
-    "HOV",
-    "HOVNP",
-    "HP",
-    "HPE",
-    "HPF",
-    "HPI",
-    "HPJ",
-    "HPP",
-    "HPQ",
-    "HPR",
-    "HPS",
-    "HPT",
-    "HQH",
-    "HQI",
-    "HQL",
-    "HQY",
-    "HR",
-    "HRB",
-    "HRC",
-    "HRI",
-    "HRL",
-    "HROW",
-    "HRTG",
-    "HRTX",
-    "HRZN",
-    "HSAC",
-    "HSACU",
-    "HSACW",
-    "HSBC",
-    "HSBC^A",
-    "HSC",
-    "HSDT",
-    "HSGX",
-    "HSIC",
-    "HSII",
-    "HSKA",
-    "HSON",
-    "HST",
-    "HSTM",
-    "HSY",
-    "HT",
-    "HTA",
-    "HTBI",
-    "HTBK",
-    "HTBX",
-    "HT^C",
-    "HTD",
-    "HT^D",
-    "HT^E",
-    "HTFA",
-    "HTGC",
-    "HTGM",
-    "HTH",
-    "HTHT",
-    "HTLD",
-    "HTLF",
-    "HTY",
-    "HTZ",
-    "HUBB",
-    "HUBG",
-    "HUBS",
-    "HUD",
-    "HUM",
-    "HUN",
-    "HURC",
-    "HURN",
-    "HUSA",
-    "HUYA",
-    "HVBC",
-    "HVT",
-    "HVT.A",
-    "HWBK",
-    "HWC",
-    "HWCC",
-    "HWCPL",
-    "HWKN",
-    "HX",
-    "HXL",
-    "HY",
-    "HYAC",
-    "HYACU",
-    "HYACW",
-    "HYB",
-    "HYI",
-    "HYLS",
-    "HYND",
-    "HYRE",
-    "HYT",
-    "HYXE",
-    "HYZD",
-    "HZN",
-    "HZNP",
-    "HZO",
-    "I",
-    "IAA",
-    "IAC",
-    "IAE",
-    "IAF",
-    "IAG",
-    "IART",
-    "IBA",
-    "IBB",
-    "IBCP",
-    "IBEX",
-    "IBIO",
-    "IBKC",
-    "IBKCN",
-    "IBKCO",
-    "IBKCP",
-    "IBM",
-    "IBN",
-    "IBO",
-    "IBOC",
-    "IBP",
-    "IBTX",
-    "IBUY",
-    "ICAD",
-    "ICBK",
-    "ICCC",
-    "ICCH",
-    "ICD",
-    "ICE",
-    "ICFI",
-    "ICHR",
-    "ICL",
-    "ICLK",
-    "ICLN",
-    "ICLR",
-    "ICMB",
-    "ICON",
-    "ICPT",
-    "ICUI",
-    "IDA",
-    "IDCC",
-    "IDE",
-    "IDEX",
-    "IDLB",
-    "IDN",
-    "IDRA",
-    "IDSA",
-    "IDSY",
-    "IDT",
-    "IDXG",
-    "IDXX",
-    "IDYA",
-    "IEA",
-    "IEAWW",
-    "IEC",
-    "IEF",
-    "IEI",
-    "IEP",
-    "IESC",
-    "IEUS",
-    "IEX",
-    "IFEU",
-    "IFF",
-    "IFFT",
-    "IFGL",
-    "IFMK",
-    "IFN",
-    "IFRX",
-    "IFS",
-    "IFV",
-    "IGA",
-    "IGC",
-    "IGD",
-    "IGF",
-    "IGI",
-    "IGIB",
-    "IGLD",
-    "IGLE",
-    "IGOV",
-    "IGR",
-    "IGSB",
-    "IGT",
-    "IHC",
-    "IHD",
-    "IHG",
-    "IHIT",
-    "IHRT",
-    "IHT",
-    "IHTA",
-    "IID",
-    "IIF",
-    "III",
-    "IIIN",
-    "IIIV",
-    "IIM",
-    "IIN",
-    "IIPR",
-    "IIPR^A",
-    "IIVI",
-    "IJT",
-    "IKNX",
-    "ILMN",
-    "ILPT",
-    "IMAC",
-    "IMACW",
-    "IMAX",
-    "IMBI",
-    "IMGN",
-    "IMH",
-    "IMI",
-    "IMKTA",
-    "IMMP",
-    "IMMR",
-    "IMMU",
-    "IMO",
-    "IMOS",
-    "IMRN",
-    "IMRNW",
-    "IMTE",
-    "IMUX",
-    "IMV",
-    "IMXI",
-    "INAP",
-    "INB",
-    "INBK",
-    "INBKL",
-    "INBKZ",
-    "INCY",
-    "INDB",
-    "INDY",
-    "INF",
-    "INFI",
-    "INFN",
-    "INFO",
-    "INFO",
-    "INFR",
-    "INFU",
-    "INFY",
-    "ING",
-    "INGN",
-    "INGR",
-    "INMB",
-    "INMD",
-    "INN",
-    "INN^D",
-    "INN^E",
-    "INNT",
-    "INO",
-    "INOD",
-    "INOV",
-    "INPX",
-    "INS",
-    "INSE",
-    "INSG",
-    "INSI",
-    "INSM",
-    "INSP",
-    "INST",
-    "INSU",
-    "INSUU",
-    "INSUW",
-    "INSW",
-    "INSW^A",
-    "INT",
-    "INTC",
-    "INTG",
-    "INTL",
-    "INTT",
-    "INTU",
-    "INUV",
-    "INVA",
-    "INVE",
-    "INVH",
-    "INWK",
-    "INXN",
-    "IO",
-    "IONS",
-    "IOR",
-    "IOSP",
-    "IOTS",
-    "IOVA",
-    "IP",
-    "IPAR",
-    "IPB",
-    "IPDN",
-    "IPG",
-    "IPGP",
-    "IPHI",
-    "IPHS",
-    "IPI",
-    "IPKW",
-    "IPLDP",
-    "IPOA",
-    "IPOA.U",
-    "IPOA.WS",
-    "IPWR",
-    "IQ",
-    "IQI",
-    "IQV",
-    "IR",
-    "IRBT",
-    "IRCP",
-    "IRDM",
-    "IRET",
-    "IRET^C",
-    "IRIX",
-    "IRL",
-    "IRM",
-    "IRMD",
-    "IROQ",
-    "IRR",
-    "IRS",
-    "IRT",
-    "IRTC",
-    "IRWD",
-    "ISBC",
-    "ISCA",
-    "ISD",
-    "ISDR",
-    "ISDS",
-    "ISDX",
-    "ISEE",
-    "ISEM",
-    "ISG",
-    "ISHG",
-    "ISIG",
-    "ISNS",
-    "ISR",
-    "ISRG",
-    "ISRL",
-    "ISSC",
-    "ISTB",
-    "ISTR",
-    "IT",
-    "ITCB",
-    "ITCI",
-    "ITEQ",
-    "ITGR",
-    "ITI",
-    "ITIC",
-    "ITMR",
-    "ITP",
-    "ITRI",
-    "ITRM",
-    "ITRN",
-    "ITT",
-    "ITUB",
-    "ITW",
-    "IUS",
-    "IUSB",
-    "IUSG",
-    "IUSS",
-    "IUSV",
-    "IVAC",
-    "IVC",
-    "IVH",
-    "IVR",
-    "IVR^A",
-    "IVR^B",
-    "IVR^C",
-    "IVZ",
-    "IX",
-    "IXUS",
-    "IZEA",
-    "JACK",
-    "JAG",
-    "JAGX",
-    "JAKK",
-    "JAN",
-    "JASN",
-    "JAX",
-    "JAZZ",
-    "JBGS",
-    "JBHT",
-    "JBK",
-    "JBL",
-    "JBLU",
-    "JBN",
-    "JBR",
-    "JBSS",
-    "JBT",
-    "JCAP",
-    "JCAP^B",
-    "JCE",
-    "JCI",
-    "JCO",
-    "JCOM",
-    "JCP",
-    "JCS",
-    "JCTCF",
-    "JD",
-    "JDD",
-    "JE",
-    "JE^A",
-    "JEC",
-    "JEF",
-    "JELD",
-    "JEMD",
-    "JEQ",
-    "JFIN",
-    "JFK",
-    "JFKKR",
-    "JFKKU",
-    "JFKKW",
-    "JFR",
-    "JFU",
-    "JG",
-    "JGH",
-    "JHAA",
-    "JHB",
-    "JHD",
-    "JHG",
-    "JHI",
-    "JHS",
-    "JHX",
-    "JHY",
-    "JILL",
-    "JJSF",
-    "JKHY",
-    "JKI",
-    "JKS",
-    "JLL",
-    "JLS",
-    "JMEI",
-    "JMF",
-    "JMIA",
-    "JMLP",
-    "JMM",
-    "JMP",
-    "JMPB",
-    "JMPD",
-    "JMT",
-    "JMU",
-    "JNCE",
-    "JNJ",
-    "JNPR",
-    "JOB",
-    "JOBS",
-    "JOE",
-    "JOF",
-    "JOUT",
-    "JP",
-    "JPC",
-    "JPI",
-    "JPM",
-    "JPM^A",
-    "JPM^C",
-    "JPM^D",
-    "JPM^F",
-    "JPM^G",
-    "JPM^H",
-    "JPS",
-    "JPT",
-    "JQC",
-    "JRI",
-    "JRJC",
-    "JRO",
-    "JRS",
-    "JRSH",
-    "JRVR",
-    "JSD",
-    "JSM",
-    "JSMD",
-    "JSML",
-    "JT",
-    "JTA",
-    "JTD",
-    "JVA",
-    "JW.A",
-    "JW.B",
-    "JWN",
-    "JYNT",
-    "K",
-    "KAI",
-    "KALA",
-    "KALU",
-    "KALV",
-    "KAMN",
-    "KAR",
-    "KB",
-    "KBAL",
-    "KBH",
-    "KBLM",
-    "KBLMR",
-    "KBLMU",
-    "KBLMW",
-    "KBR",
-    "KBSF",
-    "KBWB",
-    "KBWD",
-    "KBWP",
-    "KBWR",
-    "KBWY",
-    "KCAPL",
-    "KDMN",
-    "KDP",
-    "KE",
-    "KEG",
-    "KELYA",
-    "KELYB",
-    "KEM",
-    "KEN",
-    "KEP",
-    "KEQU",
-    "KERN",
-    "KERNW",
-    "KEX",
-    "KEY",
-    "KEY^I",
-    "KEY^J",
-    "KEY^K",
-    "KEYS",
-    "KF",
-    "KFFB",
-    "KFRC",
-    "KFS",
-    "KFY",
-    "KGC",
-    "KGJI",
-    "KHC",
-    "KIDS",
-    "KIM",
-    "KIM^I.CL",
-    "KIM^J",
-    "KIM^K.CL",
-    "KIM^L",
-    "KIM^M",
-    "KIN",
-    "KINS",
-    "KIO",
-    "KIQ",
-    "KIRK",
-    "KKR",
-    "KKR^A",
-    "KKR^B",
-    "KL",
-    "KLAC",
-    "KLDO",
-    "KLIC",
-    "KLXE",
-    "KMB",
-    "KMDA",
-    "KMF",
-    "KMI",
-    "KMPH",
-    "KMPR",
-    "KMT",
-    "KMX",
-    "KN",
-    "KNDI",
-    "KNL",
-    "KNOP",
-    "KNSA",
-    "KNSL",
-    "KNX",
-    "KO",
-    "KOD",
-    "KODK",
-    "KOF",
-    "KOOL",
-    "KOP",
-    "KOPN",
-    "KOS",
-    "KOSS",
-    "KPTI",
-    "KR",
-    "KRA",
-    "KRC",
-    "KREF",
-    "KRG",
-    "KRMA",
-    "KRNT",
-    "KRNY",
-    "KRO",
-    "KRP",
-    "KRTX",
-    "KRUS",
-    "KRYS",
-    "KSM",
-    "KSS",
-    "KSU",
-    "KSU^",
-    "KT",
-    "KTB",
-    "KTCC",
-    "KTF",
-    "KTH",
-    "KTN",
-    "KTOS",
-    "KTOV",
-    "KTOVW",
-    "KTP",
-    "KURA",
-    "KVHI",
-    "KW",
-    "KWEB",
-    "KWR",
-    "KXIN",
-    "KYN",
-    "KYN^F",
-    "KZIA",
-    "KZR",
-    "L",
-    "LAC",
-    "LACQ",
-    "LACQU",
-    "LACQW",
-    "LAD",
-    "LADR",
-    "LAIX",
-    "LAKE",
-    "LAMR",
-    "LANC",
-    "LAND",
-    "LANDP",
-    "LARK",
-    "LASR",
-    "LAUR",
-    "LAWS",
-    "LAZ",
-    "LAZY",
-    "LB",
-    "LBAI",
-    "LBC",
-    "LBRDA",
-    "LBRDK",
-    "LBRT",
-    "LBTYA",
-    "LBTYB",
-    "LBTYK",
-    "LBY",
-    "LBYAV",
-    "LBYKV",
-    "LC",
-    "LCA",
-    "LCAHU",
-    "LCAHW",
-    "LCI",
-    "LCII",
-    "LCNB",
-    "LCTX",
-    "LCUT",
-    "LDL",
-    "LDOS",
-    "LDP",
-    "LDRI",
-    "LDSF",
-    "LE",
-    "LEA",
-    "LEAF",
-    "LECO",
-    "LEDS",
-    "LEE",
-    "LEG",
-    "LEGH",
-    "LEGR",
-    "LEJU",
-    "LEN",
-    "LEN.B",
-    "LEO",
-    "LEU",
-    "LEVI",
-    "LEVL",
-    "LFAC",
-    "LFACU",
-    "LFACW",
-    "LFC",
-    "LFUS",
-    "LFVN",
-    "LGC",
-    "LGC.U",
-    "LGC.WS",
-    "LGF.A",
-    "LGF.B",
-    "LGI",
-    "LGIH",
-    "LGL",
-    "LGND",
-    "LH",
-    "LHC",
-    "LHCG",
-    "LHC.U",
-    "LHC.WS",
-    "LHX",
-    "LIFE",
-    "LII",
-    "LILA",
-    "LILAK",
-    "LIN",
-    "LINC",
-    "LIND",
-    "LINX",
-    "LIQT",
-    "LITB",
-    "LITE",
-    "LIVE",
-    "LIVN",
-    "LIVX",
-    "LJPC",
-    "LK",
-    "LKCO",
-    "LKFN",
-    "LKOR",
-    "LKQ",
-    "LKSD",
-    "LL",
-    "LLEX",
-    "LLEX",
-    "LLIT",
-    "LLNW",
-    "LLY",
-    "LM",
-    "LMAT",
-    "LMB",
-    "LMBS",
-    "LMFA",
-    "LMFAW",
-    "LMHA",
-    "LMHB",
-    "LMNR",
-    "LMNX",
-    "LMRK",
-    "LMRKN",
-    "LMRKO",
-    "LMRKP",
-    "LMST",
-    "LMT",
-    "LN",
-    "LNC",
-    "LND",
-    "LNDC",
-    "LNG",
-    "LNGR",
-    "LNN",
-    "LNT",
-    "LNTH",
-    "LOAC",
-    "LOACR",
-    "LOACU",
-    "LOACW",
-    "LOAN",
-    "LOB",
-    "LOCO",
-    "LODE",
-    "LOGC",
-    "LOGI",
-    "LOGM",
-    "LOMA",
-    "LONE",
-    "LOOP",
-    "LOPE",
-    "LOR",
-    "LORL",
-    "LOV",
-    "LOVE",
-    "LOW",
-    "LPCN",
-    "LPG",
-    "LPI",
-    "LPL",
-    "LPLA",
-    "LPSN",
-    "LPT",
-    "LPTH",
-    "LPTX",
-    "LPX",
-    "LQDA",
-    "LQDT",
-    "LRAD",
-    "LRCX",
-    "LRGE",
-    "LRN",
-    "LSBK",
-    "LSCC",
-    "LSI",
-    "LSTR",
-    "LSXMA",
-    "LSXMB",
-    "LSXMK",
-    "LTBR",
-    "LTC",
-    "LTHM",
-    "LTM",
-    "LTRPA",
-    "LTRPB",
-    "LTRX",
-    "LTS",
-    "LTS^A",
-    "LTSF",
-    "LTSH",
-    "LTSK",
-    "LTSL",
-    "LTXB",
-    "LUB",
-    "LULU",
-    "LUNA",
-    "LUNG",
-    "LUV",
-    "LVGO",
-    "LVHD",
-    "LVS",
-    "LW",
-    "LWAY",
-    "LX",
-    "LXFR",
-    "LXP",
-    "LXP^C",
-    "LXRX",
-    "LXU",
-    "LYB",
-    "LYFT",
-    "LYG",
-    "LYL",
-    "LYTS",
-    "LYV",
-    "LZB",
-    "M",
-    "MA",
-    "MAA",
-    "MAA^I",
-    "MAC",
-    "MACK",
-    "MAG",
-    "MAGS",
-    "MAIN",
-    "MAMS",
-    "MAN",
-    "MANH",
-    "MANT",
-    "MANU",
-    "MAR",
-    "MARA",
-    "MARK",
-    "MARPS",
-    "MAS",
-    "MASI",
-    "MAT",
-    "MATW",
-    "MATX",
-    "MAV",
-    "MAXR",
-    "MAYS",
-    "MBB",
-    "MBCN",
-    "MBI",
-    "MBII",
-    "MBIN",
-    "MBINO",
-    "MBINP",
-    "MBIO",
-    "MBOT",
-    "MBRX",
-    "MBSD",
-    "MBT",
-    "MBUU",
-    "MBWM",
-    "MC",
-    "MCA",
-    "MCB",
-    "MCBC",
-    "MCC",
-    "MCD",
-    "MCEF",
-    "MCEP",
-    "MCF",
-    "MCFT",
-    "MCHI",
-    "MCHP",
-    "MCHX",
-    "MCI",
-    "MCK",
-    "MCN",
-    "MCO",
-    "MCR",
-    "MCRB",
-    "MCRI",
-    "MCRN",
-    "MCS",
-    "MCV",
-    "MCX",
-    "MCY",
-    "MD",
-    "MDB",
-    "MDC",
-    "MDCA",
-    "MDCO",
-    "MDGL",
-    "MDGS",
-    "MDGSW",
-    "MDIV",
-    "MDJH",
-    "MDLA",
-    "MDLQ",
-    "MDLX",
-    "MDLY",
-    "MDLZ",
-    "MDP",
-    "MDR",
-    "MDRR",
-    "MDRX",
-    "MDSO",
-    "MDT",
-    "MDU",
-    "MDWD",
-    "MEC",
-    "MED",
-    "MEDP",
-    "MEET",
-    "MEI",
-    "MEIP",
-    "MELI",
-    "MEN",
-    "MEOH",
-    "MERC",
-    "MER^K",
-    "MESA",
-    "MESO",
-    "MET",
-    "MET^A",
-    "METC",
-    "MET^E",
-    "MFA",
-    "MFA^B",
-    "MFAC",
-    "MFAC.U",
-    "MFAC.WS",
-    "MFC",
-    "MFD",
-    "MFG",
-    "MFGP",
-    "MFIN",
-    "MFINL",
-    "MFL",
-    "MFM",
-    "MFNC",
-    "MFO",
-    "MFSF",
-    "MFT",
-    "MFV",
-    "MG",
-    "MGA",
-    "MGEE",
-    "MGEN",
-    "MGF",
-    "MGI",
-    "MGIC",
-    "MGLN",
-    "MGM",
-    "MGNX",
-    "MGP",
-    "MGPI",
-    "MGR",
-    "MGRC",
-    "MGTA",
-    "MGTX",
-    "MGU",
-    "MGY",
-    "MGYR",
-    "MH^A",
-    "MH^C",
-    "MHD",
-    "MH^D",
-    "MHE",
-    "MHF",
-    "MHH",
-    "MHI",
-    "MHK",
-    "MHLA",
-    "MHLD",
-    "MHN",
-    "MHNC",
-    "MHO",
-    "MIC",
-    "MICR",
-    "MICT",
-    "MIDD",
-    "MIE",
-    "MIK",
-    "MILN",
-    "MIME",
-    "MIN",
-    "MIND",
-    "MINDP",
-    "MINI",
-    "MIRM",
-    "MIST",
-    "MITK",
-    "MITO",
-    "MITT",
-    "MITT^A",
-    "MITT^B",
-    "MIXT",
-    "MIY",
-    "MJCO",
-    "MKC",
-    "MKC.V",
-    "MKGI",
-    "MKL",
-    "MKSI",
-    "MKTX",
-    "MLAB",
-    "MLCO",
-    "MLHR",
-    "MLI",
-    "MLM",
-    "MLND",
-    "MLNT",
-    "MLNX",
-    "MLP",
-    "MLR",
-    "MLSS",
-    "MLVF",
-    "MMAC",
-    "MMC",
-    "MMD",
-    "MMI",
-    "MMLP",
-    "MMM",
-    "MMP",
-    "MMS",
-    "MMSI",
-    "MMT",
-    "MMU",
-    "MMX",
-    "MMYT",
-    "MN",
-    "MNCL",
-    "MNCLU",
-    "MNCLW",
-    "MNDO",
-    "MNE",
-    "MNI",
-    "MNK",
-    "MNKD",
-    "MNLO",
-    "MNOV",
-    "MNP",
-    "MNR",
-    "MNR^C",
-    "MNRL",
-    "MNRO",
-    "MNSB",
-    "MNST",
-    "MNTA",
-    "MNTX",
-    "MO",
-    "MOBL",
-    "MOD",
-    "MODN",
-    "MOFG",
-    "MOG.A",
-    "MOG.B",
-    "MOGO",
-    "MOGU",
-    "MOH",
-    "MOMO",
-    "MOR",
-    "MORF",
-    "MORN",
-    "MOS",
-    "MOSC",
-    "MOSC.U",
-    "MOSC.WS",
-    "MOSY",
-    "MOTA",
-    "MOTS",
-    "MOV",
-    "MOXC",
-    "MPA",
-    "MPAA",
-    "MPB",
-    "MPC",
-    "MPLX",
-    "MPV",
-    "MPVD",
-    "MPW",
-    "MPWR",
-    "MPX",
-    "MQT",
-    "MQY",
-    "MR",
-    "MRAM",
-    "MRBK",
-    "MRC",
-    "MRCC",
-    "MRCCL",
-    "MRCY",
-    "MREO",
-    "MRIC",
-    "MRIN",
-    "MRK",
-    "MRKR",
-    "MRLN",
-    "MRNA",
-    "MRNS",
-    "MRO",
-    "MRSN",
-    "MRTN",
-    "MRTX",
-    "MRUS",
-    "MRVL",
-    "MS",
-    "MSA",
-    "MS^A",
-    "MSB",
-    "MSBF",
-    "MSBI",
-    "MSC",
-    "MSCI",
-    "MSD",
-    "MS^E",
-    "MSEX",
-    "MS^F",
-    "MSFT",
-    "MSG",
-    "MSG",
-    "MS^G",
-    "MSGN",
-    "MSI",
-    "MS^I",
-    "MS^K",
-    "MSL",
-    "MSM",
-    "MSN",
-    "MSON",
-    "MSTR",
-    "MSVB",
-    "MT",
-    "MTB",
-    "MTBC",
-    "MTBCP",
-    "MTC",
-    "MTCH",
-    "MTD",
-    "MTDR",
-    "MTEM",
-    "MTEX",
-    "MTFB",
-    "MTFBW",
-    "MTG",
-    "MTH",
-    "MTL",
-    "MTL^",
-    "MTLS",
-    "MTN",
-    "MTNB",
-    "MTOR",
-    "MTP",
-    "MTR",
-    "MTRN",
-    "MTRX",
-    "MTSC",
-    "MTSI",
-    "MTSL",
-    "MTT",
-    "MTW",
-    "MTX",
-    "MTZ",
-    "MU",
-    "MUA",
-    "MUC",
-    "MUDS",
-    "MUDSU",
-    "MUDSW",
-    "MUE",
-    "MUFG",
-    "MUH",
-    "MUI",
-    "MUJ",
-    "MUR",
-    "MUS",
-    "MUSA",
-    "MUX",
-    "MVBF",
-    "MVC",
-    "MVCD",
-    "MVF",
-    "MVIS",
-    "MVO",
-    "MVT",
-    "MWA",
-    "MWK",
-    "MX",
-    "MXC",
-    "MXE",
-    "MXF",
-    "MXIM",
-    "MXL",
-    "MYC",
-    "MYD",
-    "MYE",
-    "MYF",
-    "MYFW",
-    "MYGN",
-    "MYI",
-    "MYJ",
-    "MYL",
-    "MYN",
-    "MYO",
-    "MYOK",
-    "MYOS",
-    "MYOV",
-    "MYRG",
-    "MYSZ",
-    "MYT",
-    "MZA",
-    "NAC",
-    "NAD",
-    "NAII",
-    "NAK",
-    "NAKD",
-    "NAN",
-    "NANO",
-    "NAOV",
-    "NAT",
-    "NATH",
-    "NATI",
-    "NATR",
-    "NAV",
-    "NAVB",
-    "NAV^D",
-    "NAVI",
-    "NAZ",
-    "NBB",
-    "NBCP",
-    "NBEV",
-    "NBH",
-    "NBHC",
-    "NBIX",
-    "NBL",
-    "NBLX",
-    "NBN",
-    "NBO",
-    "NBR",
-    "NBR^A",
-    "NBRV",
-    "NBSE",
-    "NBTB",
-    "NBW",
-    "NBY",
-    "NC",
-    "NCA",
-    "NCB",
-    "NCBS",
-    "NCI",
-    "NCLH",
-    "NCLH",
-    "NCMI",
-    "NCNA",
-    "NCR",
-    "NCSM",
-    "NCTY",
-    "NCV",
-    "NCV^A",
-    "NCZ",
-    "NCZ^A",
-    "NDAQ",
-    "NDLS",
-    "NDP",
-    "NDRA",
-    "NDRAW",
-    "NDSN",
-    "NE",
-    "NEA",
-    "NEBU",
-    "NEBUU",
-    "NEBUW",
-    "NEE",
-    "NEE^I",
-    "NEE^J",
-    "NEE^K",
-    "NEE^N",
-    "NEE^O",
-    "NEM",
-    "NEN",
-    "NEO",
-    "NEOG",
-    "NEON",
-    "NEOS",
-    "NEP",
-    "NEPH",
-    "NEPT",
-    "NERV",
-    "NES",
-    "NESR",
-    "NESRW",
-    "NETE",
-    "NEU",
-    "NEV",
-    "NEW",
-    "NEWA",
-    "NEWM",
-    "NEWR",
-    "NEWT",
-    "NEWTI",
-    "NEWTL",
-    "NEXA",
-    "NEXT",
-    "NFBK",
-    "NFC",
-    "NFC.U",
-    "NFC.WS",
-    "NFE",
-    "NFG",
-    "NFIN",
-    "NFINU",
-    "NFINW",
-    "NFJ",
-    "NFLX",
-    "NFTY",
-    "NG",
-    "NGD",
-    "NGG",
-    "NGHC",
-    "NGHCN",
-    "NGHCO",
-    "NGHCP",
-    "NGHCZ",
-    "NGL",
-    "NGL^B",
-    "NGL^C",
-    "NGLS^A",
-    "NGM",
-    "NGS",
-    "NGVC",
-    "NGVT",
-    "NH",
-    "NHA",
-    "NHC",
-    "NHF",
-    "NHI",
-    "NHLD",
-    "NHLDW",
-    "NHS",
-    "NHTC",
-    "NI",
-    "NI^B",
-    "NICE",
-    "NICK",
-    "NID",
-    "NIE",
-    "NIHD",
-    "NIM",
-    "NINE",
-    "NIO",
-    "NIQ",
-    "NIU",
-    "NJR",
-    "NJV",
-    "NK",
-    "NKE",
-    "NKG",
-    "NKSH",
-    "NKTR",
-    "NKX",
-    "NL",
-    "NLNK",
-    "NLS",
-    "NLSN",
-    "NLTX",
-    "NLY",
-    "NLY^D",
-    "NLY^F",
-    "NLY^G",
-    "NLY^I",
-    "NM",
-    "NMCI",
-    "NMFC",
-    "NMFX",
-    "NM^G",
-    "NM^H",
-    "NMI",
-    "NMIH",
-    "NMK^B",
-    "NMK^C",
-    "NML",
-    "NMM",
-    "NMR",
-    "NMRD",
-    "NMRK",
-    "NMS",
-    "NMT",
-    "NMY",
-    "NMZ",
-    "NNA",
-    "NNBR",
-    "NNC",
-    "NNDM",
-    "NNI",
-    "NNN",
-    "NNN^E.CL",
-    "NNN^F",
-    "NNVC",
-    "NNY",
-    "NOA",
-    "NOAH",
-    "NOC",
-    "NODK",
-    "NOG",
-    "NOK",
-    "NOM",
-    "NOMD",
-    "NOV",
-    "NOVA",
-    "NOVN",
-    "NOVT",
-    "NOW",
-    "NP",
-    "NPAUU",
-    "NPK",
-    "NPN",
-    "NPO",
-    "NPTN",
-    "NPV",
-    "NQP",
-    "NR",
-    "NRC",
-    "NRCG",
-    "NRCG.WS",
-    "NRE",
-    "NRG",
-    "NRGX",
-    "NRIM",
-    "NRK",
-    "NRO",
-    "NRP",
-    "NRT",
-    "NRUC",
-    "NRZ",
-    "NRZ^A",
-    "NRZ^B",
-    "NS",
-    "NSA",
-    "NS^A",
-    "NSA^A",
-    "NS^B",
-    "NSC",
-    "NS^C",
-    "NSCO",
-    "NSCO.WS",
-    "NSEC",
-    "NSIT",
-    "NSL",
-    "NSP",
-    "NSPR",
-    "NSPR.WS",
-    "NSPR.WS.B",
-    "NSS",
-    "NSSC",
-    "NSTG",
-    "NSYS",
-    "NTAP",
-    "NTB",
-    "NTC",
-    "NTCT",
-    "NTEC",
-    "NTES",
-    "NTEST",
-    "NTEST.A",
-    "NTEST.B",
-    "NTEST.C",
-    "NTG",
-    "NTGN",
-    "NTGR",
-    "NTIC",
-    "NTIP",
-    "NTLA",
-    "NTN",
-    "NTNX",
-    "NTP",
-    "NTR",
-    "NTRA",
-    "NTRP",
-    "NTRS",
-    "NTRSP",
-    "NTUS",
-    "NTWK",
-    "NTX",
-    "NTZ",
-    "NUAN",
-    "NUE",
-    "NUM",
-    "NUO",
-    "NURO",
-    "NUROW",
-    "NUS",
-    "NUV",
-    "NUVA",
-    "NUW",
-    "NVAX",
-    "NVCN",
-    "NVCR",
-    "NVDA",
-    "NVEC",
-    "NVEE",
-    "NVFY",
-    "NVG",
-    "NVGS",
-    "NVIV",
-    "NVLN",
-    "NVMI",
-    "NVO",
-    "NVR",
-    "NVRO",
-    "NVS",
-    "NVT",
-    "NVTA",
-    "NVTR",
-    "NVUS",
-    "NWBI",
-    "NWE",
-    "NWFL",
-    "NWHM",
-    "NWL",
-    "NWLI",
-    "NWN",
-    "NWPX",
-    "NWS",
-    "NWSA",
-    "NX",
-    "NXC",
-    "NXE",
-    "NXGN",
-    "NXJ",
-    "NXMD",
-    "NXN",
-    "NXP",
-    "NXPI",
-    "NXQ",
-    "NXR",
-    "NXRT",
-    "NXST",
-    "NXTC",
-    "NXTD",
-    "NXTG",
-    "NYCB",
-    "NYCB^A",
-    "NYCB^U",
-    "NYMT",
-    "NYMTN",
-    "NYMTO",
-    "NYMTP",
-    "NYMX",
-    "NYNY",
-    "NYT",
-    "NYV",
-    "NZF",
-    "O",
-    "OAC",
-    "OAC.U",
-    "OAC.WS",
-    "OAK",
-    "OAK^A",
-    "OAK^B",
-    "OAS",
-    "OBAS",
-    "OBCI",
-    "OBE",
-    "OBLN",
-    "OBNK",
-    "OBSV",
-    "OC",
-    "OCC",
-    "OCCI",
-    "OCCIP",
-    "OCFC",
-    "OCN",
-    "OCSI",
-    "OCSL",
-    "OCSLL",
-    "OCUL",
-    "OCX",
-    "ODC",
-    "ODFL",
-    "ODP",
-    "ODT",
-    "OEC",
-    "OESX",
-    "OFC",
-    "OFED",
-    "OFG",
-    "OFG^A",
-    "OFG^B",
-    "OFG^D",
-    "OFIX",
-    "OFLX",
-    "OFS",
-    "OFSSL",
-    "OFSSZ",
-    "OGE",
-    "OGEN",
-    "OGI",
-    "OGS",
-    "OHAI",
-    "OHI",
-    "OI",
-    "OIA",
-    "OIBR.C",
-    "OII",
-    "OIIM",
-    "OIS",
-    "OKE",
-    "OKTA",
-    "OLBK",
-    "OLD",
-    "OLED",
-    "OLLI",
-    "OLN",
-    "OLP",
-    "OMAB",
-    "OMC",
-    "OMCL",
-    "OMER",
-    "OMEX",
-    "OMF",
-    "OMI",
-    "OMN",
-    "OMP",
-    "ON",
-    "ONB",
-    "ONCE",
-    "ONCS",
-    "ONCT",
-    "ONCY",
-    "ONDK",
-    "ONE",
-    "ONEQ",
-    "ONTX",
-    "ONTXW",
-    "ONVO",
-    "OOMA",
-    "OPB",
-    "OPBK",
-    "OPES",
-    "OPESU",
-    "OPESW",
-    "OPGN",
-    "OPGNW",
-    "OPHC",
-    "OPI",
-    "OPINI",
-    "OPK",
-    "OPNT",
-    "OPOF",
-    "OPP",
-    "OPRA",
-    "OPRX",
-    "OPTN",
-    "OPTT",
-    "OPY",
-    "OR",
-    "ORA",
-    "ORAN",
-    "ORBC",
-    "ORC",
-    "ORCC",
-    "ORCL",
-    "ORG",
-    "ORGO",
-    "ORGS",
-    "ORI",
-    "ORIT",
-    "ORLY",
-    "ORMP",
-    "ORN",
-    "ORRF",
-    "ORSNU",
-    "ORTX",
-    "OSB",
-    "OSBC",
-    "OSBCP",
-    "OSG",
-    "OSIS",
-    "OSK",
-    "OSLE",
-    "OSMT",
-    "OSN",
-    "OSPN",
-    "OSS",
-    "OSTK",
-    "OSUR",
-    "OSW",
-    "OTEL",
-    "OTEX",
-    "OTG",
-    "OTIC",
-    "OTIV",
-    "OTLK",
-    "OTLKW",
-    "OTTR",
-    "OTTW",
-    "OUT",
-    "OVBC",
-    "OVID",
-    "OVLY",
-    "OXBR",
-    "OXBRW",
-    "OXFD",
-    "OXLC",
-    "OXLCM",
-    "OXLCO",
-    "OXM",
-    "OXSQ",
-    "OXSQL",
-    "OXSQZ",
-    "OXY",
-    "OZK",
-    "PAA",
-    "PAAC",
-    "PAACR",
-    "PAACU",
-    "PAACW",
-    "PAAS",
-    "PAC",
-    "PACB",
-    "PACD",
-    "PACK",
-    "PACK.WS",
-    "PACQ",
-    "PACQU",
-    "PACQW",
-    "PACW",
-    "PAG",
-    "PAGP",
-    "PAGS",
-    "PAHC",
-    "PAI",
-    "PAM",
-    "PANL",
-    "PANW",
-    "PAR",
-    "PARR",
-    "PATI",
-    "PATK",
-    "PAVM",
-    "PAVMW",
-    "PAVMZ",
-    "PAYC",
-    "PAYS",
-    "PAYX",
-    "PB",
-    "PBA",
-    "PBB",
-    "PBBI",
-    "PBC",
-    "PBCT",
-    "PBCTP",
-    "PBF",
-    "PBFS",
-    "PBFX",
-    "PBH",
-    "PBHC",
-    "PBI",
-    "PBI^B",
-    "PBIO",
-    "PBIP",
-    "PBPB",
-    "PBR",
-    "PBR.A",
-    "PBT",
-    "PBTS",
-    "PBY",
-    "PBYI",
-    "PCAR",
-    "PCB",
-    "PCF",
-    "PCG",
-    "PCG^A",
-    "PCG^B",
-    "PCG^C",
-    "PCG^D",
-    "PCG^E",
-    "PCG^G",
-    "PCG^H",
-    "PCG^I",
-    "PCH",
-    "PCI",
-    "PCIM",
-    "PCK",
-    "PCM",
-    "PCN",
-    "PCOM",
-    "PCQ",
-    "PCRX",
-    "PCSB",
-    "PCTI",
-    "PCTY",
-    "PCYG",
-    "PCYO",
-    "PD",
-    "PDBC",
-    "PDCE",
-    "PDCO",
-    "PDD",
-    "PDEV",
-    "PDEX",
-    "PDFS",
-    "PDI",
-    "PDLB",
-    "PDLI",
-    "PDM",
-    "PDP",
-    "PDS",
-    "PDSB",
-    "PDT",
-    "PE",
-    "PEB",
-    "PEB^C",
-    "PEB^D",
-    "PEB^E",
-    "PEB^F",
-    "PEBK",
-    "PEBO",
-    "PECK",
-    "PED",
-    "PEER",
-    "PEG",
-    "PEGA",
-    "PEGI",
-    "PEI",
-    "PEI^B",
-    "PEI^C",
-    "PEI^D",
-    "PEIX",
-    "PEN",
-    "PENN",
-    "PEO",
-    "PEP",
-    "PER",
-    "PERI",
-    "PESI",
-    "PETQ",
-    "PETS",
-    "PETZ",
-    "PEY",
-    "PEZ",
-    "PFBC",
-    "PFBI",
-    "PFD",
-    "PFE",
-    "PFF",
-    "PFG",
-    "PFGC",
-    "PFH",
-    "PFI",
-    "PFIE",
-    "PFIN",
-    "PFIS",
-    "PFL",
-    "PFLT",
-    "PFM",
-    "PFMT",
-    "PFN",
-    "PFNX",
-    "PFO",
-    "PFPT",
-    "PFS",
-    "PFSI",
-    "PFSW",
-    "PG",
-    "PGC",
-    "PGJ",
-    "PGNX",
-    "PGP",
-    "PGR",
-    "PGRE",
-    "PGTI",
-    "PGTI",
-    "PGZ",
-    "PH",
-    "PHAS",
-    "PHCF",
-    "PHD",
-    "PHG",
-    "PHI",
-    "PHIO",
-    "PHIOW",
-    "PHK",
-    "PHM",
-    "PHO",
-    "PHR",
-    "PHT",
-    "PHUN",
-    "PHUNW",
-    "PHX",
-    "PI",
-    "PIC",
-    "PICO",
-    "PIC.U",
-    "PIC.WS",
-    "PID",
-    "PIE",
-    "PIH",
-    "PIHPP",
-    "PII",
-    "PIM",
-    "PINC",
-    "PINS",
-    "PIO",
-    "PIR",
-    "PIRS",
-    "PIXY",
-    "PIY",
-    "PIZ",
-    "PJC",
-    "PJH",
-    "PJT",
-    "PK",
-    "PKBK",
-    "PKD",
-    "PKE",
-    "PKG",
-    "PKI",
-    "PKO",
-    "PKOH",
-    "PKW",
-    "PKX",
-    "PLAB",
-    "PLAG",
-    "PLAN",
-    "PLAY",
-    "PLBC",
-    "PLC",
-    "PLCE",
-    "PLD",
-    "PLG",
-    "PLIN",
-    "PLL",
-    "PLM",
-    "PLMR",
-    "PLNT",
-    "PLOW",
-    "PLPC",
-    "PLSE",
-    "PLT",
-    "PLUG",
-    "PLUS",
-    "PLW",
-    "PLX",
-    "PLXP",
-    "PLXS",
-    "PLYA",
-    "PLYM",
-    "PLYM^A",
-    "PM",
-    "PMBC",
-    "PMD",
-    "PME",
-    "PMF",
-    "PML",
-    "PMM",
-    "PMO",
-    "PMOM",
-    "PMT",
-    "PMT^A",
-    "PMT^B",
-    "PMTS",
-    "PMX",
-    "PNBK",
-    "PNC",
-    "PNC^P",
-    "PNC^Q",
-    "PNF",
-    "PNFP",
-    "PNI",
-    "PNM",
-    "PNNT",
-    "PNQI",
-    "PNR",
-    "PNRG",
-    "PNRL",
-    "PNTR",
-    "PNW",
-    "POAI",
-    "PODD",
-    "POL",
-    "POLA",
-    "POLY",
-    "POOL",
-    "POPE",
-    "POR",
-    "POST",
-    "POWI",
-    "POWL",
-    "PPBI",
-    "PPC",
-    "PPDF",
-    "PPG",
-    "PPH",
-    "PPHI",
-    "PPIH",
-    "PPL",
-    "PPR",
-    "PPSI",
-    "PPT",
-    "PPX",
-    "PQG",
-    "PRA",
-    "PRAA",
-    "PRAH",
-    "PRCP",
-    "PRE^F",
-    "PRE^G",
-    "PRE^H",
-    "PRE^I",
-    "PRFT",
-    "PRFZ",
-    "PRGO",
-    "PRGS",
-    "PRGX",
-    "PRH",
-    "PRI",
-    "PRIF^A",
-    "PRIF^B",
-    "PRIF^C",
-    "PRIF^D",
-    "PRIM",
-    "PRK",
-    "PRLB",
-    "PRMW",
-    "PRN",
-    "PRNB",
-    "PRO",
-    "PROS",
-    "PROV",
-    "PRPH",
-    "PRPL",
-    "PRPO",
-    "PRQR",
-    "PRS",
-    "PRSC",
-    "PRSP",
-    "PRT",
-    "PRTA",
-    "PRTH",
-    "PRTK",
-    "PRTO",
-    "PRTS",
-    "PRTY",
-    "PRU",
-    "PRVB",
-    "PRVL",
-    "PS",
-    "PSA",
-    "PSA^A",
-    "PSA^B",
-    "PSA^C",
-    "PSA^D",
-    "PSA^E",
-    "PSA^F",
-    "PSA^G",
-    "PSA^H",
-    "PSA^V",
-    "PSA^W",
-    "PSA^X",
-    "PSB",
-    "PSB^U",
-    "PSB^V",
-    "PSB^W",
-    "PSB^X",
-    "PSB^Y",
-    "PSC",
-    "PSCC",
-    "PSCD",
-    "PSCE",
-    "PSCF",
-    "PSCH",
-    "PSCI",
-    "PSCM",
-    "PSCT",
-    "PSCU",
-    "PSDO",
-    "PSEC",
-    "PSET",
-    "PSF",
-    "PSL",
-    "PSM",
-    "PSMT",
-    "PSN",
-    "PSNL",
-    "PSO",
-    "PSTG",
-    "PSTI",
-    "PSTL",
-    "PSTV",
-    "PSTVZ",
-    "PSV",
-    "PSX",
-    "PSXP",
-    "PT",
-    "PTC",
-    "PTCT",
-    "PTE",
-    "PTEN",
-    "PTF",
-    "PTGX",
-    "PTH",
-    "PTI",
-    "PTLA",
-    "PTMN",
-    "PTN",
-    "PTNR",
-    "PTR",
-    "PTSI",
-    "PTVCA",
-    "PTVCB",
-    "PTY",
-    "PUB",
-    "PUI",
-    "PUK",
-    "PUK^",
-    "PUK^A",
-    "PULM",
-    "PUMP",
-    "PUYI",
-    "PVAC",
-    "PVAL",
-    "PVBC",
-    "PVG",
-    "PVH",
-    "PVL",
-    "PVT",
-    "PVTL",
-    "PVT.U",
-    "PVT.WS",
-    "PW",
-    "PW^A",
-    "PWOD",
-    "PWR",
-    "PXD",
-    "PXI",
-    "PXLW",
-    "PXS",
-    "PY",
-    "PYN",
-    "PYPL",
-    "PYS",
-    "PYT",
-    "PYX",
-    "PYZ",
-    "PZC",
-    "PZG",
-    "PZN",
-    "PZZA",
-    "QABA",
-    "QADA",
-    "QADB",
-    "QAT",
-    "QBAK",
-    "QCLN",
-    "QCOM",
-    "QCRH",
-    "QD",
-    "QDEL",
-    "QEP",
-    "QES",
-    "QFIN",
-    "QGEN",
-    "QGEN",
-    "QHC",
-    "QIWI",
-    "QLC",
-    "QLYS",
-    "QNST",
-    "QQEW",
-    "QQQ",
-    "QQQX",
-    "QQXT",
-    "QRHC",
-    "QRTEA",
-    "QRTEB",
-    "QRVO",
-    "QSR",
-    "QTEC",
-    "QTNT",
-    "QTRH",
-    "QTRX",
-    "QTS",
-    "QTS^A",
-    "QTS^B",
-    "QTT",
-    "QTWO",
-    "QUAD",
-    "QUIK",
-    "QUMU",
-    "QUOT",
-    "QURE",
-    "QVCD",
-    "QYLD",
-    "R",
-    "RA",
-    "RACE",
-    "RAD",
-    "RADA",
-    "RAIL",
-    "RAMP",
-    "RAND",
-    "RAPT",
-    "RARE",
-    "RARX",
-    "RAVE",
-    "RAVN",
-    "RBA",
-    "RBB",
-    "RBBN",
-    "RBC",
-    "RBCAA",
-    "RBCN",
-    "RBKB",
-    "RBNC",
-    "RBS",
-    "RBZ",
-    "RC",
-    "RCA",
-    "RCB",
-    "RCG",
-    "RCI",
-    "RCII",
-    "RCKT",
-    "RCKY",
-    "RCL",
-    "RCM",
-    "RCMT",
-    "RCON",
-    "RCP",
-    "RCS",
-    "RCUS",
-    "RDCM",
-    "RDFN",
-    "RDHL",
-    "RDI",
-    "RDIB",
-    "RDN",
-    "RDNT",
-    "RDS.A",
-    "RDS.B",
-    "RDUS",
-    "RDVT",
-    "RDVY",
-    "RDWR",
-    "RDY",
-    "RE",
-    "REAL",
-    "RECN",
-    "REDU",
-    "REED",
-    "REFR",
-    "REG",
-    "REGI",
-    "REGN",
-    "REI",
-    "REKR",
-    "RELL",
-    "RELV",
-    "RELX",
-    "RENN",
-    "REPH",
-    "REPL",
-    "RES",
-    "RESI",
-    "RESN",
-    "RETA",
-    "RETO",
-    "REV",
-    "REVG",
-    "REX",
-    "REXN",
-    "REXR",
-    "REXR^A",
-    "REXR^B",
-    "REZI",
-    "RF",
-    "RF^A",
-    "RFAP",
-    "RF^B",
-    "RF^C",
-    "RFDI",
-    "RFEM",
-    "RFEU",
-    "RFI",
-    "RFIL",
-    "RFL",
-    "RFP",
-    "RGA",
-    "RGCO",
-    "RGEN",
-    "RGLD",
-    "RGLS",
-    "RGNX",
-    "RGR",
-    "RGS",
-    "RGT",
-    "RH",
-    "RHE",
-    "RHE^A",
-    "RHI",
-    "RHP",
-    "RIBT",
-    "RICK",
-    "RIF",
-    "RIG",
-    "RIGL",
-    "RILY",
-    "RILYG",
-    "RILYH",
-    "RILYI",
-    "RILYL",
-    "RILYO",
-    "RILYZ",
-    "RING",
-    "RIO",
-    "RIOT",
-    "RIV",
-    "RIVE",
-    "RJF",
-    "RKDA",
-    "RL",
-    "RLGT",
-    "RLGY",
-    "RLH",
-    "RLI",
-    "RLJ",
-    "RLJ^A",
-    "RM",
-    "RMAX",
-    "RMBI",
-    "RMBL",
-    "RMBS",
-    "RMCF",
-    "RMD",
-    "RMED",
-    "RMG",
-    "RMG.U",
-    "RMG.WS",
-    "RMI",
-    "RMM",
-    "RMNI",
-    "RMPL^",
-    "RMR",
-    "RMT",
-    "RMTI",
-    "RNDB",
-    "RNDM",
-    "RNDV",
-    "RNEM",
-    "RNET",
-    "RNG",
-    "RNGR",
-    "RNLC",
-    "RNMC",
-    "RNP",
-    "RNR",
-    "RNR^C",
-    "RNR^E",
-    "RNR^F",
-    "RNSC",
-    "RNST",
-    "RNWK",
-    "ROAD",
-    "ROAN",
-    "ROBO",
-    "ROBT",
-    "ROCK",
-    "ROG",
-    "ROIC",
-    "ROK",
-    "ROKU",
-    "ROL",
-    "ROLL",
-    "ROP",
-    "ROSE",
-    "ROSEU",
-    "ROSEW",
-    "ROST",
-    "ROX",
-    "ROYT",
-    "RP",
-    "RPAI",
-    "RPAY",
-    "RPD",
-    "RPLA",
-    "RPLA.U",
-    "RPLA.WS",
-    "RPM",
-    "RPT",
-    "RPT^D",
-    "RQI",
-    "RRBI",
-    "RRC",
-    "RRD",
-    "RRD",
-    "RRGB",
-    "RRR",
-    "RRTS",
-    "RS",
-    "RSF",
-    "RSG",
-    "RST",
-    "RTEC",
-    "RTIX",
-    "RTLR",
-    "RTN",
-    "RTRX",
-    "RTTR",
-    "RTW",
-    "RUBI",
-    "RUBY",
-    "RUHN",
-    "RUN",
-    "RUSHA",
-    "RUSHB",
-    "RUTH",
-    "RVEN",
-    "RVI",
-    "RVLT",
-    "RVLV",
-    "RVNC",
-    "RVP",
-    "RVSB",
-    "RVT",
-    "RWGE",
-    "RWGE.U",
-    "RWGE.WS",
-    "RWLK",
-    "RWT",
-    "RXN",
-    "RXN^A",
-    "RY",
-    "RYAAY",
-    "RYAM",
-    "RYB",
-    "RYI",
-    "RYN",
-    "RY^T",
-    "RYTM",
-    "RZA",
-    "RZB",
-    "S",
-    "SA",
-    "SAB",
-    "SABR",
-    "SACH",
-    "SAEX",
-    "SAF",
-    "SAFE",
-    "SAFM",
-    "SAFT",
-    "SAGE",
-    "SAH",
-    "SAIA",
-    "SAIC",
-    "SAIL",
-    "SAL",
-    "SALM",
-    "SALT",
-    "SAM",
-    "SAMA",
-    "SAMAU",
-    "SAMAW",
-    "SAMG",
-    "SAN",
-    "SAN^B",
-    "SAND",
-    "SANM",
-    "SANW",
-    "SAP",
-    "SAR",
-    "SASR",
-    "SATS",
-    "SAUC",
-    "SAVA",
-    "SAVE",
-    "SAVE",
-    "SB",
-    "SBAC",
-    "SBBP",
-    "SBBX",
-    "SB^C",
-    "SBCF",
-    "SB^D",
-    "SBE.U",
-    "SBFG",
-    "SBFGP",
-    "SBGI",
-    "SBGL",
-    "SBH",
-    "SBI",
-    "SBLK",
-    "SBLKZ",
-    "SBNA",
-    "SBNY",
-    "SBOW",
-    "SBPH",
-    "SBR",
-    "SBRA",
-    "SBS",
-    "SBSI",
-    "SBT",
-    "SBUX",
-    "SC",
-    "SCA",
-    "SCCB",
-    "SCCI",
-    "SCCO",
-    "SCD",
-    "SCE^B",
-    "SCE^C",
-    "SCE^D",
-    "SCE^E",
-    "SCE^G",
-    "SCE^H",
-    "SCE^J",
-    "SCE^K",
-    "SCE^L",
-    "SCHL",
-    "SCHN",
-    "SCHW",
-    "SCHW^C",
-    "SCHW^D",
-    "SCI",
-    "SCKT",
-    "SCL",
-    "SCM",
-    "SCON",
-    "SCOR",
-    "SCPE",
-    "SCPE.U",
-    "SCPE.WS",
-    "SCPH",
-    "SCPL",
-    "SCS",
-    "SCSC",
-    "SCVL",
-    "SCWX",
-    "SCX",
-    "SCYX",
-    "SCZ",
-    "SD",
-    "SDC",
-    "SDG",
-    "SDI",
-    "SDPI",
-    "SDR",
-    "SDRL",
-    "SDT",
-    "SDVY",
-    "SE",
-    "SEAC",
-    "SEAS",
-    "SEB",
-    "SECO",
-    "SEDG",
-    "SEE",
-    "SEED",
-    "SEEL",
-    "SEIC",
-    "SELB",
-    "SELF",
-    "SEM",
-    "SEMG",
-    "SENEA",
-    "SENEB",
-    "SENS",
-    "SERV",
-    "SES",
-    "SESN",
-    "SF",
-    "SF^A",
-    "SFB",
-    "SF^B",
-    "SFBC",
-    "SFBS",
-    "SFE",
-    "SFET",
-    "SFIX",
-    "SFL",
-    "SFLY",
-    "SFM",
-    "SFNC",
-    "SFST",
-    "SFUN",
-    "SG",
-    "SGA",
-    "SGB",
-    "SGBX",
-    "SGC",
-    "SGEN",
-    "SGH",
-    "SGLB",
-    "SGLBW",
-    "SGMA",
-    "SGMO",
-    "SGMS",
-    "SGOC",
-    "SGRP",
-    "SGRY",
-    "SGU",
-    "SHAK",
-    "SHBI",
-    "SHEN",
-    "SHG",
-    "SHI",
-    "SHIP",
-    "SHIPW",
-    "SHIPZ",
-    "SHLL",
-    "SHLL.U",
-    "SHLL.WS",
-    "SHLO",
-    "SHLX",
-    "SHO",
-    "SHO^E",
-    "SHO^F",
-    "SHOO",
-    "SHOP",
-    "SHOS",
-    "SHSP",
-    "SHV",
-    "SHW",
-    "SHY",
-    "SIBN",
-    "SIC",
-    "SID",
-    "SIEB",
-    "SIEN",
-    "SIF",
-    "SIFY",
-    "SIG",
-    "SIGA",
-    "SIGI",
-    "SILC",
-    "SILK",
-    "SILV",
-    "SIM",
-    "SIMO",
-    "SINA",
-    "SINO",
-    "SINT",
-    "SIRI",
-    "SITC",
-    "SITC^A",
-    "SITC^J",
-    "SITC^K",
-    "SITE",
-    "SITO",
-    "SIVB",
-    "SIX",
-    "SJI",
-    "SJIU",
-    "SJM",
-    "SJR",
-    "SJT",
-    "SJW",
-    "SKIS",
-    "SKM",
-    "SKOR",
-    "SKT",
-    "SKX",
-    "SKY",
-    "SKYS",
-    "SKYW",
-    "SKYY",
-    "SLAB",
-    "SLB",
-    "SLCA",
-    "SLCT",
-    "SLDB",
-    "SLF",
-    "SLG",
-    "SLGG",
-    "SLG^I",
-    "SLGL",
-    "SLGN",
-    "SLIM",
-    "SLM",
-    "SLMBP",
-    "SLNG",
-    "SLNO",
-    "SLNOW",
-    "SLP",
-    "SLQD",
-    "SLRC",
-    "SLRX",
-    "SLS",
-    "SLVO",
-    "SM",
-    "SMAR",
-    "SMBC",
-    "SMBK",
-    "SMCP",
-    "SMED",
-    "SMFG",
-    "SMG",
-    "SMHI",
-    "SMIT",
-    "SMLP",
-    "SMM",
-    "SMMC",
-    "SMMCU",
-    "SMMCW",
-    "SMMF",
-    "SMMT",
-    "SMP",
-    "SMPL",
-    "SMRT",
-    "SMSI",
-    "SMTA",
-    "SMTC",
-    "SMTS",
-    "SMTX",
-    "SNA",
-    "SNAP",
-    "SNBR",
-    "SNCR",
-    "SND",
-    "SNDE",
-    "SNDL",
-    "SNDR",
-    "SNDX",
-    "SNE",
-    "SNES",
-    "SNFCA",
-    "SNGX",
-    "SNGXW",
-    "SNH",
-    "SNHNI",
-    "SNHNL",
-    "SNLN",
-    "SNMP",
-    "SNN",
-    "SNNA",
-    "SNOA",
-    "SNOAW",
-    "SNP",
-    "SNPS",
-    "SNR",
-    "SNSR",
-    "SNSS",
-    "SNV",
-    "SNV^D",
-    "SNV^E",
-    "SNX",
-    "SNY",
-    "SO",
-    "SOCL",
-    "SOGO",
-    "SOHO",
-    "SOHOB",
-    "SOHON",
-    "SOHOO",
-    "SOHU",
-    "SOI",
-    "SOJA",
-    "SOJB",
-    "SOJC",
-    "SOL",
-    "SOLN",
-    "SOLO",
-    "SOLOW",
-    "SOLY",
-    "SON",
-    "SONA",
-    "SONG",
-    "SONGW",
-    "SONM",
-    "SONO",
-    "SOR",
-    "SORL",
-    "SOXX",
-    "SP",
-    "SPAQ",
-    "SPAQ.U",
-    "SPAQ.WS",
-    "SPAR",
-    "SPB",
-    "SPCB",
-    "SPE",
-    "SPE^B",
-    "SPEX",
-    "SPFI",
-    "SPG",
-    "SPGI",
-    "SPG^J",
-    "SPH",
-    "SPHS",
-    "SPI",
-    "SPKE",
-    "SPKEP",
-    "SPLK",
-    "SPLP",
-    "SPLP^A",
-    "SPN",
-    "SPNE",
-    "SPNS",
-    "SPOK",
-    "SPOT",
-    "SPPI",
-    "SPR",
-    "SPRO",
-    "SPRT",
-    "SPSC",
-    "SPTN",
-    "SPWH",
-    "SPWR",
-    "SPXC",
-    "SPXX",
-    "SQ",
-    "SQBG",
-    "SQLV",
-    "SQM",
-    "SQNS",
-    "SQQQ",
-    "SR",
-    "SR^A",
-    "SRAX",
-    "SRC",
-    "SRC^A",
-    "SRCE",
-    "SRCI",
-    "SRCL",
-    "SRDX",
-    "SRE",
-    "SREA",
-    "SRE^A",
-    "SRE^B",
-    "SRET",
-    "SREV",
-    "SRF",
-    "SRG",
-    "SRG^A",
-    "SRI",
-    "SRL",
-    "SRLP",
-    "SRNE",
-    "SRPT",
-    "SRRA",
-    "SRRK",
-    "SRT",
-    "SRTS",
-    "SRTSW",
-    "SRV",
-    "SRVA",
-    "SSB",
-    "SSBI",
-    "SSD",
-    "SSFN",
-    "SSI",
-    "SSKN",
-    "SSL",
-    "SSNC",
-    "SSNT",
-    "SSP",
-    "SSPKU",
-    "SSRM",
-    "SSSS",
-    "SSTI",
-    "SSTK",
-    "SSW",
-    "SSWA",
-    "SSW^D",
-    "SSW^E",
-    "SSW^G",
-    "SSW^H",
-    "SSW^I",
-    "SSY",
-    "SSYS",
-    "ST",
-    "STAA",
-    "STAF",
-    "STAG",
-    "STAG^C",
-    "STAR",
-    "STAR^D",
-    "STAR^G",
-    "STAR^I",
-    "STAY",
-    "STBA",
-    "STC",
-    "STCN",
-    "STE",
-    "STFC",
-    "STG",
-    "STI",
-    "STI^A",
-    "STIM",
-    "STK",
-    "STKL",
-    "STKS",
-    "STL",
-    "STL^A",
-    "STLD",
-    "STM",
-    "STML",
-    "STMP",
-    "STN",
-    "STND",
-    "STNE",
-    "STNG",
-    "STNL",
-    "STNLU",
-    "STNLW",
-    "STOK",
-    "STON",
-    "STOR",
-    "STPP",
-    "STRA",
-    "STRL",
-    "STRM",
-    "STRO",
-    "STRS",
-    "STRT",
-    "STT",
-    "STT^C",
-    "STT^D",
-    "STT^E",
-    "STT^G",
-    "STWD",
-    "STX",
-    "STXB",
-    "STXS",
-    "STZ",
-    "STZ.B",
-    "SU",
-    "SUI",
-    "SUM",
-    "SUMR",
-    "SUN",
-    "SUNS",
-    "SUNW",
-    "SUP",
-    "SUPN",
-    "SUPV",
-    "SURF",
-    "SUSB",
-    "SUSC",
-    "SUSL",
-    "SUZ",
-    "SVA",
-    "SVBI",
-    "SVM",
-    "SVMK",
-    "SVRA",
-    "SVT",
-    "SVVC",
-    "SWAV",
-    "SWCH",
-    "SWI",
-    "SWIR",
-    "SWJ",
-    "SWK",
-    "SWKS",
-    "SWM",
-    "SWN",
-    "SWP",
-    "SWTX",
-    "SWX",
-    "SWZ",
-    "SXC",
-    "SXI",
-    "SXT",
-    "SXTC",
-    "SY",
-    "SYBT",
-    "SYBX",
-    "SYF",
-    "SYK",
-    "SYKE",
-    "SYMC",
-    "SYN",
-    "SYNA",
-    "SYNC",
-    "SYNH",
-    "SYNL",
-    "SYPR",
-    "SYRS",
-    "SYX",
-    "SYY",
-    "SZC",
-    "T",
-    "TA",
-    "TAC",
-    "TACO",
-    "TACOW",
-    "TACT",
-    "TAIT",
-    "TAK",
-    "TAL",
-    "TALO",
-    "TALO.WS",
-    "TANH",
-    "TANNI",
-    "TANNL",
-    "TANNZ",
-    "TAOP",
-    "TAP",
-    "TAP.A",
-    "TAPR",
-    "TARO",
-    "TAST",
-    "TAT",
-    "TATT",
-    "TAYD",
-    "TBB",
-    "TBBK",
-    "TBC",
-    "TBI",
-    "TBIO",
-    "TBK",
-    "TBLT",
-    "TBLTU",
-    "TBLTW",
-    "TBNK",
-    "TBPH",
-    "TC",
-    "TCBI",
-    "TCBIL",
-    "TCBIP",
-    "TCBK",
-    "TCCO",
-    "TCDA",
-    "TCF",
-    "TCFC",
-    "TCFCP",
-    "TCGP",
-    "TCI",
-    "TCMD",
-    "TCO",
-    "TCO^J",
-    "TCO^K",
-    "TCON",
-    "TCP",
-    "TCPC",
-    "TCRD",
-    "TCRR",
-    "TCRW",
-    "TCRZ",
-    "TCS",
-    "TCX",
-    "TD",
-    "TDA",
-    "TDAC",
-    "TDACU",
-    "TDACW",
-    "TDC",
-    "TDE",
-    "TDF",
-    "TDG",
-    "TDI",
-    "TDIV",
-    "TDJ",
-    "TDOC",
-    "TDS",
-    "TDW",
-    "TDW.WS",
-    "TDW.WS.A",
-    "TDW.WS.B",
-    "TDY",
-    "TEAF",
-    "TEAM",
-    "TECD",
-    "TECH",
-    "TECK",
-    "TECTP",
-    "TEDU",
-    "TEF",
-    "TEI",
-    "TEL",
-    "TELL",
-    "TEN",
-    "TENB",
-    "TENX",
-    "TEO",
-    "TER",
-    "TERP",
-    "TESS",
-    "TEUM",
-    "TEVA",
-    "TEX",
-    "TFSL",
-    "TFX",
-    "TG",
-    "TGA",
-    "TGB",
-    "TGC",
-    "TGE",
-    "TGEN",
-    "TGH",
-    "TGI",
-    "TGLS",
-    "TGNA",
-    "TGP",
-    "TGP^A",
-    "TGP^B",
-    "TGS",
-    "TGT",
-    "TGTX",
-    "TH",
-    "THBRU",
-    "THC",
-    "THCA",
-    "THCAU",
-    "THCAW",
-    "THCB",
-    "THCBU",
-    "THCBW",
-    "THFF",
-    "THG",
-    "THGA",
-    "THM",
-    "THO",
-    "THOR",
-    "THQ",
-    "THR",
-    "THRM",
-    "THS",
-    "THW",
-    "THWWW",
-    "TIBR",
-    "TIBRU",
-    "TIBRW",
-    "TIF",
-    "TIGO",
-    "TIGR",
-    "TILE",
-    "TIPT",
-    "TISI",
-    "TITN",
-    "TIVO",
-    "TJX",
-    "TK",
-    "TKAT",
-    "TKC",
-    "TKKS",
-    "TKKSR",
-    "TKKSU",
-    "TKKSW",
-    "TKR",
-    "TLC",
-    "TLF",
-    "TLGT",
-    "TLI",
-    "TLK",
-    "TLND",
-    "TLRA",
-    "TLRD",
-    "TLRY",
-    "TLSA",
-    "TLT",
-    "TLYS",
-    "TM",
-    "TMCX",
-    "TMCXU",
-    "TMCXW",
-    "TMDI",
-    "TMDX",
-    "TME",
-    "TMHC",
-    "TMO",
-    "TMP",
-    "TMQ",
-    "TMSR",
-    "TMST",
-    "TMUS",
-    "TNAV",
-    "TNC",
-    "TNDM",
-    "TNET",
-    "TNK",
-    "TNP",
-    "TNP^C",
-    "TNP^D",
-    "TNP^E",
-    "TNP^F",
-    "TNXP",
-    "TOCA",
-    "TOL",
-    "TOO",
-    "TOO^A",
-    "TOO^B",
-    "TOO^E",
-    "TOPS",
-    "TORC",
-    "TOT",
-    "TOTA",
-    "TOTAR",
-    "TOTAU",
-    "TOTAW",
-    "TOUR",
-    "TOWN",
-    "TOWR",
-    "TPB",
-    "TPC",
-    "TPCO",
-    "TPGH",
-    "TPGH.U",
-    "TPGH.WS",
-    "TPH",
-    "TPHS",
-    "TPIC",
-    "TPL",
-    "TPR",
-    "TPRE",
-    "TPTX",
-    "TPVG",
-    "TPVY",
-    "TPX",
-    "TPZ",
-    "TQQQ",
-    "TR",
-    "TRC",
-    "TRCB",
-    "TRCH",
-    "TRCO",
-    "TREC",
-    "TREE",
-    "TREX",
-    "TRGP",
-    "TRHC",
-    "TRI",
-    "TRIB",
-    "TRIL",
-    "TRIP",
-    "TRK",
-    "TRMB",
-    "TRMD",
-    "TRMK",
-    "TRMT",
-    "TRN",
-    "TRNE",
-    "TRNE.U",
-    "TRNE.WS",
-    "TRNO",
-    "TRNS",
-    "TRNX",
-    "TROV",
-    "TROW",
-    "TROX",
-    "TRP",
-    "TRPX",
-    "TRQ",
-    "TRS",
-    "TRST",
-    "TRT",
-    "TRTN",
-    "TRTN^A",
-    "TRTN^B",
-    "TRTX",
-    "TRU",
-    "TRUE",
-    "TRUP",
-    "TRV",
-    "TRVG",
-    "TRVI",
-    "TRVN",
-    "TRWH",
-    "TRX",
-    "TRXC",
-    "TS",
-    "TSBK",
-    "TSC",
-    "TSCAP",
-    "TSCBP",
-    "TSCO",
-    "TSE",
-    "TSEM",
-    "TSG",
-    "TSI",
-    "TSLA",
-    "TSLF",
-    "TSLX",
-    "TSM",
-    "TSN",
-    "TSQ",
-    "TSRI",
-    "TSS",
-    "TSU",
-    "TTC",
-    "TTD",
-    "TTEC",
-    "TTEK",
-    "TTGT",
-    "TTI",
-    "TTM",
-    "TTMI",
-    "TTNP",
-    "TTOO",
-    "TTP",
-    "TTPH",
-    "TTS",
-    "TTTN",
-    "TTWO",
-    "TU",
-    "TUES",
-    "TUFN",
-    "TUP",
-    "TUR",
-    "TURN",
-    "TUSA",
-    "TUSK",
-    "TV",
-    "TVC",
-    "TVE",
-    "TVIX",
-    "TVTY",
-    "TW",
-    "TWI",
-    "TWIN",
-    "TWLO",
-    "TWMC",
-    "TWN",
-    "TWNK",
-    "TWNKW",
-    "TWO",
-    "TWO^A",
-    "TWO^B",
-    "TWO^C",
-    "TWO^D",
-    "TWO^E",
-    "TWOU",
-    "TWST",
-    "TWTR",
-    "TX",
-    "TXG",
-    "TXMD",
-    "TXN",
-    "TXRH",
-    "TXT",
-    "TY",
-    "TY^",
-    "TYG",
-    "TYHT",
-    "TYL",
-    "TYME",
-    "TYPE",
-    "TZAC",
-    "TZACU",
-    "TZACW",
-    "TZOO",
-    "UA",
-    "UAA",
-    "UAE",
-    "UAL",
-    "UAMY",
-    "UAN",
-    "UAVS",
-    "UBA",
-    "UBCP",
-    "UBER",
-    "UBFO",
-    "UBIO",
-    "UBNK",
-    "UBOH",
-    "UBP",
-    "UBP^G",
-    "UBP^H",
-    "UBS",
-    "UBSI",
-    "UBX",
-    "UCBI",
-    "UCFC",
-    "UCTT",
-    "UDR",
-    "UE",
-    "UEC",
-    "UEIC",
-    "UEPS",
-    "UFAB",
-    "UFCS",
-    "UFI",
-    "UFPI",
-    "UFPT",
-    "UFS",
-    "UG",
-    "UGI",
-    "UGLD",
-    "UGP",
-    "UHAL",
-    "UHS",
-    "UHT",
-    "UI",
-    "UIHC",
-    "UIS",
-    "UL",
-    "ULBI",
-    "ULH",
-    "ULTA",
-    "UMBF",
-    "UMC",
-    "UMH",
-    "UMH^B",
-    "UMH^C",
-    "UMH^D",
-    "UMPQ",
-    "UMRX",
-    "UN",
-    "UNAM",
-    "UNB",
-    "UNF",
-    "UNFI",
-    "UNFI",
-    "UNH",
-    "UNIT",
-    "UNM",
-    "UNMA",
-    "UNP",
-    "UNT",
-    "UNTY",
-    "UNVR",
-    "UONE",
-    "UONEK",
-    "UPLD",
-    "UPS",
-    "UPWK",
-    "URBN",
-    "URG",
-    "URGN",
-    "URI",
-    "UROV",
-    "USA",
-    "USAC",
-    "USAK",
-    "USAP",
-    "USAS",
-    "USAT",
-    "USATP",
-    "USAU",
-    "USB",
-    "USB^A",
-    "USB^H",
-    "USB^M",
-    "USB^O",
-    "USB^P",
-    "USCR",
-    "USDP",
-    "USEG",
-    "USFD",
-    "USIG",
-    "USIO",
-    "USLB",
-    "USLM",
-    "USLV",
-    "USM",
-    "USMC",
-    "USNA",
-    "USOI",
-    "USPH",
-    "USWS",
-    "USWSW",
-    "USX",
-    "UTF",
-    "UTG",
-    "UTHR",
-    "UTI",
-    "UTL",
-    "UTMD",
-    "UTSI",
-    "UTX",
-    "UUU",
-    "UUUU",
-    "UUUU.WS",
-    "UVE",
-    "UVSP",
-    "UVV",
-    "UXIN",
-    "UZA",
-    "UZB",
-    "UZC",
-    "V",
-    "VAC",
-    "VAL",
-    "VALE",
-    "VALU",
-    "VALX",
-    "VAM",
-    "VAPO",
-    "VAR",
-    "VBF",
-    "VBFC",
-    "VBIV",
-    "VBLT",
-    "VBND",
-    "VBTX",
-    "VC",
-    "VCEL",
-    "VCF",
-    "VCIF",
-    "VCIT",
-    "VCLT",
-    "VCNX",
-    "VCRA",
-    "VCSH",
-    "VCTR",
-    "VCV",
-    "VCYT",
-    "VEC",
-    "VECO",
-    "VEDL",
-    "VEEV",
-    "VEON",
-    "VER",
-    "VERB",
-    "VERBW",
-    "VER^F",
-    "VERI",
-    "VERU",
-    "VERY",
-    "VET",
-    "VETS",
-    "VFC",
-    "VFF",
-    "VFL",
-    "VG",
-    "VGI",
-    "VGIT",
-    "VGLT",
-    "VGM",
-    "VGR",
-    "VGSH",
-    "VGZ",
-    "VHC",
-    "VHI",
-    "VIA",
-    "VIAB",
-    "VIAV",
-    "VICI",
-    "VICR",
-    "VIDI",
-    "VIGI",
-    "VIIX",
-    "VIOT",
-    "VIPS",
-    "VIRC",
-    "VIRT",
-    "VISL",
-    "VIST",
-    "VISTER",
-    "VIV",
-    "VIVE",
-    "VIVO",
-    "VJET",
-    "VKI",
-    "VKQ",
-    "VKTX",
-    "VKTXW",
-    "VLGEA",
-    "VLO",
-    "VLRS",
-    "VLRX",
-    "VLT",
-    "VLY",
-    "VLYPO",
-    "VLYPP",
-    "VMBS",
-    "VMC",
-    "VMD",
-    "VMET",
-    "VMI",
-    "VMM",
-    "VMO",
-    "VMW",
-    "VNCE",
-    "VNDA",
-    "VNE",
-    "VNET",
-    "VNO",
-    "VNO^K",
-    "VNO^L",
-    "VNOM",
-    "VNO^M",
-    "VNQI",
-    "VNRX",
-    "VNTR",
-    "VOC",
-    "VOD",
-    "VOLT",
-    "VONE",
-    "VONG",
-    "VONV",
-    "VOXX",
-    "VOYA",
-    "VOYA^B",
-    "VPG",
-    "VPV",
-    "VRA",
-    "VRAY",
-    "VRCA",
-    "VREX",
-    "VRIG",
-    "VRML",
-    "VRNA",
-    "VRNS",
-    "VRNT",
-    "VRRM",
-    "VRS",
-    "VRSK",
-    "VRSN",
-    "VRTS",
-    "VRTSP",
-    "VRTU",
-    "VRTV",
-    "VRTX",
-    "VSAT",
-    "VSDA",
-    "VSEC",
-    "VSH",
-    "VSI",
-    "VSLR",
-    "VSM",
-    "VSMV",
-    "VST",
-    "VSTM",
-    "VSTO",
-    "VST.WS.A",
-    "VTA",
-    "VTC",
-    "VTEC",
-    "VTGN",
-    "VTHR",
-    "VTIP",
-    "VTIQ",
-    "VTIQU",
-    "VTIQW",
-    "VTN",
-    "VTNR",
-    "VTR",
-    "VTSI",
-    "VTUS",
-    "VTVT",
-    "VTWG",
-    "VTWO",
-    "VTWV",
-    "VUSE",
-    "VUZI",
-    "VVI",
-    "VVPR",
-    "VVR",
-    "VVUS",
-    "VVV",
-    "VWOB",
-    "VXRT",
-    "VXUS",
-    "VYGR",
-    "VYMI",
-    "VZ",
-    "W",
-    "WAAS",
-    "WAB",
-    "WABC",
-    "WAFD",
-    "WAFU",
-    "WAIR",
-    "WAL",
-    "WALA",
-    "WASH",
-    "WAT",
-    "WATT",
-    "WB",
-    "WBA",
-    "WBAI",
-    "WBC",
-    "WBK",
-    "WBND",
-    "WBS",
-    "WBS^F",
-    "WBT",
-    "WCC",
-    "WCG",
-    "WCLD",
-    "WCN",
-    "WD",
-    "WDAY",
-    "WDC",
-    "WDFC",
-    "WDR",
-    "WEA",
-    "WEBK",
-    "WEC",
-    "WEI",
-    "WELL",
-    "WEN",
-    "WERN",
-    "WES",
-    "WETF",
-    "WEX",
-    "WEYS",
-    "WF",
-    "WFC",
-    "WFC^L",
-    "WFC^N",
-    "WFC^O",
-    "WFC^P",
-    "WFC^Q",
-    "WFC^R",
-    "WFC^T",
-    "WFC^V",
-    "WFC^W",
-    "WFC^X",
-    "WFC^Y",
-    "WFE^A",
-    "WGO",
-    "WH",
-    "WHD",
-    "WHF",
-    "WHFBZ",
-    "WHG",
-    "WHLM",
-    "WHLR",
-    "WHLRD",
-    "WHLRP",
-    "WHR",
-    "WIA",
-    "WIFI",
-    "WILC",
-    "WINA",
-    "WINC",
-    "WING",
-    "WINS",
-    "WIRE",
-    "WISA",
-    "WIT",
-    "WIW",
-    "WIX",
-    "WK",
-    "WKHS",
-    "WLDN",
-    "WLFC",
-    "WLH",
-    "WLK",
-    "WLKP",
-    "WLL",
-    "WLTW",
-    "WM",
-    "WMB",
-    "WMC",
-    "WMGI",
-    "WMK",
-    "WMS",
-    "WMT",
-    "WNC",
-    "WNEB",
-    "WNFM",
-    "WNS",
-    "WOOD",
-    "WOR",
-    "WORK",
-    "WORX",
-    "WOW",
-    "WPC",
-    "WPG",
-    "WPG^H",
-    "WPG^I",
-    "WPM",
-    "WPP",
-    "WPRT",
-    "WPX",
-    "WRB",
-    "WRB^B",
-    "WRB^C",
-    "WRB^D",
-    "WRB^E",
-    "WRE",
-    "WRI",
-    "WRK",
-    "WRLD",
-    "WRLS",
-    "WRLSR",
-    "WRLSU",
-    "WRLSW",
-    "WRN",
-    "WRTC",
-    "WSBC",
-    "WSBF",
-    "WSC",
-    "WSFS",
-    "WSG",
-    "WSM",
-    "WSO",
-    "WSO.B",
-    "WSR",
-    "WST",
-    "WSTG",
-    "WSTL",
-    "WTBA",
-    "WTER",
-    "WTFC",
-    "WTFCM",
-    "WTI",
-    "WTM",
-    "WTR",
-    "WTRE",
-    "WTREP",
-    "WTRH",
-    "WTRU",
-    "WTS",
-    "WTT",
-    "WTTR",
-    "WU",
-    "WUBA",
-    "WVE",
-    "WVFC",
-    "WVVI",
-    "WVVIP",
-    "WW",
-    "WWD",
-    "WWE",
-    "WWR",
-    "WWW",
-    "WY",
-    "WYND",
-    "WYNN",
-    "WYY",
-    "X",
-    "XAIR",
-    "XAN",
-    "XAN^C",
-    "XBIO",
-    "XBIOW",
-    "XBIT",
-    "XCUR",
-    "XEC",
-    "XEL",
-    "XELA",
-    "XELB",
-    "XENE",
-    "XENT",
-    "XERS",
-    "XFLT",
-    "XFOR",
-    "XHR",
-    "XIN",
-    "XLNX",
-    "XLRN",
-    "XNCR",
-    "XNET",
-    "XOG",
-    "XOM",
-    "XOMA",
-    "XON",
-    "XONE",
-    "XPEL",
-    "XPER",
-    "XPL",
-    "XPO",
-    "XRAY",
-    "XRF",
-    "XRX",
-    "XSPA",
-    "XT",
-    "XTLB",
-    "XTNT",
-    "XXII",
-    "XYF",
-    "XYL",
-    "Y",
-    "YCBD",
-    "YELP",
-    "YETI",
-    "YEXT",
-    "YGYI",
-    "YI",
-    "YIN",
-    "YJ",
-    "YLCO",
-    "YLDE",
-    "YMAB",
-    "YNDX",
-    "YORW",
-    "YPF",
-    "YRCW",
-    "YRD",
-    "YTEN",
-    "YTRA",
-    "YUM",
-    "YUMA",
-    "YUMC",
-    "YVR",
-    "YY",
-    "Z",
-    "ZAGG",
-    "ZAYO",
-    "ZB^A",
-    "ZB^G",
-    "ZBH",
-    "ZB^H",
-    "ZBIO",
-    "ZBK",
-    "ZBRA",
-    "ZDGE",
-    "ZEAL",
-    "ZEN",
-    "ZEUS",
-    "ZF",
-    "ZFGN",
-    "ZG",
-    "ZGNX",
-    "ZION",
-    "ZIONW",
-    "ZIOP",
-    "ZIV",
-    "ZIXI",
-    "ZKIN",
-    "ZLAB",
-    "ZM",
-    "ZN",
-    "ZNGA",
-    "ZNH",
-    "ZNWAA",
-    "ZOM",
-    "ZS",
-    "ZSAN",
-    "ZTEST",
-    "ZTO",
-    "ZTR",
-    "ZTS",
-    "ZUMZ",
-    "ZUO",
-    "ZVO",
-    "ZYME",
-    "ZYNE",
-    "ZYXI",
-};
+// Generated by ExtractTickers.py from tickers.csv, don't edit. Use it through SymbolTable.hpp.
+
+#include <array>
+#include <cstdint>
+
+namespace StockyBoy {
+	namespace Bots {
+		namespace SymbolData {
+			inline constexpr uint32_t COUNT = 6960;
+			inline constexpr uint32_t BUCKETS = 1741;
+
+			// Every label in sorted order, each '\0'-terminated, back to back
+			inline constexpr char BLOB[] =
+				"A\0"
+				"AA\0"
+				"AABA\0"
+				"AAC\0"
+				"AAL\0"
+				"AAMC\0"
+				"AAME\0"
+				"AAN\0"
+				"AAOI\0"
+				"AAON\0"
+				"AAP\0"
+				"AAPL\0"
+				"AAT\0"
+				"AAU\0"
+				"AAWW\0"
+				"AAXJ\0"
+				"AAXN\0"
+				"AB\0"
+				"ABB\0"
+				"ABBV\0"
+				"ABC\0"
+				"ABCB\0"
+				"ABDC\0"
+				"ABEO\0"
+				"ABEOW\0"
+				"ABEV\0"
+				"ABG\0"
+				"ABIL\0"
+				"ABIO\0"
+				"ABM\0"
+				"ABMD\0"
+				"ABR\0"
+				"ABR^A\0"
+				"ABR^B\0"
+				"ABR^C\0"
+				"ABT\0"
+				"ABTX\0"
+				"ABUS\0"
+				"AC\0"
+				"ACA\0"
+				"ACAD\0"
+				"ACAM\0"
+				"ACAMU\0"
+				"ACAMW\0"
+				"ACB\0"
+				"ACBI\0"
+				"ACC\0"
+				"ACCO\0"
+				"ACCP\0"
+				"ACER\0"
+				"ACGL\0"
+				"ACGLO\0"
+				"ACGLP\0"
+				"ACH\0"
+				"ACHC\0"
+				"ACHN\0"
+				"ACHV\0"
+				"ACIA\0"
+				"ACIU\0"
+				"ACIW\0"
+				"ACLS\0"
+				"ACM\0"
+				"ACMR\0"
+				"ACN\0"
+				"ACNB\0"
+				"ACOR\0"
+				"ACP\0"
+				"ACRE\0"
+				"ACRS\0"
+				"ACRX\0"
+				"ACST\0"
+				"ACT\0"
+				"ACTG\0"
+				"ACTT\0"
+				"ACTTU\0"
+				"ACTTW\0"
+				"ACU\0"
+				"ACV\0"
+				"ACWI\0"
+				"ACWX\0"
+				"ACY\0"
+				"ADAP\0"
+				"ADBE\0"
+				"ADC\0"
+				"ADES\0"
+				"ADI\0"
+				"ADIL\0"
+				"ADILW\0"
+				"ADM\0"
+				"ADMA\0"
+				"ADMP\0"
+				"ADMS\0"
+				"ADNT\0"
+				"ADP\0"
+				"ADPT\0"
+				"ADRA\0"
+				"ADRD\0"
+				"ADRE\0"
+				"ADRO\0"
+				"ADRU\0"
+				"ADS\0"
+				"ADSK\0"
+				"ADSW\0"
+				"ADT\0"
+				"ADTN\0"
+				"ADUS\0"
+				"ADVM\0"
+				"ADX\0"
+				"ADXS\0"
+				"AE\0"
+				"AEB\0"
+				"AEE\0"
+				"AEF\0"
+				"AEG\0"
+				"AEGN\0"
+				"AEH\0"
+				"AEHR\0"
+				"AEIS\0"
+				"AEL\0"
+				"AEM\0"
+				"AEMD\0"
+				"AEO\0"
+				"AEP\0"
+				"AEP^B\0"
+				"AER\0"
+				"AERI\0"
+				"AES\0"
+				"AESE\0"
+				"AEY\0"
+				"AEYE\0"
+				"AEZS\0"
+				"AFB\0"
+				"AFC\0"
+				"AFG\0"
+				"AFGB\0"
+				"AFGE\0"
+				"AFGH\0"
+				"AFH\0"
+				"AFHBL\0"
+				"AFI\0"
+				"AFIN\0"
+				"AFINP\0"
+				"AFL\0"
+				"AFMD\0"
+				"AFT\0"
+				"AFYA\0"
+				"AG\0"
+				"AGBA\0"
+				"AGBAR\0"
+				"AGBAU\0"
+				"AGBAW\0"
+				"AGCO\0"
+				"AGD\0"
+				"AGE\0"
+				"AGEN\0"
+				"AGFS\0"
+				"AGFSW\0"
+				"AGI\0"
+				"AGIO\0"
+				"AGLE\0"
+				"AGM\0"
+				"AGM.A\0"
+				"AGMH\0"
+				"AGM^A\0"
+				"AGM^C\0"
+				"AGM^D\0"
+				"AGN\0"
+				"AGNC\0"
+				"AGNCB\0"
+				"AGNCM\0"
+				"AGNCN\0"
+				"AGND\0"
+				"AGO\0"
+				"AGO^B\0"
+				"AGO^E\0"
+				"AGO^F\0"
+				"AGR\0"
+				"AGRO\0"
+				"AGRX\0"
+				"AGS\0"
+				"AGTC\0"
+				"AGX\0"
+				"AGYS\0"
+				"AGZD\0"
+				"AHC\0"
+				"AHH\0"
+				"AHH^A\0"
+				"AHL^C\0"
+				"AHL^D\0"
+				"AHL^E\0"
+				"AHPI\0"
+				"AHT\0"
+				"AHT^D\0"
+				"AHT^F\0"
+				"AHT^G\0"
+				"AHT^H\0"
+				"AHT^I\0"
+				"AI\0"
+				"AIA\0"
+				"AIC\0"
+				"AIF\0"
+				"AIG\0"
+				"AIG.WS\0"
+				"AIG^A\0"
+				"AIHS\0"
+				"AIM\0"
+				"AIMC\0"
+				"AIMT\0"
+				"AIN\0"
+				"AINC\0"
+				"AINV\0"
+				"AIQ\0"
+				"AIR\0"
+				"AIRG\0"
+				"AIRI\0"
+				"AIRR\0"
+				"AIRT\0"
+				"AIRTP\0"
+				"AIRTW\0"
+				"AIT\0"
+				"AIV\0"
+				"AIW\0"
+				"AIZ\0"
+				"AIZP\0"
+				"AI^B\0"
+				"AI^C\0"
+				"AJG\0"
+				"AJRD\0"
+				"AJX\0"
+				"AJXA\0"
+				"AKAM\0"
+				"AKBA\0"
+				"AKCA\0"
+				"AKER\0"
+				"AKG\0"
+				"AKO.A\0"
+				"AKO.B\0"
+				"AKR\0"
+				"AKRO\0"
+				"AKRX\0"
+				"AKS\0"
+				"AKTS\0"
+				"AKTX\0"
+				"AL\0"
+				"ALAC\0"
+				"ALACR\0"
+				"ALACU\0"
+				"ALACW\0"
+				"ALB\0"
+				"ALBO\0"
+				"ALC\0"
+				"ALCO\0"
+				"ALDR\0"
+				"ALDX\0"
+				"ALE\0"
+				"ALEC\0"
+				"ALEX\0"
+				"ALG\0"
+				"ALGN\0"
+				"ALGR\0"
+				"ALGRR\0"
+				"ALGRU\0"
+				"ALGRW\0"
+				"ALGT\0"
+				"ALIM\0"
+				"ALIT\0"
+				"ALJJ\0"
+				"ALK\0"
+				"ALKS\0"
+				"ALL\0"
+				"ALLE\0"
+				"ALLK\0"
+				"ALLO\0"
+				"ALLT\0"
+				"ALLY\0"
+				"ALLY^A\0"
+				"ALL^A\0"
+				"ALL^B\0"
+				"ALL^D.CL\0"
+				"ALL^E.CL\0"
+				"ALL^F.CL\0"
+				"ALL^G\0"
+				"ALL^H\0"
+				"ALNA\0"
+				"ALNY\0"
+				"ALO\0"
+				"ALOT\0"
+				"ALPN\0"
+				"ALP^Q\0"
+				"ALRM\0"
+				"ALRN\0"
+				"ALRS\0"
+				"ALSK\0"
+				"ALSN\0"
+				"ALT\0"
+				"ALTM\0"
+				"ALTR\0"
+				"ALTY\0"
+				"ALV\0"
+				"ALX\0"
+				"ALXN\0"
+				"ALYA\0"
+				"AL^A\0"
+				"AM\0"
+				"AMAG\0"
+				"AMAL\0"
+				"AMAT\0"
+				"AMBA\0"
+				"AMBC\0"
+				"AMBCW\0"
+				"AMBO\0"
+				"AMC\0"
+				"AMCA\0"
+				"AMCI\0"
+				"AMCIU\0"
+				"AMCIW\0"
+				"AMCR\0"
+				"AMCX\0"
+				"AMD\0"
+				"AME\0"
+				"AMED\0"
+				"AMEH\0"
+				"AMG\0"
+				"AMGN\0"
+				"AMH\0"
+				"AMH^D\0"
+				"AMH^E\0"
+				"AMH^F\0"
+				"AMH^G\0"
+				"AMH^H\0"
+				"AMK\0"
+				"AMKR\0"
+				"AMN\0"
+				"AMNB\0"
+				"AMOT\0"
+				"AMOV\0"
+				"AMP\0"
+				"AMPE\0"
+				"AMPH\0"
+				"AMPY\0"
+				"AMR\0"
+				"AMRB\0"
+				"AMRC\0"
+				"AMRH\0"
+				"AMRHW\0"
+				"AMRK\0"
+				"AMRN\0"
+				"AMRS\0"
+				"AMRWW\0"
+				"AMRX\0"
+				"AMS\0"
+				"AMSC\0"
+				"AMSF\0"
+				"AMSWA\0"
+				"AMT\0"
+				"AMTB\0"
+				"AMTBB\0"
+				"AMTD\0"
+				"AMTX\0"
+				"AMWD\0"
+				"AMX\0"
+				"AMZN\0"
+				"AN\0"
+				"ANAB\0"
+				"ANAT\0"
+				"ANCN\0"
+				"ANDA\0"
+				"ANDAR\0"
+				"ANDAU\0"
+				"ANDAW\0"
+				"ANDE\0"
+				"ANET\0"
+				"ANF\0"
+				"ANFI\0"
+				"ANGI\0"
+				"ANGO\0"
+				"ANH\0"
+				"ANH^A\0"
+				"ANH^B\0"
+				"ANH^C\0"
+				"ANIK\0"
+				"ANIP\0"
+				"ANIX\0"
+				"ANSS\0"
+				"ANTE\0"
+				"ANTM\0"
+				"ANY\0"
+				"AOBC\0"
+				"AOD\0"
+				"AON\0"
+				"AOS\0"
+				"AOSL\0"
+				"AP\0"
+				"APA\0"
+				"APAM\0"
+				"APD\0"
+				"APDN\0"
+				"APDNW\0"
+				"APEI\0"
+				"APEN\0"
+				"APEX\0"
+				"APH\0"
+				"APHA\0"
+				"APLE\0"
+				"APLS\0"
+				"APLT\0"
+				"APM\0"
+				"APO\0"
+				"APOG\0"
+				"APOP\0"
+				"APOPW\0"
+				"APO^A\0"
+				"APO^B\0"
+				"APPF\0"
+				"APPN\0"
+				"APPS\0"
+				"APRN\0"
+				"APT\0"
+				"APTO\0"
+				"APTS\0"
+				"APTV\0"
+				"APTX\0"
+				"APVO\0"
+				"APWC\0"
+				"APY\0"
+				"APYX\0"
+				"AQ\0"
+				"AQB\0"
+				"AQMS\0"
+				"AQN\0"
+				"AQNA\0"
+				"AQNB\0"
+				"AQST\0"
+				"AQUA\0"
+				"AR\0"
+				"ARA\0"
+				"ARAV\0"
+				"ARAY\0"
+				"ARC\0"
+				"ARCB\0"
+				"ARCC\0"
+				"ARCE\0"
+				"ARCH\0"
+				"ARCO\0"
+				"ARCT\0"
+				"ARD\0"
+				"ARDC\0"
+				"ARDS\0"
+				"ARDX\0"
+				"ARE\0"
+				"AREC\0"
+				"ARES\0"
+				"ARES^A\0"
+				"AREX\0"
+				"ARE^D\0"
+				"ARGD\0"
+				"ARGO\0"
+				"ARGX\0"
+				"ARI\0"
+				"ARKR\0"
+				"ARL\0"
+				"ARLO\0"
+				"ARLP\0"
+				"ARMK\0"
+				"ARMP\0"
+				"ARNA\0"
+				"ARNC\0"
+				"ARNC^\0"
+				"AROC\0"
+				"AROW\0"
+				"ARPO\0"
+				"ARQL\0"
+				"ARR\0"
+				"ARR^B\0"
+				"ARTL\0"
+				"ARTLW\0"
+				"ARTNA\0"
+				"ARTW\0"
+				"ARTX\0"
+				"ARVN\0"
+				"ARW\0"
+				"ARWR\0"
+				"ARYA\0"
+				"ARYAU\0"
+				"ARYAW\0"
+				"ASA\0"
+				"ASB\0"
+				"ASB^C\0"
+				"ASB^D\0"
+				"ASB^E\0"
+				"ASC\0"
+				"ASET\0"
+				"ASFI\0"
+				"ASG\0"
+				"ASGN\0"
+				"ASH\0"
+				"ASIX\0"
+				"ASLN\0"
+				"ASM\0"
+				"ASMB\0"
+				"ASML\0"
+				"ASNA\0"
+				"ASND\0"
+				"ASPN\0"
+				"ASPS\0"
+				"ASPU\0"
+				"ASR\0"
+				"ASRT\0"
+				"ASRV\0"
+				"ASRVP\0"
+				"ASTC\0"
+				"ASTE\0"
+				"ASUR\0"
+				"ASX\0"
+				"ASYS\0"
+				"AT\0"
+				"ATAI\0"
+				"ATAX\0"
+				"ATEC\0"
+				"ATEN\0"
+				"ATEST\0"
+				"ATEST.A\0"
+				"ATEST.B\0"
+				"ATEST.C\0"
+				"ATEX\0"
+				"ATGE\0"
+				"ATH\0"
+				"ATHE\0"
+				"ATHM\0"
+				"ATHX\0"
+				"ATH^A\0"
+				"ATI\0"
+				"ATIF\0"
+				"ATIS\0"
+				"ATISW\0"
+				"ATKR\0"
+				"ATLC\0"
+				"ATLO\0"
+				"ATNI\0"
+				"ATNM\0"
+				"ATNX\0"
+				"ATO\0"
+				"ATOM\0"
+				"ATOS\0"
+				"ATR\0"
+				"ATRA\0"
+				"ATRC\0"
+				"ATRI\0"
+				"ATRO\0"
+				"ATRS\0"
+				"ATSG\0"
+				"ATTO\0"
+				"ATU\0"
+				"ATUS\0"
+				"ATV\0"
+				"ATVI\0"
+				"ATXI\0"
+				"AU\0"
+				"AUB\0"
+				"AUBN\0"
+				"AUDC\0"
+				"AUG\0"
+				"AUMN\0"
+				"AUO\0"
+				"AUPH\0"
+				"AUTL\0"
+				"AUTO\0"
+				"AUY\0"
+				"AVA\0"
+				"AVAL\0"
+				"AVAV\0"
+				"AVB\0"
+				"AVCO\0"
+				"AVD\0"
+				"AVDL\0"
+				"AVDR\0"
+				"AVEO\0"
+				"AVGO\0"
+				"AVGR\0"
+				"AVH\0"
+				"AVID\0"
+				"AVK\0"
+				"AVLR\0"
+				"AVNS\0"
+				"AVNW\0"
+				"AVP\0"
+				"AVRO\0"
+				"AVT\0"
+				"AVTR\0"
+				"AVTR^A\0"
+				"AVX\0"
+				"AVXL\0"
+				"AVY\0"
+				"AVYA\0"
+				"AWF\0"
+				"AWI\0"
+				"AWK\0"
+				"AWP\0"
+				"AWR\0"
+				"AWRE\0"
+				"AWSM\0"
+				"AWX\0"
+				"AX\0"
+				"AXAS\0"
+				"AXDX\0"
+				"AXE\0"
+				"AXGN\0"
+				"AXGT\0"
+				"AXL\0"
+				"AXLA\0"
+				"AXNX\0"
+				"AXO\0"
+				"AXP\0"
+				"AXR\0"
+				"AXS\0"
+				"AXSM\0"
+				"AXS^D\0"
+				"AXS^E\0"
+				"AXTA\0"
+				"AXTI\0"
+				"AXU\0"
+				"AY\0"
+				"AYI\0"
+				"AYR\0"
+				"AYTU\0"
+				"AYX\0"
+				"AZN\0"
+				"AZO\0"
+				"AZPN\0"
+				"AZRE\0"
+				"AZRX\0"
+				"AZUL\0"
+				"AZZ\0"
+				"B\0"
+				"BA\0"
+				"BABA\0"
+				"BAC\0"
+				"BAC^A\0"
+				"BAC^B\0"
+				"BAC^C\0"
+				"BAC^E\0"
+				"BAC^K\0"
+				"BAC^L\0"
+				"BAC^M\0"
+				"BAC^Y\0"
+				"BAF\0"
+				"BAH\0"
+				"BAM\0"
+				"BANC\0"
+				"BANC^D\0"
+				"BANC^E\0"
+				"BAND\0"
+				"BANF\0"
+				"BANFP\0"
+				"BANR\0"
+				"BANX\0"
+				"BAP\0"
+				"BAS\0"
+				"BASI\0"
+				"BATRA\0"
+				"BATRK\0"
+				"BAX\0"
+				"BB\0"
+				"BBAR\0"
+				"BBBY\0"
+				"BBC\0"
+				"BBCP\0"
+				"BBD\0"
+				"BBDC\0"
+				"BBDO\0"
+				"BBF\0"
+				"BBGI\0"
+				"BBH\0"
+				"BBI\0"
+				"BBIO\0"
+				"BBK\0"
+				"BBL\0"
+				"BBN\0"
+				"BBP\0"
+				"BBRX\0"
+				"BBSI\0"
+				"BBT\0"
+				"BBT^F\0"
+				"BBT^G\0"
+				"BBT^H\0"
+				"BBU\0"
+				"BBVA\0"
+				"BBW\0"
+				"BBX\0"
+				"BBY\0"
+				"BC\0"
+				"BCBP\0"
+				"BCC\0"
+				"BCDA\0"
+				"BCDAW\0"
+				"BCE\0"
+				"BCEI\0"
+				"BCEL\0"
+				"BCH\0"
+				"BCLI\0"
+				"BCML\0"
+				"BCNA\0"
+				"BCO\0"
+				"BCOM\0"
+				"BCOR\0"
+				"BCOV\0"
+				"BCOW\0"
+				"BCPC\0"
+				"BCRH\0"
+				"BCRX\0"
+				"BCS\0"
+				"BCSF\0"
+				"BCTF\0"
+				"BCV\0"
+				"BCV^A\0"
+				"BCX\0"
+				"BCYC\0"
+				"BC^A\0"
+				"BC^B\0"
+				"BC^C\0"
+				"BDC\0"
+				"BDGE\0"
+				"BDJ\0"
+				"BDL\0"
+				"BDN\0"
+				"BDR\0"
+				"BDSI\0"
+				"BDX\0"
+				"BDXA\0"
+				"BE\0"
+				"BEAT\0"
+				"BECN\0"
+				"BEDU\0"
+				"BELFA\0"
+				"BELFB\0"
+				"BEN\0"
+				"BEP\0"
+				"BERY\0"
+				"BEST\0"
+				"BF.A\0"
+				"BF.B\0"
+				"BFAM\0"
+				"BFC\0"
+				"BFIN\0"
+				"BFIT\0"
+				"BFK\0"
+				"BFO\0"
+				"BFRA\0"
+				"BFS\0"
+				"BFST\0"
+				"BFS^C\0"
+				"BFS^D\0"
+				"BFY\0"
+				"BFZ\0"
+				"BG\0"
+				"BGB\0"
+				"BGCP\0"
+				"BGFV\0"
+				"BGG\0"
+				"BGH\0"
+				"BGI\0"
+				"BGIO\0"
+				"BGNE\0"
+				"BGR\0"
+				"BGRN\0"
+				"BGS\0"
+				"BGSF\0"
+				"BGT\0"
+				"BGX\0"
+				"BGY\0"
+				"BH\0"
+				"BH.A\0"
+				"BHAT\0"
+				"BHB\0"
+				"BHC\0"
+				"BHE\0"
+				"BHF\0"
+				"BHFAL\0"
+				"BHFAP\0"
+				"BHGE\0"
+				"BHK\0"
+				"BHLB\0"
+				"BHP\0"
+				"BHR\0"
+				"BHR^B\0"
+				"BHR^D\0"
+				"BHTG\0"
+				"BHV\0"
+				"BHVN\0"
+				"BIB\0"
+				"BICK\0"
+				"BID\0"
+				"BIDU\0"
+				"BIF\0"
+				"BIG\0"
+				"BIIB\0"
+				"BILI\0"
+				"BIMI\0"
+				"BIO\0"
+				"BIO.B\0"
+				"BIOC\0"
+				"BIOL\0"
+				"BIOS\0"
+				"BIOX\0"
+				"BIOX.WS\0"
+				"BIP\0"
+				"BIS\0"
+				"BIT\0"
+				"BITA\0"
+				"BIVI\0"
+				"BJ\0"
+				"BJRI\0"
+				"BK\0"
+				"BKCC\0"
+				"BKCH\0"
+				"BKD\0"
+				"BKE\0"
+				"BKEP\0"
+				"BKEPP\0"
+				"BKH\0"
+				"BKI\0"
+				"BKJ\0"
+				"BKK\0"
+				"BKN\0"
+				"BKNG\0"
+				"BKSC\0"
+				"BKT\0"
+				"BKTI\0"
+				"BKU\0"
+				"BKYI\0"
+				"BK^C\0"
+				"BL\0"
+				"BLBD\0"
+				"BLCM\0"
+				"BLCN\0"
+				"BLD\0"
+				"BLDP\0"
+				"BLDR\0"
+				"BLE\0"
+				"BLFS\0"
+				"BLIN\0"
+				"BLK\0"
+				"BLKB\0"
+				"BLL\0"
+				"BLMN\0"
+				"BLNK\0"
+				"BLNKW\0"
+				"BLPH\0"
+				"BLRX\0"
+				"BLU\0"
+				"BLUE\0"
+				"BLW\0"
+				"BLX\0"
+				"BMA\0"
+				"BMCH\0"
+				"BME\0"
+				"BMI\0"
+				"BMLP\0"
+				"BML^G\0"
+				"BML^H\0"
+				"BML^J\0"
+				"BML^L\0"
+				"BMO\0"
+				"BMRA\0"
+				"BMRC\0"
+				"BMRN\0"
+				"BMTC\0"
+				"BMY\0"
+				"BND\0"
+				"BNDW\0"
+				"BNDX\0"
+				"BNED\0"
+				"BNFT\0"
+				"BNGO\0"
+				"BNGOW\0"
+				"BNKL\0"
+				"BNS\0"
+				"BNSO\0"
+				"BNTC\0"
+				"BNTCW\0"
+				"BNY\0"
+				"BOCH\0"
+				"BOE\0"
+				"BOH\0"
+				"BOKF\0"
+				"BOKFL\0"
+				"BOLD\0"
+				"BOMN\0"
+				"BOOM\0"
+				"BOOT\0"
+				"BORR\0"
+				"BOSC\0"
+				"BOTJ\0"
+				"BOTZ\0"
+				"BOX\0"
+				"BOXL\0"
+				"BP\0"
+				"BPFH\0"
+				"BPL\0"
+				"BPMC\0"
+				"BPMP\0"
+				"BPMX\0"
+				"BPOP\0"
+				"BPOPM\0"
+				"BPOPN\0"
+				"BPR\0"
+				"BPRAP\0"
+				"BPRN\0"
+				"BPT\0"
+				"BPTH\0"
+				"BPY\0"
+				"BPYPO\0"
+				"BPYPP\0"
+				"BQH\0"
+				"BR\0"
+				"BRC\0"
+				"BREW\0"
+				"BRFS\0"
+				"BRG\0"
+				"BRG^A\0"
+				"BRG^C\0"
+				"BRG^D\0"
+				"BRID\0"
+				"BRK.A\0"
+				"BRK.B\0"
+				"BRKL\0"
+				"BRKR\0"
+				"BRKS\0"
+				"BRN\0"
+				"BRO\0"
+				"BROG\0"
+				"BROGR\0"
+				"BROGU\0"
+				"BROGW\0"
+				"BRPA\0"
+				"BRPAR\0"
+				"BRPAU\0"
+				"BRPAW\0"
+				"BRPM\0"
+				"BRPM.U\0"
+				"BRPM.WS\0"
+				"BRQS\0"
+				"BRT\0"
+				"BRX\0"
+				"BRY\0"
+				"BSA\0"
+				"BSAC\0"
+				"BSBR\0"
+				"BSD\0"
+				"BSE\0"
+				"BSET\0"
+				"BSGM\0"
+				"BSIG\0"
+				"BSL\0"
+				"BSM\0"
+				"BSMX\0"
+				"BSQR\0"
+				"BSRR\0"
+				"BST\0"
+				"BSTC\0"
+				"BSTZ\0"
+				"BSVN\0"
+				"BSX\0"
+				"BT\0"
+				"BTA\0"
+				"BTAI\0"
+				"BTE\0"
+				"BTEC\0"
+				"BTG\0"
+				"BTI\0"
+				"BTN\0"
+				"BTO\0"
+				"BTT\0"
+				"BTU\0"
+				"BTZ\0"
+				"BUD\0"
+				"BUI\0"
+				"BURG\0"
+				"BURL\0"
+				"BUSE\0"
+				"BV\0"
+				"BVN\0"
+				"BVSN\0"
+				"BVXV\0"
+				"BVXVW\0"
+				"BW\0"
+				"BWA\0"
+				"BWAY\0"
+				"BWB\0"
+				"BWEN\0"
+				"BWFG\0"
+				"BWG\0"
+				"BWL.A\0"
+				"BWMC\0"
+				"BWMCU\0"
+				"BWMCW\0"
+				"BWXT\0"
+				"BX\0"
+				"BXC\0"
+				"BXG\0"
+				"BXMT\0"
+				"BXMX\0"
+				"BXP\0"
+				"BXP^B\0"
+				"BXS\0"
+				"BY\0"
+				"BYD\0"
+				"BYFC\0"
+				"BYM\0"
+				"BYND\0"
+				"BYSI\0"
+				"BZH\0"
+				"BZM\0"
+				"BZUN\0"
+				"C\0"
+				"CAAP\0"
+				"CAAS\0"
+				"CABO\0"
+				"CAC\0"
+				"CACC\0"
+				"CACG\0"
+				"CACI\0"
+				"CADE\0"
+				"CAE\0"
+				"CAF\0"
+				"CAG\0"
+				"CAH\0"
+				"CAI\0"
+				"CAI^A\0"
+				"CAI^B\0"
+				"CAJ\0"
+				"CAKE\0"
+				"CAL\0"
+				"CALA\0"
+				"CALM\0"
+				"CALX\0"
+				"CAMP\0"
+				"CAMT\0"
+				"CANF\0"
+				"CANG\0"
+				"CAPL\0"
+				"CAPR\0"
+				"CAR\0"
+				"CARA\0"
+				"CARB\0"
+				"CARE\0"
+				"CARG\0"
+				"CARO\0"
+				"CARS\0"
+				"CART\0"
+				"CARV\0"
+				"CARZ\0"
+				"CASA\0"
+				"CASH\0"
+				"CASI\0"
+				"CASS\0"
+				"CASY\0"
+				"CAT\0"
+				"CATB\0"
+				"CATC\0"
+				"CATH\0"
+				"CATM\0"
+				"CATO\0"
+				"CATS\0"
+				"CATY\0"
+				"CB\0"
+				"CBAN\0"
+				"CBAT\0"
+				"CBAY\0"
+				"CBB\0"
+				"CBB^B\0"
+				"CBD\0"
+				"CBFV\0"
+				"CBH\0"
+				"CBIO\0"
+				"CBL\0"
+				"CBLI\0"
+				"CBLK\0"
+				"CBL^D\0"
+				"CBL^E\0"
+				"CBM\0"
+				"CBMB\0"
+				"CBMG\0"
+				"CBNK\0"
+				"CBO\0"
+				"CBOE\0"
+				"CBPO\0"
+				"CBPX\0"
+				"CBRE\0"
+				"CBRL\0"
+				"CBS\0"
+				"CBS.A\0"
+				"CBSH\0"
+				"CBSHP\0"
+				"CBT\0"
+				"CBTX\0"
+				"CBU\0"
+				"CBUS\0"
+				"CBX\0"
+				"CBZ\0"
+				"CC\0"
+				"CCB\0"
+				"CCBG\0"
+				"CCC\0"
+				"CCC.WS\0"
+				"CCCL\0"
+				"CCD\0"
+				"CCEP\0"
+				"CCF\0"
+				"CCH\0"
+				"CCH.U\0"
+				"CCH.WS\0"
+				"CCI\0"
+				"CCI^A\0"
+				"CCJ\0"
+				"CCK\0"
+				"CCL\0"
+				"CCLP\0"
+				"CCM\0"
+				"CCMP\0"
+				"CCNE\0"
+				"CCO\0"
+				"CCOI\0"
+				"CCR\0"
+				"CCRC\0"
+				"CCRN\0"
+				"CCS\0"
+				"CCU\0"
+				"CCX\0"
+				"CCX.U\0"
+				"CCX.WS\0"
+				"CCXI\0"
+				"CCZ\0"
+				"CDAY\0"
+				"CDC\0"
+				"CDE\0"
+				"CDEV\0"
+				"CDK\0"
+				"CDL\0"
+				"CDLX\0"
+				"CDMO\0"
+				"CDMOP\0"
+				"CDNA\0"
+				"CDNS\0"
+				"CDOR\0"
+				"CDR\0"
+				"CDR^B\0"
+				"CDR^C\0"
+				"CDTX\0"
+				"CDW\0"
+				"CDXC\0"
+				"CDXS\0"
+				"CDZI\0"
+				"CE\0"
+				"CEA\0"
+				"CECE\0"
+				"CECO\0"
+				"CEE\0"
+				"CEI\0"
+				"CEIX\0"
+				"CEL\0"
+				"CELC\0"
+				"CELG\0"
+				"CELGZ\0"
+				"CELH\0"
+				"CELP\0"
+				"CEM\0"
+				"CEMI\0"
+				"CEN\0"
+				"CENT\0"
+				"CENTA\0"
+				"CENX\0"
+				"CEO\0"
+				"CEPU\0"
+				"CEQP\0"
+				"CEQP^\0"
+				"CERC\0"
+				"CERN\0"
+				"CERS\0"
+				"CET\0"
+				"CETV\0"
+				"CETX\0"
+				"CETXP\0"
+				"CETXW\0"
+				"CEV\0"
+				"CEVA\0"
+				"CEY\0"
+				"CEZ\0"
+				"CF\0"
+				"CFA\0"
+				"CFB\0"
+				"CFBI\0"
+				"CFBK\0"
+				"CFFA\0"
+				"CFFAU\0"
+				"CFFAW\0"
+				"CFFI\0"
+				"CFFN\0"
+				"CFG\0"
+				"CFG^D\0"
+				"CFMS\0"
+				"CFO\0"
+				"CFR\0"
+				"CFRX\0"
+				"CFR^A\0"
+				"CFX\0"
+				"CFXA\0"
+				"CG\0"
+				"CGA\0"
+				"CGBD\0"
+				"CGC\0"
+				"CGEN\0"
+				"CGIX\0"
+				"CGNX\0"
+				"CGO\0"
+				"CHA\0"
+				"CHAC\0"
+				"CHAC.U\0"
+				"CHAC.WS\0"
+				"CHAP\0"
+				"CHCI\0"
+				"CHCO\0"
+				"CHCT\0"
+				"CHD\0"
+				"CHDN\0"
+				"CHE\0"
+				"CHEF\0"
+				"CHEK\0"
+				"CHEKW\0"
+				"CHEKZ\0"
+				"CHFS\0"
+				"CHGG\0"
+				"CHH\0"
+				"CHI\0"
+				"CHIC\0"
+				"CHK\0"
+				"CHKP\0"
+				"CHKR\0"
+				"CHK^D\0"
+				"CHL\0"
+				"CHMA\0"
+				"CHMG\0"
+				"CHMI\0"
+				"CHMI^A\0"
+				"CHMI^B\0"
+				"CHN\0"
+				"CHNA\0"
+				"CHNG\0"
+				"CHNGU\0"
+				"CHNR\0"
+				"CHRA\0"
+				"CHRS\0"
+				"CHRW\0"
+				"CHS\0"
+				"CHSCL\0"
+				"CHSCM\0"
+				"CHSCN\0"
+				"CHSCO\0"
+				"CHSCP\0"
+				"CHSP\0"
+				"CHT\0"
+				"CHTR\0"
+				"CHU\0"
+				"CHUY\0"
+				"CHW\0"
+				"CHWY\0"
+				"CHY\0"
+				"CI\0"
+				"CIA\0"
+				"CIB\0"
+				"CIBR\0"
+				"CID\0"
+				"CIDM\0"
+				"CIEN\0"
+				"CIF\0"
+				"CIFS\0"
+				"CIG\0"
+				"CIG.C\0"
+				"CIGI\0"
+				"CIH\0"
+				"CII\0"
+				"CIK\0"
+				"CIL\0"
+				"CIM\0"
+				"CIM^A\0"
+				"CIM^B\0"
+				"CIM^C\0"
+				"CIM^D\0"
+				"CINF\0"
+				"CINR\0"
+				"CIO\0"
+				"CIO^A\0"
+				"CIR\0"
+				"CISN\0"
+				"CIT\0"
+				"CIVB\0"
+				"CIVBP\0"
+				"CIX\0"
+				"CIZ\0"
+				"CIZN\0"
+				"CJ\0"
+				"CJJD\0"
+				"CKH\0"
+				"CKPT\0"
+				"CKX\0"
+				"CL\0"
+				"CLAR\0"
+				"CLB\0"
+				"CLBK\0"
+				"CLBS\0"
+				"CLCT\0"
+				"CLDB\0"
+				"CLDR\0"
+				"CLDT\0"
+				"CLDX\0"
+				"CLF\0"
+				"CLFD\0"
+				"CLGN\0"
+				"CLGX\0"
+				"CLH\0"
+				"CLI\0"
+				"CLIR\0"
+				"CLLS\0"
+				"CLM\0"
+				"CLMT\0"
+				"CLNC\0"
+				"CLNE\0"
+				"CLNY\0"
+				"CLNY^B\0"
+				"CLNY^E\0"
+				"CLNY^G\0"
+				"CLNY^H\0"
+				"CLNY^I\0"
+				"CLNY^J\0"
+				"CLOU\0"
+				"CLPR\0"
+				"CLPS\0"
+				"CLR\0"
+				"CLRB\0"
+				"CLRBZ\0"
+				"CLRG\0"
+				"CLRO\0"
+				"CLS\0"
+				"CLSD\0"
+				"CLSN\0"
+				"CLUB\0"
+				"CLVS\0"
+				"CLW\0"
+				"CLWT\0"
+				"CLX\0"
+				"CLXT\0"
+				"CM\0"
+				"CMA\0"
+				"CMBM\0"
+				"CMC\0"
+				"CMCL\0"
+				"CMCM\0"
+				"CMCO\0"
+				"CMCSA\0"
+				"CMCT\0"
+				"CMCTP\0"
+				"CMD\0"
+				"CME\0"
+				"CMFNL\0"
+				"CMG\0"
+				"CMI\0"
+				"CMLS\0"
+				"CMO\0"
+				"CMO^E\0"
+				"CMP\0"
+				"CMPR\0"
+				"CMRE\0"
+				"CMRE^B\0"
+				"CMRE^C\0"
+				"CMRE^D\0"
+				"CMRE^E\0"
+				"CMRX\0"
+				"CMS\0"
+				"CMSA\0"
+				"CMSC\0"
+				"CMSD\0"
+				"CMS^B\0"
+				"CMT\0"
+				"CMTL\0"
+				"CMU\0"
+				"CNA\0"
+				"CNAT\0"
+				"CNBKA\0"
+				"CNC\0"
+				"CNCE\0"
+				"CNCR\0"
+				"CNDT\0"
+				"CNET\0"
+				"CNF\0"
+				"CNFR\0"
+				"CNFRL\0"
+				"CNHI\0"
+				"CNI\0"
+				"CNK\0"
+				"CNMD\0"
+				"CNNE\0"
+				"CNO\0"
+				"CNOB\0"
+				"CNP\0"
+				"CNP^B\0"
+				"CNQ\0"
+				"CNR\0"
+				"CNS\0"
+				"CNSL\0"
+				"CNST\0"
+				"CNTF\0"
+				"CNTX\0"
+				"CNTY\0"
+				"CNX\0"
+				"CNXM\0"
+				"CNXN\0"
+				"CO\0"
+				"COCP\0"
+				"CODA\0"
+				"CODI\0"
+				"CODI^A\0"
+				"CODI^B\0"
+				"CODX\0"
+				"COE\0"
+				"COF\0"
+				"COF^C\0"
+				"COF^D\0"
+				"COF^F\0"
+				"COF^G\0"
+				"COF^H\0"
+				"COF^P\0"
+				"COG\0"
+				"COHN\0"
+				"COHR\0"
+				"COHU\0"
+				"COKE\0"
+				"COLB\0"
+				"COLD\0"
+				"COLL\0"
+				"COLM\0"
+				"COMM\0"
+				"COMT\0"
+				"CONE\0"
+				"CONN\0"
+				"COO\0"
+				"COOP\0"
+				"COP\0"
+				"COR\0"
+				"CORE\0"
+				"CORR\0"
+				"CORR^A\0"
+				"CORT\0"
+				"CORV\0"
+				"COST\0"
+				"COT\0"
+				"COTY\0"
+				"COUP\0"
+				"COWN\0"
+				"COWNL\0"
+				"COWNZ\0"
+				"CP\0"
+				"CPA\0"
+				"CPAA\0"
+				"CPAAU\0"
+				"CPAAW\0"
+				"CPAC\0"
+				"CPAH\0"
+				"CPB\0"
+				"CPE\0"
+				"CPF\0"
+				"CPG\0"
+				"CPHC\0"
+				"CPHI\0"
+				"CPIX\0"
+				"CPK\0"
+				"CPL\0"
+				"CPLG\0"
+				"CPLP\0"
+				"CPRI\0"
+				"CPRT\0"
+				"CPRX\0"
+				"CPS\0"
+				"CPSH\0"
+				"CPSI\0"
+				"CPSS\0"
+				"CPST\0"
+				"CPT\0"
+				"CPTA\0"
+				"CPTAG\0"
+				"CPTAL\0"
+				"CPTI\0"
+				"CQP\0"
+				"CR\0"
+				"CRAI\0"
+				"CRAY\0"
+				"CRBP\0"
+				"CRC\0"
+				"CRCM\0"
+				"CRD.A\0"
+				"CRD.B\0"
+				"CREE\0"
+				"CREG\0"
+				"CRESY\0"
+				"CREX\0"
+				"CREXW\0"
+				"CRF\0"
+				"CRH\0"
+				"CRHM\0"
+				"CRI\0"
+				"CRIS\0"
+				"CRK\0"
+				"CRL\0"
+				"CRM\0"
+				"CRMD\0"
+				"CRMT\0"
+				"CRNT\0"
+				"CRNX\0"
+				"CRON\0"
+				"CROX\0"
+				"CRR\0"
+				"CRS\0"
+				"CRSA\0"
+				"CRSAU\0"
+				"CRSAW\0"
+				"CRSP\0"
+				"CRT\0"
+				"CRTO\0"
+				"CRTX\0"
+				"CRUS\0"
+				"CRVL\0"
+				"CRVS\0"
+				"CRWD\0"
+				"CRWS\0"
+				"CRY\0"
+				"CRZO\0"
+				"CS\0"
+				"CSA\0"
+				"CSB\0"
+				"CSBR\0"
+				"CSCO\0"
+				"CSF\0"
+				"CSFL\0"
+				"CSGP\0"
+				"CSGS\0"
+				"CSII\0"
+				"CSIQ\0"
+				"CSL\0"
+				"CSLT\0"
+				"CSML\0"
+				"CSOD\0"
+				"CSPI\0"
+				"CSQ\0"
+				"CSS\0"
+				"CSSE\0"
+				"CSSEP\0"
+				"CSTE\0"
+				"CSTL\0"
+				"CSTM\0"
+				"CSTR\0"
+				"CSU\0"
+				"CSV\0"
+				"CSWC\0"
+				"CSWCL\0"
+				"CSWI\0"
+				"CSX\0"
+				"CTAA\0"
+				"CTAC\0"
+				"CTACU\0"
+				"CTACW\0"
+				"CTAS\0"
+				"CTA^A\0"
+				"CTA^B\0"
+				"CTB\0"
+				"CTBB\0"
+				"CTBI\0"
+				"CTDD\0"
+				"CTEK\0"
+				"CTEST\0"
+				"CTEST.E\0"
+				"CTEST.G\0"
+				"CTEST.L\0"
+				"CTEST.O\0"
+				"CTEST.S\0"
+				"CTEST.V\0"
+				"CTG\0"
+				"CTHR\0"
+				"CTIB\0"
+				"CTIC\0"
+				"CTK\0"
+				"CTL\0"
+				"CTLT\0"
+				"CTMX\0"
+				"CTO\0"
+				"CTR\0"
+				"CTRA\0"
+				"CTRC\0"
+				"CTRE\0"
+				"CTRM\0"
+				"CTRN\0"
+				"CTRP\0"
+				"CTS\0"
+				"CTSH\0"
+				"CTSO\0"
+				"CTST\0"
+				"CTT\0"
+				"CTV\0"
+				"CTVA\0"
+				"CTWS\0"
+				"CTXR\0"
+				"CTXRW\0"
+				"CTXS\0"
+				"CTY\0"
+				"CTZ\0"
+				"CUB\0"
+				"CUBA\0"
+				"CUBE\0"
+				"CUBI\0"
+				"CUBI^C\0"
+				"CUBI^D\0"
+				"CUBI^E\0"
+				"CUBI^F\0"
+				"CUE\0"
+				"CUI\0"
+				"CUK\0"
+				"CULP\0"
+				"CUO\0"
+				"CUR\0"
+				"CURO\0"
+				"CUTR\0"
+				"CUZ\0"
+				"CVA\0"
+				"CVBF\0"
+				"CVCO\0"
+				"CVCY\0"
+				"CVE\0"
+				"CVEO\0"
+				"CVET\0"
+				"CVGI\0"
+				"CVGW\0"
+				"CVI\0"
+				"CVIA\0"
+				"CVLT\0"
+				"CVLY\0"
+				"CVM\0"
+				"CVNA\0"
+				"CVR\0"
+				"CVRS\0"
+				"CVS\0"
+				"CVTI\0"
+				"CVU\0"
+				"CVV\0"
+				"CVX\0"
+				"CW\0"
+				"CWBC\0"
+				"CWBR\0"
+				"CWCO\0"
+				"CWEN\0"
+				"CWEN.A\0"
+				"CWH\0"
+				"CWK\0"
+				"CWST\0"
+				"CWT\0"
+				"CX\0"
+				"CXDC\0"
+				"CXE\0"
+				"CXH\0"
+				"CXO\0"
+				"CXP\0"
+				"CXSE\0"
+				"CXW\0"
+				"CY\0"
+				"CYAD\0"
+				"CYAN\0"
+				"CYBE\0"
+				"CYBR\0"
+				"CYCC\0"
+				"CYCCP\0"
+				"CYCN\0"
+				"CYD\0"
+				"CYH\0"
+				"CYOU\0"
+				"CYRN\0"
+				"CYRX\0"
+				"CYRXW\0"
+				"CYTK\0"
+				"CZNC\0"
+				"CZR\0"
+				"CZWI\0"
+				"CZZ\0"
+				"C^J\0"
+				"C^K\0"
+				"C^N\0"
+				"C^S\0"
+				"D\0"
+				"DAC\0"
+				"DAIO\0"
+				"DAKT\0"
+				"DAL\0"
+				"DALI\0"
+				"DAN\0"
+				"DAR\0"
+				"DARE\0"
+				"DAVA\0"
+				"DAVE\0"
+				"DAX\0"
+				"DB\0"
+				"DBD\0"
+				"DBI\0"
+				"DBL\0"
+				"DBVT\0"
+				"DBX\0"
+				"DCAR\0"
+				"DCF\0"
+				"DCI\0"
+				"DCIX\0"
+				"DCO\0"
+				"DCOM\0"
+				"DCP\0"
+				"DCPH\0"
+				"DCP^B\0"
+				"DCP^C\0"
+				"DCUE\0"
+				"DD\0"
+				"DDD\0"
+				"DDF\0"
+				"DDIV\0"
+				"DDMX\0"
+				"DDMXU\0"
+				"DDMXW\0"
+				"DDOC\0"
+				"DDS\0"
+				"DDT\0"
+				"DE\0"
+				"DEA\0"
+				"DEAC\0"
+				"DEACU\0"
+				"DEACW\0"
+				"DECK\0"
+				"DEI\0"
+				"DELL\0"
+				"DENN\0"
+				"DEO\0"
+				"DERM\0"
+				"DESP\0"
+				"DEST\0"
+				"DEX\0"
+				"DF\0"
+				"DFBH\0"
+				"DFBHU\0"
+				"DFBHW\0"
+				"DFFN\0"
+				"DFIN\0"
+				"DFNL\0"
+				"DFP\0"
+				"DFRG\0"
+				"DFS\0"
+				"DFVL\0"
+				"DFVS\0"
+				"DG\0"
+				"DGICA\0"
+				"DGICB\0"
+				"DGII\0"
+				"DGLD\0"
+				"DGLY\0"
+				"DGRE\0"
+				"DGRS\0"
+				"DGRW\0"
+				"DGSE\0"
+				"DGX\0"
+				"DHF\0"
+				"DHI\0"
+				"DHIL\0"
+				"DHR\0"
+				"DHR^A\0"
+				"DHT\0"
+				"DHX\0"
+				"DHXM\0"
+				"DHY\0"
+				"DIAX\0"
+				"DIN\0"
+				"DINT\0"
+				"DIOD\0"
+				"DIS\0"
+				"DISCA\0"
+				"DISCB\0"
+				"DISCK\0"
+				"DISH\0"
+				"DIT\0"
+				"DJCO\0"
+				"DK\0"
+				"DKL\0"
+				"DKS\0"
+				"DKT\0"
+				"DL\0"
+				"DLA\0"
+				"DLB\0"
+				"DLBS\0"
+				"DLHC\0"
+				"DLNG\0"
+				"DLNG^A\0"
+				"DLNG^B\0"
+				"DLPH\0"
+				"DLPN\0"
+				"DLPNW\0"
+				"DLR\0"
+				"DLR^C\0"
+				"DLR^G\0"
+				"DLR^I\0"
+				"DLR^J\0"
+				"DLR^K\0"
+				"DLTH\0"
+				"DLTR\0"
+				"DLX\0"
+				"DMAC\0"
+				"DMB\0"
+				"DMF\0"
+				"DMLP\0"
+				"DMO\0"
+				"DMPI\0"
+				"DMRC\0"
+				"DMTK\0"
+				"DMTKW\0"
+				"DNBF\0"
+				"DNI\0"
+				"DNJR\0"
+				"DNKN\0"
+				"DNLI\0"
+				"DNN\0"
+				"DNOW\0"
+				"DNP\0"
+				"DNR\0"
+				"DO\0"
+				"DOC\0"
+				"DOCU\0"
+				"DOGZ\0"
+				"DOMO\0"
+				"DOOO\0"
+				"DOOR\0"
+				"DORM\0"
+				"DOV\0"
+				"DOVA\0"
+				"DOW\0"
+				"DOX\0"
+				"DOYU\0"
+				"DPG\0"
+				"DPHC\0"
+				"DPHCU\0"
+				"DPHCW\0"
+				"DPLO\0"
+				"DPW\0"
+				"DPZ\0"
+				"DQ\0"
+				"DRAD\0"
+				"DRADP\0"
+				"DRD\0"
+				"DRE\0"
+				"DRH\0"
+				"DRI\0"
+				"DRIO\0"
+				"DRIOW\0"
+				"DRIV\0"
+				"DRMT\0"
+				"DRNA\0"
+				"DRQ\0"
+				"DRRX\0"
+				"DRUA\0"
+				"DRYS\0"
+				"DS\0"
+				"DSE\0"
+				"DSGX\0"
+				"DSKE\0"
+				"DSKEW\0"
+				"DSL\0"
+				"DSLV\0"
+				"DSM\0"
+				"DSPG\0"
+				"DSS\0"
+				"DSSI\0"
+				"DSU\0"
+				"DSWL\0"
+				"DSX\0"
+				"DSX^B\0"
+				"DS^B\0"
+				"DS^C\0"
+				"DS^D\0"
+				"DT\0"
+				"DTE\0"
+				"DTEA\0"
+				"DTF\0"
+				"DTIL\0"
+				"DTJ\0"
+				"DTLA^\0"
+				"DTQ\0"
+				"DTSS\0"
+				"DTUL\0"
+				"DTUS\0"
+				"DTV\0"
+				"DTW\0"
+				"DTY\0"
+				"DTYL\0"
+				"DTYS\0"
+				"DUC\0"
+				"DUK\0"
+				"DUKB\0"
+				"DUKH\0"
+				"DUK^A\0"
+				"DUSA\0"
+				"DVA\0"
+				"DVAX\0"
+				"DVD\0"
+				"DVLU\0"
+				"DVN\0"
+				"DVOL\0"
+				"DVY\0"
+				"DWAQ\0"
+				"DWAS\0"
+				"DWAT\0"
+				"DWCR\0"
+				"DWFI\0"
+				"DWIN\0"
+				"DWLD\0"
+				"DWMC\0"
+				"DWPP\0"
+				"DWSH\0"
+				"DWSN\0"
+				"DWTR\0"
+				"DX\0"
+				"DXB\0"
+				"DXC\0"
+				"DXCM\0"
+				"DXF\0"
+				"DXGE\0"
+				"DXJS\0"
+				"DXLG\0"
+				"DXPE\0"
+				"DXR\0"
+				"DXYN\0"
+				"DX^A\0"
+				"DX^B\0"
+				"DY\0"
+				"DYAI\0"
+				"DYNT\0"
+				"DZSI\0"
+				"E\0"
+				"EA\0"
+				"EAB\0"
+				"EAD\0"
+				"EAE\0"
+				"EAF\0"
+				"EAI\0"
+				"EARN\0"
+				"EARS\0"
+				"EAST\0"
+				"EAT\0"
+				"EB\0"
+				"EBAY\0"
+				"EBAYL\0"
+				"EBF\0"
+				"EBIX\0"
+				"EBIZ\0"
+				"EBMT\0"
+				"EBR\0"
+				"EBR.B\0"
+				"EBS\0"
+				"EBSB\0"
+				"EBTC\0"
+				"EC\0"
+				"ECA\0"
+				"ECC\0"
+				"ECCA\0"
+				"ECCB\0"
+				"ECCX\0"
+				"ECCY\0"
+				"ECF\0"
+				"ECF^A\0"
+				"ECHO\0"
+				"ECL\0"
+				"ECOL\0"
+				"ECOM\0"
+				"ECOR\0"
+				"ECOW\0"
+				"ECPG\0"
+				"ECT\0"
+				"ED\0"
+				"EDAP\0"
+				"EDD\0"
+				"EDF\0"
+				"EDI\0"
+				"EDIT\0"
+				"EDN\0"
+				"EDNT\0"
+				"EDRY\0"
+				"EDSA\0"
+				"EDTX\0"
+				"EDTXU\0"
+				"EDTXW\0"
+				"EDU\0"
+				"EDUC\0"
+				"EE\0"
+				"EEA\0"
+				"EEFT\0"
+				"EEI\0"
+				"EEMA\0"
+				"EEX\0"
+				"EFAS\0"
+				"EFBI\0"
+				"EFC\0"
+				"EFF\0"
+				"EFL\0"
+				"EFOI\0"
+				"EFR\0"
+				"EFSC\0"
+				"EFT\0"
+				"EFX\0"
+				"EGAN\0"
+				"EGBN\0"
+				"EGF\0"
+				"EGHT\0"
+				"EGI\0"
+				"EGIF\0"
+				"EGLE\0"
+				"EGO\0"
+				"EGOV\0"
+				"EGP\0"
+				"EGRX\0"
+				"EGY\0"
+				"EHC\0"
+				"EHI\0"
+				"EHR\0"
+				"EHT\0"
+				"EHTH\0"
+				"EIC\0"
+				"EIDX\0"
+				"EIG\0"
+				"EIGI\0"
+				"EIGR\0"
+				"EIM\0"
+				"EIX\0"
+				"EKSO\0"
+				"EL\0"
+				"ELAN\0"
+				"ELC\0"
+				"ELF\0"
+				"ELGX\0"
+				"ELJ\0"
+				"ELLO\0"
+				"ELMD\0"
+				"ELOX\0"
+				"ELP\0"
+				"ELS\0"
+				"ELSE\0"
+				"ELTK\0"
+				"ELU\0"
+				"ELVT\0"
+				"ELY\0"
+				"EMAN\0"
+				"EMB\0"
+				"EMCB\0"
+				"EMCF\0"
+				"EMCG\0"
+				"EMCI\0"
+				"EMD\0"
+				"EME\0"
+				"EMF\0"
+				"EMIF\0"
+				"EMKR\0"
+				"EML\0"
+				"EMMS\0"
+				"EMN\0"
+				"EMO\0"
+				"EMP\0"
+				"EMR\0"
+				"EMX\0"
+				"EMXC\0"
+				"ENB\0"
+				"ENBA\0"
+				"ENBL\0"
+				"ENDP\0"
+				"ENFC\0"
+				"ENG\0"
+				"ENIA\0"
+				"ENIC\0"
+				"ENJ\0"
+				"ENLC\0"
+				"ENLV\0"
+				"ENO\0"
+				"ENOB\0"
+				"ENPH\0"
+				"ENR\0"
+				"ENR^A\0"
+				"ENS\0"
+				"ENSG\0"
+				"ENSV\0"
+				"ENT\0"
+				"ENTA\0"
+				"ENTG\0"
+				"ENTX\0"
+				"ENTXW\0"
+				"ENV\0"
+				"ENVA\0"
+				"ENX\0"
+				"ENZ\0"
+				"ENZL\0"
+				"EOD\0"
+				"EOG\0"
+				"EOI\0"
+				"EOLS\0"
+				"EOS\0"
+				"EOT\0"
+				"EPAM\0"
+				"EPAY\0"
+				"EPC\0"
+				"EPD\0"
+				"EPIX\0"
+				"EPM\0"
+				"EPR\0"
+				"EPRT\0"
+				"EPR^C\0"
+				"EPR^E\0"
+				"EPR^G\0"
+				"EPSN\0"
+				"EPZM\0"
+				"EP^C\0"
+				"EQ\0"
+				"EQBK\0"
+				"EQC\0"
+				"EQC^D\0"
+				"EQH\0"
+				"EQIX\0"
+				"EQM\0"
+				"EQNR\0"
+				"EQR\0"
+				"EQRR\0"
+				"EQS\0"
+				"EQT\0"
+				"ERA\0"
+				"ERC\0"
+				"ERF\0"
+				"ERH\0"
+				"ERI\0"
+				"ERIC\0"
+				"ERIE\0"
+				"ERII\0"
+				"ERJ\0"
+				"EROS\0"
+				"ERYP\0"
+				"ES\0"
+				"ESBK\0"
+				"ESCA\0"
+				"ESE\0"
+				"ESEA\0"
+				"ESG\0"
+				"ESGD\0"
+				"ESGE\0"
+				"ESGG\0"
+				"ESGR\0"
+				"ESGRO\0"
+				"ESGRP\0"
+				"ESGU\0"
+				"ESI\0"
+				"ESLT\0"
+				"ESNT\0"
+				"ESP\0"
+				"ESPR\0"
+				"ESQ\0"
+				"ESRT\0"
+				"ESS\0"
+				"ESSA\0"
+				"ESTA\0"
+				"ESTC\0"
+				"ESTE\0"
+				"ESTR\0"
+				"ESTRW\0"
+				"ESXB\0"
+				"ET\0"
+				"ETB\0"
+				"ETFC\0"
+				"ETG\0"
+				"ETH\0"
+				"ETI^\0"
+				"ETJ\0"
+				"ETM\0"
+				"ETN\0"
+				"ETO\0"
+				"ETON\0"
+				"ETP^C\0"
+				"ETP^D\0"
+				"ETP^E\0"
+				"ETR\0"
+				"ETRN\0"
+				"ETSY\0"
+				"ETTX\0"
+				"ETV\0"
+				"ETW\0"
+				"ETX\0"
+				"ETY\0"
+				"EUFN\0"
+				"EURN\0"
+				"EV\0"
+				"EVA\0"
+				"EVBG\0"
+				"EVBN\0"
+				"EVC\0"
+				"EVER\0"
+				"EVF\0"
+				"EVFM\0"
+				"EVG\0"
+				"EVGBC\0"
+				"EVGN\0"
+				"EVH\0"
+				"EVI\0"
+				"EVK\0"
+				"EVLMC\0"
+				"EVLO\0"
+				"EVM\0"
+				"EVN\0"
+				"EVOK\0"
+				"EVOL\0"
+				"EVOP\0"
+				"EVR\0"
+				"EVRG\0"
+				"EVRI\0"
+				"EVSI\0"
+				"EVSIW\0"
+				"EVSTC\0"
+				"EVT\0"
+				"EVTC\0"
+				"EVV\0"
+				"EVY\0"
+				"EW\0"
+				"EWBC\0"
+				"EWJE\0"
+				"EWJV\0"
+				"EWZS\0"
+				"EXAS\0"
+				"EXC\0"
+				"EXD\0"
+				"EXEL\0"
+				"EXFO\0"
+				"EXG\0"
+				"EXK\0"
+				"EXLS\0"
+				"EXP\0"
+				"EXPC\0"
+				"EXPCU\0"
+				"EXPD\0"
+				"EXPE\0"
+				"EXPI\0"
+				"EXPO\0"
+				"EXPR\0"
+				"EXR\0"
+				"EXTN\0"
+				"EXTR\0"
+				"EYE\0"
+				"EYEG\0"
+				"EYEGW\0"
+				"EYEN\0"
+				"EYES\0"
+				"EYESW\0"
+				"EYPT\0"
+				"EZPW\0"
+				"EZT\0"
+				"F\0"
+				"FAAR\0"
+				"FAB\0"
+				"FAD\0"
+				"FAF\0"
+				"FALN\0"
+				"FAM\0"
+				"FAMI\0"
+				"FANG\0"
+				"FANH\0"
+				"FARM\0"
+				"FARO\0"
+				"FAST\0"
+				"FAT\0"
+				"FATE\0"
+				"FAX\0"
+				"FB\0"
+				"FBC\0"
+				"FBHS\0"
+				"FBIO\0"
+				"FBIOP\0"
+				"FBIZ\0"
+				"FBK\0"
+				"FBM\0"
+				"FBMS\0"
+				"FBNC\0"
+				"FBP\0"
+				"FBSS\0"
+				"FBZ\0"
+				"FC\0"
+				"FCA\0"
+				"FCAL\0"
+				"FCAN\0"
+				"FCAP\0"
+				"FCAU\0"
+				"FCBC\0"
+				"FCBP\0"
+				"FCCO\0"
+				"FCCY\0"
+				"FCEF\0"
+				"FCEL\0"
+				"FCF\0"
+				"FCFS\0"
+				"FCN\0"
+				"FCNCA\0"
+				"FCO\0"
+				"FCPT\0"
+				"FCSC\0"
+				"FCT\0"
+				"FCVT\0"
+				"FCX\0"
+				"FDBC\0"
+				"FDEF\0"
+				"FDEU\0"
+				"FDIV\0"
+				"FDNI\0"
+				"FDP\0"
+				"FDS\0"
+				"FDT\0"
+				"FDTS\0"
+				"FDUS\0"
+				"FDUSL\0"
+				"FDUSZ\0"
+				"FDX\0"
+				"FE\0"
+				"FEDU\0"
+				"FEI\0"
+				"FEIM\0"
+				"FELE\0"
+				"FELP\0"
+				"FEM\0"
+				"FEMB\0"
+				"FEMS\0"
+				"FEN\0"
+				"FENC\0"
+				"FENG\0"
+				"FEO\0"
+				"FEP\0"
+				"FET\0"
+				"FEUZ\0"
+				"FEX\0"
+				"FEYE\0"
+				"FF\0"
+				"FFA\0"
+				"FFBC\0"
+				"FFBW\0"
+				"FFC\0"
+				"FFG\0"
+				"FFHL\0"
+				"FFIC\0"
+				"FFIN\0"
+				"FFIV\0"
+				"FFNW\0"
+				"FFWM\0"
+				"FG\0"
+				"FG.WS\0"
+				"FGB\0"
+				"FGBI\0"
+				"FGEN\0"
+				"FGM\0"
+				"FGP\0"
+				"FHB\0"
+				"FHK\0"
+				"FHL\0"
+				"FHN\0"
+				"FHN^A\0"
+				"FI\0"
+				"FIBK\0"
+				"FICO\0"
+				"FID\0"
+				"FIF\0"
+				"FII\0"
+				"FINS\0"
+				"FINX\0"
+				"FIS\0"
+				"FISI\0"
+				"FISV\0"
+				"FIT\0"
+				"FITB\0"
+				"FITBI\0"
+				"FITBP\0"
+				"FIV\0"
+				"FIVE\0"
+				"FIVN\0"
+				"FIX\0"
+				"FIXD\0"
+				"FIXX\0"
+				"FIZZ\0"
+				"FJP\0"
+				"FKLY\0"
+				"FKO\0"
+				"FKU\0"
+				"FL\0"
+				"FLAG\0"
+				"FLAT\0"
+				"FLC\0"
+				"FLDM\0"
+				"FLEX\0"
+				"FLGT\0"
+				"FLIC\0"
+				"FLIR\0"
+				"FLL\0"
+				"FLLCU\0"
+				"FLMN\0"
+				"FLMNW\0"
+				"FLN\0"
+				"FLNG\0"
+				"FLNT\0"
+				"FLO\0"
+				"FLOW\0"
+				"FLR\0"
+				"FLS\0"
+				"FLT\0"
+				"FLUX\0"
+				"FLWR\0"
+				"FLWS\0"
+				"FLXN\0"
+				"FLXS\0"
+				"FLY\0"
+				"FMAO\0"
+				"FMAX\0"
+				"FMB\0"
+				"FMBH\0"
+				"FMBI\0"
+				"FMC\0"
+				"FMCI\0"
+				"FMCIU\0"
+				"FMCIW\0"
+				"FMHI\0"
+				"FMK\0"
+				"FMN\0"
+				"FMNB\0"
+				"FMO\0"
+				"FMS\0"
+				"FMX\0"
+				"FMY\0"
+				"FN\0"
+				"FNB\0"
+				"FNB^E\0"
+				"FNCB\0"
+				"FND\0"
+				"FNF\0"
+				"FNHC\0"
+				"FNJN\0"
+				"FNK\0"
+				"FNKO\0"
+				"FNLC\0"
+				"FNSR\0"
+				"FNV\0"
+				"FNWB\0"
+				"FNX\0"
+				"FNY\0"
+				"FOCS\0"
+				"FOE\0"
+				"FOF\0"
+				"FOLD\0"
+				"FOMX\0"
+				"FONR\0"
+				"FOR\0"
+				"FORD\0"
+				"FORK\0"
+				"FORM\0"
+				"FORR\0"
+				"FORTY\0"
+				"FOSL\0"
+				"FOX\0"
+				"FOXA\0"
+				"FOXF\0"
+				"FPA\0"
+				"FPAC\0"
+				"FPAC.U\0"
+				"FPAC.WS\0"
+				"FPAY\0"
+				"FPAYW\0"
+				"FPF\0"
+				"FPH\0"
+				"FPI\0"
+				"FPI^B\0"
+				"FPL\0"
+				"FPRX\0"
+				"FPXE\0"
+				"FPXI\0"
+				"FR\0"
+				"FRA\0"
+				"FRAC\0"
+				"FRAF\0"
+				"FRAN\0"
+				"FRBA\0"
+				"FRBK\0"
+				"FRC\0"
+				"FRC^D\0"
+				"FRC^F\0"
+				"FRC^G\0"
+				"FRC^H\0"
+				"FRC^I\0"
+				"FRD\0"
+				"FRED\0"
+				"FRGI\0"
+				"FRME\0"
+				"FRO\0"
+				"FRPH\0"
+				"FRPT\0"
+				"FRSX\0"
+				"FRT\0"
+				"FRTA\0"
+				"FRT^C\0"
+				"FSB\0"
+				"FSBC\0"
+				"FSBW\0"
+				"FSCT\0"
+				"FSD\0"
+				"FSEA\0"
+				"FSFG\0"
+				"FSI\0"
+				"FSK\0"
+				"FSLR\0"
+				"FSLY\0"
+				"FSM\0"
+				"FSP\0"
+				"FSS\0"
+				"FSTR\0"
+				"FSV\0"
+				"FSZ\0"
+				"FT\0"
+				"FTA\0"
+				"FTAC\0"
+				"FTACU\0"
+				"FTACW\0"
+				"FTAG\0"
+				"FTAI\0"
+				"FTC\0"
+				"FTCH\0"
+				"FTCS\0"
+				"FTDR\0"
+				"FTEK\0"
+				"FTEO\0"
+				"FTF\0"
+				"FTFT\0"
+				"FTGC\0"
+				"FTHI\0"
+				"FTI\0"
+				"FTK\0"
+				"FTLB\0"
+				"FTNT\0"
+				"FTNW\0"
+				"FTR\0"
+				"FTRI\0"
+				"FTS\0"
+				"FTSI\0"
+				"FTSL\0"
+				"FTSM\0"
+				"FTSV\0"
+				"FTV\0"
+				"FTV^A\0"
+				"FTXD\0"
+				"FTXG\0"
+				"FTXH\0"
+				"FTXL\0"
+				"FTXN\0"
+				"FTXO\0"
+				"FTXR\0"
+				"FUL\0"
+				"FULC\0"
+				"FULT\0"
+				"FUN\0"
+				"FUNC\0"
+				"FUND\0"
+				"FUSB\0"
+				"FUV\0"
+				"FV\0"
+				"FVC\0"
+				"FVCB\0"
+				"FVE\0"
+				"FVRR\0"
+				"FWONA\0"
+				"FWONK\0"
+				"FWP\0"
+				"FWRD\0"
+				"FXNC\0"
+				"FYC\0"
+				"FYT\0"
+				"FYX\0"
+				"F^B\0"
+				"G\0"
+				"GAB\0"
+				"GABC\0"
+				"GAB^D\0"
+				"GAB^G\0"
+				"GAB^H\0"
+				"GAB^J\0"
+				"GAIA\0"
+				"GAIN\0"
+				"GAINL\0"
+				"GAINM\0"
+				"GALT\0"
+				"GAM\0"
+				"GAM^B\0"
+				"GARS\0"
+				"GASS\0"
+				"GATX\0"
+				"GBAB\0"
+				"GBCI\0"
+				"GBDC\0"
+				"GBL\0"
+				"GBLI\0"
+				"GBLIL\0"
+				"GBLIZ\0"
+				"GBLK\0"
+				"GBR\0"
+				"GBT\0"
+				"GBX\0"
+				"GCAP\0"
+				"GCBC\0"
+				"GCI\0"
+				"GCO\0"
+				"GCP\0"
+				"GCV\0"
+				"GCVRZ\0"
+				"GCV^B\0"
+				"GD\0"
+				"GDDY\0"
+				"GDEN\0"
+				"GDI\0"
+				"GDL\0"
+				"GDL^C\0"
+				"GDO\0"
+				"GDOT\0"
+				"GDP\0"
+				"GDS\0"
+				"GDV\0"
+				"GDV^A\0"
+				"GDV^D\0"
+				"GDV^G\0"
+				"GDV^H\0"
+				"GE\0"
+				"GEC\0"
+				"GECC\0"
+				"GECCL\0"
+				"GECCM\0"
+				"GECCN\0"
+				"GEF\0"
+				"GEF.B\0"
+				"GEL\0"
+				"GEMP\0"
+				"GEN\0"
+				"GENC\0"
+				"GENE\0"
+				"GENY\0"
+				"GEO\0"
+				"GEOS\0"
+				"GER\0"
+				"GERN\0"
+				"GES\0"
+				"GEVO\0"
+				"GF\0"
+				"GFED\0"
+				"GFF\0"
+				"GFI\0"
+				"GFN\0"
+				"GFNCP\0"
+				"GFNSL\0"
+				"GFY\0"
+				"GGAL\0"
+				"GGB\0"
+				"GGG\0"
+				"GGM\0"
+				"GGN\0"
+				"GGN^B\0"
+				"GGO\0"
+				"GGO^A\0"
+				"GGT\0"
+				"GGT^B\0"
+				"GGT^E\0"
+				"GGZ\0"
+				"GGZ^A\0"
+				"GH\0"
+				"GHC\0"
+				"GHDX\0"
+				"GHG\0"
+				"GHL\0"
+				"GHM\0"
+				"GHSI\0"
+				"GHY\0"
+				"GIB\0"
+				"GIFI\0"
+				"GIG\0"
+				"GIG.U\0"
+				"GIG.WS\0"
+				"GIGE\0"
+				"GIGM\0"
+				"GIG~\0"
+				"GIII\0"
+				"GIL\0"
+				"GILD\0"
+				"GILT\0"
+				"GIM\0"
+				"GIS\0"
+				"GIX\0"
+				"GIX.U\0"
+				"GIX.WS\0"
+				"GIX~\0"
+				"GJH\0"
+				"GJO\0"
+				"GJP\0"
+				"GJR\0"
+				"GJS\0"
+				"GJT\0"
+				"GJV\0"
+				"GKOS\0"
+				"GL\0"
+				"GLAC\0"
+				"GLACR\0"
+				"GLACU\0"
+				"GLACW\0"
+				"GLAD\0"
+				"GLADD\0"
+				"GLADN\0"
+				"GLBS\0"
+				"GLBZ\0"
+				"GLDD\0"
+				"GLDI\0"
+				"GLG\0"
+				"GLIBA\0"
+				"GLIBP\0"
+				"GLMD\0"
+				"GLNG\0"
+				"GLO\0"
+				"GLOB\0"
+				"GLOG\0"
+				"GLOG^A\0"
+				"GLOP\0"
+				"GLOP^A\0"
+				"GLOP^B\0"
+				"GLOP^C\0"
+				"GLOW\0"
+				"GLP\0"
+				"GLPG\0"
+				"GLPI\0"
+				"GLP^A\0"
+				"GLQ\0"
+				"GLRE\0"
+				"GLT\0"
+				"GLU\0"
+				"GLUU\0"
+				"GLU^A\0"
+				"GLU^B\0"
+				"GLV\0"
+				"GLW\0"
+				"GLYC\0"
+				"GL^C\0"
+				"GM\0"
+				"GMAB\0"
+				"GMDA\0"
+				"GME\0"
+				"GMED\0"
+				"GMHI\0"
+				"GMHIU\0"
+				"GMHIW\0"
+				"GMLP\0"
+				"GMLPP\0"
+				"GMO\0"
+				"GMRE\0"
+				"GMRE^A\0"
+				"GMS\0"
+				"GMTA\0"
+				"GMZ\0"
+				"GNC\0"
+				"GNCA\0"
+				"GNE\0"
+				"GNE^A\0"
+				"GNFT\0"
+				"GNK\0"
+				"GNL\0"
+				"GNLN\0"
+				"GNL^A\0"
+				"GNMA\0"
+				"GNMK\0"
+				"GNMX\0"
+				"GNOM\0"
+				"GNPX\0"
+				"GNRC\0"
+				"GNST\0"
+				"GNT\0"
+				"GNTX\0"
+				"GNTY\0"
+				"GNT^A\0"
+				"GNUS\0"
+				"GNW\0"
+				"GO\0"
+				"GOF\0"
+				"GOGL\0"
+				"GOGO\0"
+				"GOL\0"
+				"GOLD\0"
+				"GOLF\0"
+				"GOOD\0"
+				"GOODM\0"
+				"GOODO\0"
+				"GOODP\0"
+				"GOOG\0"
+				"GOOGL\0"
+				"GOOS\0"
+				"GORO\0"
+				"GOSS\0"
+				"GPAQ\0"
+				"GPAQU\0"
+				"GPAQW\0"
+				"GPC\0"
+				"GPI\0"
+				"GPJA\0"
+				"GPK\0"
+				"GPL\0"
+				"GPM\0"
+				"GPMT\0"
+				"GPN\0"
+				"GPOR\0"
+				"GPP\0"
+				"GPRE\0"
+				"GPRK\0"
+				"GPRO\0"
+				"GPS\0"
+				"GPX\0"
+				"GRA\0"
+				"GRAF\0"
+				"GRAF.U\0"
+				"GRAF.WS\0"
+				"GRAM\0"
+				"GRBK\0"
+				"GRC\0"
+				"GRF\0"
+				"GRFS\0"
+				"GRID\0"
+				"GRIF\0"
+				"GRIN\0"
+				"GRMN\0"
+				"GRNQ\0"
+				"GROW\0"
+				"GRP.U\0"
+				"GRPN\0"
+				"GRSH\0"
+				"GRSHU\0"
+				"GRSHW\0"
+				"GRTS\0"
+				"GRUB\0"
+				"GRVY\0"
+				"GRX\0"
+				"GRX^A\0"
+				"GRX^B\0"
+				"GS\0"
+				"GSAH\0"
+				"GSAH.U\0"
+				"GSAH.WS\0"
+				"GSAT\0"
+				"GSB\0"
+				"GSBC\0"
+				"GSBD\0"
+				"GSH\0"
+				"GSHD\0"
+				"GSIT\0"
+				"GSK\0"
+				"GSKY\0"
+				"GSL\0"
+				"GSL^B\0"
+				"GSM\0"
+				"GSS\0"
+				"GSUM\0"
+				"GSV\0"
+				"GSX\0"
+				"GS^A\0"
+				"GS^C\0"
+				"GS^D\0"
+				"GS^J\0"
+				"GS^K\0"
+				"GS^N\0"
+				"GT\0"
+				"GTE\0"
+				"GTES\0"
+				"GTHX\0"
+				"GTIM\0"
+				"GTLS\0"
+				"GTN\0"
+				"GTN.A\0"
+				"GTS\0"
+				"GTT\0"
+				"GTX\0"
+				"GTY\0"
+				"GTYH\0"
+				"GULF\0"
+				"GURE\0"
+				"GUT\0"
+				"GUT^A\0"
+				"GUT^C\0"
+				"GV\0"
+				"GVA\0"
+				"GVP\0"
+				"GWB\0"
+				"GWGH\0"
+				"GWPH\0"
+				"GWR\0"
+				"GWRE\0"
+				"GWRS\0"
+				"GWW\0"
+				"GXGX\0"
+				"GXGXU\0"
+				"GXGXW\0"
+				"GYB\0"
+				"GYC\0"
+				"GYRO\0"
+				"H\0"
+				"HA\0"
+				"HABT\0"
+				"HAE\0"
+				"HAFC\0"
+				"HAIN\0"
+				"HAIR\0"
+				"HAL\0"
+				"HALL\0"
+				"HALO\0"
+				"HARP\0"
+				"HAS\0"
+				"HASI\0"
+				"HAYN\0"
+				"HBAN\0"
+				"HBANN\0"
+				"HBANO\0"
+				"HBB\0"
+				"HBCP\0"
+				"HBI\0"
+				"HBIO\0"
+				"HBM\0"
+				"HBMD\0"
+				"HBNC\0"
+				"HBP\0"
+				"HCA\0"
+				"HCAC\0"
+				"HCACU\0"
+				"HCACW\0"
+				"HCAP\0"
+				"HCAPZ\0"
+				"HCAT\0"
+				"HCC\0"
+				"HCCH\0"
+				"HCCHR\0"
+				"HCCHU\0"
+				"HCCHW\0"
+				"HCCI\0"
+				"HCFT\0"
+				"HCHC\0"
+				"HCI\0"
+				"HCKT\0"
+				"HCM\0"
+				"HCP\0"
+				"HCR\0"
+				"HCSG\0"
+				"HCXY\0"
+				"HCXZ\0"
+				"HD\0"
+				"HDB\0"
+				"HDS\0"
+				"HDSN\0"
+				"HE\0"
+				"HEAR\0"
+				"HEBT\0"
+				"HEES\0"
+				"HEI\0"
+				"HEI.A\0"
+				"HELE\0"
+				"HEP\0"
+				"HEPA\0"
+				"HEQ\0"
+				"HERD\0"
+				"HES\0"
+				"HESM\0"
+				"HEWG\0"
+				"HEXO\0"
+				"HFBL\0"
+				"HFC\0"
+				"HFFG\0"
+				"HFRO\0"
+				"HFRO^A\0"
+				"HFWA\0"
+				"HGH\0"
+				"HGLB\0"
+				"HGSH\0"
+				"HGV\0"
+				"HHC\0"
+				"HHHH\0"
+				"HHHHR\0"
+				"HHHHU\0"
+				"HHHHW\0"
+				"HHR\0"
+				"HHS\0"
+				"HHT\0"
+				"HI\0"
+				"HIBB\0"
+				"HIE\0"
+				"HIFS\0"
+				"HIG\0"
+				"HIG^G\0"
+				"HIHO\0"
+				"HII\0"
+				"HIIQ\0"
+				"HIL\0"
+				"HIMX\0"
+				"HIO\0"
+				"HIW\0"
+				"HIX\0"
+				"HJLI\0"
+				"HJLIW\0"
+				"HJV\0"
+				"HKIB\0"
+				"HL\0"
+				"HLAL\0"
+				"HLF\0"
+				"HLG\0"
+				"HLI\0"
+				"HLIO\0"
+				"HLIT\0"
+				"HLM^\0"
+				"HLNE\0"
+				"HLT\0"
+				"HLX\0"
+				"HL^B\0"
+				"HMC\0"
+				"HMG\0"
+				"HMHC\0"
+				"HMI\0"
+				"HMLP\0"
+				"HMLP^A\0"
+				"HMN\0"
+				"HMNF\0"
+				"HMST\0"
+				"HMSY\0"
+				"HMTV\0"
+				"HMY\0"
+				"HNDL\0"
+				"HNGR\0"
+				"HNI\0"
+				"HNNA\0"
+				"HNP\0"
+				"HNRG\0"
+				"HNW\0"
+				"HOFT\0"
+				"HOG\0"
+				"HOLI\0"
+				"HOLX\0"
+				"HOMB\0"
+				"HOME\0"
+				"HON\0"
+				"HONE\0"
+				"HOOK\0"
+				"HOPE\0"
+				"HOS\0"
+				"HOTH\0"
+				"HOV\0"
+				"HOVNP\0"
+				"HP\0"
+				"HPE\0"
+				"HPF\0"
+				"HPI\0"
+				"HPJ\0"
+				"HPP\0"
+				"HPQ\0"
+				"HPR\0"
+				"HPS\0"
+				"HPT\0"
+				"HQH\0"
+				"HQI\0"
+				"HQL\0"
+				"HQY\0"
+				"HR\0"
+				"HRB\0"
+				"HRC\0"
+				"HRI\0"
+				"HRL\0"
+				"HROW\0"
+				"HRTG\0"
+				"HRTX\0"
+				"HRZN\0"
+				"HSAC\0"
+				"HSACU\0"
+				"HSACW\0"
+				"HSBC\0"
+				"HSBC^A\0"
+				"HSC\0"
+				"HSDT\0"
+				"HSGX\0"
+				"HSIC\0"
+				"HSII\0"
+				"HSKA\0"
+				"HSON\0"
+				"HST\0"
+				"HSTM\0"
+				"HSY\0"
+				"HT\0"
+				"HTA\0"
+				"HTBI\0"
+				"HTBK\0"
+				"HTBX\0"
+				"HTD\0"
+				"HTFA\0"
+				"HTGC\0"
+				"HTGM\0"
+				"HTH\0"
+				"HTHT\0"
+				"HTLD\0"
+				"HTLF\0"
+				"HTY\0"
+				"HTZ\0"
+				"HT^C\0"
+				"HT^D\0"
+				"HT^E\0"
+				"HUBB\0"
+				"HUBG\0"
+				"HUBS\0"
+				"HUD\0"
+				"HUM\0"
+				"HUN\0"
+				"HURC\0"
+				"HURN\0"
+				"HUSA\0"
+				"HUYA\0"
+				"HVBC\0"
+				"HVT\0"
+				"HVT.A\0"
+				"HWBK\0"
+				"HWC\0"
+				"HWCC\0"
+				"HWCPL\0"
+				"HWKN\0"
+				"HX\0"
+				"HXL\0"
+				"HY\0"
+				"HYAC\0"
+				"HYACU\0"
+				"HYACW\0"
+				"HYB\0"
+				"HYI\0"
+				"HYLS\0"
+				"HYND\0"
+				"HYRE\0"
+				"HYT\0"
+				"HYXE\0"
+				"HYZD\0"
+				"HZN\0"
+				"HZNP\0"
+				"HZO\0"
+				"I\0"
+				"IAA\0"
+				"IAC\0"
+				"IAE\0"
+				"IAF\0"
+				"IAG\0"
+				"IART\0"
+				"IBA\0"
+				"IBB\0"
+				"IBCP\0"
+				"IBEX\0"
+				"IBIO\0"
+				"IBKC\0"
+				"IBKCN\0"
+				"IBKCO\0"
+				"IBKCP\0"
+				"IBM\0"
+				"IBN\0"
+				"IBO\0"
+				"IBOC\0"
+				"IBP\0"
+				"IBTX\0"
+				"IBUY\0"
+				"ICAD\0"
+				"ICBK\0"
+				"ICCC\0"
+				"ICCH\0"
+				"ICD\0"
+				"ICE\0"
+				"ICFI\0"
+				"ICHR\0"
+				"ICL\0"
+				"ICLK\0"
+				"ICLN\0"
+				"ICLR\0"
+				"ICMB\0"
+				"ICON\0"
+				"ICPT\0"
+				"ICUI\0"
+				"IDA\0"
+				"IDCC\0"
+				"IDE\0"
+				"IDEX\0"
+				"IDLB\0"
+				"IDN\0"
+				"IDRA\0"
+				"IDSA\0"
+				"IDSY\0"
+				"IDT\0"
+				"IDXG\0"
+				"IDXX\0"
+				"IDYA\0"
+				"IEA\0"
+				"IEAWW\0"
+				"IEC\0"
+				"IEF\0"
+				"IEI\0"
+				"IEP\0"
+				"IESC\0"
+				"IEUS\0"
+				"IEX\0"
+				"IFEU\0"
+				"IFF\0"
+				"IFFT\0"
+				"IFGL\0"
+				"IFMK\0"
+				"IFN\0"
+				"IFRX\0"
+				"IFS\0"
+				"IFV\0"
+				"IGA\0"
+				"IGC\0"
+				"IGD\0"
+				"IGF\0"
+				"IGI\0"
+				"IGIB\0"
+				"IGLD\0"
+				"IGLE\0"
+				"IGOV\0"
+				"IGR\0"
+				"IGSB\0"
+				"IGT\0"
+				"IHC\0"
+				"IHD\0"
+				"IHG\0"
+				"IHIT\0"
+				"IHRT\0"
+				"IHT\0"
+				"IHTA\0"
+				"IID\0"
+				"IIF\0"
+				"III\0"
+				"IIIN\0"
+				"IIIV\0"
+				"IIM\0"
+				"IIN\0"
+				"IIPR\0"
+				"IIPR^A\0"
+				"IIVI\0"
+				"IJT\0"
+				"IKNX\0"
+				"ILMN\0"
+				"ILPT\0"
+				"IMAC\0"
+				"IMACW\0"
+				"IMAX\0"
+				"IMBI\0"
+				"IMGN\0"
+				"IMH\0"
+				"IMI\0"
+				"IMKTA\0"
+				"IMMP\0"
+				"IMMR\0"
+				"IMMU\0"
+				"IMO\0"
+				"IMOS\0"
+				"IMRN\0"
+				"IMRNW\0"
+				"IMTE\0"
+				"IMUX\0"
+				"IMV\0"
+				"IMXI\0"
+				"INAP\0"
+				"INB\0"
+				"INBK\0"
+				"INBKL\0"
+				"INBKZ\0"
+				"INCY\0"
+				"INDB\0"
+				"INDY\0"
+				"INF\0"
+				"INFI\0"
+				"INFN\0"
+				"INFO\0"
+				"INFR\0"
+				"INFU\0"
+				"INFY\0"
+				"ING\0"
+				"INGN\0"
+				"INGR\0"
+				"INMB\0"
+				"INMD\0"
+				"INN\0"
+				"INNT\0"
+				"INN^D\0"
+				"INN^E\0"
+				"INO\0"
+				"INOD\0"
+				"INOV\0"
+				"INPX\0"
+				"INS\0"
+				"INSE\0"
+				"INSG\0"
+				"INSI\0"
+				"INSM\0"
+				"INSP\0"
+				"INST\0"
+				"INSU\0"
+				"INSUU\0"
+				"INSUW\0"
+				"INSW\0"
+				"INSW^A\0"
+				"INT\0"
+				"INTC\0"
+				"INTG\0"
+				"INTL\0"
+				"INTT\0"
+				"INTU\0"
+				"INUV\0"
+				"INVA\0"
+				"INVE\0"
+				"INVH\0"
+				"INWK\0"
+				"INXN\0"
+				"IO\0"
+				"IONS\0"
+				"IOR\0"
+				"IOSP\0"
+				"IOTS\0"
+				"IOVA\0"
+				"IP\0"
+				"IPAR\0"
+				"IPB\0"
+				"IPDN\0"
+				"IPG\0"
+				"IPGP\0"
+				"IPHI\0"
+				"IPHS\0"
+				"IPI\0"
+				"IPKW\0"
+				"IPLDP\0"
+				"IPOA\0"
+				"IPOA.U\0"
+				"IPOA.WS\0"
+				"IPWR\0"
+				"IQ\0"
+				"IQI\0"
+				"IQV\0"
+				"IR\0"
+				"IRBT\0"
+				"IRCP\0"
+				"IRDM\0"
+				"IRET\0"
+				"IRET^C\0"
+				"IRIX\0"
+				"IRL\0"
+				"IRM\0"
+				"IRMD\0"
+				"IROQ\0"
+				"IRR\0"
+				"IRS\0"
+				"IRT\0"
+				"IRTC\0"
+				"IRWD\0"
+				"ISBC\0"
+				"ISCA\0"
+				"ISD\0"
+				"ISDR\0"
+				"ISDS\0"
+				"ISDX\0"
+				"ISEE\0"
+				"ISEM\0"
+				"ISG\0"
+				"ISHG\0"
+				"ISIG\0"
+				"ISNS\0"
+				"ISR\0"
+				"ISRG\0"
+				"ISRL\0"
+				"ISSC\0"
+				"ISTB\0"
+				"ISTR\0"
+				"IT\0"
+				"ITCB\0"
+				"ITCI\0"
+				"ITEQ\0"
+				"ITGR\0"
+				"ITI\0"
+				"ITIC\0"
+				"ITMR\0"
+				"ITP\0"
+				"ITRI\0"
+				"ITRM\0"
+				"ITRN\0"
+				"ITT\0"
+				"ITUB\0"
+				"ITW\0"
+				"IUS\0"
+				"IUSB\0"
+				"IUSG\0"
+				"IUSS\0"
+				"IUSV\0"
+				"IVAC\0"
+				"IVC\0"
+				"IVH\0"
+				"IVR\0"
+				"IVR^A\0"
+				"IVR^B\0"
+				"IVR^C\0"
+				"IVZ\0"
+				"IX\0"
+				"IXUS\0"
+				"IZEA\0"
+				"JACK\0"
+				"JAG\0"
+				"JAGX\0"
+				"JAKK\0"
+				"JAN\0"
+				"JASN\0"
+				"JAX\0"
+				"JAZZ\0"
+				"JBGS\0"
+				"JBHT\0"
+				"JBK\0"
+				"JBL\0"
+				"JBLU\0"
+				"JBN\0"
+				"JBR\0"
+				"JBSS\0"
+				"JBT\0"
+				"JCAP\0"
+				"JCAP^B\0"
+				"JCE\0"
+				"JCI\0"
+				"JCO\0"
+				"JCOM\0"
+				"JCP\0"
+				"JCS\0"
+				"JCTCF\0"
+				"JD\0"
+				"JDD\0"
+				"JE\0"
+				"JEC\0"
+				"JEF\0"
+				"JELD\0"
+				"JEMD\0"
+				"JEQ\0"
+				"JE^A\0"
+				"JFIN\0"
+				"JFK\0"
+				"JFKKR\0"
+				"JFKKU\0"
+				"JFKKW\0"
+				"JFR\0"
+				"JFU\0"
+				"JG\0"
+				"JGH\0"
+				"JHAA\0"
+				"JHB\0"
+				"JHD\0"
+				"JHG\0"
+				"JHI\0"
+				"JHS\0"
+				"JHX\0"
+				"JHY\0"
+				"JILL\0"
+				"JJSF\0"
+				"JKHY\0"
+				"JKI\0"
+				"JKS\0"
+				"JLL\0"
+				"JLS\0"
+				"JMEI\0"
+				"JMF\0"
+				"JMIA\0"
+				"JMLP\0"
+				"JMM\0"
+				"JMP\0"
+				"JMPB\0"
+				"JMPD\0"
+				"JMT\0"
+				"JMU\0"
+				"JNCE\0"
+				"JNJ\0"
+				"JNPR\0"
+				"JOB\0"
+				"JOBS\0"
+				"JOE\0"
+				"JOF\0"
+				"JOUT\0"
+				"JP\0"
+				"JPC\0"
+				"JPI\0"
+				"JPM\0"
+				"JPM^A\0"
+				"JPM^C\0"
+				"JPM^D\0"
+				"JPM^F\0"
+				"JPM^G\0"
+				"JPM^H\0"
+				"JPS\0"
+				"JPT\0"
+				"JQC\0"
+				"JRI\0"
+				"JRJC\0"
+				"JRO\0"
+				"JRS\0"
+				"JRSH\0"
+				"JRVR\0"
+				"JSD\0"
+				"JSM\0"
+				"JSMD\0"
+				"JSML\0"
+				"JT\0"
+				"JTA\0"
+				"JTD\0"
+				"JVA\0"
+				"JW.A\0"
+				"JW.B\0"
+				"JWN\0"
+				"JYNT\0"
+				"K\0"
+				"KAI\0"
+				"KALA\0"
+				"KALU\0"
+				"KALV\0"
+				"KAMN\0"
+				"KAR\0"
+				"KB\0"
+				"KBAL\0"
+				"KBH\0"
+				"KBLM\0"
+				"KBLMR\0"
+				"KBLMU\0"
+				"KBLMW\0"
+				"KBR\0"
+				"KBSF\0"
+				"KBWB\0"
+				"KBWD\0"
+				"KBWP\0"
+				"KBWR\0"
+				"KBWY\0"
+				"KCAPL\0"
+				"KDMN\0"
+				"KDP\0"
+				"KE\0"
+				"KEG\0"
+				"KELYA\0"
+				"KELYB\0"
+				"KEM\0"
+				"KEN\0"
+				"KEP\0"
+				"KEQU\0"
+				"KERN\0"
+				"KERNW\0"
+				"KEX\0"
+				"KEY\0"
+				"KEYS\0"
+				"KEY^I\0"
+				"KEY^J\0"
+				"KEY^K\0"
+				"KF\0"
+				"KFFB\0"
+				"KFRC\0"
+				"KFS\0"
+				"KFY\0"
+				"KGC\0"
+				"KGJI\0"
+				"KHC\0"
+				"KIDS\0"
+				"KIM\0"
+				"KIM^I.CL\0"
+				"KIM^J\0"
+				"KIM^K.CL\0"
+				"KIM^L\0"
+				"KIM^M\0"
+				"KIN\0"
+				"KINS\0"
+				"KIO\0"
+				"KIQ\0"
+				"KIRK\0"
+				"KKR\0"
+				"KKR^A\0"
+				"KKR^B\0"
+				"KL\0"
+				"KLAC\0"
+				"KLDO\0"
+				"KLIC\0"
+				"KLXE\0"
+				"KMB\0"
+				"KMDA\0"
+				"KMF\0"
+				"KMI\0"
+				"KMPH\0"
+				"KMPR\0"
+				"KMT\0"
+				"KMX\0"
+				"KN\0"
+				"KNDI\0"
+				"KNL\0"
+				"KNOP\0"
+				"KNSA\0"
+				"KNSL\0"
+				"KNX\0"
+				"KO\0"
+				"KOD\0"
+				"KODK\0"
+				"KOF\0"
+				"KOOL\0"
+				"KOP\0"
+				"KOPN\0"
+				"KOS\0"
+				"KOSS\0"
+				"KPTI\0"
+				"KR\0"
+				"KRA\0"
+				"KRC\0"
+				"KREF\0"
+				"KRG\0"
+				"KRMA\0"
+				"KRNT\0"
+				"KRNY\0"
+				"KRO\0"
+				"KRP\0"
+				"KRTX\0"
+				"KRUS\0"
+				"KRYS\0"
+				"KSM\0"
+				"KSS\0"
+				"KSU\0"
+				"KSU^\0"
+				"KT\0"
+				"KTB\0"
+				"KTCC\0"
+				"KTF\0"
+				"KTH\0"
+				"KTN\0"
+				"KTOS\0"
+				"KTOV\0"
+				"KTOVW\0"
+				"KTP\0"
+				"KURA\0"
+				"KVHI\0"
+				"KW\0"
+				"KWEB\0"
+				"KWR\0"
+				"KXIN\0"
+				"KYN\0"
+				"KYN^F\0"
+				"KZIA\0"
+				"KZR\0"
+				"L\0"
+				"LAC\0"
+				"LACQ\0"
+				"LACQU\0"
+				"LACQW\0"
+				"LAD\0"
+				"LADR\0"
+				"LAIX\0"
+				"LAKE\0"
+				"LAMR\0"
+				"LANC\0"
+				"LAND\0"
+				"LANDP\0"
+				"LARK\0"
+				"LASR\0"
+				"LAUR\0"
+				"LAWS\0"
+				"LAZ\0"
+				"LAZY\0"
+				"LB\0"
+				"LBAI\0"
+				"LBC\0"
+				"LBRDA\0"
+				"LBRDK\0"
+				"LBRT\0"
+				"LBTYA\0"
+				"LBTYB\0"
+				"LBTYK\0"
+				"LBY\0"
+				"LBYAV\0"
+				"LBYKV\0"
+				"LC\0"
+				"LCA\0"
+				"LCAHU\0"
+				"LCAHW\0"
+				"LCI\0"
+				"LCII\0"
+				"LCNB\0"
+				"LCTX\0"
+				"LCUT\0"
+				"LDL\0"
+				"LDOS\0"
+				"LDP\0"
+				"LDRI\0"
+				"LDSF\0"
+				"LE\0"
+				"LEA\0"
+				"LEAF\0"
+				"LECO\0"
+				"LEDS\0"
+				"LEE\0"
+				"LEG\0"
+				"LEGH\0"
+				"LEGR\0"
+				"LEJU\0"
+				"LEN\0"
+				"LEN.B\0"
+				"LEO\0"
+				"LEU\0"
+				"LEVI\0"
+				"LEVL\0"
+				"LFAC\0"
+				"LFACU\0"
+				"LFACW\0"
+				"LFC\0"
+				"LFUS\0"
+				"LFVN\0"
+				"LGC\0"
+				"LGC.U\0"
+				"LGC.WS\0"
+				"LGF.A\0"
+				"LGF.B\0"
+				"LGI\0"
+				"LGIH\0"
+				"LGL\0"
+				"LGND\0"
+				"LH\0"
+				"LHC\0"
+				"LHC.U\0"
+				"LHC.WS\0"
+				"LHCG\0"
+				"LHX\0"
+				"LIFE\0"
+				"LII\0"
+				"LILA\0"
+				"LILAK\0"
+				"LIN\0"
+				"LINC\0"
+				"LIND\0"
+				"LINX\0"
+				"LIQT\0"
+				"LITB\0"
+				"LITE\0"
+				"LIVE\0"
+				"LIVN\0"
+				"LIVX\0"
+				"LJPC\0"
+				"LK\0"
+				"LKCO\0"
+				"LKFN\0"
+				"LKOR\0"
+				"LKQ\0"
+				"LKSD\0"
+				"LL\0"
+				"LLEX\0"
+				"LLIT\0"
+				"LLNW\0"
+				"LLY\0"
+				"LM\0"
+				"LMAT\0"
+				"LMB\0"
+				"LMBS\0"
+				"LMFA\0"
+				"LMFAW\0"
+				"LMHA\0"
+				"LMHB\0"
+				"LMNR\0"
+				"LMNX\0"
+				"LMRK\0"
+				"LMRKN\0"
+				"LMRKO\0"
+				"LMRKP\0"
+				"LMST\0"
+				"LMT\0"
+				"LN\0"
+				"LNC\0"
+				"LND\0"
+				"LNDC\0"
+				"LNG\0"
+				"LNGR\0"
+				"LNN\0"
+				"LNT\0"
+				"LNTH\0"
+				"LOAC\0"
+				"LOACR\0"
+				"LOACU\0"
+				"LOACW\0"
+				"LOAN\0"
+				"LOB\0"
+				"LOCO\0"
+				"LODE\0"
+				"LOGC\0"
+				"LOGI\0"
+				"LOGM\0"
+				"LOMA\0"
+				"LONE\0"
+				"LOOP\0"
+				"LOPE\0"
+				"LOR\0"
+				"LORL\0"
+				"LOV\0"
+				"LOVE\0"
+				"LOW\0"
+				"LPCN\0"
+				"LPG\0"
+				"LPI\0"
+				"LPL\0"
+				"LPLA\0"
+				"LPSN\0"
+				"LPT\0"
+				"LPTH\0"
+				"LPTX\0"
+				"LPX\0"
+				"LQDA\0"
+				"LQDT\0"
+				"LRAD\0"
+				"LRCX\0"
+				"LRGE\0"
+				"LRN\0"
+				"LSBK\0"
+				"LSCC\0"
+				"LSI\0"
+				"LSTR\0"
+				"LSXMA\0"
+				"LSXMB\0"
+				"LSXMK\0"
+				"LTBR\0"
+				"LTC\0"
+				"LTHM\0"
+				"LTM\0"
+				"LTRPA\0"
+				"LTRPB\0"
+				"LTRX\0"
+				"LTS\0"
+				"LTSF\0"
+				"LTSH\0"
+				"LTSK\0"
+				"LTSL\0"
+				"LTS^A\0"
+				"LTXB\0"
+				"LUB\0"
+				"LULU\0"
+				"LUNA\0"
+				"LUNG\0"
+				"LUV\0"
+				"LVGO\0"
+				"LVHD\0"
+				"LVS\0"
+				"LW\0"
+				"LWAY\0"
+				"LX\0"
+				"LXFR\0"
+				"LXP\0"
+				"LXP^C\0"
+				"LXRX\0"
+				"LXU\0"
+				"LYB\0"
+				"LYFT\0"
+				"LYG\0"
+				"LYL\0"
+				"LYTS\0"
+				"LYV\0"
+				"LZB\0"
+				"M\0"
+				"MA\0"
+				"MAA\0"
+				"MAA^I\0"
+				"MAC\0"
+				"MACK\0"
+				"MAG\0"
+				"MAGS\0"
+				"MAIN\0"
+				"MAMS\0"
+				"MAN\0"
+				"MANH\0"
+				"MANT\0"
+				"MANU\0"
+				"MAR\0"
+				"MARA\0"
+				"MARK\0"
+				"MARPS\0"
+				"MAS\0"
+				"MASI\0"
+				"MAT\0"
+				"MATW\0"
+				"MATX\0"
+				"MAV\0"
+				"MAXR\0"
+				"MAYS\0"
+				"MBB\0"
+				"MBCN\0"
+				"MBI\0"
+				"MBII\0"
+				"MBIN\0"
+				"MBINO\0"
+				"MBINP\0"
+				"MBIO\0"
+				"MBOT\0"
+				"MBRX\0"
+				"MBSD\0"
+				"MBT\0"
+				"MBUU\0"
+				"MBWM\0"
+				"MC\0"
+				"MCA\0"
+				"MCB\0"
+				"MCBC\0"
+				"MCC\0"
+				"MCD\0"
+				"MCEF\0"
+				"MCEP\0"
+				"MCF\0"
+				"MCFT\0"
+				"MCHI\0"
+				"MCHP\0"
+				"MCHX\0"
+				"MCI\0"
+				"MCK\0"
+				"MCN\0"
+				"MCO\0"
+				"MCR\0"
+				"MCRB\0"
+				"MCRI\0"
+				"MCRN\0"
+				"MCS\0"
+				"MCV\0"
+				"MCX\0"
+				"MCY\0"
+				"MD\0"
+				"MDB\0"
+				"MDC\0"
+				"MDCA\0"
+				"MDCO\0"
+				"MDGL\0"
+				"MDGS\0"
+				"MDGSW\0"
+				"MDIV\0"
+				"MDJH\0"
+				"MDLA\0"
+				"MDLQ\0"
+				"MDLX\0"
+				"MDLY\0"
+				"MDLZ\0"
+				"MDP\0"
+				"MDR\0"
+				"MDRR\0"
+				"MDRX\0"
+				"MDSO\0"
+				"MDT\0"
+				"MDU\0"
+				"MDWD\0"
+				"MEC\0"
+				"MED\0"
+				"MEDP\0"
+				"MEET\0"
+				"MEI\0"
+				"MEIP\0"
+				"MELI\0"
+				"MEN\0"
+				"MEOH\0"
+				"MERC\0"
+				"MER^K\0"
+				"MESA\0"
+				"MESO\0"
+				"MET\0"
+				"METC\0"
+				"MET^A\0"
+				"MET^E\0"
+				"MFA\0"
+				"MFAC\0"
+				"MFAC.U\0"
+				"MFAC.WS\0"
+				"MFA^B\0"
+				"MFC\0"
+				"MFD\0"
+				"MFG\0"
+				"MFGP\0"
+				"MFIN\0"
+				"MFINL\0"
+				"MFL\0"
+				"MFM\0"
+				"MFNC\0"
+				"MFO\0"
+				"MFSF\0"
+				"MFT\0"
+				"MFV\0"
+				"MG\0"
+				"MGA\0"
+				"MGEE\0"
+				"MGEN\0"
+				"MGF\0"
+				"MGI\0"
+				"MGIC\0"
+				"MGLN\0"
+				"MGM\0"
+				"MGNX\0"
+				"MGP\0"
+				"MGPI\0"
+				"MGR\0"
+				"MGRC\0"
+				"MGTA\0"
+				"MGTX\0"
+				"MGU\0"
+				"MGY\0"
+				"MGYR\0"
+				"MHD\0"
+				"MHE\0"
+				"MHF\0"
+				"MHH\0"
+				"MHI\0"
+				"MHK\0"
+				"MHLA\0"
+				"MHLD\0"
+				"MHN\0"
+				"MHNC\0"
+				"MHO\0"
+				"MH^A\0"
+				"MH^C\0"
+				"MH^D\0"
+				"MIC\0"
+				"MICR\0"
+				"MICT\0"
+				"MIDD\0"
+				"MIE\0"
+				"MIK\0"
+				"MILN\0"
+				"MIME\0"
+				"MIN\0"
+				"MIND\0"
+				"MINDP\0"
+				"MINI\0"
+				"MIRM\0"
+				"MIST\0"
+				"MITK\0"
+				"MITO\0"
+				"MITT\0"
+				"MITT^A\0"
+				"MITT^B\0"
+				"MIXT\0"
+				"MIY\0"
+				"MJCO\0"
+				"MKC\0"
+				"MKC.V\0"
+				"MKGI\0"
+				"MKL\0"
+				"MKSI\0"
+				"MKTX\0"
+				"MLAB\0"
+				"MLCO\0"
+				"MLHR\0"
+				"MLI\0"
+				"MLM\0"
+				"MLND\0"
+				"MLNT\0"
+				"MLNX\0"
+				"MLP\0"
+				"MLR\0"
+				"MLSS\0"
+				"MLVF\0"
+				"MMAC\0"
+				"MMC\0"
+				"MMD\0"
+				"MMI\0"
+				"MMLP\0"
+				"MMM\0"
+				"MMP\0"
+				"MMS\0"
+				"MMSI\0"
+				"MMT\0"
+				"MMU\0"
+				"MMX\0"
+				"MMYT\0"
+				"MN\0"
+				"MNCL\0"
+				"MNCLU\0"
+				"MNCLW\0"
+				"MNDO\0"
+				"MNE\0"
+				"MNI\0"
+				"MNK\0"
+				"MNKD\0"
+				"MNLO\0"
+				"MNOV\0"
+				"MNP\0"
+				"MNR\0"
+				"MNRL\0"
+				"MNRO\0"
+				"MNR^C\0"
+				"MNSB\0"
+				"MNST\0"
+				"MNTA\0"
+				"MNTX\0"
+				"MO\0"
+				"MOBL\0"
+				"MOD\0"
+				"MODN\0"
+				"MOFG\0"
+				"MOG.A\0"
+				"MOG.B\0"
+				"MOGO\0"
+				"MOGU\0"
+				"MOH\0"
+				"MOMO\0"
+				"MOR\0"
+				"MORF\0"
+				"MORN\0"
+				"MOS\0"
+				"MOSC\0"
+				"MOSC.U\0"
+				"MOSC.WS\0"
+				"MOSY\0"
+				"MOTA\0"
+				"MOTS\0"
+				"MOV\0"
+				"MOXC\0"
+				"MPA\0"
+				"MPAA\0"
+				"MPB\0"
+				"MPC\0"
+				"MPLX\0"
+				"MPV\0"
+				"MPVD\0"
+				"MPW\0"
+				"MPWR\0"
+				"MPX\0"
+				"MQT\0"
+				"MQY\0"
+				"MR\0"
+				"MRAM\0"
+				"MRBK\0"
+				"MRC\0"
+				"MRCC\0"
+				"MRCCL\0"
+				"MRCY\0"
+				"MREO\0"
+				"MRIC\0"
+				"MRIN\0"
+				"MRK\0"
+				"MRKR\0"
+				"MRLN\0"
+				"MRNA\0"
+				"MRNS\0"
+				"MRO\0"
+				"MRSN\0"
+				"MRTN\0"
+				"MRTX\0"
+				"MRUS\0"
+				"MRVL\0"
+				"MS\0"
+				"MSA\0"
+				"MSB\0"
+				"MSBF\0"
+				"MSBI\0"
+				"MSC\0"
+				"MSCI\0"
+				"MSD\0"
+				"MSEX\0"
+				"MSFT\0"
+				"MSG\0"
+				"MSGN\0"
+				"MSI\0"
+				"MSL\0"
+				"MSM\0"
+				"MSN\0"
+				"MSON\0"
+				"MSTR\0"
+				"MSVB\0"
+				"MS^A\0"
+				"MS^E\0"
+				"MS^F\0"
+				"MS^G\0"
+				"MS^I\0"
+				"MS^K\0"
+				"MT\0"
+				"MTB\0"
+				"MTBC\0"
+				"MTBCP\0"
+				"MTC\0"
+				"MTCH\0"
+				"MTD\0"
+				"MTDR\0"
+				"MTEM\0"
+				"MTEX\0"
+				"MTFB\0"
+				"MTFBW\0"
+				"MTG\0"
+				"MTH\0"
+				"MTL\0"
+				"MTLS\0"
+				"MTL^\0"
+				"MTN\0"
+				"MTNB\0"
+				"MTOR\0"
+				"MTP\0"
+				"MTR\0"
+				"MTRN\0"
+				"MTRX\0"
+				"MTSC\0"
+				"MTSI\0"
+				"MTSL\0"
+				"MTT\0"
+				"MTW\0"
+				"MTX\0"
+				"MTZ\0"
+				"MU\0"
+				"MUA\0"
+				"MUC\0"
+				"MUDS\0"
+				"MUDSU\0"
+				"MUDSW\0"
+				"MUE\0"
+				"MUFG\0"
+				"MUH\0"
+				"MUI\0"
+				"MUJ\0"
+				"MUR\0"
+				"MUS\0"
+				"MUSA\0"
+				"MUX\0"
+				"MVBF\0"
+				"MVC\0"
+				"MVCD\0"
+				"MVF\0"
+				"MVIS\0"
+				"MVO\0"
+				"MVT\0"
+				"MWA\0"
+				"MWK\0"
+				"MX\0"
+				"MXC\0"
+				"MXE\0"
+				"MXF\0"
+				"MXIM\0"
+				"MXL\0"
+				"MYC\0"
+				"MYD\0"
+				"MYE\0"
+				"MYF\0"
+				"MYFW\0"
+				"MYGN\0"
+				"MYI\0"
+				"MYJ\0"
+				"MYL\0"
+				"MYN\0"
+				"MYO\0"
+				"MYOK\0"
+				"MYOS\0"
+				"MYOV\0"
+				"MYRG\0"
+				"MYSZ\0"
+				"MYT\0"
+				"MZA\0"
+				"NAC\0"
+				"NAD\0"
+				"NAII\0"
+				"NAK\0"
+				"NAKD\0"
+				"NAN\0"
+				"NANO\0"
+				"NAOV\0"
+				"NAT\0"
+				"NATH\0"
+				"NATI\0"
+				"NATR\0"
+				"NAV\0"
+				"NAVB\0"
+				"NAVI\0"
+				"NAV^D\0"
+				"NAZ\0"
+				"NBB\0"
+				"NBCP\0"
+				"NBEV\0"
+				"NBH\0"
+				"NBHC\0"
+				"NBIX\0"
+				"NBL\0"
+				"NBLX\0"
+				"NBN\0"
+				"NBO\0"
+				"NBR\0"
+				"NBRV\0"
+				"NBR^A\0"
+				"NBSE\0"
+				"NBTB\0"
+				"NBW\0"
+				"NBY\0"
+				"NC\0"
+				"NCA\0"
+				"NCB\0"
+				"NCBS\0"
+				"NCI\0"
+				"NCLH\0"
+				"NCMI\0"
+				"NCNA\0"
+				"NCR\0"
+				"NCSM\0"
+				"NCTY\0"
+				"NCV\0"
+				"NCV^A\0"
+				"NCZ\0"
+				"NCZ^A\0"
+				"NDAQ\0"
+				"NDLS\0"
+				"NDP\0"
+				"NDRA\0"
+				"NDRAW\0"
+				"NDSN\0"
+				"NE\0"
+				"NEA\0"
+				"NEBU\0"
+				"NEBUU\0"
+				"NEBUW\0"
+				"NEE\0"
+				"NEE^I\0"
+				"NEE^J\0"
+				"NEE^K\0"
+				"NEE^N\0"
+				"NEE^O\0"
+				"NEM\0"
+				"NEN\0"
+				"NEO\0"
+				"NEOG\0"
+				"NEON\0"
+				"NEOS\0"
+				"NEP\0"
+				"NEPH\0"
+				"NEPT\0"
+				"NERV\0"
+				"NES\0"
+				"NESR\0"
+				"NESRW\0"
+				"NETE\0"
+				"NEU\0"
+				"NEV\0"
+				"NEW\0"
+				"NEWA\0"
+				"NEWM\0"
+				"NEWR\0"
+				"NEWT\0"
+				"NEWTI\0"
+				"NEWTL\0"
+				"NEXA\0"
+				"NEXT\0"
+				"NFBK\0"
+				"NFC\0"
+				"NFC.U\0"
+				"NFC.WS\0"
+				"NFE\0"
+				"NFG\0"
+				"NFIN\0"
+				"NFINU\0"
+				"NFINW\0"
+				"NFJ\0"
+				"NFLX\0"
+				"NFTY\0"
+				"NG\0"
+				"NGD\0"
+				"NGG\0"
+				"NGHC\0"
+				"NGHCN\0"
+				"NGHCO\0"
+				"NGHCP\0"
+				"NGHCZ\0"
+				"NGL\0"
+				"NGLS^A\0"
+				"NGL^B\0"
+				"NGL^C\0"
+				"NGM\0"
+				"NGS\0"
+				"NGVC\0"
+				"NGVT\0"
+				"NH\0"
+				"NHA\0"
+				"NHC\0"
+				"NHF\0"
+				"NHI\0"
+				"NHLD\0"
+				"NHLDW\0"
+				"NHS\0"
+				"NHTC\0"
+				"NI\0"
+				"NICE\0"
+				"NICK\0"
+				"NID\0"
+				"NIE\0"
+				"NIHD\0"
+				"NIM\0"
+				"NINE\0"
+				"NIO\0"
+				"NIQ\0"
+				"NIU\0"
+				"NI^B\0"
+				"NJR\0"
+				"NJV\0"
+				"NK\0"
+				"NKE\0"
+				"NKG\0"
+				"NKSH\0"
+				"NKTR\0"
+				"NKX\0"
+				"NL\0"
+				"NLNK\0"
+				"NLS\0"
+				"NLSN\0"
+				"NLTX\0"
+				"NLY\0"
+				"NLY^D\0"
+				"NLY^F\0"
+				"NLY^G\0"
+				"NLY^I\0"
+				"NM\0"
+				"NMCI\0"
+				"NMFC\0"
+				"NMFX\0"
+				"NMI\0"
+				"NMIH\0"
+				"NMK^B\0"
+				"NMK^C\0"
+				"NML\0"
+				"NMM\0"
+				"NMR\0"
+				"NMRD\0"
+				"NMRK\0"
+				"NMS\0"
+				"NMT\0"
+				"NMY\0"
+				"NMZ\0"
+				"NM^G\0"
+				"NM^H\0"
+				"NNA\0"
+				"NNBR\0"
+				"NNC\0"
+				"NNDM\0"
+				"NNI\0"
+				"NNN\0"
+				"NNN^E.CL\0"
+				"NNN^F\0"
+				"NNVC\0"
+				"NNY\0"
+				"NOA\0"
+				"NOAH\0"
+				"NOC\0"
+				"NODK\0"
+				"NOG\0"
+				"NOK\0"
+				"NOM\0"
+				"NOMD\0"
+				"NOV\0"
+				"NOVA\0"
+				"NOVN\0"
+				"NOVT\0"
+				"NOW\0"
+				"NP\0"
+				"NPAUU\0"
+				"NPK\0"
+				"NPN\0"
+				"NPO\0"
+				"NPTN\0"
+				"NPV\0"
+				"NQP\0"
+				"NR\0"
+				"NRC\0"
+				"NRCG\0"
+				"NRCG.WS\0"
+				"NRE\0"
+				"NRG\0"
+				"NRGX\0"
+				"NRIM\0"
+				"NRK\0"
+				"NRO\0"
+				"NRP\0"
+				"NRT\0"
+				"NRUC\0"
+				"NRZ\0"
+				"NRZ^A\0"
+				"NRZ^B\0"
+				"NS\0"
+				"NSA\0"
+				"NSA^A\0"
+				"NSC\0"
+				"NSCO\0"
+				"NSCO.WS\0"
+				"NSEC\0"
+				"NSIT\0"
+				"NSL\0"
+				"NSP\0"
+				"NSPR\0"
+				"NSPR.WS\0"
+				"NSPR.WS.B\0"
+				"NSS\0"
+				"NSSC\0"
+				"NSTG\0"
+				"NSYS\0"
+				"NS^A\0"
+				"NS^B\0"
+				"NS^C\0"
+				"NTAP\0"
+				"NTB\0"
+				"NTC\0"
+				"NTCT\0"
+				"NTEC\0"
+				"NTES\0"
+				"NTEST\0"
+				"NTEST.A\0"
+				"NTEST.B\0"
+				"NTEST.C\0"
+				"NTG\0"
+				"NTGN\0"
+				"NTGR\0"
+				"NTIC\0"
+				"NTIP\0"
+				"NTLA\0"
+				"NTN\0"
+				"NTNX\0"
+				"NTP\0"
+				"NTR\0"
+				"NTRA\0"
+				"NTRP\0"
+				"NTRS\0"
+				"NTRSP\0"
+				"NTUS\0"
+				"NTWK\0"
+				"NTX\0"
+				"NTZ\0"
+				"NUAN\0"
+				"NUE\0"
+				"NUM\0"
+				"NUO\0"
+				"NURO\0"
+				"NUROW\0"
+				"NUS\0"
+				"NUV\0"
+				"NUVA\0"
+				"NUW\0"
+				"NVAX\0"
+				"NVCN\0"
+				"NVCR\0"
+				"NVDA\0"
+				"NVEC\0"
+				"NVEE\0"
+				"NVFY\0"
+				"NVG\0"
+				"NVGS\0"
+				"NVIV\0"
+				"NVLN\0"
+				"NVMI\0"
+				"NVO\0"
+				"NVR\0"
+				"NVRO\0"
+				"NVS\0"
+				"NVT\0"
+				"NVTA\0"
+				"NVTR\0"
+				"NVUS\0"
+				"NWBI\0"
+				"NWE\0"
+				"NWFL\0"
+				"NWHM\0"
+				"NWL\0"
+				"NWLI\0"
+				"NWN\0"
+				"NWPX\0"
+				"NWS\0"
+				"NWSA\0"
+				"NX\0"
+				"NXC\0"
+				"NXE\0"
+				"NXGN\0"
+				"NXJ\0"
+				"NXMD\0"
+				"NXN\0"
+				"NXP\0"
+				"NXPI\0"
+				"NXQ\0"
+				"NXR\0"
+				"NXRT\0"
+				"NXST\0"
+				"NXTC\0"
+				"NXTD\0"
+				"NXTG\0"
+				"NYCB\0"
+				"NYCB^A\0"
+				"NYCB^U\0"
+				"NYMT\0"
+				"NYMTN\0"
+				"NYMTO\0"
+				"NYMTP\0"
+				"NYMX\0"
+				"NYNY\0"
+				"NYT\0"
+				"NYV\0"
+				"NZF\0"
+				"O\0"
+				"OAC\0"
+				"OAC.U\0"
+				"OAC.WS\0"
+				"OAK\0"
+				"OAK^A\0"
+				"OAK^B\0"
+				"OAS\0"
+				"OBAS\0"
+				"OBCI\0"
+				"OBE\0"
+				"OBLN\0"
+				"OBNK\0"
+				"OBSV\0"
+				"OC\0"
+				"OCC\0"
+				"OCCI\0"
+				"OCCIP\0"
+				"OCFC\0"
+				"OCN\0"
+				"OCSI\0"
+				"OCSL\0"
+				"OCSLL\0"
+				"OCUL\0"
+				"OCX\0"
+				"ODC\0"
+				"ODFL\0"
+				"ODP\0"
+				"ODT\0"
+				"OEC\0"
+				"OESX\0"
+				"OFC\0"
+				"OFED\0"
+				"OFG\0"
+				"OFG^A\0"
+				"OFG^B\0"
+				"OFG^D\0"
+				"OFIX\0"
+				"OFLX\0"
+				"OFS\0"
+				"OFSSL\0"
+				"OFSSZ\0"
+				"OGE\0"
+				"OGEN\0"
+				"OGI\0"
+				"OGS\0"
+				"OHAI\0"
+				"OHI\0"
+				"OI\0"
+				"OIA\0"
+				"OIBR.C\0"
+				"OII\0"
+				"OIIM\0"
+				"OIS\0"
+				"OKE\0"
+				"OKTA\0"
+				"OLBK\0"
+				"OLD\0"
+				"OLED\0"
+				"OLLI\0"
+				"OLN\0"
+				"OLP\0"
+				"OMAB\0"
+				"OMC\0"
+				"OMCL\0"
+				"OMER\0"
+				"OMEX\0"
+				"OMF\0"
+				"OMI\0"
+				"OMN\0"
+				"OMP\0"
+				"ON\0"
+				"ONB\0"
+				"ONCE\0"
+				"ONCS\0"
+				"ONCT\0"
+				"ONCY\0"
+				"ONDK\0"
+				"ONE\0"
+				"ONEQ\0"
+				"ONTX\0"
+				"ONTXW\0"
+				"ONVO\0"
+				"OOMA\0"
+				"OPB\0"
+				"OPBK\0"
+				"OPES\0"
+				"OPESU\0"
+				"OPESW\0"
+				"OPGN\0"
+				"OPGNW\0"
+				"OPHC\0"
+				"OPI\0"
+				"OPINI\0"
+				"OPK\0"
+				"OPNT\0"
+				"OPOF\0"
+				"OPP\0"
+				"OPRA\0"
+				"OPRX\0"
+				"OPTN\0"
+				"OPTT\0"
+				"OPY\0"
+				"OR\0"
+				"ORA\0"
+				"ORAN\0"
+				"ORBC\0"
+				"ORC\0"
+				"ORCC\0"
+				"ORCL\0"
+				"ORG\0"
+				"ORGO\0"
+				"ORGS\0"
+				"ORI\0"
+				"ORIT\0"
+				"ORLY\0"
+				"ORMP\0"
+				"ORN\0"
+				"ORRF\0"
+				"ORSNU\0"
+				"ORTX\0"
+				"OSB\0"
+				"OSBC\0"
+				"OSBCP\0"
+				"OSG\0"
+				"OSIS\0"
+				"OSK\0"
+				"OSLE\0"
+				"OSMT\0"
+				"OSN\0"
+				"OSPN\0"
+				"OSS\0"
+				"OSTK\0"
+				"OSUR\0"
+				"OSW\0"
+				"OTEL\0"
+				"OTEX\0"
+				"OTG\0"
+				"OTIC\0"
+				"OTIV\0"
+				"OTLK\0"
+				"OTLKW\0"
+				"OTTR\0"
+				"OTTW\0"
+				"OUT\0"
+				"OVBC\0"
+				"OVID\0"
+				"OVLY\0"
+				"OXBR\0"
+				"OXBRW\0"
+				"OXFD\0"
+				"OXLC\0"
+				"OXLCM\0"
+				"OXLCO\0"
+				"OXM\0"
+				"OXSQ\0"
+				"OXSQL\0"
+				"OXSQZ\0"
+				"OXY\0"
+				"OZK\0"
+				"PAA\0"
+				"PAAC\0"
+				"PAACR\0"
+				"PAACU\0"
+				"PAACW\0"
+				"PAAS\0"
+				"PAC\0"
+				"PACB\0"
+				"PACD\0"
+				"PACK\0"
+				"PACK.WS\0"
+				"PACQ\0"
+				"PACQU\0"
+				"PACQW\0"
+				"PACW\0"
+				"PAG\0"
+				"PAGP\0"
+				"PAGS\0"
+				"PAHC\0"
+				"PAI\0"
+				"PAM\0"
+				"PANL\0"
+				"PANW\0"
+				"PAR\0"
+				"PARR\0"
+				"PATI\0"
+				"PATK\0"
+				"PAVM\0"
+				"PAVMW\0"
+				"PAVMZ\0"
+				"PAYC\0"
+				"PAYS\0"
+				"PAYX\0"
+				"PB\0"
+				"PBA\0"
+				"PBB\0"
+				"PBBI\0"
+				"PBC\0"
+				"PBCT\0"
+				"PBCTP\0"
+				"PBF\0"
+				"PBFS\0"
+				"PBFX\0"
+				"PBH\0"
+				"PBHC\0"
+				"PBI\0"
+				"PBIO\0"
+				"PBIP\0"
+				"PBI^B\0"
+				"PBPB\0"
+				"PBR\0"
+				"PBR.A\0"
+				"PBT\0"
+				"PBTS\0"
+				"PBY\0"
+				"PBYI\0"
+				"PCAR\0"
+				"PCB\0"
+				"PCF\0"
+				"PCG\0"
+				"PCG^A\0"
+				"PCG^B\0"
+				"PCG^C\0"
+				"PCG^D\0"
+				"PCG^E\0"
+				"PCG^G\0"
+				"PCG^H\0"
+				"PCG^I\0"
+				"PCH\0"
+				"PCI\0"
+				"PCIM\0"
+				"PCK\0"
+				"PCM\0"
+				"PCN\0"
+				"PCOM\0"
+				"PCQ\0"
+				"PCRX\0"
+				"PCSB\0"
+				"PCTI\0"
+				"PCTY\0"
+				"PCYG\0"
+				"PCYO\0"
+				"PD\0"
+				"PDBC\0"
+				"PDCE\0"
+				"PDCO\0"
+				"PDD\0"
+				"PDEV\0"
+				"PDEX\0"
+				"PDFS\0"
+				"PDI\0"
+				"PDLB\0"
+				"PDLI\0"
+				"PDM\0"
+				"PDP\0"
+				"PDS\0"
+				"PDSB\0"
+				"PDT\0"
+				"PE\0"
+				"PEB\0"
+				"PEBK\0"
+				"PEBO\0"
+				"PEB^C\0"
+				"PEB^D\0"
+				"PEB^E\0"
+				"PEB^F\0"
+				"PECK\0"
+				"PED\0"
+				"PEER\0"
+				"PEG\0"
+				"PEGA\0"
+				"PEGI\0"
+				"PEI\0"
+				"PEIX\0"
+				"PEI^B\0"
+				"PEI^C\0"
+				"PEI^D\0"
+				"PEN\0"
+				"PENN\0"
+				"PEO\0"
+				"PEP\0"
+				"PER\0"
+				"PERI\0"
+				"PESI\0"
+				"PETQ\0"
+				"PETS\0"
+				"PETZ\0"
+				"PEY\0"
+				"PEZ\0"
+				"PFBC\0"
+				"PFBI\0"
+				"PFD\0"
+				"PFE\0"
+				"PFF\0"
+				"PFG\0"
+				"PFGC\0"
+				"PFH\0"
+				"PFI\0"
+				"PFIE\0"
+				"PFIN\0"
+				"PFIS\0"
+				"PFL\0"
+				"PFLT\0"
+				"PFM\0"
+				"PFMT\0"
+				"PFN\0"
+				"PFNX\0"
+				"PFO\0"
+				"PFPT\0"
+				"PFS\0"
+				"PFSI\0"
+				"PFSW\0"
+				"PG\0"
+				"PGC\0"
+				"PGJ\0"
+				"PGNX\0"
+				"PGP\0"
+				"PGR\0"
+				"PGRE\0"
+				"PGTI\0"
+				"PGZ\0"
+				"PH\0"
+				"PHAS\0"
+				"PHCF\0"
+				"PHD\0"
+				"PHG\0"
+				"PHI\0"
+				"PHIO\0"
+				"PHIOW\0"
+				"PHK\0"
+				"PHM\0"
+				"PHO\0"
+				"PHR\0"
+				"PHT\0"
+				"PHUN\0"
+				"PHUNW\0"
+				"PHX\0"
+				"PI\0"
+				"PIC\0"
+				"PIC.U\0"
+				"PIC.WS\0"
+				"PICO\0"
+				"PID\0"
+				"PIE\0"
+				"PIH\0"
+				"PIHPP\0"
+				"PII\0"
+				"PIM\0"
+				"PINC\0"
+				"PINS\0"
+				"PIO\0"
+				"PIR\0"
+				"PIRS\0"
+				"PIXY\0"
+				"PIY\0"
+				"PIZ\0"
+				"PJC\0"
+				"PJH\0"
+				"PJT\0"
+				"PK\0"
+				"PKBK\0"
+				"PKD\0"
+				"PKE\0"
+				"PKG\0"
+				"PKI\0"
+				"PKO\0"
+				"PKOH\0"
+				"PKW\0"
+				"PKX\0"
+				"PLAB\0"
+				"PLAG\0"
+				"PLAN\0"
+				"PLAY\0"
+				"PLBC\0"
+				"PLC\0"
+				"PLCE\0"
+				"PLD\0"
+				"PLG\0"
+				"PLIN\0"
+				"PLL\0"
+				"PLM\0"
+				"PLMR\0"
+				"PLNT\0"
+				"PLOW\0"
+				"PLPC\0"
+				"PLSE\0"
+				"PLT\0"
+				"PLUG\0"
+				"PLUS\0"
+				"PLW\0"
+				"PLX\0"
+				"PLXP\0"
+				"PLXS\0"
+				"PLYA\0"
+				"PLYM\0"
+				"PLYM^A\0"
+				"PM\0"
+				"PMBC\0"
+				"PMD\0"
+				"PME\0"
+				"PMF\0"
+				"PML\0"
+				"PMM\0"
+				"PMO\0"
+				"PMOM\0"
+				"PMT\0"
+				"PMTS\0"
+				"PMT^A\0"
+				"PMT^B\0"
+				"PMX\0"
+				"PNBK\0"
+				"PNC\0"
+				"PNC^P\0"
+				"PNC^Q\0"
+				"PNF\0"
+				"PNFP\0"
+				"PNI\0"
+				"PNM\0"
+				"PNNT\0"
+				"PNQI\0"
+				"PNR\0"
+				"PNRG\0"
+				"PNRL\0"
+				"PNTR\0"
+				"PNW\0"
+				"POAI\0"
+				"PODD\0"
+				"POL\0"
+				"POLA\0"
+				"POLY\0"
+				"POOL\0"
+				"POPE\0"
+				"POR\0"
+				"POST\0"
+				"POWI\0"
+				"POWL\0"
+				"PPBI\0"
+				"PPC\0"
+				"PPDF\0"
+				"PPG\0"
+				"PPH\0"
+				"PPHI\0"
+				"PPIH\0"
+				"PPL\0"
+				"PPR\0"
+				"PPSI\0"
+				"PPT\0"
+				"PPX\0"
+				"PQG\0"
+				"PRA\0"
+				"PRAA\0"
+				"PRAH\0"
+				"PRCP\0"
+				"PRE^F\0"
+				"PRE^G\0"
+				"PRE^H\0"
+				"PRE^I\0"
+				"PRFT\0"
+				"PRFZ\0"
+				"PRGO\0"
+				"PRGS\0"
+				"PRGX\0"
+				"PRH\0"
+				"PRI\0"
+				"PRIF^A\0"
+				"PRIF^B\0"
+				"PRIF^C\0"
+				"PRIF^D\0"
+				"PRIM\0"
+				"PRK\0"
+				"PRLB\0"
+				"PRMW\0"
+				"PRN\0"
+				"PRNB\0"
+				"PRO\0"
+				"PROS\0"
+				"PROV\0"
+				"PRPH\0"
+				"PRPL\0"
+				"PRPO\0"
+				"PRQR\0"
+				"PRS\0"
+				"PRSC\0"
+				"PRSP\0"
+				"PRT\0"
+				"PRTA\0"
+				"PRTH\0"
+				"PRTK\0"
+				"PRTO\0"
+				"PRTS\0"
+				"PRTY\0"
+				"PRU\0"
+				"PRVB\0"
+				"PRVL\0"
+				"PS\0"
+				"PSA\0"
+				"PSA^A\0"
+				"PSA^B\0"
+				"PSA^C\0"
+				"PSA^D\0"
+				"PSA^E\0"
+				"PSA^F\0"
+				"PSA^G\0"
+				"PSA^H\0"
+				"PSA^V\0"
+				"PSA^W\0"
+				"PSA^X\0"
+				"PSB\0"
+				"PSB^U\0"
+				"PSB^V\0"
+				"PSB^W\0"
+				"PSB^X\0"
+				"PSB^Y\0"
+				"PSC\0"
+				"PSCC\0"
+				"PSCD\0"
+				"PSCE\0"
+				"PSCF\0"
+				"PSCH\0"
+				"PSCI\0"
+				"PSCM\0"
+				"PSCT\0"
+				"PSCU\0"
+				"PSDO\0"
+				"PSEC\0"
+				"PSET\0"
+				"PSF\0"
+				"PSL\0"
+				"PSM\0"
+				"PSMT\0"
+				"PSN\0"
+				"PSNL\0"
+				"PSO\0"
+				"PSTG\0"
+				"PSTI\0"
+				"PSTL\0"
+				"PSTV\0"
+				"PSTVZ\0"
+				"PSV\0"
+				"PSX\0"
+				"PSXP\0"
+				"PT\0"
+				"PTC\0"
+				"PTCT\0"
+				"PTE\0"
+				"PTEN\0"
+				"PTF\0"
+				"PTGX\0"
+				"PTH\0"
+				"PTI\0"
+				"PTLA\0"
+				"PTMN\0"
+				"PTN\0"
+				"PTNR\0"
+				"PTR\0"
+				"PTSI\0"
+				"PTVCA\0"
+				"PTVCB\0"
+				"PTY\0"
+				"PUB\0"
+				"PUI\0"
+				"PUK\0"
+				"PUK^\0"
+				"PUK^A\0"
+				"PULM\0"
+				"PUMP\0"
+				"PUYI\0"
+				"PVAC\0"
+				"PVAL\0"
+				"PVBC\0"
+				"PVG\0"
+				"PVH\0"
+				"PVL\0"
+				"PVT\0"
+				"PVT.U\0"
+				"PVT.WS\0"
+				"PVTL\0"
+				"PW\0"
+				"PWOD\0"
+				"PWR\0"
+				"PW^A\0"
+				"PXD\0"
+				"PXI\0"
+				"PXLW\0"
+				"PXS\0"
+				"PY\0"
+				"PYN\0"
+				"PYPL\0"
+				"PYS\0"
+				"PYT\0"
+				"PYX\0"
+				"PYZ\0"
+				"PZC\0"
+				"PZG\0"
+				"PZN\0"
+				"PZZA\0"
+				"QABA\0"
+				"QADA\0"
+				"QADB\0"
+				"QAT\0"
+				"QBAK\0"
+				"QCLN\0"
+				"QCOM\0"
+				"QCRH\0"
+				"QD\0"
+				"QDEL\0"
+				"QEP\0"
+				"QES\0"
+				"QFIN\0"
+				"QGEN\0"
+				"QHC\0"
+				"QIWI\0"
+				"QLC\0"
+				"QLYS\0"
+				"QNST\0"
+				"QQEW\0"
+				"QQQ\0"
+				"QQQX\0"
+				"QQXT\0"
+				"QRHC\0"
+				"QRTEA\0"
+				"QRTEB\0"
+				"QRVO\0"
+				"QSR\0"
+				"QTEC\0"
+				"QTNT\0"
+				"QTRH\0"
+				"QTRX\0"
+				"QTS\0"
+				"QTS^A\0"
+				"QTS^B\0"
+				"QTT\0"
+				"QTWO\0"
+				"QUAD\0"
+				"QUIK\0"
+				"QUMU\0"
+				"QUOT\0"
+				"QURE\0"
+				"QVCD\0"
+				"QYLD\0"
+				"R\0"
+				"RA\0"
+				"RACE\0"
+				"RAD\0"
+				"RADA\0"
+				"RAIL\0"
+				"RAMP\0"
+				"RAND\0"
+				"RAPT\0"
+				"RARE\0"
+				"RARX\0"
+				"RAVE\0"
+				"RAVN\0"
+				"RBA\0"
+				"RBB\0"
+				"RBBN\0"
+				"RBC\0"
+				"RBCAA\0"
+				"RBCN\0"
+				"RBKB\0"
+				"RBNC\0"
+				"RBS\0"
+				"RBZ\0"
+				"RC\0"
+				"RCA\0"
+				"RCB\0"
+				"RCG\0"
+				"RCI\0"
+				"RCII\0"
+				"RCKT\0"
+				"RCKY\0"
+				"RCL\0"
+				"RCM\0"
+				"RCMT\0"
+				"RCON\0"
+				"RCP\0"
+				"RCS\0"
+				"RCUS\0"
+				"RDCM\0"
+				"RDFN\0"
+				"RDHL\0"
+				"RDI\0"
+				"RDIB\0"
+				"RDN\0"
+				"RDNT\0"
+				"RDS.A\0"
+				"RDS.B\0"
+				"RDUS\0"
+				"RDVT\0"
+				"RDVY\0"
+				"RDWR\0"
+				"RDY\0"
+				"RE\0"
+				"REAL\0"
+				"RECN\0"
+				"REDU\0"
+				"REED\0"
+				"REFR\0"
+				"REG\0"
+				"REGI\0"
+				"REGN\0"
+				"REI\0"
+				"REKR\0"
+				"RELL\0"
+				"RELV\0"
+				"RELX\0"
+				"RENN\0"
+				"REPH\0"
+				"REPL\0"
+				"RES\0"
+				"RESI\0"
+				"RESN\0"
+				"RETA\0"
+				"RETO\0"
+				"REV\0"
+				"REVG\0"
+				"REX\0"
+				"REXN\0"
+				"REXR\0"
+				"REXR^A\0"
+				"REXR^B\0"
+				"REZI\0"
+				"RF\0"
+				"RFAP\0"
+				"RFDI\0"
+				"RFEM\0"
+				"RFEU\0"
+				"RFI\0"
+				"RFIL\0"
+				"RFL\0"
+				"RFP\0"
+				"RF^A\0"
+				"RF^B\0"
+				"RF^C\0"
+				"RGA\0"
+				"RGCO\0"
+				"RGEN\0"
+				"RGLD\0"
+				"RGLS\0"
+				"RGNX\0"
+				"RGR\0"
+				"RGS\0"
+				"RGT\0"
+				"RH\0"
+				"RHE\0"
+				"RHE^A\0"
+				"RHI\0"
+				"RHP\0"
+				"RIBT\0"
+				"RICK\0"
+				"RIF\0"
+				"RIG\0"
+				"RIGL\0"
+				"RILY\0"
+				"RILYG\0"
+				"RILYH\0"
+				"RILYI\0"
+				"RILYL\0"
+				"RILYO\0"
+				"RILYZ\0"
+				"RING\0"
+				"RIO\0"
+				"RIOT\0"
+				"RIV\0"
+				"RIVE\0"
+				"RJF\0"
+				"RKDA\0"
+				"RL\0"
+				"RLGT\0"
+				"RLGY\0"
+				"RLH\0"
+				"RLI\0"
+				"RLJ\0"
+				"RLJ^A\0"
+				"RM\0"
+				"RMAX\0"
+				"RMBI\0"
+				"RMBL\0"
+				"RMBS\0"
+				"RMCF\0"
+				"RMD\0"
+				"RMED\0"
+				"RMG\0"
+				"RMG.U\0"
+				"RMG.WS\0"
+				"RMI\0"
+				"RMM\0"
+				"RMNI\0"
+				"RMPL^\0"
+				"RMR\0"
+				"RMT\0"
+				"RMTI\0"
+				"RNDB\0"
+				"RNDM\0"
+				"RNDV\0"
+				"RNEM\0"
+				"RNET\0"
+				"RNG\0"
+				"RNGR\0"
+				"RNLC\0"
+				"RNMC\0"
+				"RNP\0"
+				"RNR\0"
+				"RNR^C\0"
+				"RNR^E\0"
+				"RNR^F\0"
+				"RNSC\0"
+				"RNST\0"
+				"RNWK\0"
+				"ROAD\0"
+				"ROAN\0"
+				"ROBO\0"
+				"ROBT\0"
+				"ROCK\0"
+				"ROG\0"
+				"ROIC\0"
+				"ROK\0"
+				"ROKU\0"
+				"ROL\0"
+				"ROLL\0"
+				"ROP\0"
+				"ROSE\0"
+				"ROSEU\0"
+				"ROSEW\0"
+				"ROST\0"
+				"ROX\0"
+				"ROYT\0"
+				"RP\0"
+				"RPAI\0"
+				"RPAY\0"
+				"RPD\0"
+				"RPLA\0"
+				"RPLA.U\0"
+				"RPLA.WS\0"
+				"RPM\0"
+				"RPT\0"
+				"RPT^D\0"
+				"RQI\0"
+				"RRBI\0"
+				"RRC\0"
+				"RRD\0"
+				"RRGB\0"
+				"RRR\0"
+				"RRTS\0"
+				"RS\0"
+				"RSF\0"
+				"RSG\0"
+				"RST\0"
+				"RTEC\0"
+				"RTIX\0"
+				"RTLR\0"
+				"RTN\0"
+				"RTRX\0"
+				"RTTR\0"
+				"RTW\0"
+				"RUBI\0"
+				"RUBY\0"
+				"RUHN\0"
+				"RUN\0"
+				"RUSHA\0"
+				"RUSHB\0"
+				"RUTH\0"
+				"RVEN\0"
+				"RVI\0"
+				"RVLT\0"
+				"RVLV\0"
+				"RVNC\0"
+				"RVP\0"
+				"RVSB\0"
+				"RVT\0"
+				"RWGE\0"
+				"RWGE.U\0"
+				"RWGE.WS\0"
+				"RWLK\0"
+				"RWT\0"
+				"RXN\0"
+				"RXN^A\0"
+				"RY\0"
+				"RYAAY\0"
+				"RYAM\0"
+				"RYB\0"
+				"RYI\0"
+				"RYN\0"
+				"RYTM\0"
+				"RY^T\0"
+				"RZA\0"
+				"RZB\0"
+				"S\0"
+				"SA\0"
+				"SAB\0"
+				"SABR\0"
+				"SACH\0"
+				"SAEX\0"
+				"SAF\0"
+				"SAFE\0"
+				"SAFM\0"
+				"SAFT\0"
+				"SAGE\0"
+				"SAH\0"
+				"SAIA\0"
+				"SAIC\0"
+				"SAIL\0"
+				"SAL\0"
+				"SALM\0"
+				"SALT\0"
+				"SAM\0"
+				"SAMA\0"
+				"SAMAU\0"
+				"SAMAW\0"
+				"SAMG\0"
+				"SAN\0"
+				"SAND\0"
+				"SANM\0"
+				"SANW\0"
+				"SAN^B\0"
+				"SAP\0"
+				"SAR\0"
+				"SASR\0"
+				"SATS\0"
+				"SAUC\0"
+				"SAVA\0"
+				"SAVE\0"
+				"SB\0"
+				"SBAC\0"
+				"SBBP\0"
+				"SBBX\0"
+				"SBCF\0"
+				"SBE.U\0"
+				"SBFG\0"
+				"SBFGP\0"
+				"SBGI\0"
+				"SBGL\0"
+				"SBH\0"
+				"SBI\0"
+				"SBLK\0"
+				"SBLKZ\0"
+				"SBNA\0"
+				"SBNY\0"
+				"SBOW\0"
+				"SBPH\0"
+				"SBR\0"
+				"SBRA\0"
+				"SBS\0"
+				"SBSI\0"
+				"SBT\0"
+				"SBUX\0"
+				"SB^C\0"
+				"SB^D\0"
+				"SC\0"
+				"SCA\0"
+				"SCCB\0"
+				"SCCI\0"
+				"SCCO\0"
+				"SCD\0"
+				"SCE^B\0"
+				"SCE^C\0"
+				"SCE^D\0"
+				"SCE^E\0"
+				"SCE^G\0"
+				"SCE^H\0"
+				"SCE^J\0"
+				"SCE^K\0"
+				"SCE^L\0"
+				"SCHL\0"
+				"SCHN\0"
+				"SCHW\0"
+				"SCHW^C\0"
+				"SCHW^D\0"
+				"SCI\0"
+				"SCKT\0"
+				"SCL\0"
+				"SCM\0"
+				"SCON\0"
+				"SCOR\0"
+				"SCPE\0"
+				"SCPE.U\0"
+				"SCPE.WS\0"
+				"SCPH\0"
+				"SCPL\0"
+				"SCS\0"
+				"SCSC\0"
+				"SCVL\0"
+				"SCWX\0"
+				"SCX\0"
+				"SCYX\0"
+				"SCZ\0"
+				"SD\0"
+				"SDC\0"
+				"SDG\0"
+				"SDI\0"
+				"SDPI\0"
+				"SDR\0"
+				"SDRL\0"
+				"SDT\0"
+				"SDVY\0"
+				"SE\0"
+				"SEAC\0"
+				"SEAS\0"
+				"SEB\0"
+				"SECO\0"
+				"SEDG\0"
+				"SEE\0"
+				"SEED\0"
+				"SEEL\0"
+				"SEIC\0"
+				"SELB\0"
+				"SELF\0"
+				"SEM\0"
+				"SEMG\0"
+				"SENEA\0"
+				"SENEB\0"
+				"SENS\0"
+				"SERV\0"
+				"SES\0"
+				"SESN\0"
+				"SF\0"
+				"SFB\0"
+				"SFBC\0"
+				"SFBS\0"
+				"SFE\0"
+				"SFET\0"
+				"SFIX\0"
+				"SFL\0"
+				"SFLY\0"
+				"SFM\0"
+				"SFNC\0"
+				"SFST\0"
+				"SFUN\0"
+				"SF^A\0"
+				"SF^B\0"
+				"SG\0"
+				"SGA\0"
+				"SGB\0"
+				"SGBX\0"
+				"SGC\0"
+				"SGEN\0"
+				"SGH\0"
+				"SGLB\0"
+				"SGLBW\0"
+				"SGMA\0"
+				"SGMO\0"
+				"SGMS\0"
+				"SGOC\0"
+				"SGRP\0"
+				"SGRY\0"
+				"SGU\0"
+				"SHAK\0"
+				"SHBI\0"
+				"SHEN\0"
+				"SHG\0"
+				"SHI\0"
+				"SHIP\0"
+				"SHIPW\0"
+				"SHIPZ\0"
+				"SHLL\0"
+				"SHLL.U\0"
+				"SHLL.WS\0"
+				"SHLO\0"
+				"SHLX\0"
+				"SHO\0"
+				"SHOO\0"
+				"SHOP\0"
+				"SHOS\0"
+				"SHO^E\0"
+				"SHO^F\0"
+				"SHSP\0"
+				"SHV\0"
+				"SHW\0"
+				"SHY\0"
+				"SIBN\0"
+				"SIC\0"
+				"SID\0"
+				"SIEB\0"
+				"SIEN\0"
+				"SIF\0"
+				"SIFY\0"
+				"SIG\0"
+				"SIGA\0"
+				"SIGI\0"
+				"SILC\0"
+				"SILK\0"
+				"SILV\0"
+				"SIM\0"
+				"SIMO\0"
+				"SINA\0"
+				"SINO\0"
+				"SINT\0"
+				"SIRI\0"
+				"SITC\0"
+				"SITC^A\0"
+				"SITC^J\0"
+				"SITC^K\0"
+				"SITE\0"
+				"SITO\0"
+				"SIVB\0"
+				"SIX\0"
+				"SJI\0"
+				"SJIU\0"
+				"SJM\0"
+				"SJR\0"
+				"SJT\0"
+				"SJW\0"
+				"SKIS\0"
+				"SKM\0"
+				"SKOR\0"
+				"SKT\0"
+				"SKX\0"
+				"SKY\0"
+				"SKYS\0"
+				"SKYW\0"
+				"SKYY\0"
+				"SLAB\0"
+				"SLB\0"
+				"SLCA\0"
+				"SLCT\0"
+				"SLDB\0"
+				"SLF\0"
+				"SLG\0"
+				"SLGG\0"
+				"SLGL\0"
+				"SLGN\0"
+				"SLG^I\0"
+				"SLIM\0"
+				"SLM\0"
+				"SLMBP\0"
+				"SLNG\0"
+				"SLNO\0"
+				"SLNOW\0"
+				"SLP\0"
+				"SLQD\0"
+				"SLRC\0"
+				"SLRX\0"
+				"SLS\0"
+				"SLVO\0"
+				"SM\0"
+				"SMAR\0"
+				"SMBC\0"
+				"SMBK\0"
+				"SMCP\0"
+				"SMED\0"
+				"SMFG\0"
+				"SMG\0"
+				"SMHI\0"
+				"SMIT\0"
+				"SMLP\0"
+				"SMM\0"
+				"SMMC\0"
+				"SMMCU\0"
+				"SMMCW\0"
+				"SMMF\0"
+				"SMMT\0"
+				"SMP\0"
+				"SMPL\0"
+				"SMRT\0"
+				"SMSI\0"
+				"SMTA\0"
+				"SMTC\0"
+				"SMTS\0"
+				"SMTX\0"
+				"SNA\0"
+				"SNAP\0"
+				"SNBR\0"
+				"SNCR\0"
+				"SND\0"
+				"SNDE\0"
+				"SNDL\0"
+				"SNDR\0"
+				"SNDX\0"
+				"SNE\0"
+				"SNES\0"
+				"SNFCA\0"
+				"SNGX\0"
+				"SNGXW\0"
+				"SNH\0"
+				"SNHNI\0"
+				"SNHNL\0"
+				"SNLN\0"
+				"SNMP\0"
+				"SNN\0"
+				"SNNA\0"
+				"SNOA\0"
+				"SNOAW\0"
+				"SNP\0"
+				"SNPS\0"
+				"SNR\0"
+				"SNSR\0"
+				"SNSS\0"
+				"SNV\0"
+				"SNV^D\0"
+				"SNV^E\0"
+				"SNX\0"
+				"SNY\0"
+				"SO\0"
+				"SOCL\0"
+				"SOGO\0"
+				"SOHO\0"
+				"SOHOB\0"
+				"SOHON\0"
+				"SOHOO\0"
+				"SOHU\0"
+				"SOI\0"
+				"SOJA\0"
+				"SOJB\0"
+				"SOJC\0"
+				"SOL\0"
+				"SOLN\0"
+				"SOLO\0"
+				"SOLOW\0"
+				"SOLY\0"
+				"SON\0"
+				"SONA\0"
+				"SONG\0"
+				"SONGW\0"
+				"SONM\0"
+				"SONO\0"
+				"SOR\0"
+				"SORL\0"
+				"SOXX\0"
+				"SP\0"
+				"SPAQ\0"
+				"SPAQ.U\0"
+				"SPAQ.WS\0"
+				"SPAR\0"
+				"SPB\0"
+				"SPCB\0"
+				"SPE\0"
+				"SPEX\0"
+				"SPE^B\0"
+				"SPFI\0"
+				"SPG\0"
+				"SPGI\0"
+				"SPG^J\0"
+				"SPH\0"
+				"SPHS\0"
+				"SPI\0"
+				"SPKE\0"
+				"SPKEP\0"
+				"SPLK\0"
+				"SPLP\0"
+				"SPLP^A\0"
+				"SPN\0"
+				"SPNE\0"
+				"SPNS\0"
+				"SPOK\0"
+				"SPOT\0"
+				"SPPI\0"
+				"SPR\0"
+				"SPRO\0"
+				"SPRT\0"
+				"SPSC\0"
+				"SPTN\0"
+				"SPWH\0"
+				"SPWR\0"
+				"SPXC\0"
+				"SPXX\0"
+				"SQ\0"
+				"SQBG\0"
+				"SQLV\0"
+				"SQM\0"
+				"SQNS\0"
+				"SQQQ\0"
+				"SR\0"
+				"SRAX\0"
+				"SRC\0"
+				"SRCE\0"
+				"SRCI\0"
+				"SRCL\0"
+				"SRC^A\0"
+				"SRDX\0"
+				"SRE\0"
+				"SREA\0"
+				"SRET\0"
+				"SREV\0"
+				"SRE^A\0"
+				"SRE^B\0"
+				"SRF\0"
+				"SRG\0"
+				"SRG^A\0"
+				"SRI\0"
+				"SRL\0"
+				"SRLP\0"
+				"SRNE\0"
+				"SRPT\0"
+				"SRRA\0"
+				"SRRK\0"
+				"SRT\0"
+				"SRTS\0"
+				"SRTSW\0"
+				"SRV\0"
+				"SRVA\0"
+				"SR^A\0"
+				"SSB\0"
+				"SSBI\0"
+				"SSD\0"
+				"SSFN\0"
+				"SSI\0"
+				"SSKN\0"
+				"SSL\0"
+				"SSNC\0"
+				"SSNT\0"
+				"SSP\0"
+				"SSPKU\0"
+				"SSRM\0"
+				"SSSS\0"
+				"SSTI\0"
+				"SSTK\0"
+				"SSW\0"
+				"SSWA\0"
+				"SSW^D\0"
+				"SSW^E\0"
+				"SSW^G\0"
+				"SSW^H\0"
+				"SSW^I\0"
+				"SSY\0"
+				"SSYS\0"
+				"ST\0"
+				"STAA\0"
+				"STAF\0"
+				"STAG\0"
+				"STAG^C\0"
+				"STAR\0"
+				"STAR^D\0"
+				"STAR^G\0"
+				"STAR^I\0"
+				"STAY\0"
+				"STBA\0"
+				"STC\0"
+				"STCN\0"
+				"STE\0"
+				"STFC\0"
+				"STG\0"
+				"STI\0"
+				"STIM\0"
+				"STI^A\0"
+				"STK\0"
+				"STKL\0"
+				"STKS\0"
+				"STL\0"
+				"STLD\0"
+				"STL^A\0"
+				"STM\0"
+				"STML\0"
+				"STMP\0"
+				"STN\0"
+				"STND\0"
+				"STNE\0"
+				"STNG\0"
+				"STNL\0"
+				"STNLU\0"
+				"STNLW\0"
+				"STOK\0"
+				"STON\0"
+				"STOR\0"
+				"STPP\0"
+				"STRA\0"
+				"STRL\0"
+				"STRM\0"
+				"STRO\0"
+				"STRS\0"
+				"STRT\0"
+				"STT\0"
+				"STT^C\0"
+				"STT^D\0"
+				"STT^E\0"
+				"STT^G\0"
+				"STWD\0"
+				"STX\0"
+				"STXB\0"
+				"STXS\0"
+				"STZ\0"
+				"STZ.B\0"
+				"SU\0"
+				"SUI\0"
+				"SUM\0"
+				"SUMR\0"
+				"SUN\0"
+				"SUNS\0"
+				"SUNW\0"
+				"SUP\0"
+				"SUPN\0"
+				"SUPV\0"
+				"SURF\0"
+				"SUSB\0"
+				"SUSC\0"
+				"SUSL\0"
+				"SUZ\0"
+				"SVA\0"
+				"SVBI\0"
+				"SVM\0"
+				"SVMK\0"
+				"SVRA\0"
+				"SVT\0"
+				"SVVC\0"
+				"SWAV\0"
+				"SWCH\0"
+				"SWI\0"
+				"SWIR\0"
+				"SWJ\0"
+				"SWK\0"
+				"SWKS\0"
+				"SWM\0"
+				"SWN\0"
+				"SWP\0"
+				"SWTX\0"
+				"SWX\0"
+				"SWZ\0"
+				"SXC\0"
+				"SXI\0"
+				"SXT\0"
+				"SXTC\0"
+				"SY\0"
+				"SYBT\0"
+				"SYBX\0"
+				"SYF\0"
+				"SYK\0"
+				"SYKE\0"
+				"SYMC\0"
+				"SYN\0"
+				"SYNA\0"
+				"SYNC\0"
+				"SYNH\0"
+				"SYNL\0"
+				"SYPR\0"
+				"SYRS\0"
+				"SYX\0"
+				"SYY\0"
+				"SZC\0"
+				"T\0"
+				"TA\0"
+				"TAC\0"
+				"TACO\0"
+				"TACOW\0"
+				"TACT\0"
+				"TAIT\0"
+				"TAK\0"
+				"TAL\0"
+				"TALO\0"
+				"TALO.WS\0"
+				"TANH\0"
+				"TANNI\0"
+				"TANNL\0"
+				"TANNZ\0"
+				"TAOP\0"
+				"TAP\0"
+				"TAP.A\0"
+				"TAPR\0"
+				"TARO\0"
+				"TAST\0"
+				"TAT\0"
+				"TATT\0"
+				"TAYD\0"
+				"TBB\0"
+				"TBBK\0"
+				"TBC\0"
+				"TBI\0"
+				"TBIO\0"
+				"TBK\0"
+				"TBLT\0"
+				"TBLTU\0"
+				"TBLTW\0"
+				"TBNK\0"
+				"TBPH\0"
+				"TC\0"
+				"TCBI\0"
+				"TCBIL\0"
+				"TCBIP\0"
+				"TCBK\0"
+				"TCCO\0"
+				"TCDA\0"
+				"TCF\0"
+				"TCFC\0"
+				"TCFCP\0"
+				"TCGP\0"
+				"TCI\0"
+				"TCMD\0"
+				"TCO\0"
+				"TCON\0"
+				"TCO^J\0"
+				"TCO^K\0"
+				"TCP\0"
+				"TCPC\0"
+				"TCRD\0"
+				"TCRR\0"
+				"TCRW\0"
+				"TCRZ\0"
+				"TCS\0"
+				"TCX\0"
+				"TD\0"
+				"TDA\0"
+				"TDAC\0"
+				"TDACU\0"
+				"TDACW\0"
+				"TDC\0"
+				"TDE\0"
+				"TDF\0"
+				"TDG\0"
+				"TDI\0"
+				"TDIV\0"
+				"TDJ\0"
+				"TDOC\0"
+				"TDS\0"
+				"TDW\0"
+				"TDW.WS\0"
+				"TDW.WS.A\0"
+				"TDW.WS.B\0"
+				"TDY\0"
+				"TEAF\0"
+				"TEAM\0"
+				"TECD\0"
+				"TECH\0"
+				"TECK\0"
+				"TECTP\0"
+				"TEDU\0"
+				"TEF\0"
+				"TEI\0"
+				"TEL\0"
+				"TELL\0"
+				"TEN\0"
+				"TENB\0"
+				"TENX\0"
+				"TEO\0"
+				"TER\0"
+				"TERP\0"
+				"TESS\0"
+				"TEUM\0"
+				"TEVA\0"
+				"TEX\0"
+				"TFSL\0"
+				"TFX\0"
+				"TG\0"
+				"TGA\0"
+				"TGB\0"
+				"TGC\0"
+				"TGE\0"
+				"TGEN\0"
+				"TGH\0"
+				"TGI\0"
+				"TGLS\0"
+				"TGNA\0"
+				"TGP\0"
+				"TGP^A\0"
+				"TGP^B\0"
+				"TGS\0"
+				"TGT\0"
+				"TGTX\0"
+				"TH\0"
+				"THBRU\0"
+				"THC\0"
+				"THCA\0"
+				"THCAU\0"
+				"THCAW\0"
+				"THCB\0"
+				"THCBU\0"
+				"THCBW\0"
+				"THFF\0"
+				"THG\0"
+				"THGA\0"
+				"THM\0"
+				"THO\0"
+				"THOR\0"
+				"THQ\0"
+				"THR\0"
+				"THRM\0"
+				"THS\0"
+				"THW\0"
+				"THWWW\0"
+				"TIBR\0"
+				"TIBRU\0"
+				"TIBRW\0"
+				"TIF\0"
+				"TIGO\0"
+				"TIGR\0"
+				"TILE\0"
+				"TIPT\0"
+				"TISI\0"
+				"TITN\0"
+				"TIVO\0"
+				"TJX\0"
+				"TK\0"
+				"TKAT\0"
+				"TKC\0"
+				"TKKS\0"
+				"TKKSR\0"
+				"TKKSU\0"
+				"TKKSW\0"
+				"TKR\0"
+				"TLC\0"
+				"TLF\0"
+				"TLGT\0"
+				"TLI\0"
+				"TLK\0"
+				"TLND\0"
+				"TLRA\0"
+				"TLRD\0"
+				"TLRY\0"
+				"TLSA\0"
+				"TLT\0"
+				"TLYS\0"
+				"TM\0"
+				"TMCX\0"
+				"TMCXU\0"
+				"TMCXW\0"
+				"TMDI\0"
+				"TMDX\0"
+				"TME\0"
+				"TMHC\0"
+				"TMO\0"
+				"TMP\0"
+				"TMQ\0"
+				"TMSR\0"
+				"TMST\0"
+				"TMUS\0"
+				"TNAV\0"
+				"TNC\0"
+				"TNDM\0"
+				"TNET\0"
+				"TNK\0"
+				"TNP\0"
+				"TNP^C\0"
+				"TNP^D\0"
+				"TNP^E\0"
+				"TNP^F\0"
+				"TNXP\0"
+				"TOCA\0"
+				"TOL\0"
+				"TOO\0"
+				"TOO^A\0"
+				"TOO^B\0"
+				"TOO^E\0"
+				"TOPS\0"
+				"TORC\0"
+				"TOT\0"
+				"TOTA\0"
+				"TOTAR\0"
+				"TOTAU\0"
+				"TOTAW\0"
+				"TOUR\0"
+				"TOWN\0"
+				"TOWR\0"
+				"TPB\0"
+				"TPC\0"
+				"TPCO\0"
+				"TPGH\0"
+				"TPGH.U\0"
+				"TPGH.WS\0"
+				"TPH\0"
+				"TPHS\0"
+				"TPIC\0"
+				"TPL\0"
+				"TPR\0"
+				"TPRE\0"
+				"TPTX\0"
+				"TPVG\0"
+				"TPVY\0"
+				"TPX\0"
+				"TPZ\0"
+				"TQQQ\0"
+				"TR\0"
+				"TRC\0"
+				"TRCB\0"
+				"TRCH\0"
+				"TRCO\0"
+				"TREC\0"
+				"TREE\0"
+				"TREX\0"
+				"TRGP\0"
+				"TRHC\0"
+				"TRI\0"
+				"TRIB\0"
+				"TRIL\0"
+				"TRIP\0"
+				"TRK\0"
+				"TRMB\0"
+				"TRMD\0"
+				"TRMK\0"
+				"TRMT\0"
+				"TRN\0"
+				"TRNE\0"
+				"TRNE.U\0"
+				"TRNE.WS\0"
+				"TRNO\0"
+				"TRNS\0"
+				"TRNX\0"
+				"TROV\0"
+				"TROW\0"
+				"TROX\0"
+				"TRP\0"
+				"TRPX\0"
+				"TRQ\0"
+				"TRS\0"
+				"TRST\0"
+				"TRT\0"
+				"TRTN\0"
+				"TRTN^A\0"
+				"TRTN^B\0"
+				"TRTX\0"
+				"TRU\0"
+				"TRUE\0"
+				"TRUP\0"
+				"TRV\0"
+				"TRVG\0"
+				"TRVI\0"
+				"TRVN\0"
+				"TRWH\0"
+				"TRX\0"
+				"TRXC\0"
+				"TS\0"
+				"TSBK\0"
+				"TSC\0"
+				"TSCAP\0"
+				"TSCBP\0"
+				"TSCO\0"
+				"TSE\0"
+				"TSEM\0"
+				"TSG\0"
+				"TSI\0"
+				"TSLA\0"
+				"TSLF\0"
+				"TSLX\0"
+				"TSM\0"
+				"TSN\0"
+				"TSQ\0"
+				"TSRI\0"
+				"TSS\0"
+				"TSU\0"
+				"TTC\0"
+				"TTD\0"
+				"TTEC\0"
+				"TTEK\0"
+				"TTGT\0"
+				"TTI\0"
+				"TTM\0"
+				"TTMI\0"
+				"TTNP\0"
+				"TTOO\0"
+				"TTP\0"
+				"TTPH\0"
+				"TTS\0"
+				"TTTN\0"
+				"TTWO\0"
+				"TU\0"
+				"TUES\0"
+				"TUFN\0"
+				"TUP\0"
+				"TUR\0"
+				"TURN\0"
+				"TUSA\0"
+				"TUSK\0"
+				"TV\0"
+				"TVC\0"
+				"TVE\0"
+				"TVIX\0"
+				"TVTY\0"
+				"TW\0"
+				"TWI\0"
+				"TWIN\0"
+				"TWLO\0"
+				"TWMC\0"
+				"TWN\0"
+				"TWNK\0"
+				"TWNKW\0"
+				"TWO\0"
+				"TWOU\0"
+				"TWO^A\0"
+				"TWO^B\0"
+				"TWO^C\0"
+				"TWO^D\0"
+				"TWO^E\0"
+				"TWST\0"
+				"TWTR\0"
+				"TX\0"
+				"TXG\0"
+				"TXMD\0"
+				"TXN\0"
+				"TXRH\0"
+				"TXT\0"
+				"TY\0"
+				"TYG\0"
+				"TYHT\0"
+				"TYL\0"
+				"TYME\0"
+				"TYPE\0"
+				"TY^\0"
+				"TZAC\0"
+				"TZACU\0"
+				"TZACW\0"
+				"TZOO\0"
+				"UA\0"
+				"UAA\0"
+				"UAE\0"
+				"UAL\0"
+				"UAMY\0"
+				"UAN\0"
+				"UAVS\0"
+				"UBA\0"
+				"UBCP\0"
+				"UBER\0"
+				"UBFO\0"
+				"UBIO\0"
+				"UBNK\0"
+				"UBOH\0"
+				"UBP\0"
+				"UBP^G\0"
+				"UBP^H\0"
+				"UBS\0"
+				"UBSI\0"
+				"UBX\0"
+				"UCBI\0"
+				"UCFC\0"
+				"UCTT\0"
+				"UDR\0"
+				"UE\0"
+				"UEC\0"
+				"UEIC\0"
+				"UEPS\0"
+				"UFAB\0"
+				"UFCS\0"
+				"UFI\0"
+				"UFPI\0"
+				"UFPT\0"
+				"UFS\0"
+				"UG\0"
+				"UGI\0"
+				"UGLD\0"
+				"UGP\0"
+				"UHAL\0"
+				"UHS\0"
+				"UHT\0"
+				"UI\0"
+				"UIHC\0"
+				"UIS\0"
+				"UL\0"
+				"ULBI\0"
+				"ULH\0"
+				"ULTA\0"
+				"UMBF\0"
+				"UMC\0"
+				"UMH\0"
+				"UMH^B\0"
+				"UMH^C\0"
+				"UMH^D\0"
+				"UMPQ\0"
+				"UMRX\0"
+				"UN\0"
+				"UNAM\0"
+				"UNB\0"
+				"UNF\0"
+				"UNFI\0"
+				"UNH\0"
+				"UNIT\0"
+				"UNM\0"
+				"UNMA\0"
+				"UNP\0"
+				"UNT\0"
+				"UNTY\0"
+				"UNVR\0"
+				"UONE\0"
+				"UONEK\0"
+				"UPLD\0"
+				"UPS\0"
+				"UPWK\0"
+				"URBN\0"
+				"URG\0"
+				"URGN\0"
+				"URI\0"
+				"UROV\0"
+				"USA\0"
+				"USAC\0"
+				"USAK\0"
+				"USAP\0"
+				"USAS\0"
+				"USAT\0"
+				"USATP\0"
+				"USAU\0"
+				"USB\0"
+				"USB^A\0"
+				"USB^H\0"
+				"USB^M\0"
+				"USB^O\0"
+				"USB^P\0"
+				"USCR\0"
+				"USDP\0"
+				"USEG\0"
+				"USFD\0"
+				"USIG\0"
+				"USIO\0"
+				"USLB\0"
+				"USLM\0"
+				"USLV\0"
+				"USM\0"
+				"USMC\0"
+				"USNA\0"
+				"USOI\0"
+				"USPH\0"
+				"USWS\0"
+				"USWSW\0"
+				"USX\0"
+				"UTF\0"
+				"UTG\0"
+				"UTHR\0"
+				"UTI\0"
+				"UTL\0"
+				"UTMD\0"
+				"UTSI\0"
+				"UTX\0"
+				"UUU\0"
+				"UUUU\0"
+				"UUUU.WS\0"
+				"UVE\0"
+				"UVSP\0"
+				"UVV\0"
+				"UXIN\0"
+				"UZA\0"
+				"UZB\0"
+				"UZC\0"
+				"V\0"
+				"VAC\0"
+				"VAL\0"
+				"VALE\0"
+				"VALU\0"
+				"VALX\0"
+				"VAM\0"
+				"VAPO\0"
+				"VAR\0"
+				"VBF\0"
+				"VBFC\0"
+				"VBIV\0"
+				"VBLT\0"
+				"VBND\0"
+				"VBTX\0"
+				"VC\0"
+				"VCEL\0"
+				"VCF\0"
+				"VCIF\0"
+				"VCIT\0"
+				"VCLT\0"
+				"VCNX\0"
+				"VCRA\0"
+				"VCSH\0"
+				"VCTR\0"
+				"VCV\0"
+				"VCYT\0"
+				"VEC\0"
+				"VECO\0"
+				"VEDL\0"
+				"VEEV\0"
+				"VEON\0"
+				"VER\0"
+				"VERB\0"
+				"VERBW\0"
+				"VERI\0"
+				"VERU\0"
+				"VERY\0"
+				"VER^F\0"
+				"VET\0"
+				"VETS\0"
+				"VFC\0"
+				"VFF\0"
+				"VFL\0"
+				"VG\0"
+				"VGI\0"
+				"VGIT\0"
+				"VGLT\0"
+				"VGM\0"
+				"VGR\0"
+				"VGSH\0"
+				"VGZ\0"
+				"VHC\0"
+				"VHI\0"
+				"VIA\0"
+				"VIAB\0"
+				"VIAV\0"
+				"VICI\0"
+				"VICR\0"
+				"VIDI\0"
+				"VIGI\0"
+				"VIIX\0"
+				"VIOT\0"
+				"VIPS\0"
+				"VIRC\0"
+				"VIRT\0"
+				"VISL\0"
+				"VIST\0"
+				"VISTER\0"
+				"VIV\0"
+				"VIVE\0"
+				"VIVO\0"
+				"VJET\0"
+				"VKI\0"
+				"VKQ\0"
+				"VKTX\0"
+				"VKTXW\0"
+				"VLGEA\0"
+				"VLO\0"
+				"VLRS\0"
+				"VLRX\0"
+				"VLT\0"
+				"VLY\0"
+				"VLYPO\0"
+				"VLYPP\0"
+				"VMBS\0"
+				"VMC\0"
+				"VMD\0"
+				"VMET\0"
+				"VMI\0"
+				"VMM\0"
+				"VMO\0"
+				"VMW\0"
+				"VNCE\0"
+				"VNDA\0"
+				"VNE\0"
+				"VNET\0"
+				"VNO\0"
+				"VNOM\0"
+				"VNO^K\0"
+				"VNO^L\0"
+				"VNO^M\0"
+				"VNQI\0"
+				"VNRX\0"
+				"VNTR\0"
+				"VOC\0"
+				"VOD\0"
+				"VOLT\0"
+				"VONE\0"
+				"VONG\0"
+				"VONV\0"
+				"VOXX\0"
+				"VOYA\0"
+				"VOYA^B\0"
+				"VPG\0"
+				"VPV\0"
+				"VRA\0"
+				"VRAY\0"
+				"VRCA\0"
+				"VREX\0"
+				"VRIG\0"
+				"VRML\0"
+				"VRNA\0"
+				"VRNS\0"
+				"VRNT\0"
+				"VRRM\0"
+				"VRS\0"
+				"VRSK\0"
+				"VRSN\0"
+				"VRTS\0"
+				"VRTSP\0"
+				"VRTU\0"
+				"VRTV\0"
+				"VRTX\0"
+				"VSAT\0"
+				"VSDA\0"
+				"VSEC\0"
+				"VSH\0"
+				"VSI\0"
+				"VSLR\0"
+				"VSM\0"
+				"VSMV\0"
+				"VST\0"
+				"VST.WS.A\0"
+				"VSTM\0"
+				"VSTO\0"
+				"VTA\0"
+				"VTC\0"
+				"VTEC\0"
+				"VTGN\0"
+				"VTHR\0"
+				"VTIP\0"
+				"VTIQ\0"
+				"VTIQU\0"
+				"VTIQW\0"
+				"VTN\0"
+				"VTNR\0"
+				"VTR\0"
+				"VTSI\0"
+				"VTUS\0"
+				"VTVT\0"
+				"VTWG\0"
+				"VTWO\0"
+				"VTWV\0"
+				"VUSE\0"
+				"VUZI\0"
+				"VVI\0"
+				"VVPR\0"
+				"VVR\0"
+				"VVUS\0"
+				"VVV\0"
+				"VWOB\0"
+				"VXRT\0"
+				"VXUS\0"
+				"VYGR\0"
+				"VYMI\0"
+				"VZ\0"
+				"W\0"
+				"WAAS\0"
+				"WAB\0"
+				"WABC\0"
+				"WAFD\0"
+				"WAFU\0"
+				"WAIR\0"
+				"WAL\0"
+				"WALA\0"
+				"WASH\0"
+				"WAT\0"
+				"WATT\0"
+				"WB\0"
+				"WBA\0"
+				"WBAI\0"
+				"WBC\0"
+				"WBK\0"
+				"WBND\0"
+				"WBS\0"
+				"WBS^F\0"
+				"WBT\0"
+				"WCC\0"
+				"WCG\0"
+				"WCLD\0"
+				"WCN\0"
+				"WD\0"
+				"WDAY\0"
+				"WDC\0"
+				"WDFC\0"
+				"WDR\0"
+				"WEA\0"
+				"WEBK\0"
+				"WEC\0"
+				"WEI\0"
+				"WELL\0"
+				"WEN\0"
+				"WERN\0"
+				"WES\0"
+				"WETF\0"
+				"WEX\0"
+				"WEYS\0"
+				"WF\0"
+				"WFC\0"
+				"WFC^L\0"
+				"WFC^N\0"
+				"WFC^O\0"
+				"WFC^P\0"
+				"WFC^Q\0"
+				"WFC^R\0"
+				"WFC^T\0"
+				"WFC^V\0"
+				"WFC^W\0"
+				"WFC^X\0"
+				"WFC^Y\0"
+				"WFE^A\0"
+				"WGO\0"
+				"WH\0"
+				"WHD\0"
+				"WHF\0"
+				"WHFBZ\0"
+				"WHG\0"
+				"WHLM\0"
+				"WHLR\0"
+				"WHLRD\0"
+				"WHLRP\0"
+				"WHR\0"
+				"WIA\0"
+				"WIFI\0"
+				"WILC\0"
+				"WINA\0"
+				"WINC\0"
+				"WING\0"
+				"WINS\0"
+				"WIRE\0"
+				"WISA\0"
+				"WIT\0"
+				"WIW\0"
+				"WIX\0"
+				"WK\0"
+				"WKHS\0"
+				"WLDN\0"
+				"WLFC\0"
+				"WLH\0"
+				"WLK\0"
+				"WLKP\0"
+				"WLL\0"
+				"WLTW\0"
+				"WM\0"
+				"WMB\0"
+				"WMC\0"
+				"WMGI\0"
+				"WMK\0"
+				"WMS\0"
+				"WMT\0"
+				"WNC\0"
+				"WNEB\0"
+				"WNFM\0"
+				"WNS\0"
+				"WOOD\0"
+				"WOR\0"
+				"WORK\0"
+				"WORX\0"
+				"WOW\0"
+				"WPC\0"
+				"WPG\0"
+				"WPG^H\0"
+				"WPG^I\0"
+				"WPM\0"
+				"WPP\0"
+				"WPRT\0"
+				"WPX\0"
+				"WRB\0"
+				"WRB^B\0"
+				"WRB^C\0"
+				"WRB^D\0"
+				"WRB^E\0"
+				"WRE\0"
+				"WRI\0"
+				"WRK\0"
+				"WRLD\0"
+				"WRLS\0"
+				"WRLSR\0"
+				"WRLSU\0"
+				"WRLSW\0"
+				"WRN\0"
+				"WRTC\0"
+				"WSBC\0"
+				"WSBF\0"
+				"WSC\0"
+				"WSFS\0"
+				"WSG\0"
+				"WSM\0"
+				"WSO\0"
+				"WSO.B\0"
+				"WSR\0"
+				"WST\0"
+				"WSTG\0"
+				"WSTL\0"
+				"WTBA\0"
+				"WTER\0"
+				"WTFC\0"
+				"WTFCM\0"
+				"WTI\0"
+				"WTM\0"
+				"WTR\0"
+				"WTRE\0"
+				"WTREP\0"
+				"WTRH\0"
+				"WTRU\0"
+				"WTS\0"
+				"WTT\0"
+				"WTTR\0"
+				"WU\0"
+				"WUBA\0"
+				"WVE\0"
+				"WVFC\0"
+				"WVVI\0"
+				"WVVIP\0"
+				"WW\0"
+				"WWD\0"
+				"WWE\0"
+				"WWR\0"
+				"WWW\0"
+				"WY\0"
+				"WYND\0"
+				"WYNN\0"
+				"WYY\0"
+				"X\0"
+				"XAIR\0"
+				"XAN\0"
+				"XAN^C\0"
+				"XBIO\0"
+				"XBIOW\0"
+				"XBIT\0"
+				"XCUR\0"
+				"XEC\0"
+				"XEL\0"
+				"XELA\0"
+				"XELB\0"
+				"XENE\0"
+				"XENT\0"
+				"XERS\0"
+				"XFLT\0"
+				"XFOR\0"
+				"XHR\0"
+				"XIN\0"
+				"XLNX\0"
+				"XLRN\0"
+				"XNCR\0"
+				"XNET\0"
+				"XOG\0"
+				"XOM\0"
+				"XOMA\0"
+				"XON\0"
+				"XONE\0"
+				"XPEL\0"
+				"XPER\0"
+				"XPL\0"
+				"XPO\0"
+				"XRAY\0"
+				"XRF\0"
+				"XRX\0"
+				"XSPA\0"
+				"XT\0"
+				"XTLB\0"
+				"XTNT\0"
+				"XXII\0"
+				"XYF\0"
+				"XYL\0"
+				"Y\0"
+				"YCBD\0"
+				"YELP\0"
+				"YETI\0"
+				"YEXT\0"
+				"YGYI\0"
+				"YI\0"
+				"YIN\0"
+				"YJ\0"
+				"YLCO\0"
+				"YLDE\0"
+				"YMAB\0"
+				"YNDX\0"
+				"YORW\0"
+				"YPF\0"
+				"YRCW\0"
+				"YRD\0"
+				"YTEN\0"
+				"YTRA\0"
+				"YUM\0"
+				"YUMA\0"
+				"YUMC\0"
+				"YVR\0"
+				"YY\0"
+				"Z\0"
+				"ZAGG\0"
+				"ZAYO\0"
+				"ZBH\0"
+				"ZBIO\0"
+				"ZBK\0"
+				"ZBRA\0"
+				"ZB^A\0"
+				"ZB^G\0"
+				"ZB^H\0"
+				"ZDGE\0"
+				"ZEAL\0"
+				"ZEN\0"
+				"ZEUS\0"
+				"ZF\0"
+				"ZFGN\0"
+				"ZG\0"
+				"ZGNX\0"
+				"ZION\0"
+				"ZIONW\0"
+				"ZIOP\0"
+				"ZIV\0"
+				"ZIXI\0"
+				"ZKIN\0"
+				"ZLAB\0"
+				"ZM\0"
+				"ZN\0"
+				"ZNGA\0"
+				"ZNH\0"
+				"ZNWAA\0"
+				"ZOM\0"
+				"ZS\0"
+				"ZSAN\0"
+				"ZTEST\0"
+				"ZTO\0"
+				"ZTR\0"
+				"ZTS\0"
+				"ZUMZ\0"
+				"ZUO\0"
+				"ZVO\0"
+				"ZYME\0"
+				"ZYNE\0"
+				"ZYXI\0"
+				;
+
+			// Start of each label in BLOB, plus the end
+			inline constexpr std::array<uint32_t, COUNT + 1> OFFSETS = {
+				0, 2, 5, 10, 14, 18, 23, 28, 32, 37, 42, 46, 51, 55, 59, 64,
+				69, 74, 77, 81, 86, 90, 95, 100, 105, 111, 116, 120, 125, 130, 134, 139,
+				143, 149, 155, 161, 165, 170, 175, 178, 182, 187, 192, 198, 204, 208, 213, 217,
+				222, 227, 232, 237, 243, 249, 253, 258, 263, 268, 273, 278, 283, 288, 292, 297,
+				301, 306, 311, 315, 320, 325, 330, 335, 339, 344, 349, 355, 361, 365, 369, 374,
+				379, 383, 388, 393, 397, 402, 406, 411, 417, 421, 426, 431, 436, 441, 445, 450,
+				455, 460, 465, 470, 475, 479, 484, 489, 493, 498, 503, 508, 512, 517, 520, 524,
+				528, 532, 536, 541, 545, 550, 555, 559, 563, 568, 572, 576, 582, 586, 591, 595,
+				600, 604, 609, 614, 618, 622, 626, 631, 636, 641, 645, 651, 655, 660, 666, 670,
+				675, 679, 684, 687, 692, 698, 704, 710, 715, 719, 723, 728, 733, 739, 743, 748,
+				753, 757, 763, 768, 774, 780, 786, 790, 795, 801, 807, 813, 818, 822, 828, 834,
+				840, 844, 849, 854, 858, 863, 867, 872, 877, 881, 885, 891, 897, 903, 909, 914,
+				918, 924, 930, 936, 942, 948, 951, 955, 959, 963, 967, 974, 980, 985, 989, 994,
+				999, 1003, 1008, 1013, 1017, 1021, 1026, 1031, 1036, 1041, 1047, 1053, 1057, 1061, 1065, 1069,
+				1074, 1079, 1084, 1088, 1093, 1097, 1102, 1107, 1112, 1117, 1122, 1126, 1132, 1138, 1142, 1147,
+				1152, 1156, 1161, 1166, 1169, 1174, 1180, 1186, 1192, 1196, 1201, 1205, 1210, 1215, 1220, 1224,
+				1229, 1234, 1238, 1243, 1248, 1254, 1260, 1266, 1271, 1276, 1281, 1286, 1290, 1295, 1299, 1304,
+				1309, 1314, 1319, 1324, 1331, 1337, 1343, 1352, 1361, 1370, 1376, 1382, 1387, 1392, 1396, 1401,
+				1406, 1412, 1417, 1422, 1427, 1432, 1437, 1441, 1446, 1451, 1456, 1460, 1464, 1469, 1474, 1479,
+				1482, 1487, 1492, 1497, 1502, 1507, 1513, 1518, 1522, 1527, 1532, 1538, 1544, 1549, 1554, 1558,
+				1562, 1567, 1572, 1576, 1581, 1585, 1591, 1597, 1603, 1609, 1615, 1619, 1624, 1628, 1633, 1638,
+				1643, 1647, 1652, 1657, 1662, 1666, 1671, 1676, 1681, 1687, 1692, 1697, 1702, 1708, 1713, 1717,
+				1722, 1727, 1733, 1737, 1742, 1748, 1753, 1758, 1763, 1767, 1772, 1775, 1780, 1785, 1790, 1795,
+				1801, 1807, 1813, 1818, 1823, 1827, 1832, 1837, 1842, 1846, 1852, 1858, 1864, 1869, 1874, 1879,
+				1884, 1889, 1894, 1898, 1903, 1907, 1911, 1915, 1920, 1923, 1927, 1932, 1936, 1941, 1947, 1952,
+				1957, 1962, 1966, 1971, 1976, 1981, 1986, 1990, 1994, 1999, 2004, 2010, 2016, 2022, 2027, 2032,
+				2037, 2042, 2046, 2051, 2056, 2061, 2066, 2071, 2076, 2080, 2085, 2088, 2092, 2097, 2101, 2106,
+				2111, 2116, 2121, 2124, 2128, 2133, 2138, 2142, 2147, 2152, 2157, 2162, 2167, 2172, 2176, 2181,
+				2186, 2191, 2195, 2200, 2205, 2212, 2217, 2223, 2228, 2233, 2238, 2242, 2247, 2251, 2256, 2261,
+				2266, 2271, 2276, 2281, 2287, 2292, 2297, 2302, 2307, 2311, 2317, 2322, 2328, 2334, 2339, 2344,
+				2349, 2353, 2358, 2363, 2369, 2375, 2379, 2383, 2389, 2395, 2401, 2405, 2410, 2415, 2419, 2424,
+				2428, 2433, 2438, 2442, 2447, 2452, 2457, 2462, 2467, 2472, 2477, 2481, 2486, 2491, 2497, 2502,
+				2507, 2512, 2516, 2521, 2524, 2529, 2534, 2539, 2544, 2550, 2558, 2566, 2574, 2579, 2584, 2588,
+				2593, 2598, 2603, 2609, 2613, 2618, 2623, 2629, 2634, 2639, 2644, 2649, 2654, 2659, 2663, 2668,
+				2673, 2677, 2682, 2687, 2692, 2697, 2702, 2707, 2712, 2716, 2721, 2725, 2730, 2735, 2738, 2742,
+				2747, 2752, 2756, 2761, 2765, 2770, 2775, 2780, 2784, 2788, 2793, 2798, 2802, 2807, 2811, 2816,
+				2821, 2826, 2831, 2836, 2840, 2845, 2849, 2854, 2859, 2864, 2868, 2873, 2877, 2882, 2889, 2893,
+				2898, 2902, 2907, 2911, 2915, 2919, 2923, 2927, 2932, 2937, 2941, 2944, 2949, 2954, 2958, 2963,
+				2968, 2972, 2977, 2982, 2986, 2990, 2994, 2998, 3003, 3009, 3015, 3020, 3025, 3029, 3032, 3036,
+				3040, 3045, 3049, 3053, 3057, 3062, 3067, 3072, 3077, 3081, 3083, 3086, 3091, 3095, 3101, 3107,
+				3113, 3119, 3125, 3131, 3137, 3143, 3147, 3151, 3155, 3160, 3167, 3174, 3179, 3184, 3190, 3195,
+				3200, 3204, 3208, 3213, 3219, 3225, 3229, 3232, 3237, 3242, 3246, 3251, 3255, 3260, 3265, 3269,
+				3274, 3278, 3282, 3287, 3291, 3295, 3299, 3303, 3308, 3313, 3317, 3323, 3329, 3335, 3339, 3344,
+				3348, 3352, 3356, 3359, 3364, 3368, 3373, 3379, 3383, 3388, 3393, 3397, 3402, 3407, 3412, 3416,
+				3421, 3426, 3431, 3436, 3441, 3446, 3451, 3455, 3460, 3465, 3469, 3475, 3479, 3484, 3489, 3494,
+				3499, 3503, 3508, 3512, 3516, 3520, 3524, 3529, 3533, 3538, 3541, 3546, 3551, 3556, 3562, 3568,
+				3572, 3576, 3581, 3586, 3591, 3596, 3601, 3605, 3610, 3615, 3619, 3623, 3628, 3632, 3637, 3643,
+				3649, 3653, 3657, 3660, 3664, 3669, 3674, 3678, 3682, 3686, 3691, 3696, 3700, 3705, 3709, 3714,
+				3718, 3722, 3726, 3729, 3734, 3739, 3743, 3747, 3751, 3755, 3761, 3767, 3772, 3776, 3781, 3785,
+				3789, 3795, 3801, 3806, 3810, 3815, 3819, 3824, 3828, 3833, 3837, 3841, 3846, 3851, 3856, 3860,
+				3866, 3871, 3876, 3881, 3886, 3894, 3898, 3902, 3906, 3911, 3916, 3919, 3924, 3927, 3932, 3937,
+				3941, 3945, 3950, 3956, 3960, 3964, 3968, 3972, 3976, 3981, 3986, 3990, 3995, 3999, 4004, 4009,
+				4012, 4017, 4022, 4027, 4031, 4036, 4041, 4045, 4050, 4055, 4059, 4064, 4068, 4073, 4078, 4084,
+				4089, 4094, 4098, 4103, 4107, 4111, 4115, 4120, 4124, 4128, 4133, 4139, 4145, 4151, 4157, 4161,
+				4166, 4171, 4176, 4181, 4185, 4189, 4194, 4199, 4204, 4209, 4214, 4220, 4225, 4229, 4234, 4239,
+				4245, 4249, 4254, 4258, 4262, 4267, 4273, 4278, 4283, 4288, 4293, 4298, 4303, 4308, 4313, 4317,
+				4322, 4325, 4330, 4334, 4339, 4344, 4349, 4354, 4360, 4366, 4370, 4376, 4381, 4385, 4390, 4394,
+				4400, 4406, 4410, 4413, 4417, 4422, 4427, 4431, 4437, 4443, 4449, 4454, 4460, 4466, 4471, 4476,
+				4481, 4485, 4489, 4494, 4500, 4506, 4512, 4517, 4523, 4529, 4535, 4540, 4547, 4555, 4560, 4564,
+				4568, 4572, 4576, 4581, 4586, 4590, 4594, 4599, 4604, 4609, 4613, 4617, 4622, 4627, 4632, 4636,
+				4641, 4646, 4651, 4655, 4658, 4662, 4667, 4671, 4676, 4680, 4684, 4688, 4692, 4696, 4700, 4704,
+				4708, 4712, 4717, 4722, 4727, 4730, 4734, 4739, 4744, 4750, 4753, 4757, 4762, 4766, 4771, 4776,
+				4780, 4786, 4791, 4797, 4803, 4808, 4811, 4815, 4819, 4824, 4829, 4833, 4839, 4843, 4846, 4850,
+				4855, 4859, 4864, 4869, 4873, 4877, 4882, 4884, 4889, 4894, 4899, 4903, 4908, 4913, 4918, 4923,
+				4927, 4931, 4935, 4939, 4943, 4949, 4955, 4959, 4964, 4968, 4973, 4978, 4983, 4988, 4993, 4998,
+				5003, 5008, 5013, 5017, 5022, 5027, 5032, 5037, 5042, 5047, 5052, 5057, 5062, 5067, 5072, 5077,
+				5082, 5087, 5091, 5096, 5101, 5106, 5111, 5116, 5121, 5126, 5129, 5134, 5139, 5144, 5148, 5154,
+				5158, 5163, 5167, 5172, 5176, 5181, 5186, 5192, 5198, 5202, 5207, 5212, 5217, 5221, 5226, 5231,
+				5236, 5241, 5246, 5250, 5256, 5261, 5267, 5271, 5276, 5280, 5285, 5289, 5293, 5296, 5300, 5305,
+				5309, 5316, 5321, 5325, 5330, 5334, 5338, 5344, 5351, 5355, 5361, 5365, 5369, 5373, 5378, 5382,
+				5387, 5392, 5396, 5401, 5405, 5410, 5415, 5419, 5423, 5427, 5433, 5440, 5445, 5449, 5454, 5458,
+				5462, 5467, 5471, 5475, 5480, 5485, 5491, 5496, 5501, 5506, 5510, 5516, 5522, 5527, 5531, 5536,
+				5541, 5546, 5549, 5553, 5558, 5563, 5567, 5571, 5576, 5580, 5585, 5590, 5596, 5601, 5606, 5610,
+				5615, 5619, 5624, 5630, 5635, 5639, 5644, 5649, 5655, 5660, 5665, 5670, 5674, 5679, 5684, 5690,
+				5696, 5700, 5705, 5709, 5713, 5716, 5720, 5724, 5729, 5734, 5739, 5745, 5751, 5756, 5761, 5765,
+				5771, 5776, 5780, 5784, 5789, 5795, 5799, 5804, 5807, 5811, 5816, 5820, 5825, 5830, 5835, 5839,
+				5843, 5848, 5855, 5863, 5868, 5873, 5878, 5883, 5887, 5892, 5896, 5901, 5906, 5912, 5918, 5923,
+				5928, 5932, 5936, 5941, 5945, 5950, 5955, 5961, 5965, 5970, 5975, 5980, 5987, 5994, 5998, 6003,
+				6008, 6014, 6019, 6024, 6029, 6034, 6038, 6044, 6050, 6056, 6062, 6068, 6073, 6077, 6082, 6086,
+				6091, 6095, 6100, 6104, 6107, 6111, 6115, 6120, 6124, 6129, 6134, 6138, 6143, 6147, 6153, 6158,
+				6162, 6166, 6170, 6174, 6178, 6184, 6190, 6196, 6202, 6207, 6212, 6216, 6222, 6226, 6231, 6235,
+				6240, 6246, 6250, 6254, 6259, 6262, 6267, 6271, 6276, 6280, 6283, 6288, 6292, 6297, 6302, 6307,
+				6312, 6317, 6322, 6327, 6331, 6336, 6341, 6346, 6350, 6354, 6359, 6364, 6368, 6373, 6378, 6383,
+				6388, 6395, 6402, 6409, 6416, 6423, 6430, 6435, 6440, 6445, 6449, 6454, 6460, 6465, 6470, 6474,
+				6479, 6484, 6489, 6494, 6498, 6503, 6507, 6512, 6515, 6519, 6524, 6528, 6533, 6538, 6543, 6549,
+				6554, 6560, 6564, 6568, 6574, 6578, 6582, 6587, 6591, 6597, 6601, 6606, 6611, 6618, 6625, 6632,
+				6639, 6644, 6648, 6653, 6658, 6663, 6669, 6673, 6678, 6682, 6686, 6691, 6697, 6701, 6706, 6711,
+				6716, 6721, 6725, 6730, 6736, 6741, 6745, 6749, 6754, 6759, 6763, 6768, 6772, 6778, 6782, 6786,
+				6790, 6795, 6800, 6805, 6810, 6815, 6819, 6824, 6829, 6832, 6837, 6842, 6847, 6854, 6861, 6866,
+				6870, 6874, 6880, 6886, 6892, 6898, 6904, 6910, 6914, 6919, 6924, 6929, 6934, 6939, 6944, 6949,
+				6954, 6959, 6964, 6969, 6974, 6978, 6983, 6987, 6991, 6996, 7001, 7008, 7013, 7018, 7023, 7027,
+				7032, 7037, 7042, 7048, 7054, 7057, 7061, 7066, 7072, 7078, 7083, 7088, 7092, 7096, 7100, 7104,
+				7109, 7114, 7119, 7123, 7127, 7132, 7137, 7142, 7147, 7152, 7156, 7161, 7166, 7171, 7176, 7180,
+				7185, 7191, 7197, 7202, 7206, 7209, 7214, 7219, 7224, 7228, 7233, 7239, 7245, 7250, 7255, 7261,
+				7266, 7272, 7276, 7280, 7285, 7289, 7294, 7298, 7302, 7306, 7311, 7316, 7321, 7326, 7331, 7336,
+				7340, 7344, 7349, 7355, 7361, 7366, 7370, 7375, 7380, 7385, 7390, 7395, 7400, 7405, 7409, 7414,
+				7417, 7421, 7425, 7430, 7435, 7439, 7444, 7449, 7454, 7459, 7464, 7468, 7473, 7478, 7483, 7488,
+				7492, 7496, 7501, 7507, 7512, 7517, 7522, 7527, 7531, 7535, 7540, 7546, 7551, 7555, 7560, 7565,
+				7571, 7577, 7582, 7588, 7594, 7598, 7603, 7608, 7613, 7618, 7624, 7632, 7640, 7648, 7656, 7664,
+				7672, 7676, 7681, 7686, 7691, 7695, 7699, 7704, 7709, 7713, 7717, 7722, 7727, 7732, 7737, 7742,
+				7747, 7751, 7756, 7761, 7766, 7770, 7774, 7779, 7784, 7789, 7795, 7800, 7804, 7808, 7812, 7817,
+				7822, 7827, 7834, 7841, 7848, 7855, 7859, 7863, 7867, 7872, 7876, 7880, 7885, 7890, 7894, 7898,
+				7903, 7908, 7913, 7917, 7922, 7927, 7932, 7937, 7941, 7946, 7951, 7956, 7960, 7965, 7969, 7974,
+				7978, 7983, 7987, 7991, 7995, 7998, 8003, 8008, 8013, 8018, 8025, 8029, 8033, 8038, 8042, 8045,
+				8050, 8054, 8058, 8062, 8066, 8071, 8075, 8078, 8083, 8088, 8093, 8098, 8103, 8109, 8114, 8118,
+				8122, 8127, 8132, 8137, 8143, 8148, 8153, 8157, 8162, 8166, 8170, 8174, 8178, 8182, 8184, 8188,
+				8193, 8198, 8202, 8207, 8211, 8215, 8220, 8225, 8230, 8234, 8237, 8241, 8245, 8249, 8254, 8258,
+				8263, 8267, 8271, 8276, 8280, 8285, 8289, 8294, 8300, 8306, 8311, 8314, 8318, 8322, 8327, 8332,
+				8338, 8344, 8349, 8353, 8357, 8360, 8364, 8369, 8375, 8381, 8386, 8390, 8395, 8400, 8404, 8409,
+				8414, 8419, 8423, 8426, 8431, 8437, 8443, 8448, 8453, 8458, 8462, 8467, 8471, 8476, 8481, 8484,
+				8490, 8496, 8501, 8506, 8511, 8516, 8521, 8526, 8531, 8535, 8539, 8543, 8548, 8552, 8558, 8562,
+				8566, 8571, 8575, 8580, 8584, 8589, 8594, 8598, 8604, 8610, 8616, 8621, 8625, 8630, 8633, 8637,
+				8641, 8645, 8648, 8652, 8656, 8661, 8666, 8671, 8678, 8685, 8690, 8695, 8701, 8705, 8711, 8717,
+				8723, 8729, 8735, 8740, 8745, 8749, 8754, 8758, 8762, 8767, 8771, 8776, 8781, 8786, 8792, 8797,
+				8801, 8806, 8811, 8816, 8820, 8825, 8829, 8833, 8836, 8840, 8845, 8850, 8855, 8860, 8865, 8870,
+				8874, 8879, 8883, 8887, 8892, 8896, 8901, 8907, 8913, 8918, 8922, 8926, 8929, 8934, 8940, 8944,
+				8948, 8952, 8956, 8961, 8967, 8972, 8977, 8982, 8986, 8991, 8996, 9001, 9004, 9008, 9013, 9018,
+				9024, 9028, 9033, 9037, 9042, 9046, 9051, 9055, 9060, 9064, 9070, 9075, 9080, 9085, 9088, 9092,
+				9097, 9101, 9106, 9110, 9116, 9120, 9125, 9130, 9135, 9139, 9143, 9147, 9152, 9157, 9161, 9165,
+				9170, 9175, 9181, 9186, 9190, 9195, 9199, 9204, 9208, 9213, 9217, 9222, 9227, 9232, 9237, 9242,
+				9247, 9252, 9257, 9262, 9267, 9272, 9277, 9280, 9284, 9288, 9293, 9297, 9302, 9307, 9312, 9317,
+				9321, 9326, 9331, 9336, 9339, 9344, 9349, 9354, 9356, 9359, 9363, 9367, 9371, 9375, 9379, 9384,
+				9389, 9394, 9398, 9401, 9406, 9412, 9416, 9421, 9426, 9431, 9435, 9441, 9445, 9450, 9455, 9458,
+				9462, 9466, 9471, 9476, 9481, 9486, 9490, 9496, 9501, 9505, 9510, 9515, 9520, 9525, 9530, 9534,
+				9537, 9542, 9546, 9550, 9554, 9559, 9563, 9568, 9573, 9578, 9583, 9589, 9595, 9599, 9604, 9607,
+				9611, 9616, 9620, 9625, 9629, 9634, 9639, 9643, 9647, 9651, 9656, 9660, 9665, 9669, 9673, 9678,
+				9683, 9687, 9692, 9696, 9701, 9706, 9710, 9715, 9719, 9724, 9728, 9732, 9736, 9740, 9744, 9749,
+				9753, 9758, 9762, 9767, 9772, 9776, 9780, 9785, 9788, 9793, 9797, 9801, 9806, 9810, 9815, 9820,
+				9825, 9829, 9833, 9838, 9843, 9847, 9852, 9856, 9861, 9865, 9870, 9875, 9880, 9885, 9889, 9893,
+				9897, 9902, 9907, 9911, 9916, 9920, 9924, 9928, 9932, 9936, 9941, 9945, 9950, 9955, 9960, 9965,
+				9969, 9974, 9979, 9983, 9988, 9993, 9997, 10002, 10007, 10011, 10017, 10021, 10026, 10031, 10035, 10040,
+				10045, 10050, 10056, 10060, 10065, 10069, 10073, 10078, 10082, 10086, 10090, 10095, 10099, 10103, 10108, 10113,
+				10117, 10121, 10126, 10130, 10134, 10139, 10145, 10151, 10157, 10162, 10167, 10172, 10175, 10180, 10184, 10190,
+				10194, 10199, 10203, 10208, 10212, 10217, 10221, 10225, 10229, 10233, 10237, 10241, 10245, 10250, 10255, 10260,
+				10264, 10269, 10274, 10277, 10282, 10287, 10291, 10296, 10300, 10305, 10310, 10315, 10320, 10326, 10332, 10337,
+				10341, 10346, 10351, 10355, 10360, 10364, 10369, 10373, 10378, 10383, 10388, 10393, 10398, 10404, 10409, 10412,
+				10416, 10421, 10425, 10429, 10434, 10438, 10442, 10446, 10450, 10455, 10461, 10467, 10473, 10477, 10482, 10487,
+				10492, 10496, 10500, 10504, 10508, 10513, 10518, 10521, 10525, 10530, 10535, 10539, 10544, 10548, 10553, 10557,
+				10563, 10568, 10572, 10576, 10580, 10586, 10591, 10595, 10599, 10604, 10609, 10614, 10618, 10623, 10628, 10633,
+				10639, 10645, 10649, 10654, 10658, 10662, 10665, 10670, 10675, 10680, 10685, 10690, 10694, 10698, 10703, 10708,
+				10712, 10716, 10721, 10725, 10730, 10736, 10741, 10746, 10751, 10756, 10761, 10765, 10770, 10775, 10779, 10784,
+				10790, 10795, 10800, 10806, 10811, 10816, 10820, 10822, 10827, 10831, 10835, 10839, 10844, 10848, 10853, 10858,
+				10863, 10868, 10873, 10878, 10882, 10887, 10891, 10894, 10898, 10903, 10908, 10914, 10919, 10923, 10927, 10932,
+				10937, 10941, 10946, 10950, 10953, 10957, 10962, 10967, 10972, 10977, 10982, 10987, 10992, 10997, 11002, 11007,
+				11011, 11016, 11020, 11026, 11030, 11035, 11040, 11044, 11049, 11053, 11058, 11063, 11068, 11073, 11078, 11082,
+				11086, 11090, 11095, 11100, 11106, 11112, 11116, 11119, 11124, 11128, 11133, 11138, 11143, 11147, 11152, 11157,
+				11161, 11166, 11171, 11175, 11179, 11183, 11188, 11192, 11197, 11200, 11204, 11209, 11214, 11218, 11222, 11227,
+				11232, 11237, 11242, 11247, 11252, 11255, 11261, 11265, 11270, 11275, 11279, 11283, 11287, 11291, 11295, 11299,
+				11305, 11308, 11313, 11318, 11322, 11326, 11330, 11335, 11340, 11344, 11349, 11354, 11358, 11363, 11369, 11375,
+				11379, 11384, 11389, 11393, 11398, 11403, 11408, 11412, 11417, 11421, 11425, 11428, 11433, 11438, 11442, 11447,
+				11452, 11457, 11462, 11467, 11471, 11477, 11482, 11488, 11492, 11497, 11502, 11506, 11511, 11515, 11519, 11523,
+				11528, 11533, 11538, 11543, 11548, 11552, 11557, 11562, 11566, 11571, 11576, 11580, 11585, 11591, 11597, 11602,
+				11606, 11610, 11615, 11619, 11623, 11627, 11631, 11634, 11638, 11644, 11649, 11653, 11657, 11662, 11667, 11671,
+				11676, 11681, 11686, 11690, 11695, 11699, 11703, 11708, 11712, 11716, 11721, 11726, 11731, 11735, 11740, 11745,
+				11750, 11755, 11761, 11766, 11770, 11775, 11780, 11784, 11789, 11796, 11804, 11809, 11815, 11819, 11823, 11827,
+				11833, 11837, 11842, 11847, 11852, 11855, 11859, 11864, 11869, 11874, 11879, 11884, 11888, 11894, 11900, 11906,
+				11912, 11918, 11922, 11927, 11932, 11937, 11941, 11946, 11951, 11956, 11960, 11965, 11971, 11975, 11980, 11985,
+				11990, 11994, 11999, 12004, 12008, 12012, 12017, 12022, 12026, 12030, 12034, 12039, 12043, 12047, 12050, 12054,
+				12059, 12065, 12071, 12076, 12081, 12085, 12090, 12095, 12100, 12105, 12110, 12114, 12119, 12124, 12129, 12133,
+				12137, 12142, 12147, 12152, 12156, 12161, 12165, 12170, 12175, 12180, 12185, 12189, 12195, 12200, 12205, 12210,
+				12215, 12220, 12225, 12230, 12234, 12239, 12244, 12248, 12253, 12258, 12263, 12267, 12270, 12274, 12279, 12283,
+				12288, 12294, 12300, 12304, 12309, 12314, 12318, 12322, 12326, 12330, 12332, 12336, 12341, 12347, 12353, 12359,
+				12365, 12370, 12375, 12381, 12387, 12392, 12396, 12402, 12407, 12412, 12417, 12422, 12427, 12432, 12436, 12441,
+				12447, 12453, 12458, 12462, 12466, 12470, 12475, 12480, 12484, 12488, 12492, 12496, 12502, 12508, 12511, 12516,
+				12521, 12525, 12529, 12535, 12539, 12544, 12548, 12552, 12556, 12562, 12568, 12574, 12580, 12583, 12587, 12592,
+				12598, 12604, 12610, 12614, 12620, 12624, 12629, 12633, 12638, 12643, 12648, 12652, 12657, 12661, 12666, 12670,
+				12675, 12678, 12683, 12687, 12691, 12695, 12701, 12707, 12711, 12716, 12720, 12724, 12728, 12732, 12738, 12742,
+				12748, 12752, 12758, 12764, 12768, 12774, 12777, 12781, 12786, 12790, 12794, 12798, 12803, 12807, 12811, 12816,
+				12820, 12826, 12833, 12838, 12843, 12848, 12853, 12857, 12862, 12867, 12871, 12875, 12879, 12885, 12892, 12897,
+				12901, 12905, 12909, 12913, 12917, 12921, 12925, 12930, 12933, 12938, 12944, 12950, 12956, 12961, 12967, 12973,
+				12978, 12983, 12988, 12993, 12997, 13003, 13009, 13014, 13019, 13023, 13028, 13033, 13040, 13045, 13052, 13059,
+				13066, 13071, 13075, 13080, 13085, 13091, 13095, 13100, 13104, 13108, 13113, 13119, 13125, 13129, 13133, 13138,
+				13143, 13146, 13151, 13156, 13160, 13165, 13170, 13176, 13182, 13187, 13193, 13197, 13202, 13209, 13213, 13218,
+				13222, 13226, 13231, 13235, 13241, 13246, 13250, 13254, 13259, 13265, 13270, 13275, 13280, 13285, 13290, 13295,
+				13300, 13304, 13309, 13314, 13320, 13325, 13329, 13332, 13336, 13341, 13346, 13350, 13355, 13360, 13365, 13371,
+				13377, 13383, 13388, 13394, 13399, 13404, 13409, 13414, 13420, 13426, 13430, 13434, 13439, 13443, 13447, 13451,
+				13456, 13460, 13465, 13469, 13474, 13479, 13484, 13488, 13492, 13496, 13501, 13508, 13516, 13521, 13526, 13530,
+				13534, 13539, 13544, 13549, 13554, 13559, 13564, 13569, 13575, 13580, 13585, 13591, 13597, 13602, 13607, 13612,
+				13616, 13622, 13628, 13631, 13636, 13643, 13651, 13656, 13660, 13665, 13670, 13674, 13679, 13684, 13688, 13693,
+				13697, 13703, 13707, 13711, 13716, 13720, 13724, 13729, 13734, 13739, 13744, 13749, 13754, 13757, 13761, 13766,
+				13771, 13776, 13781, 13785, 13791, 13795, 13799, 13803, 13807, 13812, 13817, 13822, 13826, 13832, 13838, 13841,
+				13845, 13849, 13853, 13858, 13863, 13867, 13872, 13877, 13881, 13886, 13892, 13898, 13902, 13906, 13911, 13913,
+				13916, 13921, 13925, 13930, 13935, 13940, 13944, 13949, 13954, 13959, 13963, 13968, 13973, 13978, 13984, 13990,
+				13994, 13999, 14003, 14008, 14012, 14017, 14022, 14026, 14030, 14035, 14041, 14047, 14052, 14058, 14063, 14067,
+				14072, 14078, 14084, 14090, 14095, 14100, 14105, 14109, 14114, 14118, 14122, 14126, 14131, 14136, 14141, 14144,
+				14148, 14152, 14157, 14160, 14165, 14170, 14175, 14179, 14185, 14190, 14194, 14199, 14203, 14208, 14212, 14217,
+				14222, 14227, 14232, 14236, 14241, 14246, 14253, 14258, 14262, 14267, 14272, 14276, 14280, 14285, 14291, 14297,
+				14303, 14307, 14311, 14315, 14318, 14323, 14327, 14332, 14336, 14342, 14347, 14351, 14356, 14360, 14365, 14369,
+				14373, 14377, 14382, 14388, 14392, 14397, 14400, 14405, 14409, 14413, 14417, 14422, 14427, 14432, 14437, 14441,
+				14445, 14450, 14454, 14458, 14463, 14467, 14472, 14479, 14483, 14488, 14493, 14498, 14503, 14507, 14512, 14517,
+				14521, 14526, 14530, 14535, 14539, 14544, 14548, 14553, 14558, 14563, 14568, 14572, 14577, 14582, 14587, 14591,
+				14596, 14600, 14606, 14609, 14613, 14617, 14621, 14625, 14629, 14633, 14637, 14641, 14645, 14649, 14653, 14657,
+				14661, 14664, 14668, 14672, 14676, 14680, 14685, 14690, 14695, 14700, 14705, 14711, 14717, 14722, 14729, 14733,
+				14738, 14743, 14748, 14753, 14758, 14763, 14767, 14772, 14776, 14779, 14783, 14788, 14793, 14798, 14802, 14807,
+				14812, 14817, 14821, 14826, 14831, 14836, 14840, 14844, 14849, 14854, 14859, 14864, 14869, 14874, 14878, 14882,
+				14886, 14891, 14896, 14901, 14906, 14911, 14915, 14921, 14926, 14930, 14935, 14941, 14946, 14949, 14953, 14956,
+				14961, 14967, 14973, 14977, 14981, 14986, 14991, 14996, 15000, 15005, 15010, 15014, 15019, 15023, 15025, 15029,
+				15033, 15037, 15041, 15045, 15050, 15054, 15058, 15063, 15068, 15073, 15078, 15084, 15090, 15096, 15100, 15104,
+				15108, 15113, 15117, 15122, 15127, 15132, 15137, 15142, 15147, 15151, 15155, 15160, 15165, 15169, 15174, 15179,
+				15184, 15189, 15194, 15199, 15204, 15208, 15213, 15217, 15222, 15227, 15231, 15236, 15241, 15246, 15250, 15255,
+				15260, 15265, 15269, 15275, 15279, 15283, 15287, 15291, 15296, 15301, 15305, 15310, 15314, 15319, 15324, 15329,
+				15333, 15338, 15342, 15346, 15350, 15354, 15358, 15362, 15366, 15371, 15376, 15381, 15386, 15390, 15395, 15399,
+				15403, 15407, 15411, 15416, 15421, 15425, 15430, 15434, 15438, 15442, 15447, 15452, 15456, 15460, 15465, 15472,
+				15477, 15481, 15486, 15491, 15496, 15501, 15507, 15512, 15517, 15522, 15526, 15530, 15536, 15541, 15546, 15551,
+				15555, 15560, 15565, 15571, 15576, 15581, 15585, 15590, 15595, 15599, 15604, 15610, 15616, 15621, 15626, 15631,
+				15635, 15640, 15645, 15650, 15655, 15660, 15665, 15669, 15674, 15679, 15684, 15689, 15693, 15698, 15704, 15710,
+				15714, 15719, 15724, 15729, 15733, 15738, 15743, 15748, 15753, 15758, 15763, 15768, 15774, 15780, 15785, 15792,
+				15796, 15801, 15806, 15811, 15816, 15821, 15826, 15831, 15836, 15841, 15846, 15851, 15854, 15859, 15863, 15868,
+				15873, 15878, 15881, 15886, 15890, 15895, 15899, 15904, 15909, 15914, 15918, 15923, 15929, 15934, 15941, 15949,
+				15954, 15957, 15961, 15965, 15968, 15973, 15978, 15983, 15988, 15995, 16000, 16004, 16008, 16013, 16018, 16022,
+				16026, 16030, 16035, 16040, 16045, 16050, 16054, 16059, 16064, 16069, 16074, 16079, 16083, 16088, 16093, 16098,
+				16102, 16107, 16112, 16117, 16122, 16127, 16130, 16135, 16140, 16145, 16150, 16154, 16159, 16164, 16168, 16173,
+				16178, 16183, 16187, 16192, 16196, 16200, 16205, 16210, 16215, 16220, 16225, 16229, 16233, 16237, 16243, 16249,
+				16255, 16259, 16262, 16267, 16272, 16277, 16281, 16286, 16291, 16295, 16300, 16304, 16309, 16314, 16319, 16323,
+				16327, 16332, 16336, 16340, 16345, 16349, 16354, 16361, 16365, 16369, 16373, 16378, 16382, 16386, 16392, 16395,
+				16399, 16402, 16406, 16410, 16415, 16420, 16424, 16429, 16434, 16438, 16444, 16450, 16456, 16460, 16464, 16467,
+				16471, 16476, 16480, 16484, 16488, 16492, 16496, 16500, 16504, 16509, 16514, 16519, 16523, 16527, 16531, 16535,
+				16540, 16544, 16549, 16554, 16558, 16562, 16567, 16572, 16576, 16580, 16585, 16589, 16594, 16598, 16603, 16607,
+				16611, 16616, 16619, 16623, 16627, 16631, 16637, 16643, 16649, 16655, 16661, 16667, 16671, 16675, 16679, 16683,
+				16688, 16692, 16696, 16701, 16706, 16710, 16714, 16719, 16724, 16727, 16731, 16735, 16739, 16744, 16749, 16753,
+				16758, 16760, 16764, 16769, 16774, 16779, 16784, 16788, 16791, 16796, 16800, 16805, 16811, 16817, 16823, 16827,
+				16832, 16837, 16842, 16847, 16852, 16857, 16863, 16868, 16872, 16875, 16879, 16885, 16891, 16895, 16899, 16903,
+				16908, 16913, 16919, 16923, 16927, 16932, 16938, 16944, 16950, 16953, 16958, 16963, 16967, 16971, 16975, 16980,
+				16984, 16989, 16993, 17002, 17008, 17017, 17023, 17029, 17033, 17038, 17042, 17046, 17051, 17055, 17061, 17067,
+				17070, 17075, 17080, 17085, 17090, 17094, 17099, 17103, 17107, 17112, 17117, 17121, 17125, 17128, 17133, 17137,
+				17142, 17147, 17152, 17156, 17159, 17163, 17168, 17172, 17177, 17181, 17186, 17190, 17195, 17200, 17203, 17207,
+				17211, 17216, 17220, 17225, 17230, 17235, 17239, 17243, 17248, 17253, 17258, 17262, 17266, 17270, 17275, 17278,
+				17282, 17287, 17291, 17295, 17299, 17304, 17309, 17315, 17319, 17324, 17329, 17332, 17337, 17341, 17346, 17350,
+				17356, 17361, 17365, 17367, 17371, 17376, 17382, 17388, 17392, 17397, 17402, 17407, 17412, 17417, 17422, 17428,
+				17433, 17438, 17443, 17448, 17452, 17457, 17460, 17465, 17469, 17475, 17481, 17486, 17492, 17498, 17504, 17508,
+				17514, 17520, 17523, 17527, 17533, 17539, 17543, 17548, 17553, 17558, 17563, 17567, 17572, 17576, 17581, 17586,
+				17589, 17593, 17598, 17603, 17608, 17612, 17616, 17621, 17626, 17631, 17635, 17641, 17645, 17649, 17654, 17659,
+				17664, 17670, 17676, 17680, 17685, 17690, 17694, 17700, 17707, 17713, 17719, 17723, 17728, 17732, 17737, 17740,
+				17744, 17750, 17757, 17762, 17766, 17771, 17775, 17780, 17786, 17790, 17795, 17800, 17805, 17810, 17815, 17820,
+				17825, 17830, 17835, 17840, 17843, 17848, 17853, 17858, 17862, 17867, 17870, 17875, 17880, 17885, 17889, 17892,
+				17897, 17901, 17906, 17911, 17917, 17922, 17927, 17932, 17937, 17942, 17948, 17954, 17960, 17965, 17969, 17972,
+				17976, 17980, 17985, 17989, 17994, 17998, 18002, 18007, 18012, 18018, 18024, 18030, 18035, 18039, 18044, 18049,
+				18054, 18059, 18064, 18069, 18074, 18079, 18084, 18088, 18093, 18097, 18102, 18106, 18111, 18115, 18119, 18123,
+				18128, 18133, 18137, 18142, 18147, 18151, 18156, 18161, 18166, 18171, 18176, 18180, 18185, 18190, 18194, 18199,
+				18205, 18211, 18217, 18222, 18226, 18231, 18235, 18241, 18247, 18252, 18256, 18261, 18266, 18271, 18276, 18282,
+				18287, 18291, 18296, 18301, 18306, 18310, 18315, 18320, 18324, 18327, 18332, 18335, 18340, 18344, 18350, 18355,
+				18359, 18363, 18368, 18372, 18376, 18381, 18385, 18389, 18391, 18394, 18398, 18404, 18408, 18413, 18417, 18422,
+				18427, 18432, 18436, 18441, 18446, 18451, 18455, 18460, 18465, 18471, 18475, 18480, 18484, 18489, 18494, 18498,
+				18503, 18508, 18512, 18517, 18521, 18526, 18531, 18537, 18543, 18548, 18553, 18558, 18563, 18567, 18572, 18577,
+				18580, 18584, 18588, 18593, 18597, 18601, 18606, 18611, 18615, 18620, 18625, 18630, 18635, 18639, 18643, 18647,
+				18651, 18655, 18660, 18665, 18670, 18674, 18678, 18682, 18686, 18689, 18693, 18697, 18702, 18707, 18712, 18717,
+				18723, 18728, 18733, 18738, 18743, 18748, 18753, 18758, 18762, 18766, 18771, 18776, 18781, 18785, 18789, 18794,
+				18798, 18802, 18807, 18812, 18816, 18821, 18826, 18830, 18835, 18840, 18846, 18851, 18856, 18860, 18865, 18871,
+				18877, 18881, 18886, 18893, 18901, 18907, 18911, 18915, 18919, 18924, 18929, 18935, 18939, 18943, 18948, 18952,
+				18957, 18961, 18965, 18968, 18972, 18977, 18982, 18986, 18990, 18995, 19000, 19004, 19009, 19013, 19018, 19022,
+				19027, 19032, 19037, 19041, 19045, 19050, 19054, 19058, 19062, 19066, 19070, 19074, 19079, 19084, 19088, 19093,
+				19097, 19102, 19107, 19112, 19116, 19121, 19126, 19131, 19135, 19139, 19144, 19149, 19153, 19158, 19164, 19169,
+				19174, 19179, 19184, 19189, 19194, 19201, 19208, 19213, 19217, 19222, 19226, 19232, 19237, 19241, 19246, 19251,
+				19256, 19261, 19266, 19270, 19274, 19279, 19284, 19289, 19293, 19297, 19302, 19307, 19312, 19316, 19320, 19324,
+				19329, 19333, 19337, 19341, 19346, 19350, 19354, 19358, 19363, 19366, 19371, 19377, 19383, 19388, 19392, 19396,
+				19400, 19405, 19410, 19415, 19419, 19423, 19428, 19433, 19439, 19444, 19449, 19454, 19459, 19462, 19467, 19471,
+				19476, 19481, 19487, 19493, 19498, 19503, 19507, 19512, 19516, 19521, 19526, 19530, 19535, 19542, 19550, 19555,
+				19560, 19565, 19569, 19574, 19578, 19583, 19587, 19591, 19596, 19600, 19605, 19609, 19614, 19618, 19622, 19626,
+				19629, 19634, 19639, 19643, 19648, 19654, 19659, 19664, 19669, 19674, 19678, 19683, 19688, 19693, 19698, 19702,
+				19707, 19712, 19717, 19722, 19727, 19730, 19734, 19738, 19743, 19748, 19752, 19757, 19761, 19766, 19771, 19775,
+				19780, 19784, 19788, 19792, 19796, 19801, 19806, 19811, 19816, 19821, 19826, 19831, 19836, 19841, 19844, 19848,
+				19853, 19859, 19863, 19868, 19872, 19877, 19882, 19887, 19892, 19898, 19902, 19906, 19910, 19915, 19920, 19924,
+				19929, 19934, 19938, 19942, 19947, 19952, 19957, 19962, 19967, 19971, 19975, 19979, 19983, 19986, 19990, 19994,
+				19999, 20005, 20011, 20015, 20020, 20024, 20028, 20032, 20036, 20040, 20045, 20049, 20054, 20058, 20063, 20067,
+				20072, 20076, 20080, 20084, 20088, 20091, 20095, 20099, 20103, 20108, 20112, 20116, 20120, 20124, 20128, 20133,
+				20138, 20142, 20146, 20150, 20154, 20158, 20163, 20168, 20173, 20178, 20183, 20187, 20191, 20195, 20199, 20204,
+				20208, 20213, 20217, 20222, 20227, 20231, 20236, 20241, 20246, 20250, 20255, 20260, 20266, 20270, 20274, 20279,
+				20284, 20288, 20293, 20298, 20302, 20307, 20311, 20315, 20319, 20324, 20330, 20335, 20340, 20344, 20348, 20351,
+				20355, 20359, 20364, 20368, 20373, 20378, 20383, 20387, 20392, 20397, 20401, 20407, 20411, 20417, 20422, 20427,
+				20431, 20436, 20442, 20447, 20450, 20454, 20459, 20465, 20471, 20475, 20481, 20487, 20493, 20499, 20505, 20509,
+				20513, 20517, 20522, 20527, 20532, 20536, 20541, 20546, 20551, 20555, 20560, 20566, 20571, 20575, 20579, 20583,
+				20588, 20593, 20598, 20603, 20609, 20615, 20620, 20625, 20630, 20634, 20640, 20647, 20651, 20655, 20660, 20666,
+				20672, 20676, 20681, 20686, 20689, 20693, 20697, 20702, 20708, 20714, 20720, 20726, 20730, 20737, 20743, 20749,
+				20753, 20757, 20762, 20767, 20770, 20774, 20778, 20782, 20786, 20791, 20797, 20801, 20806, 20809, 20814, 20819,
+				20823, 20827, 20832, 20836, 20841, 20845, 20849, 20853, 20858, 20862, 20866, 20869, 20873, 20877, 20882, 20887,
+				20891, 20894, 20899, 20903, 20908, 20913, 20917, 20923, 20929, 20935, 20941, 20944, 20949, 20954, 20959, 20963,
+				20968, 20974, 20980, 20984, 20988, 20992, 20997, 21002, 21006, 21010, 21014, 21018, 21023, 21028, 21032, 21037,
+				21041, 21046, 21050, 21054, 21063, 21069, 21074, 21078, 21082, 21087, 21091, 21096, 21100, 21104, 21108, 21113,
+				21117, 21122, 21127, 21132, 21136, 21139, 21145, 21149, 21153, 21157, 21162, 21166, 21170, 21173, 21177, 21182,
+				21190, 21194, 21198, 21203, 21208, 21212, 21216, 21220, 21224, 21229, 21233, 21239, 21245, 21248, 21252, 21258,
+				21262, 21267, 21275, 21280, 21285, 21289, 21293, 21298, 21306, 21316, 21320, 21325, 21330, 21335, 21340, 21345,
+				21350, 21355, 21359, 21363, 21368, 21373, 21378, 21384, 21392, 21400, 21408, 21412, 21417, 21422, 21427, 21432,
+				21437, 21441, 21446, 21450, 21454, 21459, 21464, 21469, 21475, 21480, 21485, 21489, 21493, 21498, 21502, 21506,
+				21510, 21515, 21521, 21525, 21529, 21534, 21538, 21543, 21548, 21553, 21558, 21563, 21568, 21573, 21577, 21582,
+				21587, 21592, 21597, 21601, 21605, 21610, 21614, 21618, 21623, 21628, 21633, 21638, 21642, 21647, 21652, 21656,
+				21661, 21665, 21670, 21674, 21679, 21682, 21686, 21690, 21695, 21699, 21704, 21708, 21712, 21717, 21721, 21725,
+				21730, 21735, 21740, 21745, 21750, 21755, 21762, 21769, 21774, 21780, 21786, 21792, 21797, 21802, 21806, 21810,
+				21814, 21816, 21820, 21826, 21833, 21837, 21843, 21849, 21853, 21858, 21863, 21867, 21872, 21877, 21882, 21885,
+				21889, 21894, 21900, 21905, 21909, 21914, 21919, 21925, 21930, 21934, 21938, 21943, 21947, 21951, 21955, 21960,
+				21964, 21969, 21973, 21979, 21985, 21991, 21996, 22001, 22005, 22011, 22017, 22021, 22026, 22030, 22034, 22039,
+				22043, 22046, 22050, 22057, 22061, 22066, 22070, 22074, 22079, 22084, 22088, 22093, 22098, 22102, 22106, 22111,
+				22115, 22120, 22125, 22130, 22134, 22138, 22142, 22146, 22149, 22153, 22158, 22163, 22168, 22173, 22178, 22182,
+				22187, 22192, 22198, 22203, 22208, 22212, 22217, 22222, 22228, 22234, 22239, 22245, 22250, 22254, 22260, 22264,
+				22269, 22274, 22278, 22283, 22288, 22293, 22298, 22302, 22305, 22309, 22314, 22319, 22323, 22328, 22333, 22337,
+				22342, 22347, 22351, 22356, 22361, 22366, 22370, 22375, 22381, 22386, 22390, 22395, 22401, 22405, 22410, 22414,
+				22419, 22424, 22428, 22433, 22437, 22442, 22447, 22451, 22456, 22461, 22465, 22470, 22475, 22480, 22486, 22491,
+				22496, 22500, 22505, 22510, 22515, 22520, 22526, 22531, 22536, 22542, 22548, 22552, 22557, 22563, 22569, 22573,
+				22577, 22581, 22586, 22592, 22598, 22604, 22609, 22613, 22618, 22623, 22628, 22636, 22641, 22647, 22653, 22658,
+				22662, 22667, 22672, 22677, 22681, 22685, 22690, 22695, 22699, 22704, 22709, 22714, 22719, 22725, 22731, 22736,
+				22741, 22746, 22749, 22753, 22757, 22762, 22766, 22771, 22777, 22781, 22786, 22791, 22795, 22800, 22804, 22809,
+				22814, 22820, 22825, 22829, 22835, 22839, 22844, 22848, 22853, 22858, 22862, 22866, 22870, 22876, 22882, 22888,
+				22894, 22900, 22906, 22912, 22918, 22922, 22926, 22931, 22935, 22939, 22943, 22948, 22952, 22957, 22962, 22967,
+				22972, 22977, 22982, 22985, 22990, 22995, 23000, 23004, 23009, 23014, 23019, 23023, 23028, 23033, 23037, 23041,
+				23045, 23050, 23054, 23057, 23061, 23066, 23071, 23077, 23083, 23089, 23095, 23100, 23104, 23109, 23113, 23118,
+				23123, 23127, 23132, 23138, 23144, 23150, 23154, 23159, 23163, 23167, 23171, 23176, 23181, 23186, 23191, 23196,
+				23200, 23204, 23209, 23214, 23218, 23222, 23226, 23230, 23235, 23239, 23243, 23248, 23253, 23258, 23262, 23267,
+				23271, 23276, 23280, 23285, 23289, 23294, 23298, 23303, 23308, 23311, 23315, 23319, 23324, 23328, 23332, 23337,
+				23342, 23346, 23349, 23354, 23359, 23363, 23367, 23371, 23376, 23382, 23386, 23390, 23394, 23398, 23402, 23407,
+				23413, 23417, 23420, 23424, 23430, 23437, 23442, 23446, 23450, 23454, 23460, 23464, 23468, 23473, 23478, 23482,
+				23486, 23491, 23496, 23500, 23504, 23508, 23512, 23516, 23519, 23524, 23528, 23532, 23536, 23540, 23544, 23549,
+				23553, 23557, 23562, 23567, 23572, 23577, 23582, 23586, 23591, 23595, 23599, 23604, 23608, 23612, 23617, 23622,
+				23627, 23632, 23637, 23641, 23646, 23651, 23655, 23659, 23664, 23669, 23674, 23679, 23686, 23689, 23694, 23698,
+				23702, 23706, 23710, 23714, 23718, 23723, 23727, 23732, 23738, 23744, 23748, 23753, 23757, 23763, 23769, 23773,
+				23778, 23782, 23786, 23791, 23796, 23800, 23805, 23810, 23815, 23819, 23824, 23829, 23833, 23838, 23843, 23848,
+				23853, 23857, 23862, 23867, 23872, 23877, 23881, 23886, 23890, 23894, 23899, 23904, 23908, 23912, 23917, 23921,
+				23925, 23929, 23933, 23938, 23943, 23948, 23954, 23960, 23966, 23972, 23977, 23982, 23987, 23992, 23997, 24001,
+				24005, 24012, 24019, 24026, 24033, 24038, 24042, 24047, 24052, 24056, 24061, 24065, 24070, 24075, 24080, 24085,
+				24090, 24095, 24099, 24104, 24109, 24113, 24118, 24123, 24128, 24133, 24138, 24143, 24147, 24152, 24157, 24160,
+				24164, 24170, 24176, 24182, 24188, 24194, 24200, 24206, 24212, 24218, 24224, 24230, 24234, 24240, 24246, 24252,
+				24258, 24264, 24268, 24273, 24278, 24283, 24288, 24293, 24298, 24303, 24308, 24313, 24318, 24323, 24328, 24332,
+				24336, 24340, 24345, 24349, 24354, 24358, 24363, 24368, 24373, 24378, 24384, 24388, 24392, 24397, 24400, 24404,
+				24409, 24413, 24418, 24422, 24427, 24431, 24435, 24440, 24445, 24449, 24454, 24458, 24463, 24469, 24475, 24479,
+				24483, 24487, 24491, 24496, 24502, 24507, 24512, 24517, 24522, 24527, 24532, 24536, 24540, 24544, 24548, 24554,
+				24561, 24566, 24569, 24574, 24578, 24583, 24587, 24591, 24596, 24600, 24603, 24607, 24612, 24616, 24620, 24624,
+				24628, 24632, 24636, 24640, 24645, 24650, 24655, 24660, 24664, 24669, 24674, 24679, 24684, 24687, 24692, 24696,
+				24700, 24705, 24710, 24714, 24719, 24723, 24728, 24733, 24738, 24742, 24747, 24752, 24757, 24763, 24769, 24774,
+				24778, 24783, 24788, 24793, 24798, 24802, 24808, 24814, 24818, 24823, 24828, 24833, 24838, 24843, 24848, 24853,
+				24858, 24860, 24863, 24868, 24872, 24877, 24882, 24887, 24892, 24897, 24902, 24907, 24912, 24917, 24921, 24925,
+				24930, 24934, 24940, 24945, 24950, 24955, 24959, 24963, 24966, 24970, 24974, 24978, 24982, 24987, 24992, 24997,
+				25001, 25005, 25010, 25015, 25019, 25023, 25028, 25033, 25038, 25043, 25047, 25052, 25056, 25061, 25067, 25073,
+				25078, 25083, 25088, 25093, 25097, 25100, 25105, 25110, 25115, 25120, 25125, 25129, 25134, 25139, 25143, 25148,
+				25153, 25158, 25163, 25168, 25173, 25178, 25182, 25187, 25192, 25197, 25202, 25206, 25211, 25215, 25220, 25225,
+				25232, 25239, 25244, 25247, 25252, 25257, 25262, 25267, 25271, 25276, 25280, 25284, 25289, 25294, 25299, 25303,
+				25308, 25313, 25318, 25323, 25328, 25332, 25336, 25340, 25343, 25347, 25353, 25357, 25361, 25366, 25371, 25375,
+				25379, 25384, 25389, 25395, 25401, 25407, 25413, 25419, 25425, 25430, 25434, 25439, 25443, 25448, 25452, 25457,
+				25460, 25465, 25470, 25474, 25478, 25482, 25488, 25491, 25496, 25501, 25506, 25511, 25516, 25520, 25525, 25529,
+				25535, 25542, 25546, 25550, 25555, 25561, 25565, 25569, 25574, 25579, 25584, 25589, 25594, 25599, 25603, 25608,
+				25613, 25618, 25622, 25626, 25632, 25638, 25644, 25649, 25654, 25659, 25664, 25669, 25674, 25679, 25684, 25688,
+				25693, 25697, 25702, 25706, 25711, 25715, 25720, 25726, 25732, 25737, 25741, 25746, 25749, 25754, 25759, 25763,
+				25768, 25775, 25783, 25787, 25791, 25797, 25801, 25806, 25810, 25814, 25819, 25823, 25828, 25831, 25835, 25839,
+				25843, 25848, 25853, 25858, 25862, 25867, 25872, 25876, 25881, 25886, 25891, 25895, 25901, 25907, 25912, 25917,
+				25921, 25926, 25931, 25936, 25940, 25945, 25949, 25954, 25961, 25969, 25974, 25978, 25982, 25988, 25991, 25997,
+				26002, 26006, 26010, 26014, 26019, 26024, 26028, 26032, 26034, 26037, 26041, 26046, 26051, 26056, 26060, 26065,
+				26070, 26075, 26080, 26084, 26089, 26094, 26099, 26103, 26108, 26113, 26117, 26122, 26128, 26134, 26139, 26143,
+				26148, 26153, 26158, 26164, 26168, 26172, 26177, 26182, 26187, 26192, 26197, 26200, 26205, 26210, 26215, 26220,
+				26226, 26231, 26237, 26242, 26247, 26251, 26255, 26260, 26266, 26271, 26276, 26281, 26286, 26290, 26295, 26299,
+				26304, 26308, 26313, 26318, 26323, 26326, 26330, 26335, 26340, 26345, 26349, 26355, 26361, 26367, 26373, 26379,
+				26385, 26391, 26397, 26403, 26408, 26413, 26418, 26425, 26432, 26436, 26441, 26445, 26449, 26454, 26459, 26464,
+				26471, 26479, 26484, 26489, 26493, 26498, 26503, 26508, 26512, 26517, 26521, 26524, 26528, 26532, 26536, 26541,
+				26545, 26550, 26554, 26559, 26562, 26567, 26572, 26576, 26581, 26586, 26590, 26595, 26600, 26605, 26610, 26615,
+				26619, 26624, 26630, 26636, 26641, 26646, 26650, 26655, 26658, 26662, 26667, 26672, 26676, 26681, 26686, 26690,
+				26695, 26699, 26704, 26709, 26714, 26719, 26724, 26727, 26731, 26735, 26740, 26744, 26749, 26753, 26758, 26764,
+				26769, 26774, 26779, 26784, 26789, 26794, 26798, 26803, 26808, 26813, 26817, 26821, 26826, 26832, 26838, 26843,
+				26850, 26858, 26863, 26868, 26872, 26877, 26882, 26887, 26893, 26899, 26904, 26908, 26912, 26916, 26921, 26925,
+				26929, 26934, 26939, 26943, 26948, 26952, 26957, 26962, 26967, 26972, 26977, 26981, 26986, 26991, 26996, 27001,
+				27006, 27011, 27018, 27025, 27032, 27037, 27042, 27047, 27051, 27055, 27060, 27064, 27068, 27072, 27076, 27081,
+				27085, 27090, 27094, 27098, 27102, 27107, 27112, 27117, 27122, 27126, 27131, 27136, 27141, 27145, 27149, 27154,
+				27159, 27164, 27170, 27175, 27179, 27185, 27190, 27195, 27201, 27205, 27210, 27215, 27220, 27224, 27229, 27232,
+				27237, 27242, 27247, 27252, 27257, 27262, 27266, 27271, 27276, 27281, 27285, 27290, 27296, 27302, 27307, 27312,
+				27316, 27321, 27326, 27331, 27336, 27341, 27346, 27351, 27355, 27360, 27365, 27370, 27374, 27379, 27384, 27389,
+				27394, 27398, 27403, 27409, 27414, 27420, 27424, 27430, 27436, 27441, 27446, 27450, 27455, 27460, 27466, 27470,
+				27475, 27479, 27484, 27489, 27493, 27499, 27505, 27509, 27513, 27516, 27521, 27526, 27531, 27537, 27543, 27549,
+				27554, 27558, 27563, 27568, 27573, 27577, 27582, 27587, 27593, 27598, 27602, 27607, 27612, 27618, 27623, 27628,
+				27632, 27637, 27642, 27645, 27650, 27657, 27665, 27670, 27674, 27679, 27683, 27688, 27694, 27699, 27703, 27708,
+				27714, 27718, 27723, 27727, 27732, 27738, 27743, 27748, 27755, 27759, 27764, 27769, 27774, 27779, 27784, 27788,
+				27793, 27798, 27803, 27808, 27813, 27818, 27823, 27828, 27831, 27836, 27841, 27845, 27850, 27855, 27858, 27863,
+				27867, 27872, 27877, 27882, 27888, 27893, 27897, 27902, 27907, 27912, 27918, 27924, 27928, 27932, 27938, 27942,
+				27946, 27951, 27956, 27961, 27966, 27971, 27975, 27980, 27986, 27990, 27995, 28000, 28004, 28009, 28013, 28018,
+				28022, 28027, 28031, 28036, 28041, 28045, 28051, 28056, 28061, 28066, 28071, 28075, 28080, 28086, 28092, 28098,
+				28104, 28110, 28114, 28119, 28122, 28127, 28132, 28137, 28144, 28149, 28156, 28163, 28170, 28175, 28180, 28184,
+				28189, 28193, 28198, 28202, 28206, 28211, 28217, 28221, 28226, 28231, 28235, 28240, 28246, 28250, 28255, 28260,
+				28264, 28269, 28274, 28279, 28284, 28290, 28296, 28301, 28306, 28311, 28316, 28321, 28326, 28331, 28336, 28341,
+				28346, 28350, 28356, 28362, 28368, 28374, 28379, 28383, 28388, 28393, 28397, 28403, 28406, 28410, 28414, 28419,
+				28423, 28428, 28433, 28437, 28442, 28447, 28452, 28457, 28462, 28467, 28471, 28475, 28480, 28484, 28489, 28494,
+				28498, 28503, 28508, 28513, 28517, 28522, 28526, 28530, 28535, 28539, 28543, 28547, 28552, 28556, 28560, 28564,
+				28568, 28572, 28577, 28580, 28585, 28590, 28594, 28598, 28603, 28608, 28612, 28617, 28622, 28627, 28632, 28637,
+				28642, 28646, 28650, 28654, 28656, 28659, 28663, 28668, 28674, 28679, 28684, 28688, 28692, 28697, 28705, 28710,
+				28716, 28722, 28728, 28733, 28737, 28743, 28748, 28753, 28758, 28762, 28767, 28772, 28776, 28781, 28785, 28789,
+				28794, 28798, 28803, 28809, 28815, 28820, 28825, 28828, 28833, 28839, 28845, 28850, 28855, 28860, 28864, 28869,
+				28875, 28880, 28884, 28889, 28893, 28898, 28904, 28910, 28914, 28919, 28924, 28929, 28934, 28939, 28943, 28947,
+				28950, 28954, 28959, 28965, 28971, 28975, 28979, 28983, 28987, 28991, 28996, 29000, 29005, 29009, 29013, 29020,
+				29029, 29038, 29042, 29047, 29052, 29057, 29062, 29067, 29073, 29078, 29082, 29086, 29090, 29095, 29099, 29104,
+				29109, 29113, 29117, 29122, 29127, 29132, 29137, 29141, 29146, 29150, 29153, 29157, 29161, 29165, 29169, 29174,
+				29178, 29182, 29187, 29192, 29196, 29202, 29208, 29212, 29216, 29221, 29224, 29230, 29234, 29239, 29245, 29251,
+				29256, 29262, 29268, 29273, 29277, 29282, 29286, 29290, 29295, 29299, 29303, 29308, 29312, 29316, 29322, 29327,
+				29333, 29339, 29343, 29348, 29353, 29358, 29363, 29368, 29373, 29378, 29382, 29385, 29390, 29394, 29399, 29405,
+				29411, 29417, 29421, 29425, 29429, 29434, 29438, 29442, 29447, 29452, 29457, 29462, 29467, 29471, 29476, 29479,
+				29484, 29490, 29496, 29501, 29506, 29510, 29515, 29519, 29523, 29527, 29532, 29537, 29542, 29547, 29551, 29556,
+				29561, 29565, 29569, 29575, 29581, 29587, 29593, 29598, 29603, 29607, 29611, 29617, 29623, 29629, 29634, 29639,
+				29643, 29648, 29654, 29660, 29666, 29671, 29676, 29681, 29685, 29689, 29694, 29699, 29706, 29714, 29718, 29723,
+				29728, 29732, 29736, 29741, 29746, 29751, 29756, 29760, 29764, 29769, 29772, 29776, 29781, 29786, 29791, 29796,
+				29801, 29806, 29811, 29816, 29820, 29825, 29830, 29835, 29839, 29844, 29849, 29854, 29859, 29863, 29868, 29875,
+				29883, 29888, 29893, 29898, 29903, 29908, 29913, 29917, 29922, 29926, 29930, 29935, 29939, 29944, 29951, 29958,
+				29963, 29967, 29972, 29977, 29981, 29986, 29991, 29996, 30001, 30005, 30010, 30013, 30018, 30022, 30028, 30034,
+				30039, 30043, 30048, 30052, 30056, 30061, 30066, 30071, 30075, 30079, 30083, 30088, 30092, 30096, 30100, 30104,
+				30109, 30114, 30119, 30123, 30127, 30132, 30137, 30142, 30146, 30151, 30155, 30160, 30165, 30168, 30173, 30178,
+				30182, 30186, 30191, 30196, 30201, 30204, 30208, 30212, 30217, 30222, 30225, 30229, 30234, 30239, 30244, 30248,
+				30253, 30259, 30263, 30268, 30274, 30280, 30286, 30292, 30298, 30303, 30308, 30311, 30315, 30320, 30324, 30329,
+				30333, 30336, 30340, 30345, 30349, 30354, 30359, 30363, 30368, 30374, 30380, 30385, 30388, 30392, 30396, 30400,
+				30405, 30409, 30414, 30418, 30423, 30428, 30433, 30438, 30443, 30448, 30452, 30458, 30464, 30468, 30473, 30477,
+				30482, 30487, 30492, 30496, 30499, 30503, 30508, 30513, 30518, 30523, 30527, 30532, 30537, 30541, 30544, 30548,
+				30553, 30557, 30562, 30566, 30570, 30573, 30578, 30582, 30585, 30590, 30594, 30599, 30604, 30608, 30612, 30618,
+				30624, 30630, 30635, 30640, 30643, 30648, 30652, 30656, 30661, 30665, 30670, 30674, 30679, 30683, 30687, 30692,
+				30697, 30702, 30708, 30713, 30717, 30722, 30727, 30731, 30736, 30740, 30745, 30749, 30754, 30759, 30764, 30769,
+				30774, 30780, 30785, 30789, 30795, 30801, 30807, 30813, 30819, 30824, 30829, 30834, 30839, 30844, 30849, 30854,
+				30859, 30864, 30868, 30873, 30878, 30883, 30888, 30893, 30899, 30903, 30907, 30911, 30916, 30920, 30924, 30929,
+				30934, 30938, 30942, 30947, 30955, 30959, 30964, 30968, 30973, 30977, 30981, 30985, 30987, 30991, 30995, 31000,
+				31005, 31010, 31014, 31019, 31023, 31027, 31032, 31037, 31042, 31047, 31052, 31055, 31060, 31064, 31069, 31074,
+				31079, 31084, 31089, 31094, 31099, 31103, 31108, 31112, 31117, 31122, 31127, 31132, 31136, 31141, 31147, 31152,
+				31157, 31162, 31168, 31172, 31177, 31181, 31185, 31189, 31192, 31196, 31201, 31206, 31210, 31214, 31219, 31223,
+				31227, 31231, 31235, 31240, 31245, 31250, 31255, 31260, 31265, 31270, 31275, 31280, 31285, 31290, 31295, 31300,
+				31307, 31311, 31316, 31321, 31326, 31330, 31334, 31339, 31345, 31351, 31355, 31360, 31365, 31369, 31373, 31379,
+				31385, 31390, 31394, 31398, 31403, 31407, 31411, 31415, 31419, 31424, 31429, 31433, 31438, 31442, 31447, 31453,
+				31459, 31465, 31470, 31475, 31480, 31484, 31488, 31493, 31498, 31503, 31508, 31513, 31518, 31525, 31529, 31533,
+				31537, 31542, 31547, 31552, 31557, 31562, 31567, 31572, 31577, 31582, 31586, 31591, 31596, 31601, 31607, 31612,
+				31617, 31622, 31627, 31632, 31637, 31641, 31645, 31650, 31654, 31659, 31663, 31672, 31677, 31682, 31686, 31690,
+				31695, 31700, 31705, 31710, 31715, 31721, 31727, 31731, 31736, 31740, 31745, 31750, 31755, 31760, 31765, 31770,
+				31775, 31780, 31784, 31789, 31793, 31798, 31802, 31807, 31812, 31817, 31822, 31827, 31830, 31832, 31837, 31841,
+				31846, 31851, 31856, 31861, 31865, 31870, 31875, 31879, 31884, 31887, 31891, 31896, 31900, 31904, 31909, 31913,
+				31919, 31923, 31927, 31931, 31936, 31940, 31943, 31948, 31952, 31957, 31961, 31965, 31970, 31974, 31978, 31983,
+				31987, 31992, 31996, 32001, 32005, 32010, 32013, 32017, 32023, 32029, 32035, 32041, 32047, 32053, 32059, 32065,
+				32071, 32077, 32083, 32089, 32093, 32096, 32100, 32104, 32110, 32114, 32119, 32124, 32130, 32136, 32140, 32144,
+				32149, 32154, 32159, 32164, 32169, 32174, 32179, 32184, 32188, 32192, 32196, 32199, 32204, 32209, 32214, 32218,
+				32222, 32227, 32231, 32236, 32239, 32243, 32247, 32252, 32256, 32260, 32264, 32268, 32273, 32278, 32282, 32287,
+				32291, 32296, 32301, 32305, 32309, 32313, 32319, 32325, 32329, 32333, 32338, 32342, 32346, 32352, 32358, 32364,
+				32370, 32374, 32378, 32382, 32387, 32392, 32398, 32404, 32410, 32414, 32419, 32424, 32429, 32433, 32438, 32442,
+				32446, 32450, 32456, 32460, 32464, 32469, 32474, 32479, 32484, 32489, 32495, 32499, 32503, 32507, 32512, 32518,
+				32523, 32528, 32532, 32536, 32541, 32544, 32549, 32553, 32558, 32563, 32569, 32572, 32576, 32580, 32584, 32588,
+				32591, 32596, 32601, 32605, 32607, 32612, 32616, 32622, 32627, 32633, 32638, 32643, 32647, 32651, 32656, 32661,
+				32666, 32671, 32676, 32681, 32686, 32690, 32694, 32699, 32704, 32709, 32714, 32718, 32722, 32727, 32731, 32736,
+				32741, 32746, 32750, 32754, 32759, 32763, 32767, 32772, 32775, 32780, 32785, 32790, 32794, 32798, 32800, 32805,
+				32810, 32815, 32820, 32825, 32828, 32832, 32835, 32840, 32845, 32850, 32855, 32860, 32864, 32869, 32873, 32878,
+				32883, 32887, 32892, 32897, 32901, 32904, 32906, 32911, 32916, 32920, 32925, 32929, 32934, 32939, 32944, 32949,
+				32954, 32959, 32963, 32968, 32971, 32976, 32979, 32984, 32989, 32995, 33000, 33004, 33009, 33014, 33019, 33022,
+				33025, 33030, 33034, 33040, 33044, 33047, 33052, 33058, 33062, 33066, 33070, 33075, 33079, 33083, 33088, 33093,
+				33098,
+			};
+
+			// Displacement seed of each hash bucket
+			inline constexpr std::array<uint16_t, BUCKETS> SEEDS = {
+				91, 21, 6, 112, 311, 38, 7, 39, 27, 33, 2, 212, 20, 80, 6, 147,
+				32, 8, 54, 272, 48, 45, 128, 0, 17, 232, 53, 8, 0, 9, 10, 1,
+				186, 86, 102, 41, 16, 24, 9, 16, 0, 16, 10, 21, 27, 0, 18, 77,
+				35, 0, 0, 5, 17, 29, 1, 0, 34, 170, 37, 3, 85, 220, 1, 4,
+				21, 10, 2, 32, 206, 5, 0, 272, 4, 11, 20, 216, 17, 29, 0, 3,
+				34, 5, 15, 0, 8, 127, 28, 6, 0, 4, 5, 194, 19, 82, 1, 15,
+				69, 0, 37, 26, 1, 191, 0, 1, 26, 11, 25, 9, 3, 186, 156, 90,
+				88, 15, 169, 50, 22, 300, 64, 110, 2, 2, 7, 2, 0, 6, 25, 0,
+				6, 12, 2, 13, 4, 97, 146, 135, 12, 77, 12, 14, 2, 0, 111, 0,
+				6, 1, 0, 10, 2, 94, 130, 60, 0, 83, 58, 139, 115, 86, 173, 41,
+				7, 51, 1, 10, 1, 3, 26, 10, 6, 0, 177, 87, 252, 7, 0, 3,
+				7, 3, 52, 37, 0, 71, 3, 75, 1, 3, 133, 199, 416, 0, 12, 28,
+				50, 0, 34, 105, 21, 30, 42, 39, 19, 121, 2, 81, 3, 27, 172, 2,
+				159, 27, 3, 15, 103, 136, 0, 156, 18, 110, 3, 5, 1, 3, 0, 36,
+				1, 90, 17, 56, 77, 2, 1, 2, 5, 89, 2, 309, 50, 0, 0, 18,
+				71, 27, 10, 1, 1, 12, 27, 4, 237, 1, 52, 18, 78, 1, 2, 340,
+				0, 66, 90, 2, 10, 45, 38, 115, 3, 10, 0, 114, 19, 53, 3, 0,
+				177, 156, 12, 29, 29, 13, 84, 137, 12, 32, 0, 0, 235, 0, 6, 40,
+				223, 9, 3, 1, 7, 21, 5, 23, 95, 13, 0, 43, 7, 0, 2, 19,
+				55, 13, 2, 5, 193, 0, 0, 119, 28, 7, 31, 0, 1, 1, 3, 3,
+				4, 23, 8, 73, 23, 0, 117, 28, 6, 141, 16, 3, 3, 1, 198, 92,
+				0, 8, 172, 0, 227, 576, 0, 95, 20, 1, 7, 32, 3, 87, 17, 0,
+				66, 200, 0, 67, 11, 26, 14, 41, 20, 183, 0, 26, 0, 368, 0, 10,
+				259, 108, 70, 60, 39, 100, 5, 11, 37, 194, 4, 46, 5, 4, 9, 55,
+				114, 186, 0, 3, 32, 43, 58, 17, 1, 23, 6, 48, 5, 1, 148, 16,
+				0, 0, 199, 0, 12, 0, 47, 3, 116, 279, 219, 1, 10, 26, 120, 3,
+				150, 73, 56, 0, 6, 26, 4, 26, 88, 4, 17, 6, 195, 0, 0, 6,
+				121, 1, 12, 146, 1, 38, 2, 262, 301, 5, 3, 85, 38, 15, 2, 6,
+				113, 206, 5, 460, 120, 0, 21, 11, 0, 5, 79, 21, 2, 32, 35, 35,
+				512, 34, 52, 1, 0, 92, 7, 98, 22, 5, 0, 0, 1, 49, 100, 8,
+				10, 99, 9, 52, 102, 1, 1, 1, 1, 0, 176, 79, 2, 0, 34, 13,
+				2, 4, 1, 8, 60, 31, 0, 0, 6, 0, 45, 364, 396, 17, 23, 0,
+				213, 122, 24, 0, 3, 33, 11, 80, 63, 95, 1, 2, 269, 83, 46, 14,
+				58, 24, 112, 497, 45, 477, 1, 200, 205, 21, 1, 0, 9, 65, 76, 62,
+				7, 1, 23, 189, 3, 3, 366, 0, 46, 45, 72, 15, 46, 11, 1, 116,
+				3, 128, 31, 1, 8, 36, 0, 6, 854, 64, 9, 413, 6, 60, 7, 4,
+				244, 19, 8, 5, 79, 231, 0, 129, 0, 63, 79, 381, 59, 2, 162, 47,
+				19, 27, 3, 5, 7, 0, 0, 1, 47, 72, 23, 13, 703, 19, 14, 2,
+				210, 78, 1, 0, 48, 35, 6, 4, 12, 15, 6, 0, 1, 50, 190, 1,
+				58, 13, 0, 60, 7, 37, 11, 8, 14, 0, 11, 7, 674, 40, 58, 41,
+				45, 66, 16, 77, 11, 158, 0, 89, 1, 118, 36, 149, 696, 3, 384, 12,
+				119, 57, 594, 0, 218, 3, 854, 159, 0, 449, 23, 50, 4, 3, 2, 4,
+				163, 9, 281, 6, 3, 8, 56, 175, 15, 31, 112, 0, 8, 184, 0, 375,
+				0, 5, 196, 26, 6, 3, 122, 78, 15, 110, 54, 19, 24, 11, 18, 244,
+				2, 109, 27, 209, 303, 92, 38, 40, 26, 1253, 36, 162, 285, 59, 0, 341,
+				37, 2, 20, 73, 30, 31, 3, 217, 13, 319, 9, 6, 13, 62, 74, 150,
+				47, 25, 28, 14, 0, 3, 4, 3, 16, 7, 7, 204, 500, 0, 166, 0,
+				10, 22, 3, 10, 22, 34, 198, 34, 41, 6, 0, 537, 201, 1001, 396, 11,
+				230, 20, 3, 9, 11, 172, 8, 0, 22, 16, 495, 65, 5, 74, 788, 637,
+				9, 0, 194, 8, 0, 16, 121, 127, 193, 43, 3, 30, 302, 5, 43, 46,
+				85, 113, 6, 202, 6, 0, 11, 22, 150, 25, 643, 1, 27, 8, 578, 0,
+				218, 109, 14, 900, 205, 401, 53, 0, 12, 307, 123, 7, 4, 322, 34, 1,
+				0, 26, 0, 0, 290, 5, 6, 61, 89, 186, 14, 21, 9, 91, 2, 11,
+				369, 517, 0, 27, 0, 7, 22, 3, 50, 58, 343, 1, 115, 2, 248, 18,
+				21, 4, 394, 16, 2, 188, 31, 0, 123, 0, 1, 38, 8, 1, 75, 1,
+				0, 47, 303, 32, 769, 153, 32, 0, 123, 186, 632, 454, 84, 0, 823, 89,
+				290, 10, 2, 0, 199, 48, 0, 48, 0, 295, 53, 5, 0, 150, 0, 99,
+				84, 52, 411, 186, 865, 0, 9, 2, 3, 6, 2, 2, 35, 80, 388, 45,
+				0, 68, 560, 3, 103, 3, 10, 29, 10, 32, 1214, 763, 94, 523, 0, 118,
+				264, 5, 173, 16, 126, 22, 17, 235, 469, 376, 2, 12, 0, 7, 134, 37,
+				3, 21, 3, 43, 103, 19, 103, 3, 76, 26, 0, 2, 4, 70, 228, 69,
+				5, 147, 10, 44, 376, 0, 118, 120, 162, 24, 216, 42, 0, 280, 158, 0,
+				0, 5, 149, 2, 162, 600, 270, 687, 22, 24, 210, 2, 333, 1, 20, 726,
+				133, 45, 0, 304, 442, 228, 50, 28, 396, 10, 14, 76, 3, 128, 107, 77,
+				239, 143, 8, 27, 49, 88, 3, 56, 236, 90, 122, 1, 2, 14, 110, 0,
+				50, 0, 1705, 15, 28, 852, 118, 131, 76, 412, 76, 42, 1, 471, 22, 265,
+				24, 56, 995, 73, 436, 12, 5, 551, 20, 0, 2, 8, 37, 187, 62, 234,
+				453, 20, 0, 34, 601, 32, 91, 24, 78, 13, 64, 108, 2, 7, 35, 140,
+				6, 87, 16, 181, 4, 216, 21, 120, 450, 1, 84, 351, 250, 18, 585, 19,
+				167, 332, 38, 176, 12, 39, 16, 214, 2, 3, 9, 597, 3, 647, 459, 75,
+				385, 0, 0, 653, 0, 7, 263, 9, 45, 700, 36, 59, 179, 12, 136, 3,
+				68, 394, 15, 584, 18, 11, 120, 5, 633, 13, 90, 177, 824, 0, 10, 555,
+				1, 103, 18, 366, 916, 624, 31, 0, 65, 190, 402, 96, 1269, 42, 594, 0,
+				70, 266, 101, 73, 78, 273, 50, 0, 533, 34, 503, 21, 27, 514, 0, 56,
+				840, 251, 29, 536, 48, 110, 4, 0, 199, 848, 536, 23, 585, 125, 618, 1274,
+				235, 433, 58, 89, 7, 0, 179, 160, 21, 1893, 258, 0, 7, 819, 75, 401,
+				371, 162, 2, 17, 2, 0, 165, 3, 270, 109, 251, 490, 11, 132, 549, 0,
+				5, 3, 4, 472, 152, 47, 155, 2, 135, 0, 211, 632, 3, 359, 0, 677,
+				4, 17, 1, 43, 42, 892, 409, 26, 40, 22, 70, 6, 74, 120, 211, 0,
+				4, 146, 0, 1, 1, 8, 463, 323, 52, 9, 333, 214, 0, 82, 180, 151,
+				19, 44, 64, 20, 4, 148, 4, 0, 79, 873, 256, 60, 587, 1440, 7, 10,
+				123, 48, 899, 12, 9, 556, 701, 225, 4, 147, 816, 67, 562, 123, 444, 134,
+				337, 38, 52, 0, 450, 44, 111, 27, 57, 333, 72, 173, 2, 575, 48, 12,
+				332, 0, 14, 2, 766, 1681, 6, 383, 6, 186, 60, 733, 583, 169, 0, 76,
+				485, 1, 29, 0, 4, 1, 30, 197, 335, 151, 0, 48, 193, 8, 1, 344,
+				0, 4, 0, 2, 184, 792, 4, 12, 3, 175, 488, 3, 479, 337, 680, 157,
+				1, 1, 4, 6, 165, 1128, 129, 964, 314, 9, 51, 54, 15, 110, 954, 150,
+				548, 1120, 60, 187, 495, 14, 0, 1, 0, 36, 196, 2, 1122, 893, 570, 246,
+				1708, 2642, 506, 2, 421, 11, 2, 98, 274, 0, 395, 20, 0, 343, 3376, 2,
+				22, 23, 6, 11, 55, 33, 31, 76, 19, 1226, 179, 331, 5, 1374, 7, 1522,
+				128, 0, 0, 583, 905, 25, 359, 708, 0, 39, 32, 1875, 6, 10, 1, 2,
+				26, 56, 23, 14, 112, 385, 154, 4, 269, 11, 23, 6, 1186, 762, 1, 1,
+				34, 2, 418, 574, 65, 21, 2, 707, 162, 23, 916, 345, 12, 2, 1034, 1135,
+				9, 26, 168, 4, 240, 1201, 527, 28, 2394, 153, 401, 19, 49, 0, 47, 2,
+				26, 28, 7, 1158, 761, 30, 83, 137, 987, 94, 97, 8, 1125, 2187, 745, 50,
+				4, 331, 989, 1116, 19, 804, 77, 19, 0, 473, 693, 343, 1676, 528, 25, 613,
+				41, 485, 47, 11, 7, 7, 970, 318, 0, 197, 130, 544, 9, 0, 10, 30,
+				1673, 5, 1, 794, 675, 335, 168, 2, 34, 4, 2, 1, 4, 2, 1360, 2,
+				449, 41, 594, 25, 319, 10, 3, 6, 0, 12, 13, 3, 22, 591, 885, 5,
+				68, 3, 135, 13, 156, 715, 260, 22, 1102, 210, 120, 1, 1371, 90, 855, 783,
+				297, 1208, 29, 0, 25, 1338, 134, 173, 237, 122, 15, 297, 163, 61, 15, 161,
+				613, 27, 1973, 121, 844, 3, 1047, 2393, 28, 1, 384, 56, 6, 169, 139, 96,
+				597, 38, 45, 1051, 11, 21, 9, 452, 353, 664, 960, 57, 224, 106, 1129, 53,
+				1073, 65, 1, 754, 0, 1318, 1845, 27, 854, 16, 12, 1, 325, 0, 1870, 14,
+				0, 13, 1745, 419, 2, 195, 65, 297, 62, 7, 667, 343, 0, 571, 319, 0,
+				347, 124, 21, 1519, 389, 31, 222, 42, 1270, 786, 24, 182, 954, 397, 7273, 1037,
+				3513, 6, 622, 0, 4960, 1955, 6690, 75, 51, 175, 19, 567, 24, 54, 306, 17,
+				1671, 41, 1, 767, 28, 234, 1564, 14, 3984, 132, 65, 31, 5250, 191, 459, 21,
+				659, 120, 11, 0, 141, 137, 155, 2462, 216, 931, 996, 10183, 1039,
+			};
+
+			// Slot -> symbol id
+			inline constexpr std::array<uint16_t, COUNT> SLOTS = {
+				6156, 1091, 3295, 3159, 4633, 2176, 4820, 1042, 5932, 3827, 1372, 6346, 3655, 2356, 244, 5862,
+				6479, 2207, 4400, 5025, 1262, 6006, 3420, 3467, 4538, 5158, 413, 4829, 2478, 5948, 1465, 4875,
+				3225, 3204, 4986, 66, 1227, 6317, 5993, 6937, 3810, 2063, 1411, 5869, 6766, 1380, 5233, 1994,
+				6279, 4174, 2699, 6760, 1861, 1150, 5744, 4387, 6449, 5455, 6264, 1212, 2824, 78, 170, 6025,
+				5253, 1870, 727, 2128, 952, 4177, 627, 4146, 2548, 3715, 5222, 4881, 567, 1719, 6643, 4450,
+				910, 2226, 2162, 3892, 5822, 1056, 3841, 2084, 695, 6858, 2492, 3680, 6103, 5827, 3276, 6746,
+				6601, 524, 143, 5845, 4267, 255, 3709, 4650, 6300, 282, 81, 3257, 6029, 2002, 793, 4244,
+				547, 1924, 6783, 6922, 360, 4958, 1322, 638, 1535, 4940, 1794, 2918, 2455, 5979, 3544, 3870,
+				1627, 2143, 4041, 5316, 6832, 2023, 2417, 3143, 1936, 5079, 6337, 2056, 5267, 2795, 5485, 4481,
+				148, 2370, 5379, 746, 2847, 1225, 4817, 5696, 585, 5034, 2501, 1084, 442, 6019, 6500, 3415,
+				4738, 4111, 5457, 5301, 4134, 1424, 6551, 887, 804, 50, 287, 2484, 5636, 226, 92, 4473,
+				203, 5361, 4491, 2902, 2343, 5829, 2415, 5994, 3407, 5279, 5105, 4839, 4029, 1050, 3168, 332,
+				3223, 5665, 881, 5951, 3221, 1405, 1063, 1812, 5376, 3424, 6576, 1097, 6845, 145, 1343, 337,
+				2504, 2684, 3971, 371, 1734, 480, 3478, 5583, 6158, 5258, 3822, 6844, 6773, 199, 2746, 2257,
+				4900, 4392, 2842, 5901, 1665, 5076, 477, 6299, 1407, 1452, 2722, 2245, 1881, 1421, 252, 2248,
+				1797, 6536, 5346, 2466, 674, 330, 1003, 3615, 4528, 3713, 2844, 1816, 326, 6437, 3340, 1820,
+				2393, 631, 2967, 5341, 416, 6661, 3397, 3751, 4425, 4185, 4682, 1970, 2014, 1928, 4860, 14,
+				5106, 5099, 469, 927, 4218, 5440, 3488, 3574, 5017, 794, 1486, 4199, 6208, 4122, 3877, 6761,
+				4759, 5976, 1320, 5944, 2883, 5623, 4548, 2776, 5970, 5472, 762, 4783, 2841, 5453, 2790, 1495,
+				6344, 1390, 795, 2609, 6909, 3725, 5950, 1768, 6088, 2231, 1377, 1305, 4763, 5840, 5796, 2384,
+				3299, 4962, 195, 1155, 2201, 5878, 5966, 5612, 6856, 4784, 466, 6597, 2230, 643, 5427, 5186,
+				3036, 6452, 3432, 3294, 3317, 2234, 3076, 6461, 3376, 3774, 5750, 938, 6621, 3024, 2382, 4683,
+				4420, 2629, 55, 1564, 8, 6154, 3439, 5511, 3382, 6642, 2404, 6682, 5276, 2266, 4278, 5677,
+				4268, 4068, 497, 738, 2708, 6277, 2303, 1457, 6221, 2546, 778, 297, 1531, 4877, 1701, 6467,
+				5168, 774, 5924, 4720, 5828, 174, 3580, 2421, 2155, 6315, 5688, 786, 1567, 2596, 6812, 2515,
+				4733, 1969, 4161, 4175, 2126, 2711, 2324, 6550, 2268, 2033, 6649, 4908, 4115, 6409, 3785, 740,
+				212, 4352, 1048, 2805, 6122, 2735, 2097, 1536, 3390, 3764, 3473, 717, 4519, 4, 6729, 6160,
+				3388, 4036, 5184, 4620, 5866, 6862, 222, 93, 3708, 3526, 645, 2283, 528, 5689, 5297, 6561,
+				1215, 6436, 2445, 3763, 733, 5537, 5813, 6470, 6336, 68, 228, 51, 2473, 5837, 256, 6328,
+				1247, 601, 5063, 3436, 2276, 3161, 765, 149, 6758, 1500, 5643, 1905, 5357, 2165, 4805, 6011,
+				663, 3086, 2225, 713, 3820, 2332, 1427, 6150, 286, 1201, 6252, 5215, 570, 2913, 3611, 2860,
+				3692, 2656, 5694, 6433, 3094, 2211, 1824, 3948, 6079, 5784, 2389, 920, 5178, 1494, 4226, 2762,
+				1977, 2144, 1968, 3946, 5772, 4963, 3675, 6465, 156, 4204, 3872, 4012, 5701, 6331, 4574, 3147,
+				4497, 3342, 3777, 3600, 5800, 1375, 2936, 4452, 5904, 4488, 2053, 2243, 4707, 4367, 911, 6813,
+				981, 3646, 1099, 1778, 3953, 1765, 25, 5132, 4358, 3608, 3563, 1963, 4706, 4168, 1132, 2601,
+				1089, 4849, 2465, 628, 2672, 935, 1990, 4294, 1129, 3952, 606, 1368, 4808, 4658, 1919, 1740,
+				5809, 1503, 2495, 6840, 2249, 1152, 1075, 5123, 6110, 2312, 4643, 26, 6935, 6948, 2158, 3335,
+				5633, 4520, 3975, 6924, 673, 3274, 6144, 2247, 6454, 5803, 3440, 732, 4760, 5611, 5077, 3976,
+				5385, 284, 1695, 3640, 4435, 4912, 633, 1183, 5477, 3091, 4444, 4458, 6207, 1134, 5695, 2942,
+				2499, 1416, 1224, 179, 1098, 478, 1014, 4531, 2605, 3998, 3301, 3826, 5815, 3492, 6048, 4859,
+				4645, 532, 3456, 5352, 74, 1698, 2464, 5419, 2968, 2521, 207, 5973, 3746, 4750, 4705, 2920,
+				3196, 2448, 5531, 5188, 4275, 1571, 3017, 1582, 3638, 4943, 1688, 2481, 2718, 6352, 1433, 3021,
+				672, 2409, 4555, 2493, 4430, 3148, 2640, 1230, 6092, 5711, 3864, 1364, 4604, 5395, 6955, 6171,
+				6693, 4807, 1473, 5712, 3189, 2476, 4550, 1355, 3610, 801, 2565, 4020, 6633, 4719, 6407, 998,
+				2094, 2457, 4013, 3054, 6741, 1434, 1689, 4832, 4834, 1672, 6499, 2036, 3481, 984, 3821, 1397,
+				6234, 3682, 3804, 1406, 428, 5284, 6491, 2660, 5334, 6078, 1652, 5211, 5915, 1633, 1678, 2970,
+				2387, 5724, 986, 4353, 3616, 1662, 1351, 6222, 3747, 1933, 741, 6276, 5542, 3365, 206, 3009,
+				6383, 4391, 4222, 2915, 1553, 5051, 4544, 1301, 6100, 3582, 6529, 5895, 635, 1821, 1763, 4090,
+				2365, 1702, 5061, 4228, 4659, 3999, 791, 6620, 4119, 4074, 204, 1318, 3592, 6442, 5298, 5291,
+				6417, 3780, 1604, 4629, 6308, 6130, 2710, 2459, 5095, 5304, 489, 636, 2024, 6952, 5249, 4181,
+				2669, 3887, 5148, 2530, 471, 5016, 3004, 855, 5931, 1333, 3779, 1239, 1631, 1365, 3521, 5841,
+				1532, 4942, 6801, 3136, 5113, 679, 3106, 3438, 4334, 1700, 4586, 6827, 4580, 1435, 1595, 5360,
+				5478, 3606, 2861, 3160, 353, 3586, 6606, 240, 1791, 3556, 6481, 1417, 3863, 815, 3289, 5588,
+				258, 4475, 2295, 3153, 646, 3165, 545, 3914, 6505, 499, 73, 2688, 6735, 6201, 453, 352,
+				1440, 1049, 5991, 4066, 3123, 1914, 4646, 4745, 4138, 5911, 5327, 4372, 5383, 1705, 2663, 5091,
+				5607, 564, 6341, 2741, 6124, 1394, 6007, 2378, 5919, 1207, 747, 4997, 6876, 2542, 6098, 4514,
+				1184, 315, 2474, 5216, 6354, 1823, 6786, 4456, 3699, 5153, 1591, 5195, 5563, 4077, 2334, 3571,
+				5763, 1055, 6365, 3125, 1522, 379, 3982, 2488, 1801, 5416, 4944, 2887, 3974, 4123, 1607, 6332,
+				2969, 744, 1347, 535, 2524, 3337, 1248, 701, 2692, 2705, 3347, 377, 869, 1577, 4462, 6556,
+				3778, 6241, 797, 726, 1654, 4562, 4166, 1572, 600, 1112, 773, 681, 1568, 1090, 4219, 860,
+				4572, 4923, 459, 6453, 1829, 599, 3878, 3242, 6732, 4395, 4797, 6819, 3516, 2270, 6720, 4530,
+				2566, 6622, 6667, 6152, 6055, 6810, 1733, 4856, 1711, 158, 4508, 5024, 780, 2236, 3216, 6944,
+				3509, 2888, 6202, 3, 6895, 4728, 5424, 3351, 3550, 907, 5318, 3728, 2167, 6480, 448, 2555,
+				954, 6123, 5954, 4096, 1975, 6478, 6678, 5593, 5634, 5124, 5754, 3669, 4897, 4810, 6575, 6182,
+				21, 3075, 4841, 6143, 1650, 4891, 6904, 776, 4929, 5885, 2993, 3374, 3847, 6730, 915, 6397,
+				3018, 5913, 4665, 3288, 3658, 1898, 5562, 5120, 1833, 1321, 4035, 4991, 2354, 452, 5134, 2395,
+				1849, 2267, 5393, 4460, 6065, 6833, 376, 127, 4751, 3002, 6174, 1811, 699, 5058, 2341, 5464,
+				6335, 4200, 5074, 229, 2863, 1332, 4005, 548, 1526, 1403, 2767, 3855, 168, 1009, 3298, 6444,
+				484, 3187, 2613, 5709, 3899, 1024, 6626, 6848, 4647, 5622, 4873, 4781, 224, 35, 2299, 1722,
+				517, 5167, 3938, 5220, 745, 4305, 1807, 5547, 1761, 6788, 593, 3138, 6828, 4742, 6236, 5969,
+				2700, 6487, 4065, 3259, 6547, 3951, 4466, 2836, 5328, 22, 1879, 260, 1953, 6472, 2639, 2224,
+				5957, 4351, 5691, 4969, 664, 696, 7, 5764, 4215, 6188, 4644, 893, 3133, 2593, 2093, 3589,
+				3549, 1312, 951, 2657, 4992, 2754, 4326, 6129, 1081, 5205, 6814, 6445, 2759, 4602, 6200, 4757,
+				5510, 3644, 444, 3928, 634, 5450, 4804, 3486, 1598, 6081, 6204, 5959, 739, 6592, 4440, 4972,
+				2594, 1527, 2682, 2366, 5052, 5821, 6181, 6042, 4708, 5125, 4898, 2866, 4961, 1525, 6333, 6303,
+				5942, 1534, 2573, 6075, 5032, 903, 621, 5752, 4374, 1086, 1389, 3733, 487, 6293, 163, 5426,
+				4153, 5825, 3319, 1250, 6239, 6351, 2728, 4171, 5394, 2781, 5865, 6769, 3081, 3590, 1102, 4259,
+				5154, 4598, 3621, 1966, 5021, 4594, 5062, 3934, 626, 4104, 3244, 5433, 5338, 4361, 5174, 6630,
+				63, 2186, 4099, 2070, 2198, 2856, 3391, 1010, 4000, 5386, 749, 5525, 382, 2500, 359, 4612,
+				5146, 300, 5830, 4959, 4098, 1544, 1067, 3985, 231, 1167, 4662, 6628, 657, 6847, 6471, 6870,
+				141, 2401, 2816, 3495, 154, 4292, 5802, 2783, 4549, 4934, 1383, 2715, 1101, 660, 4396, 5336,
+				1775, 596, 1813, 6634, 6694, 3087, 6815, 4439, 3313, 5758, 4245, 2031, 5647, 6906, 2749, 192,
+				169, 4630, 172, 611, 808, 670, 2598, 3578, 5023, 5655, 671, 957, 2008, 4288, 2086, 1709,
+				2646, 4402, 2954, 2298, 4546, 1900, 2477, 5169, 2428, 5698, 423, 3363, 5283, 622, 437, 2534,
+				5035, 2768, 6483, 2760, 3679, 3266, 6131, 3807, 6891, 5939, 281, 3058, 3011, 5740, 3262, 4885,
+				5012, 1648, 3497, 1617, 6849, 814, 5848, 5479, 2037, 2098, 6612, 6199, 5259, 399, 5321, 4105,
+				2830, 1790, 2914, 3171, 996, 3823, 1958, 12, 4427, 18, 5461, 1853, 1814, 4535, 5767, 3576,
+				3268, 4935, 6585, 344, 5498, 2250, 94, 950, 6496, 3183, 5795, 3430, 5557, 2528, 4500, 2163,
+				6715, 2612, 6619, 5066, 5049, 2686, 6905, 6624, 2985, 4412, 5816, 5684, 1649, 6053, 4303, 432,
+				1723, 106, 1957, 2072, 4684, 2802, 6938, 5582, 6423, 4866, 1537, 6549, 1441, 6249, 5198, 3271,
+				1483, 5751, 3012, 6214, 2848, 1472, 2058, 5554, 3341, 4774, 685, 6018, 2695, 882, 3455, 4828,
+				1799, 6545, 4960, 5055, 147, 4801, 1515, 3981, 818, 1340, 4314, 6933, 5975, 5228, 3419, 3032,
+				2077, 89, 5309, 2358, 4343, 4378, 3671, 1864, 921, 1045, 5399, 2132, 2650, 1447, 2296, 4773,
+				2049, 698, 2833, 692, 3260, 1869, 4141, 807, 4821, 5387, 280, 4403, 4040, 4687, 6147, 6582,
+				3250, 349, 4047, 1860, 2829, 5373, 6012, 987, 2604, 1912, 2787, 6913, 2043, 3958, 6940, 6749,
+				6884, 5749, 2436, 506, 5139, 5522, 4802, 3535, 250, 766, 2065, 6080, 4957, 4492, 1540, 3504,
+				697, 4739, 6572, 6864, 798, 1177, 5111, 1552, 5619, 4091, 5736, 4770, 615, 3267, 2073, 6930,
+				5876, 3285, 3016, 2061, 5071, 2694, 1133, 4950, 159, 6690, 6785, 4618, 4826, 2986, 3098, 6822,
+				3790, 1307, 825, 6558, 4438, 6064, 6704, 6096, 5591, 2782, 4741, 5031, 2310, 649, 6405, 5603,
+				6685, 5302, 2099, 6115, 642, 5559, 2130, 2228, 4276, 1609, 6548, 6364, 5294, 4008, 942, 2757,
+				3082, 6866, 1749, 6193, 5102, 906, 4455, 6355, 3898, 2595, 5927, 1837, 6360, 3229, 2529, 6790,
+				1693, 2411, 6447, 6583, 348, 5104, 6474, 3787, 5729, 2621, 3377, 715, 4996, 6149, 3001, 5792,
+				2489, 4553, 5686, 6657, 3596, 5649, 2394, 3041, 1127, 4611, 3067, 1254, 6385, 6133, 1158, 5470,
+				3850, 714, 5171, 1052, 4583, 2416, 3945, 6613, 6184, 4477, 4120, 5864, 13, 1296, 2076, 2825,
+				5295, 2557, 3799, 561, 3258, 6541, 405, 5325, 4463, 2210, 1241, 6659, 3726, 4056, 2673, 2550,
+				4192, 2138, 6408, 3284, 2319, 3553, 6959, 2429, 3245, 6373, 77, 4811, 5128, 6706, 719, 4527,
+				304, 3519, 1339, 1796, 864, 4736, 1597, 5985, 61, 6697, 2685, 2309, 1117, 2809, 4803, 2868,
+				871, 4482, 2927, 2085, 2717, 361, 6117, 1012, 2643, 3794, 1542, 6322, 1603, 6896, 1866, 3670,
+				120, 4567, 460, 4125, 6440, 5496, 2486, 4631, 1314, 6473, 4551, 5921, 878, 1023, 3157, 6086,
+				6327, 1068, 2115, 3206, 3800, 2516, 4001, 944, 1233, 1020, 2064, 1243, 54, 4453, 76, 6020,
+				5112, 4922, 625, 4370, 1092, 3816, 5861, 1336, 3599, 4619, 5995, 1922, 1439, 2786, 2278, 5368,
+				6726, 2677, 5738, 2831, 5618, 2301, 5039, 5856, 5881, 6666, 2750, 1122, 4712, 6587, 4285, 144,
+				5353, 731, 629, 2146, 2435, 1327, 3104, 870, 552, 6744, 3134, 5770, 2703, 5094, 6524, 6127,
+				6312, 5741, 3648, 6119, 4918, 4844, 2135, 3840, 2046, 5187, 165, 38, 2998, 3309, 1956, 1759,
+				5667, 2774, 4187, 4754, 1785, 1028, 4080, 835, 1249, 6502, 5529, 5543, 4988, 140, 2105, 1838,
+				1153, 6593, 2872, 6255, 6256, 1897, 514, 1690, 3547, 3990, 2502, 5003, 3483, 6004, 1985, 6441,
+				6173, 5493, 5492, 3668, 6233, 4302, 1947, 6, 5243, 4792, 4446, 1106, 1995, 5592, 6311, 809,
+				137, 5245, 6062, 173, 4024, 4766, 1071, 1889, 5852, 6095, 4518, 4325, 588, 6900, 3933, 3279,
+				3077, 1263, 5366, 896, 6722, 2400, 1297, 971, 1126, 5491, 5320, 5657, 1414, 5463, 4822, 3984,
+				1051, 2379, 584, 4217, 2199, 6774, 6528, 3710, 510, 3704, 293, 1428, 1842, 2943, 983, 3496,
+				2423, 6066, 5579, 6206, 1950, 356, 3716, 5965, 5422, 394, 2047, 5085, 755, 6001, 3696, 3066,
+				4990, 5396, 10, 2873, 4543, 3306, 3195, 2756, 5271, 3567, 3344, 5504, 4052, 5312, 6357, 4853,
+				4626, 988, 5028, 2159, 5863, 5181, 4974, 389, 6307, 5606, 6138, 5202, 6663, 5972, 6063, 1328,
+				5851, 2561, 5561, 3861, 4128, 2879, 58, 4130, 6388, 4312, 579, 6653, 1061, 6532, 824, 4904,
+				2980, 1524, 2175, 720, 4308, 3537, 1545, 6868, 4415, 3207, 5605, 3174, 5928, 5349, 3750, 4025,
+				2039, 2563, 6023, 2562, 3956, 2102, 3996, 4045, 4093, 582, 1760, 6869, 618, 5475, 5143, 632,
+				3151, 6943, 5831, 5722, 3475, 6371, 3926, 3368, 248, 5952, 262, 5938, 5161, 4470, 2190, 390,
+				1429, 2113, 5054, 3353, 3683, 3316, 1798, 5046, 1848, 5441, 3163, 3910, 3731, 419, 6476, 3752,
+				2676, 2623, 138, 6503, 3124, 934, 5569, 1236, 3364, 88, 1561, 1868, 3530, 4190, 465, 4652,
+				6074, 1308, 2583, 6304, 6686, 4332, 4554, 6298, 4921, 1687, 1203, 6518, 1032, 2723, 4529, 849,
+				455, 5293, 918, 2172, 5500, 3566, 5344, 4819, 2054, 6696, 5044, 4925, 1, 1335, 4864, 1160,
+				186, 1038, 1667, 2869, 6085, 533, 4234, 4498, 6702, 847, 2433, 6665, 876, 2209, 1538, 959,
+				4694, 278, 3505, 2246, 5818, 4825, 3941, 655, 1163, 4525, 3943, 3265, 237, 3786, 5264, 176,
+				828, 6589, 3518, 1684, 2850, 3637, 3528, 4677, 4981, 3947, 4717, 2240, 3707, 329, 543, 5781,
+				5151, 4946, 3437, 605, 3426, 4291, 1064, 2009, 1893, 1602, 1116, 1021, 691, 3597, 3110, 2585,
+				2900, 2804, 1680, 3203, 2121, 128, 4734, 1858, 3302, 3122, 2895, 1066, 6456, 60, 6553, 5115,
+				4250, 367, 5067, 2479, 941, 5823, 6941, 1855, 3700, 6637, 2666, 166, 2122, 4033, 1192, 610,
+				5780, 3394, 2976, 5005, 135, 757, 3771, 4046, 6504, 374, 1475, 6350, 4494, 3620, 3635, 3714,
+				1686, 5811, 1948, 2467, 429, 4086, 2263, 4070, 4813, 3300, 4579, 4914, 6090, 6265, 6093, 4107,
+				6776, 1131, 6598, 1221, 4556, 2108, 2618, 5850, 5296, 1786, 3417, 6220, 4846, 3690, 5759, 4735,
+				1653, 3484, 116, 4879, 2040, 6284, 6843, 1151, 370, 493, 3423, 2034, 4655, 1800, 5458, 6672,
+				4235, 2472, 982, 4269, 5430, 1292, 2532, 4330, 3166, 1283, 1901, 1190, 1482, 3994, 2739, 6356,
+				4571, 3056, 400, 313, 2350, 3205, 6254, 2371, 6166, 1656, 2747, 3275, 3053, 677, 2071, 2683,
+				4587, 6771, 4747, 6165, 4753, 4796, 2823, 723, 4169, 6058, 2931, 6278, 5337, 6772, 6681, 3277,
+				6091, 5987, 131, 1910, 3035, 837, 339, 312, 4581, 1923, 3333, 3479, 2145, 5069, 4874, 2964,
+				5908, 1088, 3418, 861, 3339, 4545, 2353, 3756, 2067, 5022, 4238, 2168, 4103, 6137, 270, 3639,
+				5765, 2451, 591, 1669, 4213, 3903, 3524, 1189, 4504, 6721, 2537, 1710, 4848, 4300, 4260, 3865,
+				3579, 4087, 1619, 3768, 4189, 242, 2864, 1148, 4880, 2004, 6836, 5553, 5041, 6412, 6057, 3853,
+				1199, 4207, 2286, 2602, 6379, 3118, 4196, 2347, 1783, 2339, 123, 178, 6739, 1232, 4699, 4366,
+				6287, 4467, 4563, 4233, 3795, 5757, 82, 725, 3561, 5578, 1022, 5409, 3273, 1751, 1643, 2748,
+				5789, 5404, 1925, 4837, 1450, 1707, 6266, 6865, 3217, 6185, 365, 5437, 1299, 4283, 857, 6392,
+				1015, 5448, 2822, 4193, 4718, 6197, 3405, 783, 3802, 6432, 5335, 4513, 5804, 6762, 4982, 640,
+				4017, 4878, 494, 4082, 3533, 576, 2139, 6784, 3487, 5859, 5675, 3808, 6014, 3109, 1630, 1585,
+				6186, 5620, 6569, 6656, 1449, 3742, 554, 6451, 4258, 3950, 6800, 2333, 3029, 2289, 5884, 1737,
+				2961, 1762, 1583, 1213, 4812, 4999, 1620, 689, 3494, 2775, 3090, 2494, 1659, 5907, 6714, 6947,
+				623, 1216, 171, 2420, 3014, 2798, 1123, 398, 1896, 3498, 2402, 4850, 5356, 4133, 4515, 5365,
+				2272, 2431, 2454, 4744, 6855, 6627, 3049, 1884, 3149, 6087, 2933, 978, 3130, 662, 544, 1997,
+				1808, 6260, 2649, 3185, 6463, 4076, 2731, 5721, 1587, 1453, 4557, 2507, 2797, 4436, 3727, 1182,
+				4336, 6752, 2991, 4978, 4791, 4905, 4385, 1725, 5486, 4919, 3555, 407, 3717, 6217, 6826, 2581,
+				395, 2318, 3689, 1586, 3026, 1031, 155, 5735, 2075, 6227, 2615, 2702, 3190, 4163, 2030, 5240,
+				3705, 3965, 5867, 2, 4298, 5968, 1708, 5098, 3373, 2109, 4157, 6237, 1766, 4148, 4532, 1983,
+				6482, 1854, 4398, 5229, 3738, 6026, 2114, 2090, 6835, 6647, 5774, 586, 267, 438, 6286, 3674,
+				1362, 1451, 1623, 2893, 5292, 2205, 3632, 6857, 1438, 1959, 3792, 1442, 2325, 2180, 1560, 5452,
+				1996, 3612, 2119, 6039, 1290, 5087, 19, 4432, 4464, 6155, 597, 1315, 5311, 619, 4095, 235,
+				1907, 854, 892, 2182, 6387, 964, 1284, 1033, 1882, 3625, 2901, 1270, 1257, 6584, 6568, 4584,
+				4152, 2308, 5732, 5806, 3662, 2111, 384, 6520, 6928, 2069, 6779, 2671, 1641, 6934, 6060, 2892,
+				2446, 6617, 124, 5466, 3331, 392, 1125, 417, 2734, 1058, 2214, 6348, 1425, 1554, 3511, 3672,
+				4333, 1013, 2944, 6775, 30, 5660, 1521, 5521, 2483, 1274, 5381, 1357, 2019, 1634, 5875, 2438,
+				1642, 99, 1261, 1529, 775, 2857, 2239, 4229, 2977, 908, 2799, 5182, 2587, 2906, 969, 3761,
+				1418, 3027, 3263, 1921, 4131, 3345, 1685, 6942, 5019, 4311, 6044, 4071, 4573, 3812, 333, 5141,
+				6082, 1664, 5812, 3604, 852, 612, 5989, 5414, 3979, 5992, 4255, 458, 4510, 90, 598, 5057,
+				5000, 4926, 308, 2637, 5285, 5844, 6338, 1551, 5225, 2264, 3880, 6687, 6159, 1325, 5638, 6650,
+				6705, 3693, 5359, 5042, 3967, 6170, 2564, 4184, 2590, 6562, 1507, 3099, 4798, 5632, 3115, 785,
+				3282, 4833, 414, 1039, 1395, 4126, 1246, 188, 4749, 5771, 385, 6410, 1404, 467, 4676, 6796,
+				5170, 3536, 3224, 5133, 1259, 48, 1876, 3441, 5015, 3146, 1366, 6270, 5710, 2576, 6588, 4691,
+				218, 2552, 1373, 5194, 3643, 5838, 6272, 3209, 126, 3191, 305, 2430, 3466, 6537, 6183, 5248,
+				202, 340, 571, 4454, 5138, 1044, 926, 1053, 4323, 3515, 6954, 1485, 4931, 3809, 6401, 2480,
+				3045, 1939, 3427, 1580, 2789, 846, 3759, 2287, 3290, 5836, 965, 1345, 4800, 6586, 5456, 3885,
+				4114, 2255, 1793, 1272, 6579, 5889, 5489, 2000, 4668, 2716, 265, 3485, 2412, 6242, 6259, 891,
+				1110, 4009, 888, 2141, 1293, 6196, 4241, 3837, 2988, 3007, 153, 512, 1226, 1103, 6825, 724,
+				787, 2551, 5118, 2329, 4489, 6638, 6424, 4014, 1787, 2651, 481, 327, 6623, 6036, 3922, 2045,
+				6316, 6925, 5589, 4383, 1731, 4637, 1054, 958, 6907, 5565, 676, 5503, 644, 6210, 1115, 6398,
+				5719, 3025, 1628, 1639, 511, 3421, 1584, 799, 5883, 31, 4143, 519, 3398, 1298, 4673, 6135,
+				5219, 2653, 3052, 4055, 5702, 4835, 6544, 2233, 4639, 4316, 3875, 4896, 1573, 2796, 4840, 3050,
+				4872, 4845, 2079, 4417, 3793, 5300, 6021, 4422, 1105, 3322, 853, 5145, 675, 3469, 5447, 1742,
+				500, 4814, 5922, 4243, 3867, 1062, 3193, 4743, 6391, 3848, 6104, 6821, 121, 4680, 3634, 3305,
+				2919, 2304, 28, 4429, 4592, 2294, 2273, 3681, 3602, 5761, 5946, 3776, 3308, 6691, 334, 3641,
+				4506, 33, 263, 431, 923, 386, 6402, 3247, 411, 4790, 3664, 261, 5996, 5977, 3080, 5109,
+				1668, 6416, 2485, 6468, 6736, 2403, 1721, 880, 6711, 4938, 947, 4723, 295, 6232, 551, 5256,
+				2571, 1295, 6728, 994, 6908, 4144, 426, 3055, 211, 6132, 5654, 4061, 2340, 6475, 6542, 6141,
+				2178, 4394, 6514, 6302, 4654, 2149, 6799, 3907, 6580, 687, 4445, 446, 2525, 4686, 2140, 607,
+				3278, 1857, 4561, 3857, 5797, 5323, 905, 5314, 5326, 5082, 6929, 580, 3401, 5783, 6809, 2642,
+				3057, 5480, 2169, 6070, 2670, 4010, 4423, 3828, 5305, 5497, 5988, 2924, 5509, 5, 1341, 2184,
+				2982, 2582, 2817, 2288, 3416, 6853, 2880, 769, 2540, 840, 1908, 3966, 6816, 3448, 6703, 900,
+				5517, 180, 856, 4156, 4132, 2328, 5199, 1676, 5906, 2307, 4903, 3737, 3468, 3954, 1280, 6823,
+				4382, 3243, 6230, 6889, 1992, 3452, 1932, 314, 4596, 4474, 2808, 943, 3796, 6191, 3433, 2432,
+				2062, 6669, 6218, 5983, 1539, 3139, 1550, 5152, 6099, 441, 271, 4851, 5668, 578, 4399, 3111,
+				6614, 4576, 1076, 238, 1492, 6153, 2897, 4365, 2029, 3743, 6755, 1302, 3859, 4642, 2904, 184,
+				526, 5715, 5278, 3458, 4322, 527, 4401, 5200, 5798, 6323, 3718, 5726, 215, 4930, 2821, 5652,
+				1019, 5669, 5900, 6846, 210, 5420, 6248, 5282, 130, 6280, 1589, 2173, 2311, 2156, 5136, 5451,
+				420, 1714, 4740, 6811, 2217, 955, 3595, 4566, 834, 6851, 2800, 945, 4240, 5700, 6530, 5505,
+				1692, 6329, 3944, 3514, 5886, 1913, 2631, 2443, 5308, 3540, 3583, 2867, 6596, 985, 5997, 1736,
+				6753, 4674, 2903, 5446, 3697, 6951, 3940, 1886, 4613, 1104, 185, 2148, 406, 1337, 810, 2777,
+				1136, 2766, 1563, 3904, 2771, 2261, 3757, 6501, 3286, 402, 6414, 6003, 1030, 1188, 707, 5144,
+				4917, 4522, 4582, 1165, 2934, 4701, 4304, 2572, 2721, 3607, 2733, 1729, 2092, 5690, 972, 72,
+				5610, 2252, 3429, 3873, 6655, 5705, 335, 6380, 3754, 4713, 5953, 4627, 3127, 4893, 3324, 1194,
+				761, 5173, 2461, 6768, 6516, 5348, 1114, 929, 1374, 4985, 4038, 4309, 1666, 2840, 976, 839,
+				2974, 6513, 5926, 2691, 1176, 6887, 4112, 4888, 2444, 6427, 2834, 710, 6139, 1508, 197, 5402,
+				3150, 3435, 604, 3252, 1592, 1208, 5210, 3176, 1324, 5246, 6050, 5310, 4266, 2645, 4279, 2018,
+				3862, 461, 2166, 4589, 902, 3983, 5731, 2971, 445, 3088, 4966, 3775, 1565, 5824, 3000, 3178,
+				3724, 4140, 6738, 6484, 2091, 4022, 3913, 3520, 5917, 4685, 4772, 1756, 3930, 784, 867, 656,
+				6377, 5887, 6636, 3917, 1002, 3119, 6339, 6871, 3184, 6084, 2828, 4341, 1420, 5799, 995, 4597,
+				1399, 2862, 3753, 3667, 3491, 5929, 4852, 3068, 2127, 5847, 4461, 6125, 2941, 6224, 6450, 1497,
+				1422, 6560, 4696, 264, 5056, 1036, 4180, 3618, 5269, 850, 3633, 1359, 716, 2305, 1638, 777,
+				424, 743, 4064, 5507, 316, 2987, 4973, 6751, 5658, 5007, 4097, 1945, 6915, 3312, 4409, 4507,
+				6680, 4979, 4345, 5650, 3457, 1400, 37, 2591, 530, 6399, 276, 1360, 4730, 5254, 2427, 6957,
+				3323, 4274, 1840, 2164, 266, 225, 4263, 3835, 1875, 1000, 4890, 5544, 2330, 3508, 4616, 234,
+				4689, 4338, 4480, 6817, 4558, 2513, 4746, 3894, 2517, 3539, 6808, 6709, 789, 1773, 3446, 5826,
+				669, 1590, 3132, 4729, 1369, 6818, 1222, 2654, 2958, 650, 24, 1205, 4537, 6071, 1256, 2519,
+				3280, 3702, 5319, 4600, 518, 1107, 4170, 4195, 2020, 273, 3063, 6578, 5539, 6194, 6546, 6921,
+				1843, 1448, 6882, 5027, 4539, 4362, 5937, 841, 4892, 5898, 2984, 4632, 1398, 4407, 4871, 3031,
+				6187, 2999, 5204, 1338, 6673, 4027, 2687, 6069, 239, 5444, 702, 2619, 5272, 434, 2806, 5445,
+				513, 291, 1210, 3126, 5791, 4761, 4359, 796, 5739, 3202, 1410, 2541, 1456, 3332, 1505, 521,
+				1817, 5602, 1988, 4767, 6376, 2491, 2845, 5190, 2005, 5364, 2219, 5857, 4661, 5597, 826, 2990,
+				3114, 3923, 1746, 5288, 712, 3703, 4485, 2665, 2755, 306, 5999, 4048, 728, 3920, 694, 2664,
+				5963, 5639, 3281, 1396, 1501, 4390, 328, 440, 4282, 4524, 5392, 6485, 5819, 575, 5532, 3450,
+				3228, 4428, 5980, 6290, 1459, 3096, 5462, 2917, 4945, 4397, 5237, 5728, 2589, 1938, 3803, 1519,
+				2680, 4827, 5540, 3231, 2630, 5747, 2907, 1480, 3688, 4225, 243, 5930, 4523, 2363, 4145, 3199,
+				1498, 2972, 2714, 342, 2698, 768, 5506, 1718, 2951, 2344, 654, 1716, 1944, 6374, 5037, 3745,
+				6083, 5776, 6526, 2381, 3881, 4593, 4088, 1906, 2490, 5608, 5339, 1082, 425, 3403, 44, 1929,
+				1037, 2302, 541, 602, 924, 6294, 3044, 2736, 522, 4424, 5262, 5613, 1087, 4726, 5766, 2659,
+				1223, 1541, 2690, 2496, 2858, 6016, 5628, 2223, 3380, 6240, 2724, 6262, 2877, 3652, 1174, 3287,
+				4785, 5371, 6343, 2314, 2707, 2957, 6157, 3254, 5020, 4895, 5519, 375, 2818, 2042, 3501, 4355,
+				1677, 5221, 4172, 4457, 3784, 75, 2241, 3023, 1724, 647, 1234, 3730, 39, 4678, 5009, 2729,
+				6313, 5261, 3474, 4261, 4054, 490, 1581, 2150, 4936, 3846, 5594, 4928, 2558, 6880, 119, 718,
+				104, 62, 6250, 539, 858, 5708, 3194, 3977, 3559, 5671, 6382, 1444, 187, 1809, 1145, 2235,
+				6713, 3937, 1827, 3564, 5512, 5412, 4486, 3989, 4660, 4565, 2028, 4449, 3932, 1008, 1219, 3338,
+				5163, 421, 6334, 6824, 1679, 6743, 4237, 5630, 1512, 1279, 4672, 6030, 534, 3326, 1566, 1095,
+				4357, 6517, 2706, 5981, 975, 3356, 1455, 4569, 2197, 1124, 4780, 803, 372, 2511, 4297, 1017,
+				1285, 5978, 2945, 6043, 3762, 2633, 5375, 3117, 5934, 277, 2975, 2237, 5535, 6898, 2012, 6216,
+				435, 4310, 2859, 536, 4483, 5150, 4037, 2469, 46, 6874, 2634, 1040, 3330, 2610, 1287, 2626,
+				3706, 948, 812, 6834, 408, 1661, 5116, 5523, 734, 470, 97, 1046, 1300, 5277, 5894, 5596,
+				4110, 2035, 2832, 1113, 6059, 3871, 4703, 6554, 6367, 6457, 1070, 756, 3685, 6247, 2779, 6901,
+				4516, 2351, 3532, 6893, 2232, 52, 5943, 6342, 4758, 1354, 4043, 381, 1162, 2983, 5526, 1344,
+				617, 3627, 3200, 6108, 1120, 5097, 3660, 1987, 2989, 1443, 4595, 2258, 462, 565, 4026, 3179,
+				5880, 219, 1934, 4198, 4794, 6289, 2600, 1720, 6782, 990, 6136, 4883, 274, 5714, 4413, 427,
+				690, 6683, 2352, 3385, 6508, 3408, 4664, 4155, 3935, 6190, 5471, 6031, 4113, 5230, 6446, 1358,
+				69, 764, 3283, 1777, 2118, 3413, 6151, 6112, 5398, 4375, 1980, 4167, 5670, 6434, 735, 4147,
+				967, 895, 4339, 3241, 5555, 553, 6032, 1034, 5363, 873, 2227, 2752, 83, 2518, 3642, 3770,
+				0, 2578, 5142, 1317, 6615, 540, 557, 568, 3927, 3211, 3167, 3964, 2959, 5566, 5251, 167,
+				5871, 603, 3500, 5083, 508, 6920, 4714, 758, 1578, 3135, 2142, 883, 1392, 4154, 6168, 5469,
+				1942, 5214, 343, 1240, 4907, 5748, 1651, 310, 4695, 3396, 4830, 4799, 378, 865, 6073, 3960,
+				2279, 2547, 6488, 6411, 1490, 2326, 3824, 1077, 5201, 3348, 5013, 970, 5581, 2297, 4479, 1513,
+				5070, 5725, 5551, 3292, 4509, 5238, 5436, 2751, 5663, 3949, 2916, 2316, 2603, 3748, 6211, 3649,
+				6497, 5737, 1750, 1276, 1352, 4296, 1172, 5746, 6431, 3749, 1753, 5084, 1141, 6567, 27, 5250,
+				102, 3663, 5266, 6531, 3201, 2348, 2527, 196, 2204, 4622, 2753, 4823, 5164, 2419, 6163, 2658,
+				3507, 2422, 5790, 4350, 2048, 851, 4615, 2597, 4206, 5962, 324, 4782, 1464, 56, 4271, 3665,
+				1431, 4301, 6806, 5805, 3100, 2052, 5096, 6510, 6400, 5454, 205, 6192, 4356, 2599, 3758, 2616,
+				2881, 5137, 1041, 5114, 5998, 5699, 6631, 3383, 368, 1436, 1575, 4693, 4021, 2855, 5244, 6897,
+				2871, 700, 4108, 3013, 4955, 1458, 3781, 1890, 1885, 2342, 3916, 157, 2200, 1471, 6448, 1899,
+				1782, 1952, 3997, 2357, 4044, 520, 1788, 2925, 6668, 230, 2089, 4018, 3565, 3141, 4656, 5982,
+				4816, 4862, 1520, 2935, 772, 5423, 6102, 5265, 503, 6618, 6175, 1304, 1386, 47, 6189, 3113,
+				5580, 2377, 3801, 5403, 4106, 3783, 4614, 2606, 2390, 4692, 4459, 5197, 639, 1697, 5786, 4220,
+				1815, 4051, 1847, 3732, 590, 1663, 6010, 3172, 4212, 4121, 5662, 4281, 1626, 6439, 1982, 2104,
+				4503, 3789, 221, 1198, 4354, 1326, 5482, 3929, 2254, 3577, 781, 5378, 502, 3409, 5716, 1180,
+				844, 2315, 2244, 5629, 3869, 5242, 6370, 3969, 3598, 3084, 214, 4431, 175, 1476, 1670, 1904,
+				181, 6369, 862, 9, 3510, 289, 6854, 6038, 1187, 2896, 4496, 6523, 4451, 57, 3529, 2910,
+				451, 5342, 1281, 32, 3741, 3270, 4886, 4441, 6430, 4015, 133, 5263, 2827, 1211, 6611, 1268,
+				336, 6353, 6745, 4039, 5036, 6923, 3876, 3915, 2807, 5678, 5484, 5193, 5380, 5203, 3995, 2170,
+				6859, 3626, 3445, 1986, 1348, 6017, 4006, 4293, 3647, 5033, 1915, 1109, 2081, 6077, 2497, 1408,
+				1715, 1895, 3325, 1610, 4059, 5833, 3819, 3698, 1228, 6610, 1264, 3905, 6533, 4389, 5303, 1696,
+				5369, 4376, 3177, 2962, 6515, 5121, 6570, 6521, 6837, 1941, 763, 4254, 4117, 3614, 3851, 5127,
+				2792, 2878, 6759, 5268, 3461, 556, 5006, 3619, 3227, 3906, 6443, 1806, 3654, 558, 3548, 5217,
+				6219, 253, 201, 3140, 2010, 3443, 686, 6795, 2549, 5858, 4641, 85, 4346, 3860, 5050, 3673,
+				290, 5384, 2265, 3545, 4933, 1646, 6605, 5117, 1309, 6097, 3991, 6493, 6507, 4384, 3051, 2362,
+				6860, 1331, 4651, 6140, 1202, 4953, 2791, 1822, 2949, 1489, 87, 3131, 2471, 2973, 491, 2475,
+				2560, 4956, 70, 4414, 6723, 2697, 3782, 2368, 162, 3318, 2157, 1920, 5893, 5060, 2016, 1839,
+				6557, 1706, 2359, 4208, 705, 3829, 5425, 208, 919, 6195, 3358, 5177, 1356, 6885, 1728, 3370,
+				6540, 5920, 1622, 5745, 875, 4932, 6105, 2183, 109, 3661, 752, 751, 6608, 2407, 2611, 4769,
+				2238, 2383, 1493, 3839, 4248, 2763, 3980, 2652, 2259, 5501, 5100, 5370, 6878, 2738, 608, 6061,
+				6403, 5483, 4028, 5126, 2899, 3721, 4287, 6459, 6731, 5949, 1976, 5960, 6917, 3568, 86, 6118,
+				5645, 1415, 1303, 3272, 6049, 5860, 1470, 6877, 1069, 1154, 2082, 5936, 4994, 3197, 3729, 2592,
+				5808, 4588, 3623, 4941, 2160, 2966, 3425, 4610, 2220, 1874, 6381, 680, 658, 4023, 3712, 6178,
+				2103, 5180, 5940, 5817, 355, 3121, 105, 5961, 6363, 2361, 5621, 2194, 2526, 3144, 6052, 4560,
+				160, 5683, 4731, 4534, 890, 5494, 6002, 4476, 299, 2769, 268, 3008, 3019, 4129, 3460, 2161,
+				2885, 6754, 2282, 2203, 4252, 973, 1926, 4568, 2837, 6076, 4590, 1576, 3838, 1193, 1909, 4348,
+				245, 5681, 6415, 5571, 1231, 4182, 6509, 4606, 3527, 4954, 5307, 91, 2212, 4277, 1802, 4003,
+				1385, 5030, 5468, 6692, 6852, 2632, 6559, 1614, 6700, 1334, 3357, 3310, 220, 5600, 4601, 2442,
+				3073, 5637, 79, 182, 401, 6309, 2533, 6229, 3482, 303, 5073, 587, 457, 3233, 6609, 6797,
+				3921, 3896, 2704, 1727, 3849, 2213, 6421, 4216, 6425, 3030, 5787, 1880, 3097, 5101, 3101, 5072,
+				6041, 2773, 5631, 2293, 2136, 6372, 2994, 5899, 4335, 2100, 4786, 2946, 2539, 6919, 4591, 2843,
+				322, 6918, 2886, 23, 4603, 1846, 997, 5421, 2498, 2544, 4762, 4724, 577, 5129, 2349, 1238,
+				4317, 2256, 560, 4083, 4380, 1286, 6764, 3226, 6883, 2744, 358, 1179, 1288, 523, 3659, 1772,
+				3678, 1361, 4795, 345, 1593, 5389, 3164, 2780, 525, 5956, 439, 2188, 6950, 1657, 4280, 64,
+				387, 6594, 6684, 3192, 6413, 3065, 3182, 4869, 2947, 6737, 6148, 6169, 5059, 5843, 4176, 5206,
+				3557, 3811, 2106, 4700, 4547, 1509, 1852, 6555, 5742, 3220, 6384, 2021, 2346, 6698, 1771, 3336,
+				6767, 3095, 2154, 4478, 6114, 5313, 730, 1647, 2614, 5435, 2192, 2620, 4779, 2413, 3798, 3355,
+				3129, 6902, 6671, 1330, 5110, 5782, 5935, 6945, 3814, 5810, 5545, 6708, 29, 2462, 1363, 5888,
+				479, 3291, 3882, 5753, 3931, 1130, 6725, 2193, 3942, 2191, 1547, 5149, 879, 4075, 504, 6273,
+				3543, 5533, 3411, 1393, 1514, 5108, 6577, 2134, 4577, 802, 5078, 3264, 6257, 1506, 1311, 4118,
+				5577, 940, 2055, 194, 3630, 4787, 6285, 961, 3817, 113, 6710, 5340, 2979, 4768, 3230, 4465,
+				6676, 1694, 3248, 2538, 122, 36, 3830, 65, 3375, 2290, 71, 6107, 1559, 956, 5274, 1323,
+				275, 2202, 3105, 4042, 6209, 101, 198, 3471, 6522, 2221, 1574, 754, 3806, 5289, 6404, 1121,
+				2574, 4349, 933, 2758, 6319, 3657, 294, 5372, 666, 1937, 2803, 3042, 1533, 142, 1961, 904,
+				3059, 5157, 1253, 1741, 6916, 4710, 5008, 6215, 5788, 4214, 1206, 1730, 3739, 4094, 736, 449,
+				6677, 3128, 5604, 838, 3766, 6310, 5418, 80, 1011, 2952, 3402, 2206, 3046, 6763, 3296, 146,
+				223, 5558, 1379, 1306, 4210, 3092, 3888, 5598, 1217, 3186, 6645, 5192, 5275, 4137, 2434, 6228,
+				5147, 3040, 2306, 2323, 1260, 2336, 3591, 2570, 1277, 5773, 2120, 648, 5407, 4368, 1845, 1409,
+				3198, 4142, 2022, 6791, 5530, 391, 5355, 1613, 1370, 383, 2463, 4533, 5429, 1258, 4725, 5706,
+				5281, 5518, 3343, 4178, 4073, 6271, 3925, 53, 5232, 2922, 2369, 1166, 3825, 1242, 3613, 2737,
+				189, 132, 5165, 2335, 6347, 1437, 6641, 1543, 1149, 782, 4404, 6359, 5473, 5528, 2905, 573,
+				6390, 4901, 1747, 4306, 2189, 3815, 5189, 3684, 3924, 5546, 5155, 1460, 6699, 4084, 1382, 5673,
+				2625, 4078, 6164, 3939, 1569, 5026, 2882, 6912, 6282, 3856, 4910, 396, 5459, 4100, 430, 6489,
+				1831, 6460, 1096, 3238, 1548, 5191, 5933, 817, 1353, 6375, 1523, 492, 114, 3314, 2364, 364,
+				2810, 5779, 5088, 5236, 6244, 4704, 6599, 1029, 1266, 1007, 1267, 1269, 107, 4670, 620, 5648,
+				3653, 3609, 6033, 129, 1818, 4884, 6393, 1446, 3884, 1171, 1675, 233, 3078, 5896, 4490, 682,
+				5778, 3454, 1629, 6429, 34, 319, 3962, 6632, 3961, 897, 3470, 6616, 4057, 979, 5317, 6781,
+				866, 6274, 2026, 6914, 3569, 868, 3760, 1596, 2015, 1461, 5717, 5047, 3327, 2655, 482, 1371,
+				496, 2151, 1738, 1085, 3587, 5413, 2277, 6798, 559, 4286, 1732, 5882, 4858, 6267, 6875, 6009,
+				3970, 1481, 307, 2510, 3422, 1830, 3010, 6867, 2681, 1671, 1319, 292, 1594, 5777, 3594, 3232,
+				4031, 4324, 183, 3955, 901, 5043, 5656, 1902, 6296, 4320, 4295, 1388, 6008, 3879, 2641, 6654,
+				3542, 6670, 2408, 6406, 2345, 3895, 5431, 4564, 3603, 6841, 5075, 397, 5185, 2588, 1635, 42,
+				3315, 1478, 6829, 4748, 2487, 2820, 827, 3711, 6911, 5080, 2772, 3378, 2044, 529, 3359, 1111,
+				624, 1350, 898, 1828, 4069, 2195, 6225, 6349, 3180, 1487, 1927, 5350, 3656, 1658, 3636, 583,
+				3755, 5241, 5196, 1555, 6890, 1888, 2667, 2635, 4815, 6045, 3412, 4552, 6646, 3531, 1502, 1744,
+				2709, 3480, 3988, 4471, 1445, 6345, 5718, 1200, 1169, 4831, 1856, 1892, 4876, 1235, 2730, 5713,
+				380, 4965, 4536, 1844, 3622, 1549, 6419, 2112, 2095, 134, 3442, 3541, 3617, 1080, 5541, 5697,
+				4405, 5682, 3843, 1637, 4906, 6675, 5160, 1159, 6180, 1946, 5064, 1883, 4824, 5687, 1094, 4818,
+				259, 1462, 616, 11, 5941, 5474, 1218, 5835, 2535, 2813, 4976, 5162, 351, 5567, 5536, 3181,
+				3428, 3845, 2373, 6378, 6689, 5707, 95, 6389, 3145, 1601, 1316, 5785, 5775, 6464, 6205, 1993,
+				5548, 6718, 4049, 6881, 3399, 2997, 6789, 6750, 6590, 1027, 2955, 1342, 6297, 1704, 1776, 2644,
+				301, 2531, 5572, 6939, 5693, 748, 5443, 4913, 3512, 6740, 2617, 2152, 917, 614, 4158, 4002,
+				550, 750, 2066, 5290, 5390, 346, 5374, 4072, 3329, 5065, 3155, 272, 1491, 3601, 1758, 269,
+				2452, 2636, 3558, 1789, 108, 1251, 999, 2453, 1488, 454, 3772, 6574, 842, 3169, 6778, 5280,
+				2890, 3651, 6162, 4865, 2078, 3773, 373, 4621, 3060, 4624, 5877, 6054, 5183, 5089, 968, 930,
+				1991, 4764, 4124, 136, 5986, 2778, 6838, 1562, 2898, 464, 1940, 5255, 2638, 5103, 3389, 4377,
+				6251, 2852, 3993, 1916, 4067, 4709, 5945, 1474, 4909, 393, 2875, 6831, 1903, 4102, 1974, 3240,
+				4224, 6707, 4191, 4437, 5324, 6958, 5853, 2512, 6727, 3650, 6734, 819, 6679, 5720, 5768, 1181,
+				5273, 829, 3701, 2719, 4867, 6534, 4947, 1588, 1057, 4526, 403, 4011, 5640, 4160, 4559, 1644,
+				5584, 5891, 4139, 5432, 1960, 5332, 6494, 4092, 6395, 6640, 3506, 4186, 5460, 3451, 1774, 3414,
+				1346, 2674, 1964, 3522, 6024, 667, 5890, 2385, 4364, 6674, 886, 1605, 4623, 3381, 3028, 1530,
+				2460, 925, 3883, 5322, 6695, 5916, 991, 2701, 652, 4162, 5208, 3890, 2177, 4911, 4101, 3666,
+				5870, 922, 3214, 2013, 2181, 5538, 2001, 161, 4732, 3038, 4363, 1606, 4634, 4016, 2380, 4007,
+				4688, 6830, 3015, 3239, 3034, 3645, 3788, 767, 6926, 217, 4887, 3719, 139, 1384, 2784, 3293,
+				1197, 1391, 450, 4227, 5362, 67, 831, 836, 5549, 2794, 4307, 3573, 5411, 3253, 2179, 516,
+				3071, 2627, 5573, 4416, 2133, 1962, 5223, 6358, 6269, 4205, 4977, 2027, 1599, 6899, 2137, 6243,
+				3074, 456, 6027, 5001, 4657, 4347, 6651, 4062, 5382, 4899, 1004, 885, 3588, 4916, 1972, 1313,
+				3352, 1655, 1170, 4484, 6573, 3992, 5635, 5524, 5814, 2174, 2003, 5415, 1419, 5842, 5213, 357,
+				2846, 1770, 5910, 4756, 4289, 404, 4755, 4149, 1244, 6281, 3156, 5552, 6644, 3463, 6325, 1998,
+				3061, 2376, 505, 4060, 254, 1173, 249, 5333, 5401, 6203, 4542, 2956, 1949, 6565, 3334, 6792,
+				4360, 6873, 5755, 1511, 5408, 4894, 779, 1468, 1625, 5947, 4855, 2116, 5955, 4030, 5756, 3691,
+				3959, 1713, 2216, 4406, 3987, 1558, 3006, 6318, 1025, 6283, 6495, 4861, 117, 4540, 4135, 688,
+				5576, 537, 4771, 1119, 6511, 1570, 1699, 6330, 2556, 3360, 1757, 2107, 5680, 1191, 213, 5090,
+				3575, 5490, 641, 3538, 4863, 931, 4246, 3534, 2437, 613, 232, 1484, 737, 3813, 753, 4202,
+				2953, 3350, 3152, 2662, 6757, 4666, 2929, 6121, 4949, 2406, 43, 463, 2374, 4495, 1984, 3162,
+				863, 3366, 5909, 2732, 693, 1931, 3911, 4262, 1887, 4426, 1673, 3986, 1612, 3158, 1850, 5614,
+				110, 5727, 916, 5672, 241, 3404, 4256, 3902, 5879, 4605, 3033, 6564, 2742, 5733, 3858, 2940,
+				5235, 2911, 3354, 562, 946, 59, 4109, 2129, 1954, 2269, 190, 320, 1310, 4340, 5873, 4727,
+				872, 5854, 4053, 6477, 6793, 874, 6910, 3328, 2678, 2123, 1282, 476, 6648, 1836, 813, 125,
+				1168, 3406, 4984, 2839, 6716, 2835, 4521, 4236, 6603, 5661, 1430, 6068, 542, 3695, 1878, 4920,
+				3431, 2978, 2327, 4201, 3525, 4381, 811, 1528, 6538, 6314, 472, 247, 877, 1196, 5439, 1479,
+				759, 2726, 3218, 4179, 5045, 4967, 2275, 1621, 2647, 6662, 2628, 1499, 2426, 5397, 722, 5130,
+				4737, 4290, 6527, 6566, 4318, 5964, 1767, 6366, 4411, 6581, 2208, 1859, 1978, 3694, 4469, 2894,
+				2624, 2814, 1381, 3893, 2948, 45, 820, 4722, 5570, 2865, 2508, 2981, 1074, 953, 2727, 2960,
+				5391, 594, 992, 2125, 708, 1674, 884, 1743, 331, 653, 6519, 6094, 2761, 5508, 4628, 3909,
+				609, 592, 3393, 2386, 4472, 966, 1835, 2815, 6936, 318, 4239, 2218, 2011, 3261, 1402, 3908,
+				595, 509, 6047, 3208, 960, 4721, 5481, 4585, 1967, 3631, 1376, 5674, 2559, 1146, 3854, 6261,
+				3868, 2995, 1026, 4327, 4702, 5723, 1611, 1329, 2110, 3070, 6428, 683, 2391, 3918, 1413, 1660,
+				5018, 3464, 5239, 6931, 659, 5624, 721, 5586, 4843, 2059, 103, 2117, 6552, 4939, 5595, 4329,
+				993, 3605, 5086, 1001, 894, 1645, 1832, 5231, 3554, 2088, 4487, 257, 4975, 6512, 963, 2928,
+				2586, 216, 474, 1209, 5428, 5406, 3972, 347, 6362, 1349, 507, 4671, 2908, 5575, 630, 6492,
+				5226, 4221, 6903, 1841, 1803, 5040, 4331, 6051, 1780, 20, 1291, 4388, 3447, 2579, 1745, 6177,
+				2396, 1681, 1691, 4194, 2242, 6324, 3022, 4698, 6629, 1792, 2083, 5760, 3384, 2399, 2322, 1894,
+				5834, 2509, 3562, 4004, 2440, 1137, 1636, 2025, 4373, 2849, 4442, 913, 4209, 2937, 3462, 6015,
+				2932, 4971, 6000, 3503, 4284, 3628, 4197, 6770, 2793, 3818, 1873, 2372, 1065, 1237, 4315, 4998,
+				5107, 3919, 1289, 283, 1735, 5495, 1175, 2456, 1108, 1006, 1872, 2041, 6142, 3297, 3154, 1073,
+				6246, 2229, 3175, 3072, 2536, 5644, 5527, 2392, 1615, 1979, 5513, 788, 4987, 350, 4468, 1755,
+				1556, 2321, 6223, 3112, 2909, 2819, 4793, 974, 2284, 6807, 1078, 5014, 6600, 2281, 2080, 531,
+				4775, 115, 4937, 1951, 4964, 4211, 4272, 1477, 5918, 5343, 3465, 706, 937, 6212, 5442, 3395,
+				3736, 1518, 1005, 5092, 5679, 486, 4079, 6780, 2689, 6126, 2007, 3866, 5306, 2068, 4165, 2470,
+				4253, 6539, 2397, 1516, 2425, 495, 4836, 3767, 4511, 193, 1147, 6034, 2811, 709, 4257, 704,
+				6106, 5172, 40, 3720, 6113, 2725, 3570, 6777, 4697, 1863, 2514, 3372, 805, 6394, 6802, 6295,
+				1851, 3744, 2930, 3387, 1271, 6525, 5984, 3321, 1059, 285, 1965, 637, 2567, 6128, 1060, 4989,
+				2450, 4085, 6803, 2017, 2405, 362, 3170, 6717, 4386, 288, 6469, 1496, 914, 1229, 443, 5912,
+				4203, 1600, 1784, 3831, 2222, 6288, 589, 2074, 4924, 3043, 1891, 3311, 6466, 3103, 5990, 2874,
+				325, 3269, 4032, 4788, 1618, 3844, 3901, 5093, 468, 4889, 1214, 2271, 5053, 5609, 3897, 4541,
+				6245, 2675, 4501, 152, 4517, 2057, 6820, 6804, 2938, 2745, 2770, 5038, 6607, 4625, 1144, 6231,
+				1726, 2520, 1467, 2367, 3369, 5587, 1432, 6805, 3079, 678, 2355, 1981, 3551, 1955, 6932, 2398,
+				4421, 928, 5704, 4448, 2543, 2185, 1156, 3255, 2439, 3493, 3676, 1466, 2424, 41, 6652, 5224,
+				5156, 5730, 6658, 5659, 5666, 2801, 2449, 5487, 2482, 5287, 6712, 2607, 3210, 4081, 5227, 2764,
+				6787, 6320, 5585, 6146, 317, 6455, 2414, 3502, 447, 816, 6213, 2087, 3472, 6292, 4675, 6886,
+				1139, 4183, 209, 5839, 4570, 1469, 3560, 4970, 5029, 6022, 6040, 3137, 3102, 5166, 5516, 3765,
+				2153, 822, 3593, 4321, 729, 5914, 6072, 5011, 3453, 1834, 5358, 2912, 6543, 2038, 2853, 3047,
+				566, 5247, 830, 5793, 5140, 1079, 1367, 1278, 2854, 1546, 4034, 5515, 2870, 4679, 6486, 279,
+				5849, 2441, 2580, 4617, 2388, 6396, 5345, 3963, 418, 3891, 388, 4249, 5676, 1161, 5769, 3874,
+				1640, 549, 488, 1035, 1138, 1426, 6571, 1781, 2300, 5467, 569, 2331, 3362, 1739, 6872, 5617,
+				6422, 2060, 2765, 6894, 3973, 2096, 3064, 6438, 5902, 3434, 3499, 800, 3048, 1973, 4983, 3517,
+				3249, 3842, 5601, 4640, 6238, 6850, 711, 977, 6226, 2505, 1579, 1186, 6591, 3833, 3037, 2506,
+				823, 246, 6046, 6733, 3489, 6263, 2317, 1140, 5004, 5923, 4952, 3722, 1093, 6111, 3836, 6639,
+				4328, 1935, 6109, 4681, 1185, 5897, 5286, 5925, 1204, 5354, 2743, 501, 5299, 6306, 5176, 5520,
+				485, 6167, 3237, 2523, 3005, 1157, 1135, 1018, 2124, 2661, 1142, 1517, 4089, 2826, 5743, 5685,
+				1387, 5568, 3936, 5967, 1752, 1624, 17, 4663, 6176, 5329, 6013, 843, 4636, 1825, 1871, 668,
+				1971, 4777, 1754, 2285, 2503, 6842, 6602, 3400, 3769, 3444, 4669, 4231, 2950, 5068, 1118, 6172,
+				6765, 6067, 845, 832, 483, 5855, 1999, 309, 3552, 4607, 6028, 3978, 3256, 6953, 2545, 498,
+				4809, 3085, 5703, 703, 3392, 5514, 2447, 2939, 4847, 6435, 475, 4393, 5794, 2522, 3832, 3083,
+				5449, 5846, 1378, 1252, 4806, 6426, 4715, 1826, 2260, 5958, 415, 5616, 4379, 5872, 2006, 4868,
+				5048, 6635, 191, 6035, 5330, 5550, 3968, 4344, 433, 4575, 3234, 661, 889, 1275, 6258, 6861,
+				4667, 6595, 6145, 1504, 1423, 5590, 5534, 5347, 6179, 112, 6253, 5159, 3142, 5377, 298, 2280,
+				5315, 3371, 6005, 5488, 4512, 369, 4251, 1819, 1195, 2320, 96, 6506, 3307, 5971, 1748, 5234,
+				6701, 4230, 2171, 790, 4993, 6161, 338, 5081, 2375, 2696, 3246, 5664, 792, 2251, 5010, 6340,
+				5646, 5417, 4752, 5367, 1273, 3572, 912, 2926, 5868, 6198, 341, 4369, 1412, 6604, 5564, 1245,
+				4434, 323, 6946, 3020, 5218, 962, 5762, 1683, 939, 1072, 1712, 2262, 3546, 177, 1255, 1779,
+				2923, 321, 3886, 2147, 2693, 3173, 5820, 5400, 6756, 4842, 2838, 2196, 5692, 3107, 6458, 3734,
+				3304, 3303, 3346, 6037, 5257, 5434, 2568, 3834, 1047, 4447, 2554, 2468, 4418, 4870, 4948, 4838,
+				4578, 296, 6134, 5653, 5270, 4136, 949, 6462, 3222, 1463, 4116, 2050, 6747, 3089, 1918, 1862,
+				3624, 4608, 2410, 3251, 5801, 4337, 3686, 4648, 2338, 3585, 3039, 5832, 899, 3215, 1810, 84,
+				4789, 2713, 6563, 5351, 200, 436, 3629, 3386, 5627, 236, 4915, 1930, 5331, 1294, 2274, 3235,
+				6719, 4265, 2051, 4019, 6498, 5905, 5438, 3459, 4609, 6748, 848, 6949, 4247, 1608, 1682, 2812,
+				3523, 4902, 4716, 4273, 2418, 1128, 2891, 1717, 4499, 3889, 1769, 4854, 6927, 6305, 2131, 4653,
+				936, 4857, 2553, 3581, 2679, 6742, 3361, 5734, 909, 5574, 574, 1911, 651, 5476, 538, 4980,
+				6116, 4419, 5499, 6275, 409, 4433, 6101, 5874, 6888, 3805, 2788, 4232, 581, 1100, 100, 6839,
+				1917, 3791, 6056, 1265, 2992, 833, 1703, 6664, 3957, 2215, 311, 6368, 4765, 5625, 4778, 5502,
+				821, 2876, 2720, 16, 2577, 227, 2101, 2921, 665, 5465, 6291, 2851, 164, 2187, 3236, 3367,
+				3852, 49, 5212, 1764, 1795, 6268, 4313, 4505, 4443, 4635, 5131, 5807, 98, 4502, 563, 2889,
+				4264, 4951, 1865, 6490, 5615, 1043, 4342, 760, 3213, 3320, 6386, 1016, 3740, 4188, 3410, 5626,
+				422, 932, 2360, 4058, 4127, 4299, 5252, 5175, 572, 6089, 1401, 4223, 251, 15, 6863, 5135,
+				5410, 4319, 412, 3120, 4711, 5974, 6625, 5388, 2996, 2253, 3003, 5179, 3069, 3912, 4995, 4408,
+				3490, 1164, 4776, 5405, 989, 3188, 4173, 6660, 2458, 5903, 2584, 6956, 4150, 5207, 6418, 1989,
+				410, 1510, 366, 4927, 5122, 2965, 6892, 4638, 354, 2712, 5651, 742, 5642, 2575, 5002, 1877,
+				2337, 2740, 5119, 3900, 1805, 5260, 3379, 3476, 770, 6301, 5209, 4159, 4410, 5599, 980, 4690,
+				859, 6794, 515, 2648, 1220, 6321, 771, 6326, 363, 6688, 4063, 4493, 3723, 4242, 3349, 1867,
+				1616, 2313, 4151, 546, 2622, 3687, 2292, 4599, 3797, 3449, 5641, 3212, 3062, 1557, 3677, 6235,
+				2291, 6535, 5560, 150, 4270, 6120, 2963, 3513, 2608, 1804, 6879, 3735, 1454, 111, 302, 4164,
+				4371, 1178, 4649, 151, 6420, 4968, 555, 4050, 2668, 3584, 2032, 1632, 5556, 5892, 3108, 6361,
+				2884, 6724, 2785, 3477, 806, 2569, 1143, 473, 3219, 1943, 3116, 4882, 1083, 118, 684, 3093,
+			};
+		}
+	}
+}
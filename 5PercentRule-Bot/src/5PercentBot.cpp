@@ -1,151 +1,400 @@
 #include "pch.h"
 
 #include "Headers/5PercentBot.hpp"
-#include "Headers/Utils/ticker_labels.hpp"
+#include "Headers/Strategy.hpp"
+#include "Headers/Utils/SymbolTable.hpp"
 
-#include <StockScraper/Headers/Fetch.hpp>
+#include <StockScraper/Headers/BatchFetch.hpp>
+#include <StockScraper/Headers/MarketDataProvider.hpp>
+#include <StockScraper/Headers/BarCache.hpp>
 #include <StockScraper/Headers/StockData.hpp>
+#include <StockScraper/Headers/OrderQueue.hpp>
+#include <StockScraper/Headers/PositionBook.hpp>
+#include <StockScraper/Headers/TradeStream.hpp>
+#include <StockScraper/Headers/Universe.hpp>
+#include <StockScraper/Headers/FailureCache.hpp>
+#include <StockScraper/Headers/RateLimiter.hpp>
 
 namespace StockyBoy {
 	namespace Bots {
 		namespace FivePercentRule {
-			constexpr float FORGIVENESS = 0.1f;
+			// Universe scan: how many requests are in flight at once, and how many tickers are fetched per batch
+			// (the scan stops between batches once the budget is spent)
+			constexpr size_t SCAN_CONCURRENCY = 16;
+			constexpr size_t SCAN_BATCH_SIZE = 128;
+
+			// A live 1m bar older than this (no trades lately, or the stream dropped) falls back to the daily close
+			constexpr std::chrono::seconds LIVE_PRICE_MAX_AGE{ 180 };
+
+			// Market orders fill within seconds in market hours, this only bounds a stuck order
+			constexpr std::chrono::seconds FILL_TIMEOUT{ 120 };
+
+			// Skipped before any request goes out: penny stocks and names that barely trade
+			constexpr Scraper::UniverseFilter UNIVERSE_FILTER{ .minPrice = 1.0f, .minAvgVolume = 50'000.0f };
+
+			// A symbol leaves the universe after this many runs in a row where fetching it failed,
+			// or brought nothing newer than STALE_AFTER (delisted names still answer with their old bars)
+			constexpr uint32_t MAX_MISSES = 3;
+			constexpr std::chrono::days STALE_AFTER{ 14 };
 
 			namespace fs = std::filesystem;
-			namespace chrono = std::chrono;
 
-			static std::string ToString(std::chrono::year_month_day ymwd) {
-				using namespace std::chrono;
+			// Daily bars from the cache's provider, through the on-disk cache. Prices come from the live bars first when they're fresh,
+			// then from the quote provider.
+			// The scan walks the universe file's symbols that pass UNIVERSE_FILTER, or the built-in table without one,
+			// and leaves out symbols still backing off in the failure cache.
+			class LiveMarket : public MarketData {
+			private:
+				const Scraper::BarCache& Cache;
+				Scraper::MarketDataProvider& Quotes;
+				const Scraper::BarBuilder* Live;
+				Scraper::FailureCache& Failures;
 
-				year y = ymwd.year();
-				month m = ymwd.month();
-				day d = ymwd.day();
+				const Scraper::Universe* Listing;
+				std::vector<uint32_t> Selected; // Listing ids passing UNIVERSE_FILTER, ascending
 
-				// Convert to ints
-				int y_val = int(y);
-				unsigned m_val = unsigned(m);
-				unsigned wd_val = unsigned(d);  // Sunday=0, Monday=1, ...
+				std::unordered_map<std::string, bool> Fetched; // label -> whether its refresh went through
 
-				return std::format("{:04}-{:02}-{:02}", y_val, m_val, wd_val);
-			}
+				std::string_view LabelAt(uint32_t index) const {
+					return Listing ? Listing->label(Selected[index]) : SymbolName(static_cast<SymbolId>(index));
+				}
 
-			static std::string GetTodayString() {
-				auto today_days = chrono::floor<chrono::days>(chrono::system_clock::now());
-				chrono::year_month_day today{ today_days };
-				return ToString(today);
-			}
+				bool IndexOf(const std::string& label, uint32_t& out_Index) const {
+					if (!Listing) {
+						SymbolId id;
+						if (!FindSymbol(label, id)) return false;
+						out_Index = id;
+						return true;
+					}
+
+					uint32_t symbol;
+					if (!Listing->Find(label, symbol)) return false;
+
+					auto it = std::lower_bound(Selected.begin(), Selected.end(), symbol);
+					if (it == Selected.end() || *it != symbol) return false;
+					out_Index = static_cast<uint32_t>(it - Selected.begin());
+					return true;
+				}
 
-			static bool InMarketHours() {
-				using namespace std::chrono;
+			public:
+				LiveMarket(const Scraper::BarCache& cache, Scraper::MarketDataProvider& quotes, const Scraper::BarBuilder* live, Scraper::FailureCache& failures,
+					const Scraper::Universe* universe)
+					: Cache(cache), Quotes(quotes), Live(live), Failures(failures), Listing(universe)
+				{
+					if (Listing) Selected = Listing->Select(UNIVERSE_FILTER);
+				}
 
-				auto now = system_clock::now();
+				size_t universeSize() const override { return Listing ? Selected.size() : SYMBOL_COUNT; }
 
-				// extract date
-				auto today_days = floor<days>(now);
-				year_month_day ymd{ today_days };
+				const std::unordered_map<std::string, bool>& fetched() const { return Fetched; }
 
-				// check if week day
-				weekday wd{ today_days };
-				if (wd == Saturday || wd == Sunday) {
-					return false;
+				bool LivePrice(const std::string& label, int64_t now, float& out_Price) const {
+					Scraper::Bar bar;
+					if (!Live || !Live->Latest(label, MINUTES_1, bar) || now - bar.epoch > LIVE_PRICE_MAX_AGE.count()) {
+						return false;
+					}
+
+					out_Price = static_cast<float>(bar.close);
+					return true;
 				}
 
-				// extract time of day
-				auto time_since_midnight = now - today_days;
-				hh_mm_ss hms{ time_since_midnight }; // in UTC
+				bool GetPrice(const std::string& label, float& out_Price) override {
+					using namespace StockyBoy::Scraper;
 
-				// Convert time-of-day to seconds for easy comparison
-				auto secs = duration_cast<seconds>(hms.to_duration()).count();
+					const int64_t now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+					if (LivePrice(label, now, out_Price)) {
+						return true;
+					}
 
-				// market hours
-				auto open_buffer = (14h + 30min);	// latest open
-				auto close_buffer = (20h);			// earliest close
+					StockTable table;
+					Result result = Cache.Refresh(label, DAYS_1, RANGE_1Y, table);
 
-				auto open_secs = duration_cast<seconds>(open_buffer).count();
-				auto close_secs = duration_cast<seconds>(close_buffer).count();
+					if (!result.succeeded || table.close.empty()) {
+						return false;
+					}
 
-				return secs >= open_secs && secs <= close_secs;
-			}
+					out_Price = static_cast<float>(table.close.back());
+					return true;
+				}
 
-			static std::vector<uint32_t> getShuffledIndices(uint32_t n) {
-				std::vector<uint32_t> indices(n);
-				std::iota(indices.begin(), indices.end(), 0); // fill with 0..n-1
+				// Fresh live bars first, then one batched quote lookup, and the daily close for whatever is left
+				void GetPrices(std::span<const std::string> labels, Tickers& out_Prices) override {
+					using namespace StockyBoy::Scraper;
 
-				static thread_local std::mt19937_64 rng(std::random_device{}());
-				std::shuffle(indices.begin(), indices.end(), rng);
+					const int64_t now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
 
-				return indices;
-			}
+					std::vector<std::string> missing;
+					for (const std::string& label : labels) {
+						float price;
+						if (LivePrice(label, now, price)) out_Prices[label] = price;
+						else missing.push_back(label);
+					}
 
-			static float getPercentageChange(float _old, float _new) {
-				return ((_new - _old) / _old) * 100.0f;
-			}
+					if (missing.empty()) return;
 
-			static float getPricePercentageChange(const std::string& label, uint32_t window, float* out_CurrentPrice = nullptr) {
-				using namespace StockyBoy::Scraper;
+					// A failed quote request still leaves the daily close below
+					std::vector<Quote> quotes;
+					Quotes.FetchQuotes(missing, quotes);
 
-				std::string data;
-				Result result = Fetch(label, DAYS_1, RANGE_1Y, data);
+					for (const Quote& quote : quotes) {
+						out_Prices[quote.symbol] = static_cast<float>(quote.price);
+					}
 
-				if (!result.succeeded) {
-					return 0.0f;
+					for (const std::string& label : missing) {
+						float price;
+						if (!out_Prices.contains(label) && GetPrice(label, price)) out_Prices[label] = price;
+					}
 				}
 
-				StockTable table;
-				result = getStockTable(data, table);
+				void Scan(const Scraper::Screener& screener, uint32_t depth, std::span<const uint32_t> order, const Tickers& exclude, const OnHit& onHit) override {
+					using namespace StockyBoy::Scraper;
+
+					// Holdings outside the universe can't come up in the scan anyway
+					std::vector<uint8_t> skip(universeSize(), 0);
+					for (const auto& [label, price] : exclude) {
+						uint32_t index;
+						if (IndexOf(label, index)) skip[index] = 1;
+					}
+
+					const int64_t now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+					std::vector<FetchRequest> requests;
+					std::vector<StockTable> tables;
+					requests.reserve(SCAN_BATCH_SIZE);
+					tables.reserve(SCAN_BATCH_SIZE);
+
+					size_t position = 0;
+					while (position < order.size()) {
+						// --- Collect the next batch in shuffled order, asking only for bars missing from the cache ---
+						requests.clear();
+						tables.clear();
+						while (requests.size() < SCAN_BATCH_SIZE && position < order.size()) {
+							const uint32_t index = order[position++];
+							if (skip[index]) continue;
+
+							const std::string label(LabelAt(index));
+							if (Failures.Blocked(label, now)) continue;
+
+							StockTable& cached = tables.emplace_back();
+							Cache.Load(label, DAYS_1, cached); // stays empty on a cache miss
+
+							requests.push_back(Cache.RefreshRequest(label, DAYS_1, RANGE_1Y, cached));
+						}
+
+						std::vector<BarResponse> responses = Cache.provider().FetchBars(requests, SCAN_CONCURRENCY);
+
+						// A batch where nothing went through is an outage, not a batch of dead symbols
+						const bool anySucceeded = std::any_of(responses.begin(), responses.end(), [](const BarResponse& response) { return response.result.succeeded; });
+
+						// --- Merge what came back; only symbols refreshed just now are screened, cached closes may be days old ---
+						std::vector<size_t> refreshed;
+						refreshed.reserve(responses.size());
+						for (size_t i = 0; i < responses.size(); ++i) {
+							const std::string& label = requests[i].label;
+
+							Result outcome = responses[i].result;
+							if (outcome.succeeded) {
+								refreshed.push_back(i); // merged into tables[i] even if storing it fails
+								outcome = Cache.Update(label, DAYS_1, tables[i], responses[i].table);
+							}
+
+							if (outcome.succeeded) {
+								Failures.RecordSuccess(label);
+							}
+							else if (anySucceeded) {
+								Failures.RecordFailure(label, outcome.kind, now);
+							}
+
+							// An outage or throttling says nothing about the symbol, it doesn't count against it in the universe
+							if (outcome.succeeded || (anySucceeded && FailureCache::IsSymbolError(outcome.kind))) {
+								Fetched[label] = outcome.succeeded;
+							}
+						}
+
+						// --- Screen the batch at once: `depth` closes per symbol is all the rule looks at ---
+						CloseMatrix closes(refreshed.size(), depth);
+						for (size_t row = 0; row < refreshed.size(); ++row) {
+							closes.Set(row, requests[refreshed[row]].label, tables[refreshed[row]]);
+						}
 
-				if (!result.succeeded) {
-					return 0.0f;
+						// Hits come back in request order, so the shuffle still decides who gets the budget
+						const std::span<const double> latest = closes.latest();
+						for (const ScreenHit& hit : screener.Run(closes)) {
+							if (!onHit(closes.label(hit.symbol), static_cast<float>(latest[hit.symbol]))) {
+								return; // the rest of this batch is cached already
+							}
+						}
+					}
+				}
+			};
+
+			// Orders go to Alpaca, positions start from the account's positions at the beginning of the run
+			class AlpacaPortfolio : public Portfolio {
+			private:
+				Scraper::Alpaca::Account& account;
+				Scraper::Alpaca::OrderQueue& orders;
+				Tickers Holdings;
+				std::unordered_map<std::string, std::string> Quantities; // label -> exact qty held, sells close the whole position
+				std::string OrderTag; // prefix of every client order id, one per run
+				std::unordered_set<std::string> Submitted; // client order ids Alpaca accepted
+
+			public:
+				AlpacaPortfolio(Scraper::Alpaca::Account& account, Scraper::Alpaca::OrderQueue& orders, const Scraper::Alpaca::PositionBook& book, std::string orderTag)
+					: account(account), orders(orders), OrderTag(std::move(orderTag))
+				{
+					Holdings.reserve(book.size());
+					for (const auto& [label, position] : book.positions()) {
+						Holdings[label] = position.avgEntryPrice;
+						if (!position.qtyText.empty()) Quantities[label] = position.qtyText;
+					}
 				}
 
-				const size_t recordsNum = table.close.size();
+				const Tickers& holdings() const override { return Holdings; }
 
-				if (recordsNum == 0 || window >= recordsNum) {
-					return 0.0f;  // not enough data, or invalid window
+				const std::unordered_set<std::string>& submitted() const { return Submitted; }
+
+				// The balance from Init can be a day old, one Refresh is a single small request
+				bool GetBalance(float& out_Balance) override {
+					return account.Refresh().succeeded && account.GetBalance(out_Balance).succeeded;
 				}
 
-				size_t latestIndex = recordsNum - 1;
-				double latestClose = table.close[latestIndex];
-				double oldPrice = table.close[latestIndex - window];
+				std::vector<Scraper::Result> Execute(const std::vector<Trade>& trades) override {
+					using namespace StockyBoy::Scraper;
+
+					std::vector<Result> results(trades.size());
+					std::vector<Order> batch;
+					std::vector<size_t> placed; // trade index of each order in `batch`
+					batch.reserve(trades.size());
+					for (size_t i = 0; i < trades.size(); ++i) {
+						const Trade& trade = trades[i];
+
+						// A sell is for the whole position, by its exact qty: a dollar amount would leave a remainder behind
+						std::string qty;
+						if (trade.action == Action::SELL) {
+							auto it = Quantities.find(trade.label);
+							if (it == Quantities.end()) {
+								results[i] = Result::Fail("[StockyBoy][5Percent] No position qty to sell for: " + trade.label);
+								continue;
+							}
+							qty = it->second;
+						}
+
+						// One order per symbol and side per run, so a retried request can't trade twice
+						batch.push_back(Order{
+							.action = trade.action,
+							.type = OrderType::MARKET,
+							.value = trade.value,
+							.label = trade.label,
+							.qty = std::move(qty),
+							.clientOrderId = OrderTag + (trade.action == Action::BUY ? "-buy-" : "-sell-") + trade.label
+							});
+						placed.push_back(i);
+					}
+
+					// Goes out as fast as the rate limit allows, a few orders in flight at once
+					std::vector<Result> submitted = orders.SubmitAll(batch);
 
-				if (oldPrice == 0.0) {
-					return 0.0f;
+					for (size_t j = 0; j < placed.size(); ++j) {
+						const size_t i = placed[j];
+						results[i] = std::move(submitted[j]);
+						if (!results[i].succeeded) continue;
+
+						Submitted.insert(batch[j].clientOrderId);
+
+						if (trades[i].action == Action::BUY) {
+							Holdings[trades[i].label] = trades[i].price;
+						}
+						else {
+							Holdings.erase(trades[i].label);
+						}
+					}
+
+					return results;
 				}
+			};
 
-				if (out_CurrentPrice) *out_CurrentPrice = latestClose;
+			Scraper::Result UpdateUniverse(const Scraper::BarCache& cache, const fs::path& path, const fs::path& listing,
+				const std::unordered_map<std::string, bool>& fetched)
+			{
+				using namespace StockyBoy::Scraper;
 
-				return getPercentageChange(oldPrice, latestClose);
-			}
+				std::vector<UniverseEntry> previous; // in label order
+				{
+					Universe current;
+					if (current.Open(path).succeeded) {
+						previous = current.entries();
+					}
+				} // unmapped before the file gets replaced
+
+				std::vector<UniverseEntry> entries;
+				std::ifstream listingFile;
+				if (!listing.empty()) listingFile.open(listing);
 
-			using Tickers = std::unordered_map<std::string, float>;
-			static Tickers getNewTrades(uint32_t window, float Budget, const std::unordered_map<std::string, float>* holding = nullptr) {
-				Tickers toBuy;
+				if (listingFile) {
+					Result result = Universe::ReadListing(listingFile, entries);
+					if (!result.succeeded) {
+						return result;
+					}
 
-				uint32_t totalTickerNum = static_cast<uint32_t>(TICKER_LABELS.size());
+					// Symbols staying in the universe keep what is known about them
+					for (UniverseEntry& entry : entries) {
+						auto it = std::lower_bound(previous.begin(), previous.end(), entry.label,
+							[](const UniverseEntry& known, const std::string& label) { return known.label < label; });
+						if (it == previous.end() || it->label != entry.label) continue;
 
-				auto shuffledIndices = getShuffledIndices(totalTickerNum);
+						const Exchange exchange = (entry.exchange != Exchange::UNKNOWN) ? entry.exchange : it->exchange;
+						entry = std::move(*it);
+						entry.exchange = exchange;
+					}
+				}
+				else if (!previous.empty()) {
+					entries = std::move(previous);
+				}
+				else {
+					entries.reserve(SYMBOL_COUNT);
+					for (uint32_t id = 0; id < SYMBOL_COUNT; ++id) {
+						entries.push_back(UniverseEntry{ .label = std::string(SymbolName(static_cast<SymbolId>(id))) });
+					}
+				}
 
-				for (const uint32_t index : shuffledIndices) {
-					if (Budget <= 0.0f) break;
+				const int64_t now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+				const int64_t staleAfter = std::chrono::duration_cast<std::chrono::seconds>(STALE_AFTER).count();
 
-					const std::string& label = TICKER_LABELS[index];
+				for (UniverseEntry& entry : entries) {
+					auto it = fetched.find(entry.label);
+					const bool tried = it != fetched.end();
 
-					if (holding && holding->contains(label)) continue;
+					if (tried && !it->second) {
+						++entry.misses;
+					}
+					else if (tried || !entry.known()) {
+						MappedBars bars;
+						if (cache.Map(entry.label, DAYS_1, bars).succeeded) {
+							Universe::Describe(bars.view(), entry);
+						}
 
-					// If stock went down of at least 5%, buy
-					float currPrice;
-					if (getPricePercentageChange(label, window, &currPrice) <= -5.0f + FORGIVENESS) {
-						toBuy[label] = currPrice;
-						Budget -= 5.0f;
+						if (tried) {
+							entry.misses = (entry.known() && now - entry.lastBar <= staleAfter) ? 0 : entry.misses + 1;
+						}
 					}
+
+					entry.active = entry.misses < MAX_MISSES;
 				}
 
-				return toBuy;
+				return Universe::Write(path, std::move(entries));
+			}
+
+			bool Run(const std::string& logPath, StockyBoy::Scraper::Alpaca::Account& account, uint32_t window, float budget)
+			{
+				return Run(logPath, account, Params{ .window = window }, budget);
 			}
 
-			bool Run(const std::string& _logPath, StockyBoy::Scraper::Alpaca::Account& account, uint32_t window, float dailyBudget)
+			bool Run(const std::string& _logPath, StockyBoy::Scraper::Alpaca::Account& account, const Params& params, float dailyBudget,
+				const StockyBoy::Scraper::BarBuilder* live, const Providers& providers)
 			{
-				if (!InMarketHours()) {
+				const SystemClock clock;
+
+				if (!InMarketHours(clock)) {
 					return false;
 				}
 
@@ -164,12 +413,18 @@ namespace StockyBoy {
 					std::getline(latestLogDataFile, lastRecordDate);
 				}
 				
-				std::string todayDay = GetTodayString();
+				std::string todayDay = GetTodayString(clock);
 
 				if (lastRecordDate == todayDay) {
 					return false;
 				}
 
+				// Holdings come from the broker, so fills, partial fills and manual trades are all accounted for
+				StockyBoy::Scraper::Alpaca::PositionBook book;
+				if (!book.SyncPositions(account).succeeded) {
+					return false; // retried next cycle, nothing was written yet
+				}
+
 				fs::create_directories(logPath / todayDay);
 
 				// Create/Overwrite latest.txt to write our date
@@ -178,92 +433,69 @@ namespace StockyBoy {
 
 				std::ofstream log(logPath / todayDay / "log.txt");
 
-				std::unordered_map<std::string, float> tradesHolding;
+				const StockyBoy::Scraper::BarCache cache = providers.bars
+					? StockyBoy::Scraper::BarCache(logPath.parent_path() / "BarCache", *providers.bars)
+					: StockyBoy::Scraper::BarCache(logPath.parent_path() / "BarCache");
+				StockyBoy::Scraper::MarketDataProvider& quotes = providers.quotes ? *providers.quotes : StockyBoy::Scraper::YahooProvider::Default();
 
-				Tickers todayBuys;
-				Tickers todaySells;
+				// Seeded on the first run, and rebuilt from Universe.csv whenever that is edited
+				const fs::path universePath = logPath.parent_path() / "Universe.sbu";
+				const fs::path listingPath = logPath.parent_path() / "Universe.csv";
 
-				if (lastRecordDate.empty()) {
-					todayBuys = getNewTrades(window, dailyBudget); // get the max amount of trades for our budget cap using the 5%-rule
-				}
-				else {
-					std::ifstream holdingTradesFile(logPath / lastRecordDate / "Holding.txt");
-					std::ifstream pricesFile(logPath / lastRecordDate / "Prices.txt");
-					std::string tradeLabel, price;
-					while (std::getline(holdingTradesFile, tradeLabel) && std::getline(pricesFile, price)) {
-						tradesHolding[tradeLabel] = std::stof(price);
+				std::error_code ec;
+				if (!fs::exists(universePath) || (fs::exists(listingPath) && fs::last_write_time(listingPath, ec) > fs::last_write_time(universePath, ec))) {
+					const StockyBoy::Scraper::Result seeded = UpdateUniverse(cache, universePath, listingPath);
+					if (!seeded.succeeded) {
+						log << "Universe not updated: " << seeded.error << '\n';
 					}
+				}
 
-					for (const auto& [label, price] : tradesHolding) {
-						float currPrice;
-						getPricePercentageChange(label, window, &currPrice); // just to get current price
+				StockyBoy::Scraper::Universe universe;
+				const StockyBoy::Scraper::Result opened = universe.Open(universePath);
+				if (!opened.succeeded) {
+					log << "Scanning the built-in ticker list: " << opened.error << '\n';
+				}
 
-						float priceChange = getPercentageChange(price, currPrice);
+				// Symbols that came back 404 or empty lately, so the scan doesn't ask for them again every run
+				StockyBoy::Scraper::FailureCache failures(logPath.parent_path() / "Failures.csv");
+				failures.Load();
 
-						if (priceChange >= 5.0f - FORGIVENESS) {
-							todaySells[label] = currPrice;
-						}
-					}
+				LiveMarket market(cache, quotes, live, failures, opened.succeeded ? &universe : nullptr);
+				StockyBoy::Scraper::Alpaca::OrderQueue orders(account);
+				AlpacaPortfolio portfolio(account, orders, book, "5pct-" + todayDay);
 
-					// find new BUYS if budget allows it
-					float totalBalance;
-					if (account.GetBalance(totalBalance).succeeded) {
-						if (totalBalance > dailyBudget) {
-							todayBuys = getNewTrades(window, dailyBudget, &tradesHolding);
-						}
-					}
+				// Subscribed before the first order goes out, so no fill is missed
+				StockyBoy::Scraper::Alpaca::TradeStream stream(account);
+				const StockyBoy::Scraper::Result streaming = stream.Start();
+				if (!streaming.succeeded) {
+					log << "No trade updates, fills won't be recorded: " << streaming.error << '\n';
 				}
 
-				using namespace StockyBoy::Scraper;
-				constexpr std::chrono::milliseconds tradeDelay{ 500 };
-
-				// Execute trades
-				// Unfortunately no execution::par, idk how the API will behave with that
-				for (const auto& [label, price] : todayBuys) {
-					bool suceeded = account.SubmitOrder(
-						Order{
-							.action = Action::BUY,
-							.type = OrderType::MARKET,
-							.value = 5.0f,
-							.label = label
-						}
-					).succeeded;
+				static thread_local std::mt19937_64 rng(std::random_device{}());
 
-					if (!suceeded) {
-						log << "Failed to buy from " << label << '\n';
-					}
-					else {
-						tradesHolding[label] = price;
-					}
+				// On the first run, get the max amount of trades for our budget cap. After that, only buy if the balance allows it.
+				const Session session{ .params = params, .budget = dailyBudget, .checkBalance = !lastRecordDate.empty() };
+				RunSession(session, market, portfolio, rng, log);
 
-					std::this_thread::sleep_for(tradeDelay);
+				if (streaming.succeeded) {
+					std::ofstream fills(logPath / todayDay / "Fills.csv");
+					StockyBoy::Scraper::Alpaca::RecordFills(stream, portfolio.submitted(), book, fills, log, FILL_TIMEOUT);
 				}
-				for (const auto& [label, price] : todaySells) {
 
-					bool suceeded = account.SubmitOrder(
-						Order{
-							.action = Action::SELL,
-							.type = OrderType::MARKET,
-							.value = 5.0f,
-							.label = label
-						}
-					).succeeded;
-
-					if (!suceeded) {
-						log << "Failed to sell " << label << '\n';
-					}
-					else {
-						tradesHolding.erase(label);
-					}
+				for (const StockyBoy::Scraper::HostStats& stats : StockyBoy::Scraper::RateGovernor::Get().Stats()) {
+					log << stats.host << ": " << stats.requests << " requests, " << stats.failures << " failed, " << stats.retries << " retried, "
+						<< stats.throttled << " throttled, now allowed " << stats.allowedRate << "/s\n";
+				}
 
-					std::this_thread::sleep_for(tradeDelay);
+				const StockyBoy::Scraper::Result saved = failures.Save();
+				if (!saved.succeeded) {
+					log << "Failure cache not saved: " << saved.error << '\n';
 				}
 
-				std::ofstream holdingTradesFile(logPath / todayDay / "Holding.txt");
-				std::ofstream pricesTradesFile(logPath / todayDay / "Prices.txt");
-				for (const auto& [label, price] : tradesHolding) {
-					holdingTradesFile << label + "\n";
-					pricesTradesFile << std::to_string(price) + "\n";
+				universe.Close();
+				const StockyBoy::Scraper::Result updated = UpdateUniverse(cache, universePath, listingPath, market.fetched());
+				if (!updated.succeeded) {
+					log << "Universe not updated: " << updated.error << '\n';
 				}
 
 				return true;
@@ -0,0 +1,293 @@
+#include "pch.h"
+
+#include "Headers/Backtest.hpp"
+#include "Headers/Utils/SymbolTable.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace StockyBoy {
+	namespace Bots {
+		namespace FivePercentRule {
+			static constexpr double MISSING = std::numeric_limits<double>::quiet_NaN();
+			static constexpr int64_t SECONDS_PER_DAY = 24 * 60 * 60;
+
+			static int64_t DayOf(int64_t epoch) {
+				return (epoch >= 0) ? epoch / SECONDS_PER_DAY : (epoch - SECONDS_PER_DAY + 1) / SECONDS_PER_DAY;
+			}
+
+			// ====================
+			// History
+			// ====================
+
+			History History::Build(std::span<const std::string> labels, std::span<const Scraper::StockTableView> bars)
+			{
+				History history;
+
+				const size_t symbolNum = std::min(labels.size(), bars.size());
+				if (symbolNum == 0) {
+					return history;
+				}
+
+				// --- Calendar: mark every day any symbol traded, then number them ---
+				int64_t first = std::numeric_limits<int64_t>::max();
+				int64_t last = std::numeric_limits<int64_t>::min();
+				for (size_t s = 0; s < symbolNum; ++s) {
+					if (bars[s].empty()) continue;
+					first = std::min(first, DayOf(bars[s].epochs.front()));
+					last = std::max(last, DayOf(bars[s].epochs.back()));
+				}
+				if (first > last) {
+					return history;
+				}
+
+				std::vector<uint32_t> dayIndex(static_cast<size_t>(last - first + 1), 0);
+				for (size_t s = 0; s < symbolNum; ++s) {
+					for (int64_t epoch : bars[s].epochs) {
+						dayIndex[static_cast<size_t>(DayOf(epoch) - first)] = 1;
+					}
+				}
+				for (size_t i = 0; i < dayIndex.size(); ++i) {
+					if (dayIndex[i]) {
+						dayIndex[i] = static_cast<uint32_t>(history.Days.size());
+						history.Days.push_back(first + static_cast<int64_t>(i));
+					}
+				}
+
+				// --- Scatter every symbol's closes into its column ---
+				history.Labels.assign(labels.begin(), labels.begin() + symbolNum);
+				history.Closes.assign(history.Days.size() * symbolNum, MISSING);
+				for (size_t s = 0; s < symbolNum; ++s) {
+					history.Symbols.emplace(history.Labels[s], static_cast<uint32_t>(s));
+
+					const Scraper::StockTableView& view = bars[s];
+					for (size_t i = 0; i < view.size(); ++i) {
+						const size_t row = dayIndex[static_cast<size_t>(DayOf(view.epochs[i]) - first)];
+						history.Closes[row * symbolNum + s] = view.close[i]; // a later bar on the same day wins
+					}
+				}
+
+				return history;
+			}
+
+			History History::Load(const Scraper::BarCache& cache, std::span<const char* const> labels)
+			{
+				std::vector<Scraper::MappedBars> mapped;
+				std::vector<Scraper::StockTableView> views;
+				std::vector<std::string> found;
+				mapped.reserve(labels.size());
+
+				for (const char* label : labels) {
+					Scraper::MappedBars bars;
+					if (!cache.Map(label, DAYS_1, bars).succeeded || bars.view().empty()) continue;
+
+					mapped.push_back(std::move(bars));
+					found.emplace_back(label);
+				}
+
+				views.reserve(mapped.size());
+				for (const Scraper::MappedBars& bars : mapped) {
+					views.push_back(bars.view());
+				}
+
+				return Build(found, views);
+			}
+
+			History History::Load(const Scraper::BarCache& cache)
+			{
+				std::vector<const char*> labels(SYMBOL_COUNT);
+				for (uint32_t id = 0; id < SYMBOL_COUNT; ++id) {
+					labels[id] = SymbolCStr(static_cast<SymbolId>(id));
+				}
+				return Load(cache, labels);
+			}
+
+			std::span<const double> History::closes(size_t day) const
+			{
+				return std::span<const double>(Closes).subspan(day * Labels.size(), Labels.size());
+			}
+
+			bool History::Find(const std::string& label, uint32_t& out_Symbol) const
+			{
+				auto it = Symbols.find(label);
+				if (it == Symbols.end()) {
+					return false;
+				}
+				out_Symbol = it->second;
+				return true;
+			}
+
+			// ====================
+			// ReplayMarket
+			// ====================
+
+			ReplayMarket::ReplayMarket(const History& history)
+				: Data(history), LastClose(history.symbols(), MISSING), Hits(history.symbols(), 0)
+			{
+			}
+
+			void ReplayMarket::SetDay(size_t day)
+			{
+				Day = day;
+
+				const std::span<const double> today = Data.closes(day);
+				for (size_t s = 0; s < today.size(); ++s) {
+					if (!std::isnan(today[s])) LastClose[s] = today[s];
+				}
+			}
+
+			bool ReplayMarket::GetPrice(const std::string& label, float& out_Price)
+			{
+				uint32_t symbol;
+				if (!Data.Find(label, symbol)) {
+					return false;
+				}
+
+				const double close = Data.closes(Day)[symbol];
+				if (std::isnan(close)) {
+					return false;
+				}
+
+				out_Price = static_cast<float>(close);
+				return true;
+			}
+
+			void ReplayMarket::Scan(const Scraper::Screener& screener, uint32_t depth, std::span<const uint32_t> order, const Tickers& exclude, const OnHit& onHit)
+			{
+				if (Window.depth() != depth || Window.symbols() != Data.symbols()) {
+					Window = Scraper::CloseMatrix(Data.labels(), depth);
+				}
+
+				for (uint32_t barsAgo = 0; barsAgo < depth; ++barsAgo) {
+					Window.SetRow(barsAgo, (barsAgo <= Day) ? Data.closes(Day - barsAgo) : std::span<const double>{});
+				}
+
+				std::fill(Hits.begin(), Hits.end(), 0);
+				for (const Scraper::ScreenHit& hit : screener.Run(Window)) {
+					Hits[hit.symbol] = 1;
+				}
+
+				for (const auto& [label, price] : exclude) {
+					uint32_t symbol;
+					if (Data.Find(label, symbol)) Hits[symbol] = 0;
+				}
+
+				// Walk the hits in the caller's order, like the live scan does batch by batch
+				const std::span<const double> latest = Window.latest();
+				for (uint32_t symbol : order) {
+					if (!Hits[symbol]) continue;
+
+					if (!onHit(Data.labels()[symbol], static_cast<float>(latest[symbol]))) {
+						return;
+					}
+				}
+			}
+
+			// ====================
+			// InMemoryPortfolio
+			// ====================
+
+			bool InMemoryPortfolio::GetBalance(float& out_Balance)
+			{
+				out_Balance = static_cast<float>(Cash);
+				return true;
+			}
+
+			std::vector<Scraper::Result> InMemoryPortfolio::Execute(const std::vector<Trade>& trades)
+			{
+				std::vector<Scraper::Result> results;
+				results.reserve(trades.size());
+				for (const Trade& trade : trades) {
+					results.push_back((trade.action == Scraper::Action::BUY)
+						? Buy(trade.label, trade.price, trade.value)
+						: Sell(trade.label, trade.price));
+				}
+				return results;
+			}
+
+			Scraper::Result InMemoryPortfolio::Buy(const std::string& label, float price, float value)
+			{
+				if (price <= 0.0f) {
+					return Scraper::Result::Fail("[StockyBoy][Backtest] No price for: " + label);
+				}
+				if (Cash < value) {
+					return Scraper::Result::Fail("[StockyBoy][Backtest] Not enough cash to buy: " + label);
+				}
+
+				Cash -= value;
+				Shares[label] += value / price;
+				Holdings[label] = price;
+				++Buys;
+				return Scraper::Result::Ok();
+			}
+
+			Scraper::Result InMemoryPortfolio::Sell(const std::string& label, float price)
+			{
+				auto it = Shares.find(label);
+				if (it == Shares.end()) {
+					return Scraper::Result::Fail("[StockyBoy][Backtest] No position in: " + label);
+				}
+
+				Cash += it->second * price;
+				Shares.erase(it);
+				Holdings.erase(label);
+				++Sells;
+				return Scraper::Result::Ok();
+			}
+
+			double InMemoryPortfolio::Equity(const ReplayMarket& market, const History& history) const
+			{
+				double equity = Cash;
+				for (const auto& [label, shares] : Shares) {
+					uint32_t symbol;
+					const double close = history.Find(label, symbol) ? market.lastClose(symbol) : MISSING;
+					equity += shares * (std::isnan(close) ? Holdings.at(label) : close);
+				}
+				return equity;
+			}
+
+			// ====================
+			// Backtest
+			// ====================
+
+			BacktestResult Backtest(const History& history, const BacktestConfig& config, std::ostream* log)
+			{
+				BacktestResult result;
+				result.startingCash = config.startingCash;
+
+				ReplayMarket market(history);
+				InMemoryPortfolio portfolio(config.startingCash);
+				ManualClock clock;
+				std::mt19937_64 rng(config.seed);
+
+				std::ostream discard(nullptr);
+				std::ostream& out = log ? *log : discard;
+
+				result.days.reserve(history.days());
+				result.equity.reserve(history.days());
+
+				bool firstSession = true;
+				for (size_t day = 0; day < history.days(); ++day) {
+					market.SetDay(day);
+					if (day < config.params.window) continue; // not enough bars for the rule yet
+
+					// Mid-session, so the same market-hours gate as the live run applies (weekends are skipped)
+					clock.Set(std::chrono::system_clock::time_point(std::chrono::seconds(history.day(day) * SECONDS_PER_DAY)) + std::chrono::hours(15));
+					if (!InMarketHours(clock)) continue;
+
+					const Session session{ .params = config.params, .budget = config.dailyBudget, .checkBalance = !firstSession };
+					RunSession(session, market, portfolio, rng, out);
+					firstSession = false;
+
+					result.days.push_back(history.day(day));
+					result.equity.push_back(portfolio.Equity(market, history));
+				}
+
+				result.buys = portfolio.buys();
+				result.sells = portfolio.sells();
+
+				return result;
+			}
+		}
+	}
+}
@@ -0,0 +1,156 @@
+#include "pch.h"
+
+#include "Headers/Strategy.hpp"
+
+namespace StockyBoy {
+	namespace Bots {
+		namespace FivePercentRule {
+			namespace chrono = std::chrono;
+
+			static std::string ToString(std::chrono::year_month_day ymwd) {
+				using namespace std::chrono;
+
+				year y = ymwd.year();
+				month m = ymwd.month();
+				day d = ymwd.day();
+
+				// Convert to ints
+				int y_val = int(y);
+				unsigned m_val = unsigned(m);
+				unsigned wd_val = unsigned(d);  // Sunday=0, Monday=1, ...
+
+				return std::format("{:04}-{:02}-{:02}", y_val, m_val, wd_val);
+			}
+
+			std::string GetTodayString(const Clock& clock) {
+				auto today_days = chrono::floor<chrono::days>(clock.now());
+				chrono::year_month_day today{ today_days };
+				return ToString(today);
+			}
+
+			bool InMarketHours(const Clock& clock) {
+				using namespace std::chrono;
+
+				auto now = clock.now();
+
+				// extract date
+				auto today_days = floor<days>(now);
+				year_month_day ymd{ today_days };
+
+				// check if week day
+				weekday wd{ today_days };
+				if (wd == Saturday || wd == Sunday) {
+					return false;
+				}
+
+				// extract time of day
+				auto time_since_midnight = now - today_days;
+				hh_mm_ss hms{ time_since_midnight }; // in UTC
+
+				// Convert time-of-day to seconds for easy comparison
+				auto secs = duration_cast<seconds>(hms.to_duration()).count();
+
+				// market hours
+				auto open_buffer = (14h + 30min);	// latest open
+				auto close_buffer = (20h);			// earliest close
+
+				auto open_secs = duration_cast<seconds>(open_buffer).count();
+				auto close_secs = duration_cast<seconds>(close_buffer).count();
+
+				return secs >= open_secs && secs <= close_secs;
+			}
+
+			float getPercentageChange(float _old, float _new) {
+				return ((_new - _old) / _old) * 100.0f;
+			}
+
+			Scraper::Screener MakeBuyScreener(const Params& params) {
+				using Scraper::Screener;
+
+				// If stock went down of at least buyDrop %, buy
+				Screener screener;
+				screener.Where(Screener::PercentChange(params.window), Screener::AtMost(-params.buyDrop + params.forgiveness));
+				return screener;
+			}
+
+			std::vector<uint32_t> getShuffledIndices(uint32_t n, std::mt19937_64& rng) {
+				std::vector<uint32_t> indices(n);
+				std::iota(indices.begin(), indices.end(), 0); // fill with 0..n-1
+
+				std::shuffle(indices.begin(), indices.end(), rng);
+
+				return indices;
+			}
+
+			void RunSession(const Session& session, MarketData& market, Portfolio& portfolio, std::mt19937_64& rng, std::ostream& log) {
+				const Params& params = session.params;
+
+				Tickers todayBuys;
+				Tickers todaySells;
+
+				// --- Sell what went up at least sellGain % since we bought it ---
+				std::vector<std::string> held;
+				held.reserve(portfolio.holdings().size());
+				for (const auto& [label, price] : portfolio.holdings()) {
+					held.push_back(label);
+				}
+
+				Tickers prices;
+				market.GetPrices(held, prices);
+
+				for (const auto& [label, price] : portfolio.holdings()) {
+					auto it = prices.find(label);
+					if (it == prices.end()) continue;
+
+					const float currPrice = it->second;
+					float priceChange = getPercentageChange(price, currPrice);
+
+					if (priceChange >= params.sellGain - params.forgiveness) {
+						todaySells[label] = currPrice;
+					}
+				}
+
+				// --- Buy dips, in shuffled order, while the budget allows it ---
+				bool canBuy = session.budget > 0.0f && params.tradeValue > 0.0f;
+				if (canBuy && session.checkBalance) {
+					float totalBalance;
+					canBuy = portfolio.GetBalance(totalBalance) && totalBalance > session.budget;
+				}
+
+				if (canBuy) {
+					float budget = session.budget;
+					const std::vector<uint32_t> order = getShuffledIndices(static_cast<uint32_t>(market.universeSize()), rng);
+
+					market.Scan(MakeBuyScreener(params), params.window + 1, order, portfolio.holdings(),
+						[&](const std::string& label, float price) {
+							todayBuys[label] = price;
+							budget -= params.tradeValue;
+							return budget > 0.0f;
+						});
+				}
+
+				// --- Execute trades ---
+				std::vector<Trade> trades;
+				trades.reserve(todayBuys.size() + todaySells.size());
+				for (const auto& [label, price] : todayBuys) {
+					trades.push_back(Trade{ .action = Scraper::Action::BUY, .label = label, .price = price, .value = params.tradeValue });
+				}
+				for (const auto& [label, price] : todaySells) {
+					trades.push_back(Trade{ .action = Scraper::Action::SELL, .label = label, .price = price, .value = 0.0f });
+				}
+
+				const std::vector<Scraper::Result> results = portfolio.Execute(trades);
+				for (size_t i = 0; i < trades.size() && i < results.size(); ++i) {
+					if (results[i].succeeded) continue;
+
+					if (trades[i].action == Scraper::Action::BUY) {
+						log << "Failed to buy from " << trades[i].label << '\n';
+					}
+					else {
+						log << "Failed to sell " << trades[i].label << '\n';
+					}
+				}
+			}
+		}
+	}
+}
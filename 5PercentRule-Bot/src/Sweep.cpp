@@ -0,0 +1,172 @@
+#include "pch.h"
+
+#include "Headers/Sweep.hpp"
+
+#include <mutex>
+#include <deque>
+#include <memory>
+#include <functional>
+
+namespace StockyBoy {
+	namespace Bots {
+		namespace FivePercentRule {
+			// ====================
+			// Work stealing
+			// ====================
+
+			// Owner pops from the back, thieves take from the front
+			class TaskQueue {
+			private:
+				std::mutex Mutex;
+				std::deque<size_t> Tasks;
+
+			public:
+				void Push(size_t task) {
+					std::lock_guard<std::mutex> lock(Mutex);
+					Tasks.push_back(task);
+				}
+
+				bool Pop(size_t& out_Task) {
+					std::lock_guard<std::mutex> lock(Mutex);
+					if (Tasks.empty()) return false;
+					out_Task = Tasks.back();
+					Tasks.pop_back();
+					return true;
+				}
+
+				bool Steal(size_t& out_Task) {
+					std::lock_guard<std::mutex> lock(Mutex);
+					if (Tasks.empty()) return false;
+					out_Task = Tasks.front();
+					Tasks.pop_front();
+					return true;
+				}
+			};
+
+			// Runs task(0..count-1) once each. Workers start on contiguous blocks and steal from the others
+			// once theirs is empty. No task is ever added later, so a full round of failed steals means done.
+			static void RunParallel(size_t count, size_t threads, const std::function<void(size_t)>& task) {
+				if (count == 0) return;
+
+				if (threads == 0) {
+					threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+				}
+				threads = std::min(threads, count);
+
+				std::vector<std::unique_ptr<TaskQueue>> queues;
+				for (size_t t = 0; t < threads; ++t) {
+					queues.push_back(std::make_unique<TaskQueue>());
+				}
+				for (size_t i = 0; i < count; ++i) {
+					queues[i * threads / count]->Push(i);
+				}
+
+				auto worker = [&](size_t self) {
+					size_t next;
+					while (true) {
+						bool found = queues[self]->Pop(next);
+						for (size_t k = 1; !found && k < threads; ++k) {
+							found = queues[(self + k) % threads]->Steal(next);
+						}
+						if (!found) return;
+
+						task(next);
+					}
+					};
+
+				std::vector<std::thread> pool;
+				for (size_t t = 1; t < threads; ++t) {
+					pool.emplace_back(worker, t);
+				}
+				worker(0);
+
+				for (std::thread& thread : pool) {
+					thread.join();
+				}
+			}
+
+			// ====================
+			// Sweep
+			// ====================
+
+			template <typename T>
+			static std::vector<T> OrDefault(const std::vector<T>& values, T fallback) {
+				return values.empty() ? std::vector<T>{ fallback } : values;
+			}
+
+			std::vector<Params> SweepGrid::Expand() const {
+				const Params defaults{};
+
+				const std::vector<uint32_t> windowValues = OrDefault(windows, defaults.window);
+				const std::vector<float> buyValues = OrDefault(buyDrops, defaults.buyDrop);
+				const std::vector<float> sellValues = OrDefault(sellGains, defaults.sellGain);
+				const std::vector<float> forgivenessValues = OrDefault(forgiveness, defaults.forgiveness);
+				const std::vector<float> tradeValueValues = OrDefault(tradeValues, defaults.tradeValue);
+
+				std::vector<Params> grid;
+				grid.reserve(windowValues.size() * buyValues.size() * sellValues.size() * forgivenessValues.size() * tradeValueValues.size());
+
+				for (uint32_t window : windowValues)
+					for (float buyDrop : buyValues)
+						for (float sellGain : sellValues)
+							for (float slack : forgivenessValues)
+								for (float tradeValue : tradeValueValues)
+									grid.push_back(Params{
+										.window = window,
+										.buyDrop = buyDrop,
+										.sellGain = sellGain,
+										.forgiveness = slack,
+										.tradeValue = tradeValue
+										});
+
+				return grid;
+			}
+
+			SweepRow Summarize(const Params& params, const BacktestResult& result) {
+				SweepRow row{ .params = params, .trades = result.buys + result.sells };
+
+				const double finalEquity = result.equity.empty() ? result.startingCash : result.equity.back();
+				if (result.startingCash > 0.0) {
+					row.totalReturn = finalEquity / result.startingCash - 1.0;
+				}
+
+				double peak = result.startingCash;
+				for (double equity : result.equity) {
+					peak = std::max(peak, equity);
+					if (peak > 0.0) {
+						row.maxDrawdown = std::max(row.maxDrawdown, (peak - equity) / peak);
+					}
+				}
+
+				return row;
+			}
+
+			std::vector<SweepRow> Sweep(const History& history, std::span<const Params> grid, const BacktestConfig& base, size_t threads) {
+				std::vector<SweepRow> rows(grid.size());
+
+				// Every task writes its own row, the history is only read
+				RunParallel(grid.size(), threads, [&](size_t i) {
+					BacktestConfig config = base;
+					config.params = grid[i];
+					rows[i] = Summarize(grid[i], Backtest(history, config));
+					});
+
+				return rows;
+			}
+
+			void WriteSweepTable(std::ostream& out, std::span<const SweepRow> rows) {
+				out << "window,buyDrop,sellGain,forgiveness,tradeValue,return,maxDrawdown,trades\n";
+				for (const SweepRow& row : rows) {
+					out << row.params.window << ','
+						<< row.params.buyDrop << ','
+						<< row.params.sellGain << ','
+						<< row.params.forgiveness << ','
+						<< row.params.tradeValue << ','
+						<< row.totalReturn << ','
+						<< row.maxDrawdown << ','
+						<< row.trades << '\n';
+				}
+			}
+		}
+	}
+}
@@ -3,12 +3,16 @@
 #include <LexviEngine.hpp>
 
 #include <mutex>
+#include <memory>
 #include <string>
 #include <thread>
 #include <atomic>
 
 #include "StockScraper/Headers/Types.hpp"
 #include "StockScraper/Headers/Alpaca.hpp"
+#include "StockScraper/Headers/AccountPoller.hpp"
+#include "StockScraper/Headers/BarBuilder.hpp"
+#include "StockScraper/Headers/MarketStream.hpp"
 #include "StockScraper/Headers/StockData.hpp"
 
 // Application
@@ -49,11 +53,31 @@ private:
         StockTable  table;
     } stockData;
 
+    // UI thread only: date strings for the table rows and the plot axis
+    StockyBoy::Scraper::DateLabels dateLabels;
+
     std::mutex stockMutex;
     std::thread stockThread;
 
     std::atomic<bool> fetchingStock = false;
 
+    // =========================================================================
+    // === Live Bars ===========================================================
+    // =========================================================================
+    // Built from Alpaca's market data stream; the Market tab plots them and the bot prices from them
+    StockyBoy::Scraper::BarBuilder liveBars;
+    std::unique_ptr<StockyBoy::Scraper::Alpaca::MarketStream> marketStream; // live thread only
+
+    struct LiveUI {
+        bool enabled = false;
+        std::string label;
+        StockyBoy::INTERVAL interval = StockyBoy::MINUTES_1;
+        uint64_t version = 0; // liveBars version last copied into stockData
+    } liveUI;
+
+    std::thread liveThread;
+    std::atomic<bool> startingLive = false;
+
     // =========================================================================
     // === Account UI / Data ===================================================
     // =========================================================================
@@ -63,7 +87,11 @@ private:
 
     struct AccountData {
         Account current;
+        StockyBoy::Scraper::Alpaca::ACCOUNTS loaded = StockyBoy::Scraper::Alpaca::ACCOUNTS::COUNT;
         bool available = false;
+
+        // Keeps balance and portfolio value fresh in the background, the UI only reads its snapshot
+        std::unique_ptr<StockyBoy::Scraper::Alpaca::AccountPoller> poller;
     } accountData;
 
     std::mutex accountMutex;
@@ -100,6 +128,9 @@ private:
     void ShowStockPlot();
     void StockTableUI();
 
+    // ImPlot formatter: bar index on the x axis -> date of that bar
+    static int FormatTimeAxis(double value, char* buff, int size, void* userData);
+
     // =========================================================================
     // === Async Operations ====================================================
     // =========================================================================
@@ -108,6 +139,11 @@ private:
 
     void AsyncFetchAccount(StockyBoy::Scraper::Alpaca::ACCOUNTS account);
 
+    void AsyncStartLive(const std::string& label);
+
+    // UI thread: copies the live bars into stockData when they changed
+    void UpdateLiveBars();
+
     // =========================================================================
     // === UI Theme ============================================================
     // =========================================================================
@@ -6,6 +6,8 @@
 #include <Utils/Logging.hpp>
 #include <imgui.h>
 #include <implot.h>
+#include <cmath>
+#include <cstdio>
 #include <iostream>
 #include <filesystem>
 
@@ -23,7 +25,8 @@ bool Application::loadResources(Lexvi::Engine&)
 
             while (!shouldStop) {
                 std::chrono::seconds waitDuration;
-                bool algoExecuted = StockyBoy::Bots::FivePercentRule::Run(fs::current_path().string() + "\\5PercentBot\\Log", fivePercentAccount, 3, 50.0f);
+                bool algoExecuted = StockyBoy::Bots::FivePercentRule::Run(fs::current_path().string() + "\\5PercentBot\\Log", fivePercentAccount,
+                    StockyBoy::Bots::FivePercentRule::Params{ .window = 3 }, 50.0f, &liveBars);
 
                 if (algoExecuted) {
                     LEXVI_LOG_INFO("[StockyBoy][5Percent] Trade cycle executed, next check in 24 hours.");
@@ -77,6 +80,9 @@ void Application::shutdown() {
 
     if (stockThread.joinable()) stockThread.join();
     if (accountThread.joinable()) accountThread.join();
+    if (liveThread.joinable()) liveThread.join();
+    accountData.poller.reset();
+    marketStream.reset();
     if (FivePercentThread.joinable()) FivePercentThread.join();
 }
 
@@ -122,6 +128,16 @@ void Application::AsyncFetchAccount(StockyBoy::Scraper::Alpaca::ACCOUNTS account
 
     fetchingAccount.store(true);
 
+    // Same account again: credentials are already loaded, just ask the poller for a refresh
+    {
+        std::lock_guard<std::mutex> lock(accountMutex);
+        if (accountData.available && accountData.loaded == account && accountData.poller) {
+            accountData.poller->RefreshNow();
+            fetchingAccount.store(false);
+            return;
+        }
+    }
+
     Account fetched;
     Result fetchResult = fetched.Load(account);
     if (!fetchResult.succeeded) {
@@ -130,13 +146,61 @@ void Application::AsyncFetchAccount(StockyBoy::Scraper::Alpaca::ACCOUNTS account
         return;
     }
 
-    std::lock_guard<std::mutex> lock(accountMutex);
-    accountData.current = std::move(fetched);
-    accountData.available = true;
+    auto poller = std::make_unique<Alpaca::AccountPoller>(fetched);
+
+    {
+        std::lock_guard<std::mutex> lock(accountMutex);
+        accountData.current = std::move(fetched);
+        accountData.loaded = account;
+        accountData.available = true;
+        accountData.poller.swap(poller);
+    }
+
+    // The old poller may be mid-request, join it outside the lock
+    poller.reset();
 
     fetchingAccount.store(false);
 }
 
+void Application::AsyncStartLive(const std::string& label) {
+    using namespace StockyBoy::Scraper;
+
+    startingLive.store(true);
+
+    // Market data uses the same keys as trading, one connection serves every symbol
+    if (!marketStream) {
+        Alpaca::Account account;
+        Result loadResult = account.Load(Alpaca::ACCOUNTS::FIVE_PERCENT);
+        if (!loadResult.succeeded) {
+            errorHandler.Push(loadResult.error);
+            startingLive.store(false);
+            return;
+        }
+        marketStream = std::make_unique<Alpaca::MarketStream>(account, liveBars);
+    }
+
+    marketStream->Subscribe({ label });
+
+    Result startResult = marketStream->Start();
+    if (!startResult.succeeded) {
+        errorHandler.Push(startResult.error);
+    }
+
+    startingLive.store(false);
+}
+
+void Application::UpdateLiveBars() {
+    const uint64_t version = liveBars.version();
+    if (version == liveUI.version) return;
+
+    std::lock_guard<std::mutex> lock(stockMutex);
+    if (liveBars.Snapshot(liveUI.label, liveUI.interval, stockData.table).succeeded) {
+        stockData.label = liveUI.label;
+        stockData.rawData.clear();
+        liveUI.version = version;
+    }
+}
+
 // ============================================================================
 // UI - Main App UI
 // ============================================================================
@@ -186,17 +250,26 @@ void Application::RenderMainUI() {
             }
 
             // Show account data
+            std::lock_guard<std::mutex> lock(accountMutex);
             if (accountData.available) {
                 std::string name;
-                float balance = 0.f, portfolioValue = 0.f;
+                AlpacaAccountDetails details;
+                AccountPoller::Clock::time_point updated{};
                 accountData.current.GetName(name);
-                accountData.current.GetBalance(balance);
-                accountData.current.GetPorfolioValue(portfolioValue);
+
+                // Until the poller has a snapshot, show what Load fetched
+                if (!accountData.poller || !accountData.poller->Snapshot(details, &updated).succeeded) {
+                    accountData.current.GetDetails(details);
+                }
 
                 ImGui::SeparatorText("Account Summary");
                 ImGui::Text("Name: %s", name.c_str());
-                ImGui::Text("Balance: %.2f", balance);
-                ImGui::Text("Portfolio Value: %.2f", portfolioValue);
+                ImGui::Text("Balance: %.2f", details.cashBalance);
+                ImGui::Text("Portfolio Value: %.2f", details.portfolioValue);
+                if (updated != AccountPoller::Clock::time_point{}) {
+                    const auto age = std::chrono::duration_cast<std::chrono::seconds>(AccountPoller::Clock::now() - updated);
+                    ImGui::TextDisabled("Updated %llds ago", static_cast<long long>(age.count()));
+                }
             }
 
             ImGui::EndTabItem();
@@ -248,6 +321,7 @@ void Application::RenderMainUI() {
             ImGui::Checkbox("Normalize Data", &stockUI.normalize);
 
             if (ImGui::Button("Fetch Stock Data")) {
+                liveUI.enabled = false;
                 if (stockThread.joinable()) stockThread.join();
                 stockThread = std::thread(&Application::AsyncFetchData, this,
                     std::string(stockUI.label),
@@ -255,10 +329,37 @@ void Application::RenderMainUI() {
                     stockUI.normalize);
             }
 
+            // Live: 1m or 5m bars built from the trade stream, no re-download
+            ImGui::SameLine();
+            if (ImGui::Button("Stream Live") && stockUI.label[0] != '\0') {
+                if (liveThread.joinable()) liveThread.join();
+                liveUI.enabled = true;
+                liveUI.label = stockUI.label;
+                liveUI.interval = (stockUI.interval == MINUTES_5) ? MINUTES_5 : MINUTES_1;
+                liveUI.version = 0;
+                liveThread = std::thread(&Application::AsyncStartLive, this, liveUI.label);
+            }
+
+            if (liveUI.enabled) {
+                ImGui::SameLine();
+                if (ImGui::Button("Stop Live")) {
+                    liveUI.enabled = false;
+                }
+            }
+
             if (fetchingStock.load()) {
                 ImGui::ProgressBar((float)ImGui::GetTime() * -0.2f, ImVec2(-1, 0), "Fetching...");
             }
 
+            if (startingLive.load()) {
+                ImGui::ProgressBar((float)ImGui::GetTime() * -0.2f, ImVec2(-1, 0), "Connecting...");
+            }
+
+            if (liveUI.enabled) {
+                UpdateLiveBars();
+                ImGui::TextDisabled("Live %s bars for %s", ToString(liveUI.interval).c_str(), liveUI.label.c_str());
+            }
+
             ImGui::SeparatorText("Stock Overview");
             ImGui::Checkbox("Show Volume", &stockUI.showVolume);
 
@@ -314,14 +415,22 @@ void Application::StockTableUI() {
         ImGui::TableSetupColumn("Volume");
         ImGui::TableHeadersRow();
 
-        for (const auto& row : stockData.table.data) {
-            ImGui::TableNextRow();
-            ImGui::TableNextColumn(); ImGui::Text("%s", row.date.c_str());
-            ImGui::TableNextColumn(); ImGui::Text("%.2f", row.open);
-            ImGui::TableNextColumn(); ImGui::Text("%.2f", row.high);
-            ImGui::TableNextColumn(); ImGui::Text("%.2f", row.low);
-            ImGui::TableNextColumn(); ImGui::Text("%.2f", row.close);
-            ImGui::TableNextColumn(); ImGui::Text("%.2f", row.volume);
+        // Only the visible rows are assembled and have their date formatted
+        ImGuiListClipper clipper;
+        clipper.Begin((int)stockData.table.size());
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                const StockyBoy::Scraper::StockRow row = stockData.table[i];
+                const std::string& date = dateLabels.Format(row.epoch, stockData.table.intraday());
+
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%s", date.c_str());
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", row.open);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", row.high);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", row.low);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", row.close);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f", row.volume);
+            }
         }
 
         ImGui::EndTable();
@@ -334,13 +443,21 @@ void Application::StockTableUI() {
 void Application::ShowStockPlot() {
     if (ImPlot::BeginPlot("Stock Overview", ImVec2(-1, -1))) {
         if (!stockData.table.close.empty()) {
-            ImPlot::SetupAxis(ImAxis_X1, "Day");
+            // Bars are plotted by index so closed-market gaps take no space, the axis shows their real dates
+            ImPlot::SetupAxis(ImAxis_X1, "Date");
+            ImPlot::SetupAxisFormat(ImAxis_X1, &Application::FormatTimeAxis, this);
             ImPlot::SetupAxis(ImAxis_Y1, "Price ($)");
-            ImPlot::SetupAxisLimits(ImAxis_X1, 0, (double)stockData.table.data.size() - 1);
+            ImPlot::SetupAxisLimits(ImAxis_X1, 0, (double)stockData.table.size() - 1);
 
             if (stockUI.showVolume)
                 ImPlot::SetupAxis(ImAxis_Y2, "Volume", ImPlotAxisFlags_AuxDefault);
 
+            if (stockData.table.intraday() && stockData.table.sessionStarts.size() > 1) {
+                ImPlot::PlotInfLines("Sessions",
+                    stockData.table.sessionStarts.data() + 1,
+                    (int)stockData.table.sessionStarts.size() - 1);
+            }
+
             ImPlot::PushStyleColor(ImPlotCol_PlotBg, ImVec4(0, 0.8f, 0, 1));
             ImPlot::PlotLine("Close Price",
                 stockData.table.timeStamps.data(),
@@ -363,6 +480,18 @@ void Application::ShowStockPlot() {
     }
 }
 
+int Application::FormatTimeAxis(double value, char* buff, int size, void* userData) {
+    Application* app = static_cast<Application*>(userData);
+    const StockTable& table = app->stockData.table;
+
+    const double index = std::round(value);
+    if (index < 0.0 || index >= (double)table.size()) {
+        return snprintf(buff, size, "%s", "");
+    }
+
+    const std::string& label = app->dateLabels.Format(table.epochs[(size_t)index], table.intraday());
+    return snprintf(buff, size, "%s", label.c_str());
+}
 
 // ============================================================================
 // UI - Error Window
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <condition_variable>
+
+#include "Alpaca.hpp"
+
+namespace StockyBoy {
+	namespace Scraper {
+		namespace Alpaca {
+			// Refreshes a copy of the account on its own thread every `period`, so readers take the last
+			// snapshot under a lock instead of waiting on a request. The first refresh runs at once.
+			class AccountPoller {
+			public:
+				using Clock = std::chrono::steady_clock;
+
+				static constexpr std::chrono::seconds DEFAULT_PERIOD{ 30 };
+
+			private:
+				Account account; // only used by the poll thread
+
+				std::chrono::milliseconds period;
+
+				mutable std::mutex mutex;
+				std::condition_variable wake;
+				AlpacaAccountDetails snapshot{};
+				Clock::time_point updated{};
+				Result last = Result::Fail("[StockyBoy][AccountPoller] No refresh yet");
+				bool refreshRequested = false;
+				bool stopping = false;
+
+				std::thread worker;
+
+				void Poll();
+
+			public:
+				explicit AccountPoller(const Account& account, std::chrono::milliseconds period = DEFAULT_PERIOD);
+				~AccountPoller();
+
+				AccountPoller(const AccountPoller&) = delete;
+				AccountPoller& operator=(const AccountPoller&) = delete;
+
+				// Last good snapshot, fails until the first refresh succeeded. `out_Updated` is when it was taken.
+				Result Snapshot(AlpacaAccountDetails& out_Details, Clock::time_point* out_Updated = nullptr) const;
+
+				// Outcome of the most recent refresh, which may be newer than the snapshot
+				Result LastResult() const;
+
+				// Wakes the thread for a refresh now instead of at the end of the period
+				void RefreshNow();
+
+				void SetPeriod(std::chrono::milliseconds period);
+			};
+		}
+	}
+}
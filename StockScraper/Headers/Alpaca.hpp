@@ -3,8 +3,13 @@
 #include "Result.hpp"
 
 #include <map>
+#include <span>
+#include <memory>
 #include <array>
 #include <string>
+#include <vector>
+
+struct curl_slist;
 
 namespace StockyBoy {
     namespace Scraper {
@@ -25,6 +30,14 @@ namespace StockyBoy {
             OrderType type;
             float value;
             std::string label;
+
+            // When set, the order is for this many shares (as Alpaca writes them, e.g. Position::qtyText) instead of `value` dollars.
+            // Selling a position's exact qty closes it without leaving a fractional remainder.
+            std::string qty{};
+
+            // Optional, unique per order (max 128 chars). Alpaca rejects a second order with the same id,
+            // which makes resubmitting after a timeout safe.
+            std::string clientOrderId{};
         };
 
         namespace Alpaca { 
@@ -40,21 +53,66 @@ namespace StockyBoy {
                 float portfolioValue{};
             };
 
+            // One row of GET /positions
+            struct Position {
+                std::string symbol{};
+                float qty{};
+                std::string qtyText{}; // qty exactly as Alpaca sent it, empty once a fill changed it
+                float avgEntryPrice{};
+                float currentPrice{};
+                float marketValue{};
+            };
+
+            // One row of GET /orders?status=open. Orders placed by notional have qty 0 and the other way round.
+            struct OpenOrder {
+                std::string id{};
+                std::string clientOrderId{};
+                std::string symbol{};
+                Action action = Action::BUY;
+                float notional{};
+                float qty{};
+                float filledQty{};
+            };
+
             const inline std::array<std::string, (size_t)ACCOUNTS::COUNT> AccountName = {
                 "5Percent"
             };
 
+            // Alpaca's documented trading API budget, per account: every GET and POST to the endpoint counts
+            inline constexpr double REQUESTS_PER_MINUTE = 200.0;
+            inline constexpr double REQUEST_BURST = 10.0;
+
+            // Sets the RateGovernor limits of `host` (the trading endpoint or data.alpaca.markets) to that budget
+            void LimitRequests(const std::string& host);
+
+            class TradeStream;
+            class MarketStream;
+            class DataProvider;
+
             class Account {
             private:
+                // The streams and the market data client open their own connections with the same keys
+                friend class TradeStream;
+                friend class MarketStream;
+                friend class DataProvider;
+
                 std::string EndPoint{};
+                std::string Host{}; // RateGovernor key of EndPoint
                 std::string Key{};
                 std::string Secret{};
 
                 std::string Name{};
 
+                // Built once in Init and shared by copies, curl only reads them
+                std::shared_ptr<curl_slist> Headers{};
+                std::shared_ptr<curl_slist> JsonHeaders{};
+
             private:
                 AlpacaAccountDetails details;
 
+                // GET EndPoint + path on a pooled handle, paced by the RateGovernor of the host; fails on anything but a 200
+                Result Get(const std::string& path, std::string& out_Response);
+
             public:
                 Account() = default;
                 Account(const std::string& endPoint, const std::string& key, const std::string& secret);
@@ -63,12 +121,25 @@ namespace StockyBoy {
                 Result Init(const std::string& endPoint, const std::string& key, const std::string& secret);
                 Result Load(ACCOUNTS account);
 
+                // Re-reads id, account number, cash and equity with the keys already set up
+                Result Refresh();
+
                 Result SubmitOrder(Order order);
 
+                // Posts every order over one connection, one result per order in the same order. Each POST is paced by the
+                // RateGovernor of the host like Get, so orders and polling share one budget. Orders with a clientOrderId
+                // are retried with backoff on transport errors and 429s.
+                std::vector<Result> SubmitOrders(std::span<const Order> orders);
+
+                // One request each, replace the contents of the output
+                Result GetPositions(std::vector<Position>& out_Positions);
+                Result GetOpenOrders(std::vector<OpenOrder>& out_Orders);
+
                 Result GetBalance(float& balance);
                 Result GetPorfolioValue(float& value);
 
                 Result GetName(std::string& name);
+                Result GetDetails(AlpacaAccountDetails& out_Details);
 
             public:
                 bool empty() {
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Alpaca.hpp"
+#include "MarketDataProvider.hpp"
+
+namespace StockyBoy {
+	namespace Scraper {
+		namespace Alpaca {
+			// Alpaca's historical market data REST API (/v2/stocks), with the keys of an account.
+			// Bars are split-adjusted like Yahoo's. The 5d interval has no Alpaca timeframe and fails as INVALID.
+			class DataProvider : public MarketDataProvider {
+			public:
+				static constexpr const char* DATA_URL = "https://data.alpaca.markets";
+
+				// Symbols per latest-trade request, the URL stays well under any length limit
+				static constexpr size_t QUOTE_BATCH_SIZE = 100;
+
+				// Pages of bars followed per request before giving up (10000 bars each)
+				static constexpr uint32_t MAX_PAGES = 64;
+
+			private:
+				std::string Url{};
+				std::string Feed{};
+				std::shared_ptr<curl_slist> Headers{};
+				RetryPolicy Retry{};
+
+			public:
+				// Free "iex" feed by default, "sip" needs a paid plan
+				DataProvider(const Account& account, std::string feed = "iex", std::string url = DATA_URL);
+
+			public:
+				const char* name() const override { return "alpaca"; }
+
+				std::vector<BarResponse> FetchBars(const std::vector<FetchRequest>& requests, size_t maxConcurrent = 16) override;
+				Result FetchQuotes(std::span<const std::string> symbols, std::vector<Quote>& out_Quotes) override;
+
+				using MarketDataProvider::FetchBars;
+
+				// "1Min", "1Hour", "1Day"... false for intervals Alpaca has no timeframe for
+				static bool Timeframe(INTERVAL interval, std::string& out_Timeframe);
+			};
+		}
+	}
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <mutex>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+
+#include "Types.hpp"
+#include "Result.hpp"
+#include "StockData.hpp"
+
+namespace StockyBoy {
+	namespace Scraper {
+		struct Bar {
+			int64_t epoch{}; // start of the bar, Unix seconds
+			double open{};
+			double high{};
+			double low{};
+			double close{};
+			double volume{};
+		};
+
+		// The last `capacity` bars of one interval, the oldest is overwritten once full. Never allocates after construction.
+		class BarRing {
+		private:
+			std::vector<Bar> Bars;
+			size_t Head = 0; // oldest bar
+			size_t Count = 0;
+			int64_t Seconds;
+
+			Bar& At(size_t i) { return Bars[(Head + i) % Bars.size()]; }
+
+		public:
+			BarRing(size_t capacity, int64_t seconds);
+
+			// False for a tick that falls before the oldest bar kept, or in a minute with no bar between two kept ones
+			bool Add(int64_t epoch, double price, double size);
+
+			size_t size() const { return Count; }
+			size_t capacity() const { return Bars.size(); }
+			int64_t seconds() const { return Seconds; }
+
+			// 0 is the oldest bar
+			const Bar& operator[](size_t i) const { return Bars[(Head + i) % Bars.size()]; }
+			const Bar& back() const { return (*this)[Count - 1]; }
+		};
+
+		// Aggregates trade ticks into 1m and 5m bars for every tracked symbol. Track allocates a symbol's rings once;
+		// after that a tick is a hash lookup and an in-place update under the lock. Ticks for other symbols are ignored.
+		class BarBuilder {
+		public:
+			static constexpr std::array<INTERVAL, 2> INTERVALS = { MINUTES_1, MINUTES_5 };
+
+			// Five sessions of 1m bars
+			static constexpr size_t DEFAULT_CAPACITY = 5 * 390;
+
+		private:
+			// Lets the tick path look up a string_view without building a std::string
+			struct SymbolHash {
+				using is_transparent = void;
+				size_t operator()(std::string_view symbol) const { return std::hash<std::string_view>{}(symbol); }
+			};
+
+			struct Series {
+				std::array<BarRing, INTERVALS.size()> rings;
+			};
+
+			size_t Capacity;
+
+			mutable std::mutex Mutex;
+			std::unordered_map<std::string, std::unique_ptr<Series>, SymbolHash, std::equal_to<>> Symbols;
+
+			std::atomic<uint64_t> Version{ 0 };
+
+			static int IntervalSlot(INTERVAL interval);
+
+		public:
+			explicit BarBuilder(size_t capacity = DEFAULT_CAPACITY);
+
+			void Track(const std::string& symbol);
+			bool Tracks(std::string_view symbol) const;
+			std::vector<std::string> symbols() const;
+
+			// `size` is the traded quantity, 0 for quotes (they move the price but add no volume)
+			bool OnTick(std::string_view symbol, int64_t epochMs, double price, double size);
+
+			// Copies one interval's bars into `out`, oldest first, and indexes its time axis
+			Result Snapshot(std::string_view symbol, INTERVAL interval, StockTable& out) const;
+
+			// Newest bar of one interval, false when there is none yet
+			bool Latest(std::string_view symbol, INTERVAL interval, Bar& out_Bar) const;
+
+			// Bumped by every accepted tick, so readers can skip a Snapshot when nothing changed
+			uint64_t version() const { return Version.load(std::memory_order_acquire); }
+		};
+	}
+}
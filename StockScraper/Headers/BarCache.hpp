@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Types.hpp"
+#include "Result.hpp"
+#include "StockData.hpp"
+#include "BatchFetch.hpp"
+#include "MarketDataProvider.hpp"
+#include "MappedFile.hpp"
+
+#include <string>
+#include <filesystem>
+
+namespace StockyBoy {
+	namespace Scraper {
+		// Bar file opened in place: the view points straight into the mapping, nothing is copied onto the heap.
+		// Keep it short-lived, a mapped file can't be replaced by BarCache::Store on Windows.
+		class MappedBars {
+		private:
+			MappedFile File{};
+			StockTableView Bars{};
+
+		public:
+			const StockTableView& view() const { return Bars; }
+
+		private:
+			friend class BarCache;
+		};
+
+		// Local OHLCV store, one memory-mappable file of fixed-width columns per (label, interval).
+		// Refreshing only downloads the bars after the last cached one, so warm scans are mostly disk reads.
+		// Bars come from YahooProvider::Default() unless another provider is given. Each provider gets its own
+		// subdirectory named after it: bars from different sources (daily bar stamps, adjustments) are never merged.
+		class BarCache {
+		private:
+			std::filesystem::path Directory{};
+			MarketDataProvider* Provider = nullptr;
+
+		public:
+			BarCache() = default;
+			explicit BarCache(const std::filesystem::path& directory);
+			// `provider` must outlive the cache
+			BarCache(const std::filesystem::path& directory, MarketDataProvider& provider);
+
+		public:
+			MarketDataProvider& provider() const { return Provider ? *Provider : YahooProvider::Default(); }
+
+			// Directory / provider().name()
+			std::filesystem::path directory() const;
+			std::filesystem::path PathFor(const std::string& label, INTERVAL interval) const;
+
+			Result Map(const std::string& label, INTERVAL interval, MappedBars& out_Bars) const;
+			Result Load(const std::string& label, INTERVAL interval, StockTable& out_Table) const;
+			Result Store(const std::string& label, INTERVAL interval, const StockTable& table) const;
+
+			// Request that brings `cached` up to date: the whole coldRange when nothing is cached,
+			// otherwise only the bars from the last cached one (which may still have been forming) up to now
+			FetchRequest RefreshRequest(const std::string& label, INTERVAL interval, RANGE coldRange, const StockTable& cached) const;
+
+			// Parses a response to RefreshRequest, merges it into `cached` and stores the result
+			Result Update(const std::string& label, INTERVAL interval, StockTable& cached, const std::string& freshData) const;
+			// Same, with the bars already parsed
+			Result Update(const std::string& label, INTERVAL interval, StockTable& cached, const StockTable& fresh) const;
+
+			// Load, fetch what is missing, merge and store back. When the fetch fails, out_Table still gets the cached bars
+			// (empty on a cold cache) but the fetch's failure is returned: those bars may be days old.
+			Result Refresh(const std::string& label, INTERVAL interval, RANGE coldRange, StockTable& out_Table) const;
+
+			// Appends `fresh` to `cached`, replacing cached bars that overlap the first fresh one
+			static void Merge(StockTable& cached, const StockTable& fresh, INTERVAL interval);
+		};
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Types.hpp"
+#include "Fetch.hpp"
+#include "Result.hpp"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+struct curl_slist;
+
+namespace StockyBoy {
+    namespace Scraper {
+        struct FetchRequest {
+            std::string label;
+            INTERVAL interval = DAYS_1;
+            RANGE range = RANGE_1Y;
+
+            // When period2 is set, the bars between these Unix epochs (seconds) are requested instead of range
+            int64_t period1 = 0;
+            int64_t period2 = 0;
+        };
+
+        struct FetchResponse {
+            Result result;
+            std::string data;
+        };
+
+        // Fetches every request concurrently on a single curl multi handle.
+        // At most maxConcurrent transfers are in flight at once, and responses[i] always answers requests[i].
+        // New transfers start as fast as each host's RateGovernor allows; transient failures are queued again per `retry`
+        // while the rest of the batch keeps going.
+        std::vector<FetchResponse> FetchBatch(const std::vector<FetchRequest>& requests, size_t maxConcurrent = 16, const RetryPolicy& retry = {});
+
+        // Same engine for prebuilt URLs (an empty one fails as INVALID), responses[i] answers urls[i].
+        // `headers` go out with every request and must outlive the call.
+        std::vector<FetchResponse> FetchUrls(const std::vector<std::string>& urls, size_t maxConcurrent = 16, const RetryPolicy& retry = {}, curl_slist* headers = nullptr);
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+// Internal to StockScraper: exposes curl types, so only include it from the module's sources.
+#include <curl/curl.h>
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace StockyBoy {
+    namespace Scraper {
+        // Process-wide pool of curl easy handles, kept per host so their connections stay warm.
+        // Every handle shares one DNS, TLS-session and connection cache, and the pool is safe to use from any thread.
+        class ConnectionPool {
+        public:
+            // Leased handle, goes back to the pool when destroyed
+            class Handle {
+            public:
+                Handle() = default;
+                Handle(Handle&& other) noexcept;
+                Handle& operator=(Handle&& other) noexcept;
+                ~Handle();
+
+                Handle(const Handle&) = delete;
+                Handle& operator=(const Handle&) = delete;
+
+            public:
+                CURL* get() const { return curl; }
+                explicit operator bool() const { return curl != nullptr; }
+
+            private:
+                friend class ConnectionPool;
+                Handle(ConnectionPool* pool, std::string host, CURL* curl);
+
+                void Release();
+
+            private:
+                ConnectionPool* pool = nullptr;
+                std::string host{};
+                CURL* curl = nullptr;
+            };
+
+        public:
+            static ConnectionPool& Get();
+
+            // Returns an empty handle if curl could not allocate one
+            Handle Acquire(const std::string& host);
+
+            // Applies the pool defaults (shared caches, keep-alive, HTTP/2), call again after curl_easy_reset
+            void Configure(CURL* curl);
+
+            // "https://host:port/path" -> "https://host:port"
+            static std::string HostOf(const std::string& url);
+
+        private:
+            ConnectionPool();
+            ~ConnectionPool();
+
+            void Release(const std::string& host, CURL* curl);
+
+            static void LockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* userp);
+            static void UnlockShare(CURL* handle, curl_lock_data data, void* userp);
+
+        private:
+            static constexpr size_t MAX_IDLE_PER_HOST = 32;
+
+            CURLSH* share = nullptr;
+            std::array<std::mutex, CURL_LOCK_DATA_LAST> shareLocks;
+
+            std::mutex poolMutex;
+            std::unordered_map<std::string, std::vector<CURL*>> idle;
+        };
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Result.hpp"
+
+#include <mutex>
+#include <string>
+#include <cstdint>
+#include <filesystem>
+#include <unordered_map>
+
+namespace StockyBoy {
+	namespace Scraper {
+		// Symbols whose last fetches failed for reasons a quick retry won't fix (404, no bars), and when to try them again.
+		// Each failure in a row doubles the wait, up to a cap per error class; one success forgets the symbol.
+		// Connection trouble, throttling, server errors, other HTTP errors and malformed answers can hit every symbol at once
+		// and are never cached.
+		class FailureCache {
+		public:
+			struct Entry {
+				ErrorKind kind = ErrorKind::NONE;
+				uint32_t failures = 0; // in a row
+				int64_t retryAt = 0;   // Unix seconds
+			};
+
+		private:
+			std::filesystem::path Path{};
+
+			mutable std::mutex mutex;
+			std::unordered_map<std::string, Entry> Entries;
+			bool dirty = false;
+
+		public:
+			FailureCache() = default;
+			explicit FailureCache(const std::filesystem::path& path);
+
+		public:
+			// A missing file is an empty cache
+			Result Load();
+			// Only writes when something changed since the last Load/Save
+			Result Save();
+
+			// True while `label` is backing off, skip the request
+			bool Blocked(const std::string& label, int64_t now) const;
+
+			void RecordFailure(const std::string& label, ErrorKind kind, int64_t now);
+			void RecordSuccess(const std::string& label);
+
+			bool Find(const std::string& label, Entry& out_Entry) const;
+			size_t size() const;
+
+			// Seconds to wait after `failures` failures in a row of `kind`, 0 for kinds that aren't cached
+			static int64_t Backoff(ErrorKind kind, uint32_t failures);
+			static bool IsSymbolError(ErrorKind kind) { return Backoff(kind, 1) > 0; }
+		};
+	}
+}
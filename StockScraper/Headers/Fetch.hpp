@@ -3,10 +3,72 @@
 #include "Types.hpp"
 #include "Result.hpp"
 
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cstdint>
+
 namespace StockyBoy {
     namespace Scraper {
         size_t WriteCallback(void* contents, size_t size, size_t nmemb, void* userp);
 
-        Result Fetch(const std::string& label, INTERVAL interval, RANGE range, std::string& out_Data);
+        // Collects one response body. Once the headers are in, the whole body is reserved from Content-Length,
+        // with room for decompression when it comes encoded, so it lands in one allocation.
+        struct ResponseSink {
+            std::string* out = nullptr;
+            int64_t contentLength = -1;
+            bool encoded = false;
+            bool sized = false;
+        };
+
+        // CURLOPT_WRITEFUNCTION / CURLOPT_HEADERFUNCTION, both with a ResponseSink* as their data
+        size_t SinkWriteCallback(void* contents, size_t size, size_t nmemb, void* userp);
+        size_t SinkHeaderCallback(char* buffer, size_t size, size_t nitems, void* userp);
+
+        // Per-thread pool of response buffers. Strings keep their capacity between responses,
+        // so a warm scan downloads into memory that is already allocated.
+        class ResponseArena {
+        private:
+            static constexpr size_t MAX_BUFFERS = 64;
+            static constexpr size_t MAX_KEPT_CAPACITY = 8 << 20; // bigger ones are freed rather than kept around
+
+            std::vector<std::string> Free;
+
+        public:
+            static ResponseArena& ForThread();
+
+            // Empty, with whatever capacity it had
+            std::string Acquire();
+            void Recycle(std::string&& buffer);
+        };
+
+        // Error class of a non-200 HTTP status
+        ErrorKind HttpErrorKind(long httpCode);
+
+        // Transient failures (connection trouble, 429, 5xx) are retried with jittered exponential backoff
+        struct RetryPolicy {
+            uint32_t maxAttempts = 4; // including the first
+            std::chrono::milliseconds baseDelay{ 500 };
+            std::chrono::milliseconds maxDelay{ 15000 };
+        };
+
+        bool IsRetryable(ErrorKind kind);
+
+        // Full jitter: uniform in [0, min(maxDelay, baseDelay * 2^attempt)], but never before the server's Retry-After.
+        // Never more than maxDelay: a longer Retry-After isn't waited out, see RetryAfterTooLong.
+        std::chrono::milliseconds RetryDelay(const RetryPolicy& policy, uint32_t attempt, std::chrono::milliseconds retryAfter = {});
+
+        // The server asked for a longer pause than the policy allows. The request fails as THROTTLED right away
+        // instead of holding a thread or a batch slot for it.
+        bool RetryAfterTooLong(const RetryPolicy& policy, std::chrono::milliseconds retryAfter);
+
+        // Validates the interval/range combo and builds the Yahoo chart URL for a label
+        Result GetChartURL(const std::string& label, INTERVAL interval, RANGE range, std::string& out_URL);
+        // Same, for the bars between two Unix epochs (seconds) instead of a preset range
+        Result GetChartURL(const std::string& label, INTERVAL interval, int64_t period1, int64_t period2, std::string& out_URL);
+
+        // Paced by the RateGovernor of the host, transient failures are retried per `retry`
+        Result Fetch(const std::string& label, INTERVAL interval, RANGE range, std::string& out_Data, const RetryPolicy& retry = {});
+        Result Fetch(const std::string& label, INTERVAL interval, int64_t period1, int64_t period2, std::string& out_Data, const RetryPolicy& retry = {});
     }
 }
\ No newline at end of file
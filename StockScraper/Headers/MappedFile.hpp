@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Result.hpp"
+
+#include <cstddef>
+#include <filesystem>
+
+namespace StockyBoy {
+	namespace Scraper {
+		// Read-only memory mapping of a whole file, unmapped on destruction
+		class MappedFile {
+		private:
+			const std::byte* Data = nullptr;
+			size_t Size = 0;
+
+#ifdef _WIN32
+			void* FileHandle = nullptr;
+			void* MappingHandle = nullptr;
+#else
+			int FileDescriptor = -1;
+#endif
+
+		public:
+			MappedFile() = default;
+			MappedFile(MappedFile&& other) noexcept;
+			MappedFile& operator=(MappedFile&& other) noexcept;
+			~MappedFile();
+
+			MappedFile(const MappedFile&) = delete;
+			MappedFile& operator=(const MappedFile&) = delete;
+
+		public:
+			Result Open(const std::filesystem::path& path);
+			void Close();
+
+			const std::byte* data() const { return Data; }
+			size_t size() const { return Size; }
+			bool empty() const { return Size == 0; }
+		};
+
+		// Moves a fully written `tempPath` over `path`, so readers see the old file or the new one, never half of one.
+		// Falls back to remove + rename where the rename can't replace (Windows); the old file must not be mapped then.
+		bool SwapInTempFile(const std::filesystem::path& tempPath, const std::filesystem::path& path);
+	}
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Types.hpp"
+#include "Fetch.hpp"
+#include "Quotes.hpp"
+#include "Result.hpp"
+#include "StockData.hpp"
+#include "BatchFetch.hpp"
+
+#include <span>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+namespace StockyBoy {
+	namespace Scraper {
+		struct BarResponse {
+			Result result;
+			StockTable table;
+		};
+
+		// Where bars and last prices come from. Providers answer with parsed tables, so callers never see a wire format
+		// and one source can be swapped for another (Yahoo, Alpaca, recordings on disk) per request type.
+		class MarketDataProvider {
+		public:
+			virtual ~MarketDataProvider() = default;
+
+			// Short name for logs
+			virtual const char* name() const = 0;
+
+			// responses[i] answers requests[i], with at most maxConcurrent requests in flight
+			virtual std::vector<BarResponse> FetchBars(const std::vector<FetchRequest>& requests, size_t maxConcurrent = 16) = 0;
+
+			// Last price of every symbol, symbols without one are left out
+			virtual Result FetchQuotes(std::span<const std::string> symbols, std::vector<Quote>& out_Quotes) = 0;
+
+			// One request on its own
+			Result FetchBars(const FetchRequest& request, StockTable& out_Table);
+		};
+
+		// --- Yahoo ---
+
+		// The v8 chart endpoint for bars (FetchBatch) and the spark endpoint for quotes (FetchQuotes)
+		class YahooProvider : public MarketDataProvider {
+		private:
+			RetryPolicy Retry{};
+
+		public:
+			YahooProvider() = default;
+			explicit YahooProvider(const RetryPolicy& retry) : Retry(retry) {}
+
+			// Shared instance, what a BarCache uses unless told otherwise
+			static YahooProvider& Default();
+
+		public:
+			const char* name() const override { return "yahoo"; }
+
+			std::vector<BarResponse> FetchBars(const std::vector<FetchRequest>& requests, size_t maxConcurrent = 16) override;
+			Result FetchQuotes(std::span<const std::string> symbols, std::vector<Quote>& out_Quotes) override;
+
+			using MarketDataProvider::FetchBars;
+		};
+
+		// --- Recordings ---
+
+		// Serves bars recorded on disk, one Yahoo chart JSON per (label, interval), so a raw Yahoo response is a valid
+		// recording too. No network: runs are deterministic and work offline.
+		// A request for a period gets the recorded bars inside it; one for a range gets that much history back from the
+		// last recorded bar. Quotes are the last positive recorded close at the finest interval on disk, symbols without one are left out.
+		class ReplayProvider : public MarketDataProvider {
+		private:
+			std::filesystem::path Directory{};
+
+		public:
+			explicit ReplayProvider(const std::filesystem::path& directory);
+
+		public:
+			const char* name() const override { return "replay"; }
+
+			std::vector<BarResponse> FetchBars(const std::vector<FetchRequest>& requests, size_t maxConcurrent = 16) override;
+			Result FetchQuotes(std::span<const std::string> symbols, std::vector<Quote>& out_Quotes) override;
+
+			using MarketDataProvider::FetchBars;
+
+			static std::filesystem::path PathFor(const std::filesystem::path& directory, const std::string& label, INTERVAL interval);
+
+			// Merges `table` into the recording of (label, interval), creating it if needed
+			static Result Record(const std::filesystem::path& directory, const std::string& label, INTERVAL interval, const StockTable& table);
+
+			// Yahoo chart JSON for a table, the format recordings are kept in
+			static std::string ToChartJson(const StockTable& table);
+		};
+
+		// Passes everything through to `source` and records every bar answer for a ReplayProvider on the same directory.
+		// A recording that can't be written doesn't fail the fetch (the bars are fine), it is kept for recordResult().
+		class RecordingProvider : public MarketDataProvider {
+		private:
+			MarketDataProvider& Source;
+			std::filesystem::path Directory{};
+
+			mutable std::mutex mutex;
+			Result FirstFailure = Result::Ok();
+			size_t Failures = 0;
+
+		public:
+			RecordingProvider(MarketDataProvider& source, const std::filesystem::path& directory);
+
+		public:
+			const char* name() const override { return Source.name(); }
+
+			// Ok while every answer so far was recorded, otherwise the first failure and how many recordings were lost
+			Result recordResult() const;
+
+			std::vector<BarResponse> FetchBars(const std::vector<FetchRequest>& requests, size_t maxConcurrent = 16) override;
+			Result FetchQuotes(std::span<const std::string> symbols, std::vector<Quote>& out_Quotes) override;
+
+			using MarketDataProvider::FetchBars;
+		};
+	}
+}
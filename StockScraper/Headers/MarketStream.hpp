@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Alpaca.hpp"
+#include "BarBuilder.hpp"
+#include "StreamClient.hpp"
+
+namespace StockyBoy {
+	namespace Scraper {
+		namespace Alpaca {
+			// Alpaca's real-time market data WebSocket, feeding trades (and optionally quote midpoints) into a BarBuilder.
+			// Symbols can be added while it runs; they are tracked in the builder and subscribed on the live connection.
+			class MarketStream : public StreamClient {
+			public:
+				// Free IEX feed; "sip" needs a paid plan, "test" streams the FAKEPACA symbol around the clock
+				static constexpr const char* IEX_URL = "wss://stream.data.alpaca.markets/v2/iex";
+
+			private:
+				std::string Key{};
+				std::string Secret{};
+				bool Quotes;
+
+				BarBuilder& Bars;
+
+				std::vector<std::string> Wanted;    // guarded by mutex
+				bool wantedChanged = false;
+
+			protected:
+				Result Session(bool& out_Retry) override;
+
+			public:
+				MarketStream(const Account& account, BarBuilder& bars, std::string url = IEX_URL, bool quotes = false);
+				~MarketStream() override;
+
+				// Adds symbols; already subscribed ones are skipped
+				void Subscribe(const std::vector<std::string>& symbols);
+			};
+		}
+	}
+}
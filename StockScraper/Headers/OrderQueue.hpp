@@ -0,0 +1,60 @@
+#pragma once
+
+#include <deque>
+#include <mutex>
+#include <future>
+#include <thread>
+#include <vector>
+#include <functional>
+#include <condition_variable>
+
+#include "Alpaca.hpp"
+
+namespace StockyBoy {
+	namespace Scraper {
+		namespace Alpaca {
+			// Submits orders on a few worker threads, each taking its share of what is waiting as one Account::SubmitOrders
+			// batch over a single connection. Pacing is the Account's: every request to its endpoint, orders and
+			// account/position polling alike, goes through the RateGovernor of that host and stays under REQUESTS_PER_MINUTE.
+			// Workers lease their handles from the ConnectionPool, so in-flight requests reuse warm connections.
+			// Destroying the queue waits for every order already submitted.
+			class OrderQueue {
+			public:
+				using OnResult = std::function<void(const Order& order, const Result& result)>;
+
+				static constexpr size_t DEFAULT_IN_FLIGHT = 4;
+
+			private:
+				struct Pending {
+					Order order;
+					std::promise<Result> promise;
+					OnResult onResult;
+				};
+
+				Account& account;
+
+				std::mutex mutex;
+				std::condition_variable wake;
+				std::deque<Pending> pending;
+				bool stopping = false;
+
+				std::vector<std::thread> workers;
+
+				void Work();
+
+			public:
+				explicit OrderQueue(Account& account, size_t maxInFlight = DEFAULT_IN_FLIGHT);
+				~OrderQueue();
+
+				OrderQueue(const OrderQueue&) = delete;
+				OrderQueue& operator=(const OrderQueue&) = delete;
+
+				// Returns at once, the future (and `onResult`, called on a worker thread) gets the outcome
+				std::future<Result> Submit(Order order, OnResult onResult = {});
+
+				// Submits every order and blocks until all are done, results in the same order
+				std::vector<Result> SubmitAll(const std::vector<Order>& orders);
+			};
+		}
+	}
+}
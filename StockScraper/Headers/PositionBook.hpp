@@ -0,0 +1,47 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "Alpaca.hpp"
+
+namespace StockyBoy {
+	namespace Scraper {
+		namespace Alpaca {
+			// The broker's positions by symbol, plus its open orders. Sync* replace one side with a single request,
+			// the Apply* calls keep the book current in between as orders are placed, filled or cancelled.
+			class PositionBook {
+			private:
+				std::unordered_map<std::string, Position> Positions;
+				std::vector<OpenOrder> Orders;
+
+			public:
+				Result SyncPositions(Account& account);
+				Result SyncOpenOrders(Account& account);
+
+				void SetPositions(std::vector<Position> positions);
+				void SetOpenOrders(std::vector<OpenOrder> orders);
+
+				// A fill moves the average entry price on buys, a sell that closes the quantity removes the symbol
+				void ApplyFill(const std::string& symbol, Action action, float qty, float price);
+
+				void Upsert(Position position);
+				void Erase(const std::string& symbol);
+
+				void AddOpenOrder(OpenOrder order);
+				void RemoveOpenOrder(const std::string& id);
+
+				const Position* Find(const std::string& symbol) const;
+				bool Holds(const std::string& symbol) const { return Positions.contains(symbol); }
+				bool HasOpenOrder(const std::string& symbol, Action action) const;
+
+				size_t size() const { return Positions.size(); }
+				bool empty() const { return Positions.empty(); }
+
+				const std::unordered_map<std::string, Position>& positions() const { return Positions; }
+				const std::vector<OpenOrder>& openOrders() const { return Orders; }
+			};
+		}
+	}
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Fetch.hpp"
+#include "Result.hpp"
+
+#include <span>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace StockyBoy {
+	namespace Scraper {
+		struct Quote {
+			std::string symbol;
+			double price = 0.0;
+			int64_t time = 0; // Unix seconds of the trade/bar the price comes from, 0 if Yahoo didn't say
+		};
+
+		// Yahoo's spark endpoint answers at most this many symbols per request
+		inline constexpr size_t QUOTE_BATCH_SIZE = 20;
+
+		// Builds the spark URL for up to QUOTE_BATCH_SIZE symbols
+		Result GetQuoteURL(std::span<const std::string> symbols, std::string& out_URL);
+
+		// Parses one spark response, appending a Quote per symbol that has a price. Understands both the
+		// {"spark":{"result":[...]}} layout and the newer one keyed by symbol.
+		Result ParseQuotes(const std::string& data, std::vector<Quote>& out_Quotes);
+
+		// Last price of every symbol, QUOTE_BATCH_SIZE symbols per request, all requests in one FetchUrls batch.
+		// Symbols Yahoo has no price for are left out; fails only when no batch came back at all.
+		Result FetchQuotes(std::span<const std::string> symbols, std::vector<Quote>& out_Quotes, const RetryPolicy& retry = {});
+	}
+}
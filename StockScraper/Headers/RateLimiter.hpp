@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Result.hpp"
+
+#include <mutex>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+namespace StockyBoy {
+	namespace Scraper {
+		// Token bucket: holds up to `burst` tokens and refills at `perSecond`. One request spends one token,
+		// so over any window of T seconds at most burst + perSecond * T requests go out.
+		class TokenBucket {
+		public:
+			using Clock = std::chrono::steady_clock;
+
+		private:
+			std::mutex Mutex;
+			double Burst;
+			double PerSecond;
+			double Tokens;
+			Clock::time_point Last;
+
+			void RefillLocked(Clock::time_point now);
+
+		public:
+			TokenBucket(double burst, double perSecond);
+
+			// Blocks until a token is available and takes it
+			void Acquire();
+			bool TryAcquire();
+
+			// Time until the next token, zero if one is available now
+			Clock::duration Wait();
+
+			// Changes the refill rate from now on, tokens already in the bucket stay
+			void SetRate(double perSecond);
+			double rate();
+		};
+
+		// What a host has seen, over the process lifetime and over the last minute
+		struct HostStats {
+			std::string host;
+			uint64_t requests = 0;
+			uint64_t failures = 0;
+			uint64_t retries = 0;
+			uint64_t throttled = 0;    // 429s
+			double allowedRate = 0.0;  // requests per second the governor lets through right now
+			double requestRate = 0.0;  // requests per second, last minute
+			double errorRate = 0.0;    // share of the last minute's requests that failed
+		};
+
+		// Request pacing shared by every fetch in the process, one token bucket per host. The rate adapts:
+		// each 429 halves it and pauses the host for its Retry-After, each success raises it a little, up to the ceiling.
+		class RateGovernor {
+		public:
+			using Clock = std::chrono::steady_clock;
+
+			struct Limits {
+				double burst = 16.0;
+				double initialRate = 20.0;   // requests per second
+				double minRate = 0.5;
+				double maxRate = 50.0;
+				double increase = 0.1;       // added to the rate per success
+				double decrease = 0.5;       // the rate is multiplied by this on a 429
+			};
+
+		private:
+			static constexpr size_t WINDOW_SECONDS = 60;
+
+			struct Second {
+				int64_t stamp = -1;
+				uint32_t requests = 0;
+				uint32_t failures = 0;
+			};
+
+			struct Host {
+				explicit Host(const Limits& limits);
+
+				Limits limits;
+				TokenBucket bucket;
+				double rate;
+				Clock::time_point pausedUntil{};
+
+				uint64_t requests = 0, failures = 0, retries = 0, throttled = 0;
+				std::array<Second, WINDOW_SECONDS> window{};
+			};
+
+			mutable std::mutex mutex;
+			std::unordered_map<std::string, std::unique_ptr<Host>> Hosts;
+			std::unordered_map<std::string, Limits> HostLimits;
+			Limits DefaultLimits{};
+
+			Host& HostLocked(const std::string& host);
+			static Second& SecondLocked(Host& state, Clock::time_point now);
+			static HostStats StatsLocked(const std::string& name, const Host& state, Clock::time_point now);
+
+		public:
+			static RateGovernor& Get();
+
+			// For hosts seen after this call
+			void SetLimits(const std::string& host, const Limits& limits);
+
+			// Blocks until `host` may take another request
+			void Acquire(const std::string& host);
+			// Non-blocking: false while the host is paused or out of tokens, with the time to wait
+			bool TryAcquire(const std::string& host, Clock::duration& out_Wait);
+
+			// Call once per finished attempt. `retryAfter` is the server's Retry-After, zero when it sent none.
+			void OnResult(const std::string& host, const Result& result, Clock::duration retryAfter = Clock::duration::zero());
+			void OnRetry(const std::string& host);
+
+			std::vector<HostStats> Stats() const;
+		};
+	}
+}
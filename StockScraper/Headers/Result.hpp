@@ -4,12 +4,26 @@
 
 namespace StockyBoy {
 	namespace Scraper {
+        // Why a call failed, so callers can tell a dead symbol from a bad connection
+        enum class ErrorKind {
+            NONE,
+            OTHER,
+            NETWORK,    // couldn't connect, timed out, connection dropped
+            THROTTLED,  // HTTP 429
+            SERVER,     // HTTP 5xx
+            NOT_FOUND,  // HTTP 404, Yahoo's answer for unknown and delisted symbols
+            HTTP,       // any other unexpected HTTP status
+            NO_DATA,    // the response came back without bars
+            INVALID,    // malformed request or response
+        };
+
         struct Result {
             bool succeeded = false;
             std::string error{};
+            ErrorKind kind = ErrorKind::NONE;
 
-            static Result Ok() { return { true, {} }; }
-            static Result Fail(const std::string& msg) { return { false, msg }; }
+            static Result Ok() { return { true, {}, ErrorKind::NONE }; }
+            static Result Fail(const std::string& msg, ErrorKind kind = ErrorKind::OTHER) { return { false, msg, kind }; }
         };
 	}
-}
\ No newline at end of file
+}
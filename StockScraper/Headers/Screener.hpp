@@ -0,0 +1,77 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+#include "StockData.hpp"
+
+namespace StockyBoy {
+	namespace Scraper {
+		// Latest `depth` closes of N symbols in one contiguous block, right-aligned on each symbol's last bar.
+		// Stored bar-major (row k holds every symbol's close from k bars ago) so a cross-sectional
+		// comparison between two bars is a single pass over two contiguous rows.
+		// Symbols with less history than `depth` are padded with NaN, and so is every close that is not a positive price (a null bar).
+		class CloseMatrix {
+		private:
+			std::vector<std::string> Labels;
+			std::vector<double> Values;
+			uint32_t Depth = 0;
+
+		public:
+			CloseMatrix() = default;
+			CloseMatrix(size_t symbols, uint32_t depth);
+			CloseMatrix(std::vector<std::string> labels, uint32_t depth);
+
+			void Set(size_t symbol, const std::string& label, std::span<const double> close);
+			void Set(size_t symbol, const std::string& label, const StockTable& table) { Set(symbol, label, table.close); }
+
+			// Overwrites a whole row with one close per symbol, e.g. a day of an already date-aligned history
+			void SetRow(uint32_t barsAgo, std::span<const double> closes);
+
+			// Every symbol's close `barsAgo` bars before its latest one
+			std::span<const double> row(uint32_t barsAgo) const;
+			std::span<const double> latest() const { return row(0); }
+
+			const std::string& label(size_t symbol) const { return Labels[symbol]; }
+			size_t symbols() const { return Labels.size(); }
+			uint32_t depth() const { return Depth; }
+		};
+
+		struct ScreenHit {
+			size_t symbol;
+			double value; // value of the first rule's metric
+		};
+
+		// Runs every rule's metric over the whole matrix, keeps the symbols that pass all of them (in matrix order)
+		class Screener {
+		public:
+			// Fills one value per symbol, NaN where the symbol lacks the history
+			using Metric = std::function<void(const CloseMatrix& matrix, std::span<double> out)>;
+			using Predicate = std::function<bool(double value)>;
+
+		private:
+			struct Rule {
+				Metric metric;
+				Predicate predicate;
+			};
+
+			std::vector<Rule> Rules;
+
+		public:
+			Screener& Where(Metric metric, Predicate predicate);
+
+			std::vector<ScreenHit> Run(const CloseMatrix& matrix) const;
+
+			// --- Metrics ---
+			static Metric PercentChange(uint32_t window);
+			static Metric LogReturn(uint32_t window);
+
+			// --- Predicates (false for NaN) ---
+			static Predicate AtMost(double threshold);
+			static Predicate AtLeast(double threshold);
+		};
+	}
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cstddef>
+#include <utility>
+
+namespace StockyBoy {
+	namespace Scraper {
+		// Bounded lock-free ring for exactly one producer thread and one consumer thread.
+		// Capacity is rounded up to a power of two; TryPush fails instead of blocking when it is full.
+		template <typename T>
+		class SpscQueue {
+		private:
+			// Head and tail on separate cache lines, so producer and consumer don't invalidate each other
+			static constexpr size_t CACHE_LINE = 64;
+
+			std::unique_ptr<T[]> Slots;
+			size_t Mask;
+
+			alignas(CACHE_LINE) std::atomic<size_t> Head{ 0 }; // next slot to read, owned by the consumer
+			alignas(CACHE_LINE) std::atomic<size_t> Tail{ 0 }; // next slot to write, owned by the producer
+
+			static size_t RoundUp(size_t capacity) {
+				size_t size = 2;
+				while (size < capacity) size <<= 1;
+				return size;
+			}
+
+		public:
+			explicit SpscQueue(size_t capacity)
+				: Slots(std::make_unique<T[]>(RoundUp(capacity))), Mask(RoundUp(capacity) - 1) {}
+
+			SpscQueue(const SpscQueue&) = delete;
+			SpscQueue& operator=(const SpscQueue&) = delete;
+
+			// Producer only. On failure `value` is left untouched, so the caller can retry with it.
+			template <typename U>
+			bool TryPush(U&& value) {
+				const size_t tail = Tail.load(std::memory_order_relaxed);
+				if (tail - Head.load(std::memory_order_acquire) > Mask) {
+					return false;
+				}
+
+				Slots[tail & Mask] = std::forward<U>(value);
+				Tail.store(tail + 1, std::memory_order_release);
+				return true;
+			}
+
+			// Consumer only
+			bool TryPop(T& out_Value) {
+				const size_t head = Head.load(std::memory_order_relaxed);
+				if (head == Tail.load(std::memory_order_acquire)) {
+					return false;
+				}
+
+				out_Value = std::move(Slots[head & Mask]);
+				Head.store(head + 1, std::memory_order_release);
+				return true;
+			}
+
+			// Approximate from any thread other than the two ends
+			size_t size() const {
+				return Tail.load(std::memory_order_acquire) - Head.load(std::memory_order_acquire);
+			}
+
+			bool empty() const { return size() == 0; }
+			size_t capacity() const { return Mask + 1; }
+		};
+	}
+}
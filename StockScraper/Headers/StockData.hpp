@@ -1,15 +1,20 @@
 #pragma once
 
+#include <span>
 #include <string>
 #include <vector>
+#include <cstdint>
+#include <iterator>
+#include <unordered_map>
 
 #include "Result.hpp"
 
 namespace StockyBoy {
 	namespace Scraper {
+		// One bar, assembled on demand from the StockTable columns
 		struct StockRow
 		{
-			std::string date = "";
+			int64_t epoch = 0;
 			double open = 0.0;
 			double high = 0.0;
 			double low = 0.0;
@@ -17,21 +22,102 @@ namespace StockyBoy {
 			double volume = 0.0;
 		};
 
+		// Bars stored column by column, one entry per bar in every column
 		struct StockTable {
-			std::vector<StockRow> data;
+			// Unix epoch (seconds, UTC) of each bar, as reported by Yahoo
+			std::vector<int64_t> epochs;
 
-			// -- Flattenned data
-
-			std::vector<std::string> date;
 			std::vector<double> open;
 			std::vector<double> high;
 			std::vector<double> low;
 			std::vector<double> close;
 			std::vector<double> volume;
 
+			// Plot x coordinate of each bar: its index, so overnight/weekend gaps take no space on the axis
 			std::vector<double> timeStamps;
+
+			// Index of the first bar of each session (a run of bars with no overnight/weekend/holiday gap), starts with 0
+			std::vector<uint32_t> sessionStarts;
+
+			// Smallest spacing between two bars in seconds, i.e. the bar interval (0 with fewer than 2 bars)
+			int64_t barSpacing = 0;
+
+		public:
+			class RowIterator {
+			private:
+				const StockTable* table = nullptr;
+				size_t index = 0;
+
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = StockRow;
+				using difference_type = std::ptrdiff_t;
+				using pointer = void;
+				using reference = StockRow;
+
+				RowIterator() = default;
+				RowIterator(const StockTable* table, size_t index) : table(table), index(index) {}
+
+				StockRow operator*() const { return (*table)[index]; }
+				RowIterator& operator++() { ++index; return *this; }
+				RowIterator operator++(int) { RowIterator old = *this; ++index; return old; }
+				bool operator==(const RowIterator& other) const { return index == other.index; }
+			};
+
+			size_t size() const { return epochs.size(); }
+			bool empty() const { return epochs.empty(); }
+
+			StockRow operator[](size_t i) const {
+				return StockRow{
+					.epoch = epochs[i],
+					.open = open[i],
+					.high = high[i],
+					.low = low[i],
+					.close = close[i],
+					.volume = volume[i]
+				};
+			}
+
+			RowIterator begin() const { return RowIterator(this, 0); }
+			RowIterator end() const { return RowIterator(this, size()); }
+
+			bool intraday() const { return barSpacing > 0 && barSpacing < 24 * 60 * 60; }
 		};
 
+		// Non-owning columns, either over a StockTable or straight over a mapped bar file
+		struct StockTableView {
+			std::span<const int64_t> epochs;
+			std::span<const double> open;
+			std::span<const double> high;
+			std::span<const double> low;
+			std::span<const double> close;
+			std::span<const double> volume;
+
+			size_t size() const { return epochs.size(); }
+			bool empty() const { return epochs.empty(); }
+		};
+
+		StockTableView View(const StockTable& table);
+
 		Result getStockTable(const std::string& data, StockTable& table, bool normalize = false);
+
+		// Rebuilds timeStamps, sessionStarts and barSpacing from the epochs column
+		void IndexTimeAxis(StockTable& table);
+
+		// "%Y-%m-%d" of a Unix epoch, in UTC
+		std::string FormatDate(int64_t epoch);
+
+		// Caches one "%Y-%m-%d" string per calendar day, so labelling bars costs a lookup instead of a conversion
+		class DateLabels {
+		private:
+			std::unordered_map<int64_t, std::string> Days{};
+			std::string Scratch{};
+
+		public:
+			const std::string& Day(int64_t epoch);
+
+			// "%Y-%m-%d", plus " %H:%M" (UTC) when withTime is set. The reference is valid until the next call.
+			const std::string& Format(int64_t epoch, bool withTime);
+		};
 	}
 }
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <condition_variable>
+
+#include "Result.hpp"
+
+namespace StockyBoy {
+	namespace Scraper {
+		// Runs one WebSocket session after another on a background thread, reconnecting with backoff until Stop.
+		// Derived streams implement Session and call SetReady once subscribed; their destructor must call Stop,
+		// so the thread never runs Session on a half-destroyed object.
+		class StreamClient {
+		protected:
+			std::string Url{};
+
+			mutable std::mutex mutex;
+			std::condition_variable wake;
+
+			bool Stopping() const;
+			void SetReady(bool value);
+
+			// One connection, returns once it drops or Stopping(). `out_Retry` is false when reconnecting is pointless.
+			virtual Result Session(bool& out_Retry) = 0;
+
+		private:
+			Result last = Result::Fail("[StockyBoy][Stream] Not started");
+			bool stopping = false;
+			bool ready = false;
+			bool finished = false; // the thread has returned and needs a join before restarting
+
+			std::thread worker;
+
+			void Work();
+
+		public:
+			explicit StreamClient(std::string url) : Url(std::move(url)) {}
+			virtual ~StreamClient();
+
+			StreamClient(const StreamClient&) = delete;
+			StreamClient& operator=(const StreamClient&) = delete;
+
+			// Starts the thread and waits until the session is ready, or fails after `timeout`
+			// (the thread keeps trying in the background unless the server refused the login)
+			Result Start(std::chrono::milliseconds timeout = std::chrono::seconds(10));
+			void Stop();
+
+			bool isReady() const;
+			Result LastResult() const;
+		};
+	}
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <istream>
+#include <ostream>
+#include <cstdint>
+#include <string_view>
+
+#include "Result.hpp"
+#include "BarBuilder.hpp"
+
+namespace StockyBoy {
+	namespace Scraper {
+		// One line of a tick file: "epochMs,symbol,price,size", in time order. Lines starting with '#' are comments.
+		void WriteTick(std::ostream& out, std::string_view symbol, int64_t epochMs, double price, double size);
+
+		// Feeds a tick file into `bars`. With `speed` > 0 the original spacing is kept, divided by `speed`
+		// (60 plays a minute per second); with 0 it goes as fast as it reads. Stops early once `stop` is set.
+		Result ReplayTicks(std::istream& in, BarBuilder& bars, double speed = 0.0, const std::atomic<bool>* stop = nullptr);
+	}
+}
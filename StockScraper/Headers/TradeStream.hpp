@@ -0,0 +1,83 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <ostream>
+#include <unordered_set>
+
+#include "Alpaca.hpp"
+#include "SpscQueue.hpp"
+#include "PositionBook.hpp"
+#include "StreamClient.hpp"
+
+namespace StockyBoy {
+	namespace Scraper {
+		namespace Alpaca {
+			enum class TradeEventType {
+				NEW,
+				FILL,
+				PARTIAL_FILL,
+				CANCELED,
+				EXPIRED,
+				REJECTED,
+				OTHER,
+				COUNT
+			};
+
+			// One trade_updates message. qty and price belong to this execution (fills only),
+			// filledQty and filledAvgPrice are the order's totals so far.
+			struct TradeEvent {
+				TradeEventType type = TradeEventType::OTHER;
+				std::string orderId{};
+				std::string clientOrderId{};
+				std::string symbol{};
+				Action action = Action::BUY;
+				float qty{};
+				float price{};
+				float filledQty{};
+				float filledAvgPrice{};
+				float positionQty{};
+			};
+
+			// After these the order gets no more updates
+			inline bool IsTerminal(TradeEventType type) {
+				return type == TradeEventType::FILL || type == TradeEventType::CANCELED ||
+					type == TradeEventType::EXPIRED || type == TradeEventType::REJECTED;
+			}
+
+			// Alpaca's trade_updates WebSocket on a background thread. Events go into a lock-free queue that one
+			// consumer thread drains with Poll. Drops are reconnected with backoff, a refused login is not retried.
+			class TradeStream : public StreamClient {
+			public:
+				static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+			private:
+				std::string Key{};
+				std::string Secret{};
+
+				SpscQueue<TradeEvent> Events;
+
+				bool Push(TradeEvent event);
+
+			protected:
+				Result Session(bool& out_Retry) override;
+
+			public:
+				// https://paper-api.alpaca.markets/v2 -> wss://paper-api.alpaca.markets/stream
+				static std::string StreamUrl(const std::string& endPoint);
+
+				explicit TradeStream(const Account& account, size_t capacity = DEFAULT_CAPACITY);
+				~TradeStream() override;
+
+				// Consumer side, call from a single thread
+				bool Poll(TradeEvent& out_Event);
+			};
+
+			// Waits until every order in `pending` (by client order id) is filled, cancelled or rejected, or `timeout` passes.
+			// Each execution goes into `book` and is written to `fills` as CSV with its real price and quantity;
+			// orders ending without a fill and orders still open at the end are noted in `log`.
+			void RecordFills(TradeStream& stream, std::unordered_set<std::string> pending, PositionBook& book,
+				std::ostream& fills, std::ostream& log, std::chrono::seconds timeout);
+		}
+	}
+}
@@ -3,6 +3,7 @@
 #include <map>
 #include <string>
 #include <vector>
+#include <cstdint>
 
 namespace StockyBoy {
     enum INTERVAL {
@@ -67,4 +68,10 @@ namespace StockyBoy {
     RANGE FromStringToRange(const std::string& str);
 
     bool IsValidCombo(INTERVAL interval, RANGE range);
+
+    // Nominal length of one bar in seconds (months are approximated), 0 if invalid
+    int64_t ToSeconds(INTERVAL interval);
+
+    // Nominal length of a range in seconds, 0 for ytd and max (they don't have a fixed length)
+    int64_t ToSeconds(RANGE range);
 }
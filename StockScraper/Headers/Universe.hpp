@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Result.hpp"
+#include "StockData.hpp"
+#include "MappedFile.hpp"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <istream>
+#include <filesystem>
+#include <string_view>
+
+namespace StockyBoy {
+	namespace Scraper {
+		enum class Exchange : uint8_t {
+			UNKNOWN,
+			NYSE,
+			NASDAQ,
+			AMEX,
+			ARCA,
+			OTHER,
+			COUNT
+		};
+
+		std::string_view ToString(Exchange exchange);
+		Exchange ExchangeFromString(std::string_view name);
+
+		constexpr uint32_t ExchangeBit(Exchange exchange) { return 1u << static_cast<uint32_t>(exchange); }
+		constexpr uint32_t ALL_EXCHANGES = (1u << static_cast<uint32_t>(Exchange::COUNT)) - 1;
+
+		// One symbol of the universe, with what the last daily bars said about it
+		struct UniverseEntry {
+			std::string label;
+			Exchange exchange = Exchange::UNKNOWN;
+			float lastPrice = 0.0f;
+			float avgVolume = 0.0f;   // shares per day, over the last AVG_VOLUME_BARS bars
+			int64_t lastBar = 0;      // epoch of the latest daily bar, 0 while it was never seen
+			uint32_t misses = 0;      // fetches in a row that came back with nothing
+			bool active = true;       // false for delisted/dead symbols, scans leave them out
+
+			bool known() const { return lastBar != 0; }
+		};
+
+		// What Universe::Select keeps. Symbols with no bars yet can only be judged after their first fetch.
+		struct UniverseFilter {
+			float minPrice = 0.0f;
+			float minAvgVolume = 0.0f;
+			double minDollarVolume = 0.0;          // lastPrice * avgVolume
+			uint32_t exchanges = ALL_EXCHANGES;    // ExchangeBit of each exchange to keep
+			bool includeUnknown = true;
+		};
+
+		struct UniverseRecord;
+
+		// The ticker universe as one memory-mapped file: per-symbol metadata sorted by label, plus a prebuilt index
+		// of the active symbols by dollar volume, so a liquidity filter is a binary search instead of a pass over everything.
+		// Ids are positions in label order and only hold for the file they came from.
+		class Universe {
+		public:
+			static constexpr size_t AVG_VOLUME_BARS = 20;
+
+		private:
+			MappedFile File{};
+			const UniverseRecord* Records = nullptr;
+			size_t Count = 0;
+			std::span<const uint32_t> Liquid{};   // active and known, by dollar volume, descending
+			std::span<const uint32_t> Unknown{};  // active, never seen
+			const char* Labels = nullptr;
+
+		public:
+			Universe() = default;
+
+			Result Open(const std::filesystem::path& path);
+			void Close();
+
+			// Sorts by label and drops duplicate labels (the first one wins) before writing
+			static Result Write(const std::filesystem::path& path, std::vector<UniverseEntry> entries);
+
+			// Reads a listing CSV with a "ticker" (or "symbol") column and an optional "exchange" column, like tickers.csv
+			static Result ReadListing(std::istream& in, std::vector<UniverseEntry>& out_Entries);
+
+			// Sets lastPrice, avgVolume and lastBar from daily bars, leaves the rest alone
+			static void Describe(const StockTableView& daily, UniverseEntry& entry);
+
+		public:
+			size_t size() const { return Count; }
+			bool empty() const { return Count == 0; }
+
+			std::string_view label(uint32_t symbol) const;
+			UniverseEntry entry(uint32_t symbol) const;
+			std::vector<UniverseEntry> entries() const;
+
+			bool Find(std::string_view label, uint32_t& out_Symbol) const;
+
+			// Ids passing `filter`, ascending. Inactive symbols never do.
+			std::vector<uint32_t> Select(const UniverseFilter& filter) const;
+		};
+	}
+}
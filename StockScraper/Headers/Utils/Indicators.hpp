@@ -0,0 +1,264 @@
+#pragma once
+
+#include <span>
+#include <deque>
+#include <limits>
+#include <vector>
+#include <cstdint>
+
+#include "StockData.hpp"
+
+namespace StockyBoy {
+	namespace Maths {
+		// Value of an indicator during its warm-up, before enough bars have been seen
+		inline constexpr double WARMUP = std::numeric_limits<double>::quiet_NaN();
+
+		// --------------------------------------------------------------------
+		// Incremental indicators: Push one new bar, get the latest value back.
+		// Every Push is O(1) (amortized for min/max), and returns WARMUP until ready().
+		// --------------------------------------------------------------------
+
+		// Last `window` values, oldest evicted first
+		class RollingWindow {
+		private:
+			std::vector<double> Values;
+			size_t Head = 0;
+			size_t Count = 0;
+
+		public:
+			explicit RollingWindow(uint32_t window);
+
+			// Returns true once the window is full and out_Evicted holds the value that fell out
+			bool Push(double value, double& out_Evicted);
+			void Reset();
+
+			bool full() const { return !Values.empty() && Count == Values.size(); }
+			size_t capacity() const { return Values.size(); }
+			size_t size() const { return Count; }
+
+			// The values in the window, in storage order (not oldest first)
+			std::span<const double> values() const { return std::span<const double>(Values.data(), Count); }
+		};
+
+		// The sliding sum rounds a little each bar, so it is summed again from scratch every `window` bars, like
+		// RollingStdDev
+		class RollingSMA {
+		private:
+			RollingWindow Window;
+			double Sum = 0.0;
+			size_t SinceRecompute = 0;
+
+		public:
+			explicit RollingSMA(uint32_t window) : Window(window) {}
+
+			double Push(double value);
+			void Reset();
+
+			bool ready() const { return Window.full(); }
+			double value() const { return ready() ? Sum / Window.capacity() : WARMUP; }
+		};
+
+		// Seeded with the SMA of the first `window` values
+		class RollingEMA {
+		private:
+			uint32_t Window;
+			double Alpha;
+			uint32_t Seen = 0;
+			double Value = 0.0;
+
+		public:
+			explicit RollingEMA(uint32_t window);
+
+			double Push(double value);
+			void Reset();
+
+			bool ready() const { return Window > 0 && Seen >= Window; }
+			double value() const { return ready() ? Value : WARMUP; }
+		};
+
+		// Linearly weighted, newest value has weight `window`
+		class RollingWMA {
+		private:
+			RollingWindow Window;
+			double Sum = 0.0;
+			double WeightedSum = 0.0;
+			uint32_t Seen = 0;
+
+		public:
+			explicit RollingWMA(uint32_t window) : Window(window) {}
+
+			double Push(double value);
+			void Reset();
+
+			bool ready() const { return Window.full(); }
+			double value() const;
+		};
+
+		// Monotonic deque: candidates for the extreme, oldest at the front
+		template <typename Compare>
+		class RollingExtreme {
+		private:
+			struct Entry {
+				uint64_t index;
+				double value;
+			};
+
+			std::deque<Entry> Candidates;
+			uint32_t Window;
+			uint64_t Next = 0;
+
+		public:
+			explicit RollingExtreme(uint32_t window) : Window(window) {}
+
+			double Push(double value) {
+				if (Window == 0) return WARMUP;
+
+				while (!Candidates.empty() && !Compare{}(Candidates.back().value, value)) {
+					Candidates.pop_back();
+				}
+				Candidates.push_back(Entry{ Next, value });
+				++Next;
+
+				while (Candidates.front().index + Window < Next) {
+					Candidates.pop_front();
+				}
+				return this->value();
+			}
+
+			void Reset() {
+				Candidates.clear();
+				Next = 0;
+			}
+
+			bool ready() const { return Window > 0 && Next >= Window; }
+			double value() const { return ready() ? Candidates.front().value : WARMUP; }
+		};
+
+		struct StrictlyLess { bool operator()(double a, double b) const { return a < b; } };
+		struct StrictlyGreater { bool operator()(double a, double b) const { return a > b; } };
+
+		using RollingMin = RollingExtreme<StrictlyLess>;
+		using RollingMax = RollingExtreme<StrictlyGreater>;
+
+		// Population standard deviation over the window. Welford's update keeps the squared deviations from the mean
+		// instead of a raw sum of squares, so prices far from 0 don't cancel out. The sliding update still rounds a
+		// little each bar, so the window is summed again from scratch every `window` bars (amortized O(1)).
+		class RollingStdDev {
+		private:
+			RollingWindow Window;
+			double Mean = 0.0;
+			double SquaredDeviations = 0.0; // sum of (x - Mean)^2 over the window
+			size_t SinceRecompute = 0;
+
+			void Recompute();
+
+		public:
+			explicit RollingStdDev(uint32_t window) : Window(window) {}
+
+			double Push(double value);
+			void Reset();
+
+			bool ready() const { return Window.full(); }
+			double mean() const { return ready() ? Mean : WARMUP; }
+			double value() const;
+		};
+
+		struct Band {
+			double middle = WARMUP;
+			double upper = WARMUP;
+			double lower = WARMUP;
+		};
+
+		// SMA +/- k standard deviations
+		class RollingBollinger {
+		private:
+			RollingStdDev Deviation;
+			double K;
+
+		public:
+			RollingBollinger(uint32_t window, double k = 2.0) : Deviation(window), K(k) {}
+
+			Band Push(double value);
+			void Reset() { Deviation.Reset(); }
+
+			bool ready() const { return Deviation.ready(); }
+			Band value() const;
+		};
+
+		// Wilder's RSI, needs window + 1 closes
+		class RollingRSI {
+		private:
+			uint32_t Window;
+			uint32_t Changes = 0;
+			double PreviousClose = 0.0;
+			bool HasPrevious = false;
+			double AverageGain = 0.0;
+			double AverageLoss = 0.0;
+
+		public:
+			explicit RollingRSI(uint32_t window = 14) : Window(window) {}
+
+			double Push(double close);
+			void Reset();
+
+			bool ready() const { return Window > 0 && Changes >= Window; }
+			double value() const;
+		};
+
+		// Wilder's average true range
+		class RollingATR {
+		private:
+			uint32_t Window;
+			uint32_t Seen = 0;
+			double PreviousClose = 0.0;
+			double Value = 0.0;
+
+		public:
+			explicit RollingATR(uint32_t window = 14) : Window(window) {}
+
+			double Push(double high, double low, double close);
+			void Reset();
+
+			bool ready() const { return Window > 0 && Seen >= Window; }
+			double value() const { return ready() ? Value : WARMUP; }
+		};
+
+		// Volume-weighted average of the typical price (h + l + c) / 3 since the last Reset
+		class RollingVWAP {
+		private:
+			double PriceVolume = 0.0;
+			double Volume = 0.0;
+
+		public:
+			double Push(double high, double low, double close, double volume);
+			void Reset();
+
+			bool ready() const { return Volume > 0.0; }
+			double value() const { return ready() ? PriceVolume / Volume : WARMUP; }
+		};
+
+		// --------------------------------------------------------------------
+		// Batch indicators: one O(n) pass over the columns, WARMUP where the indicator is not ready yet
+		// --------------------------------------------------------------------
+
+		std::vector<double> SMA(std::span<const double> values, uint32_t window);
+		std::vector<double> EMA(std::span<const double> values, uint32_t window);
+		std::vector<double> WMA(std::span<const double> values, uint32_t window);
+		std::vector<double> MovingMin(std::span<const double> values, uint32_t window);
+		std::vector<double> MovingMax(std::span<const double> values, uint32_t window);
+		std::vector<double> StdDev(std::span<const double> values, uint32_t window);
+
+		struct Bands {
+			std::vector<double> middle;
+			std::vector<double> upper;
+			std::vector<double> lower;
+		};
+		Bands Bollinger(std::span<const double> values, uint32_t window, double k = 2.0);
+
+		std::vector<double> RSI(std::span<const double> close, uint32_t window = 14);
+		std::vector<double> ATR(const Scraper::StockTableView& bars, uint32_t window = 14);
+
+		// Restarts at every session start given (e.g. StockTable::sessionStarts for intraday bars), cumulative otherwise
+		std::vector<double> VWAP(const Scraper::StockTableView& bars, std::span<const uint32_t> sessionStarts = {});
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <span>
+#include <cstdint>
+
+namespace StockyBoy {
+	namespace Maths {
+		// --------------------------------------------------------------------
+		// Vectorized column kernels. The widest instruction set the CPU supports
+		// (AVX2, then SSE2) is picked once at runtime, with a scalar fallback elsewhere.
+		// NaN values are skipped by Max/Min and propagate everywhere else.
+		// --------------------------------------------------------------------
+
+		enum class SimdLevel : uint8_t {
+			Scalar,
+			SSE2,
+			AVX2
+		};
+
+		SimdLevel ActiveSimdLevel();
+		const char* ToString(SimdLevel level);
+
+		// Caps the dispatch at `level`, never above what the CPU supports, and returns the level now active.
+		// For tests and benchmarks that compare the paths.
+		SimdLevel SetSimdLevel(SimdLevel level);
+
+		// -infinity / +infinity for an empty span
+		double Max(std::span<const double> values);
+		double Min(std::span<const double> values);
+		double Sum(std::span<const double> values);
+
+		// values[i] *= factor
+		void Scale(std::span<double> values, double factor);
+		// out[i] = values[i] * factor, out must be at least as long as values
+		void ScaleInto(std::span<const double> values, std::span<double> out, double factor);
+
+		// values[i] /= divisor. A true divide on every path, bit-identical to the plain loop (unlike Scale by 1 / divisor).
+		void Divide(std::span<double> values, double divisor);
+		// out[i] = values[i] / divisor, out must be at least as long as values
+		void DivideInto(std::span<const double> values, std::span<double> out, double divisor);
+
+		// Element-wise over equal-length spans, out must be at least as long as from.
+		// Pass (v.first(n - k), v.subspan(k)) for the change over k bars along one column.
+		// out[i] = (to[i] - from[i]) / from[i] * 100
+		void PercentChange(std::span<const double> from, std::span<const double> to, std::span<double> out);
+		// out[i] = ln(to[i] / from[i])
+		void LogReturn(std::span<const double> from, std::span<const double> to, std::span<double> out);
+	}
+}
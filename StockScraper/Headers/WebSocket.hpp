@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+
+#include "Result.hpp"
+
+namespace StockyBoy {
+	namespace Scraper {
+		// One client WebSocket over curl's CONNECT_ONLY mode. Blocking calls, meant to be owned by a single thread.
+		// curl answers pings itself; fragmented messages are put back together before Receive returns them.
+		class WebSocket {
+		private:
+			void* Curl = nullptr; // CURL*, kept opaque so the header doesn't need curl.h
+			std::string Partial{};
+
+		public:
+			WebSocket() = default;
+			~WebSocket();
+
+			WebSocket(const WebSocket&) = delete;
+			WebSocket& operator=(const WebSocket&) = delete;
+
+			// ws:// or wss://, closes any previous connection first
+			Result Connect(const std::string& url, long connectTimeoutSeconds = 10);
+			void Close();
+
+			bool connected() const { return Curl != nullptr; }
+
+			Result SendText(const std::string& text);
+
+			// Waits up to `timeoutMs` for one whole text or binary message. Succeeds with an empty `out_Message`
+			// when nothing complete arrived in time, fails once the connection is closed or broken.
+			Result Receive(std::string& out_Message, long timeoutMs);
+		};
+	}
+}
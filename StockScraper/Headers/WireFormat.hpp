@@ -0,0 +1,24 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include <string>
+#include <cstdint>
+#include <string_view>
+
+namespace StockyBoy {
+	namespace Scraper {
+		// "2021-02-22T15:51:44.208123Z" (RFC 3339, UTC) -> Unix milliseconds, -1 when malformed.
+		// A fraction of any length is read, only the milliseconds are kept ("...44.2Z" is 200 ms).
+		int64_t ParseTimestampMs(std::string_view text);
+
+		// Unix seconds -> "2021-02-22T05:00:00Z"
+		std::string FormatTimestamp(int64_t epoch);
+
+		// Percent-encodes `text` for a URL path or query, everything but [A-Za-z0-9.-_~] is escaped
+		void AppendEncoded(std::string& out, std::string_view text);
+
+		// object[key] as a number, `fallback` when it is missing, null or not a number
+		double JsonNumber(const nlohmann::json& object, const char* key, double fallback = 0.0);
+	}
+}
@@ -0,0 +1,384 @@
+"""Local stand-in for the Alpaca trading API, for development without network access.
+
+Serves the REST endpoints the scraper uses (/v2/account, /v2/positions, /v2/orders) and the
+trade_updates WebSocket at /stream. Every accepted order is reported as `new`, then filled in full
+after --fill-delay seconds at a fixed price per symbol, which also moves cash and positions.
+
+The market data WebSocket is at /v2/iex (also /v2/sip and /v2/test): subscribed symbols get a
+random-walk trade every --tick-interval seconds around that same price.
+
+    python MockAlpaca.py --port 8790
+    Endpoint: http://127.0.0.1:8790/v2   (credentials file, any key/secret unless --key/--secret are set)
+    Market data: ws://127.0.0.1:8790/v2/iex
+
+Orders for symbols listed in --reject are rejected over the stream instead of filled.
+Standard library only.
+"""
+
+import argparse
+import base64
+import hashlib
+import json
+import random
+import socket
+import struct
+import threading
+import time
+import uuid
+import zlib
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+WS_GUID = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+
+
+# ====================
+# Broker state
+# ====================
+
+class Broker:
+    def __init__(self, args):
+        self.args = args
+        self.lock = threading.Lock()
+        self.cash = args.cash
+        self.positions = {}   # symbol -> [qty, avg entry price]
+        self.orders = {}      # id -> order dict
+        self.client_ids = set()
+        self.streams = []     # listening WebSocket clients
+
+    def price(self, symbol):
+        # Stable per symbol, so repeated runs see the same fills
+        return round(10.0 + zlib.crc32(symbol.encode()) % 49000 / 100.0, 2)
+
+    def account(self):
+        with self.lock:
+            equity = self.cash + sum(qty * self.price(s) for s, (qty, _) in self.positions.items())
+            return {"id": "mock-account", "account_number": "MOCK0001", "status": "ACTIVE",
+                    "cash": f"{self.cash:.2f}", "equity": f"{equity:.2f}", "buying_power": f"{self.cash:.2f}"}
+
+    def position_list(self):
+        with self.lock:
+            rows = []
+            for symbol, (qty, entry) in sorted(self.positions.items()):
+                price = self.price(symbol)
+                rows.append({"symbol": symbol, "qty": f"{qty:.9f}", "avg_entry_price": f"{entry:.4f}",
+                             "current_price": f"{price:.2f}", "market_value": f"{qty * price:.2f}", "side": "long"})
+            return rows
+
+    def open_orders(self):
+        with self.lock:
+            return [dict(o) for o in self.orders.values() if o["status"] in ("new", "accepted", "partially_filled")]
+
+    def submit(self, body):
+        """Returns (http code, response) and schedules the stream events."""
+        symbol = body.get("symbol")
+        side = body.get("side")
+        if not symbol or side not in ("buy", "sell") or not (body.get("notional") or body.get("qty")):
+            return 422, {"code": 40010001, "message": "symbol, side and notional or qty are required"}
+
+        client_id = body.get("client_order_id") or str(uuid.uuid4())
+        with self.lock:
+            if client_id in self.client_ids:
+                return 422, {"code": 40010001, "message": "client_order_id must be unique"}
+            self.client_ids.add(client_id)
+
+            order = {"id": str(uuid.uuid4()), "client_order_id": client_id, "symbol": symbol, "side": side,
+                     "type": body.get("type", "market"), "time_in_force": body.get("time_in_force", "day"),
+                     "notional": body.get("notional"), "qty": body.get("qty"),
+                     "filled_qty": "0", "filled_avg_price": None, "status": "new"}
+            self.orders[order["id"]] = order
+
+        self.publish("new", order)
+        threading.Timer(self.args.fill_delay, self.execute, args=(order["id"],)).start()
+        return 200, dict(order)
+
+    def execute(self, order_id):
+        with self.lock:
+            order = self.orders[order_id]
+            symbol = order["symbol"]
+            price = self.price(symbol)
+
+            if symbol in self.args.reject:
+                order["status"] = "rejected"
+                event, extra = "rejected", {}
+            else:
+                qty = float(order["qty"]) if order["qty"] else float(order["notional"]) / price
+                held, entry = self.positions.get(symbol, [0.0, 0.0])
+
+                if order["side"] == "buy":
+                    self.cash -= qty * price
+                    total = held + qty
+                    self.positions[symbol] = [total, (held * entry + qty * price) / total]
+                else:
+                    qty = min(qty, held)
+                    self.cash += qty * price
+                    if held - qty <= 1e-9:
+                        self.positions.pop(symbol, None)
+                    else:
+                        self.positions[symbol] = [held - qty, entry]
+
+                order.update(status="filled", filled_qty=f"{qty:.9f}", filled_avg_price=f"{price:.2f}")
+                event = "fill"
+                extra = {"price": f"{price:.2f}", "qty": f"{qty:.9f}",
+                         "position_qty": f"{self.positions.get(symbol, [0.0])[0]:.9f}"}
+
+            snapshot = dict(order)
+
+        self.publish(event, snapshot, extra)
+
+    def publish(self, event, order, extra=None):
+        message = {"stream": "trade_updates",
+                   "data": {"event": event, "timestamp": time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime()),
+                            "order": order, **(extra or {})}}
+        payload = json.dumps(message).encode()
+        with self.lock:
+            clients = list(self.streams)
+        for client in clients:
+            client.send(payload, opcode=0x2)  # Alpaca sends trade updates as binary frames
+
+
+# ====================
+# WebSocket
+# ====================
+
+class WebSocket:
+    def __init__(self, sock):
+        self.sock = sock
+        self.send_lock = threading.Lock()
+
+    def read_exact(self, n):
+        data = b""
+        while len(data) < n:
+            chunk = self.sock.recv(n - len(data))
+            if not chunk:
+                raise ConnectionError("closed")
+            data += chunk
+        return data
+
+    def receive(self):
+        """Returns (opcode, payload) of the next whole message."""
+        message, first_opcode = b"", None
+        while True:
+            b0, b1 = self.read_exact(2)
+            opcode, fin = b0 & 0x0F, b0 & 0x80
+            length = b1 & 0x7F
+            if length == 126:
+                length = struct.unpack(">H", self.read_exact(2))[0]
+            elif length == 127:
+                length = struct.unpack(">Q", self.read_exact(8))[0]
+            mask = self.read_exact(4) if b1 & 0x80 else b"\0\0\0\0"
+            payload = bytes(c ^ mask[i % 4] for i, c in enumerate(self.read_exact(length)))
+
+            if opcode >= 0x8:  # control frames are never fragmented
+                return opcode, payload
+            if first_opcode is None:
+                first_opcode = opcode
+            message += payload
+            if fin:
+                return first_opcode, message
+
+    def send(self, payload, opcode=0x1):
+        header = bytes([0x80 | opcode])
+        if len(payload) < 126:
+            header += bytes([len(payload)])
+        elif len(payload) < 1 << 16:
+            header += bytes([126]) + struct.pack(">H", len(payload))
+        else:
+            header += bytes([127]) + struct.pack(">Q", len(payload))
+        with self.send_lock:
+            try:
+                self.sock.sendall(header + payload)
+            except OSError:
+                pass
+
+
+# ====================
+# HTTP
+# ====================
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    broker = None
+
+    def log_message(self, fmt, *args):
+        if self.broker.args.verbose:
+            super().log_message(fmt, *args)
+
+    def reply(self, code, obj):
+        body = json.dumps(obj).encode()
+        self.send_response(code)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def authorized(self, key, secret):
+        args = self.broker.args
+        return (not args.key or key == args.key) and (not args.secret or secret == args.secret)
+
+    def check_headers(self):
+        if self.authorized(self.headers.get("APCA-API-KEY-ID"), self.headers.get("APCA-API-SECRET-KEY")):
+            return True
+        self.reply(401, {"code": 40110000, "message": "request is not authorized"})
+        return False
+
+    def do_GET(self):
+        path = self.path.split("?")[0]
+        if self.headers.get("Upgrade", "").lower() == "websocket":
+            if path == "/stream":
+                return self.stream()
+            if path in ("/v2/iex", "/v2/sip", "/v2/test"):
+                return self.data_stream()
+        if not self.check_headers():
+            return
+        if path == "/v2/account":
+            self.reply(200, self.broker.account())
+        elif path == "/v2/positions":
+            self.reply(200, self.broker.position_list())
+        elif path == "/v2/orders":
+            self.reply(200, self.broker.open_orders())
+        else:
+            self.reply(404, {"code": 40410000, "message": "not found"})
+
+    def do_POST(self):
+        if not self.check_headers():
+            return
+        raw = self.rfile.read(int(self.headers.get("Content-Length", 0)))
+        if self.path.split("?")[0] != "/v2/orders":
+            return self.reply(404, {"code": 40410000, "message": "not found"})
+        try:
+            body = json.loads(raw)
+        except ValueError:
+            return self.reply(400, {"code": 40010000, "message": "malformed json"})
+        self.reply(*self.broker.submit(body))
+
+    def upgrade(self):
+        accept = base64.b64encode(hashlib.sha1((self.headers["Sec-WebSocket-Key"] + WS_GUID).encode()).digest()).decode()
+        self.send_response(101, "Switching Protocols")
+        self.send_header("Upgrade", "websocket")
+        self.send_header("Connection", "Upgrade")
+        self.send_header("Sec-WebSocket-Accept", accept)
+        self.end_headers()
+        self.wfile.flush()
+
+        self.connection.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.close_connection = True
+        return WebSocket(self.connection)
+
+    def data_stream(self):
+        ws = self.upgrade()
+        send = lambda items: ws.send(json.dumps(items).encode())
+        send([{"T": "success", "msg": "connected"}])
+
+        symbols, lock, stop = {}, threading.Lock(), threading.Event()
+
+        def ticker():
+            while not stop.wait(self.broker.args.tick_interval):
+                now = time.time()
+                stamp = time.strftime("%Y-%m-%dT%H:%M:%S", time.gmtime(now)) + f".{int(now % 1 * 1e6):06d}Z"
+                batch = []
+                with lock:
+                    for symbol in symbols:
+                        symbols[symbol] = round(max(0.01, symbols[symbol] * (1 + random.gauss(0, 0.001))), 2)
+                        batch.append({"T": "t", "S": symbol, "p": symbols[symbol], "s": random.randint(1, 500),
+                                      "t": stamp, "x": "V", "i": random.getrandbits(32), "z": "C"})
+                if batch:
+                    send(batch)
+
+        threading.Thread(target=ticker, daemon=True).start()
+        authed = False
+        try:
+            while True:
+                opcode, payload = ws.receive()
+                if opcode == 0x8:
+                    break
+                if opcode == 0x9:
+                    ws.send(payload, opcode=0xA)
+                    continue
+                try:
+                    msg = json.loads(payload)
+                except ValueError:
+                    continue
+
+                if msg.get("action") == "auth":
+                    authed = self.authorized(msg.get("key"), msg.get("secret"))
+                    if not authed:
+                        send([{"T": "error", "code": 402, "msg": "auth failed"}])
+                        break
+                    send([{"T": "success", "msg": "authenticated"}])
+                elif msg.get("action") == "subscribe" and authed:
+                    with lock:
+                        for symbol in msg.get("trades", []):
+                            symbols.setdefault(symbol, self.broker.price(symbol))
+                        trades = sorted(symbols)
+                    send([{"T": "subscription", "trades": trades, "quotes": [], "bars": []}])
+        except (ConnectionError, OSError):
+            pass
+        finally:
+            stop.set()
+
+    def stream(self):
+        ws = self.upgrade()
+        authed = False
+        try:
+            while True:
+                opcode, payload = ws.receive()
+                if opcode == 0x8:
+                    ws.send(payload[:2], opcode=0x8)
+                    break
+                if opcode == 0x9:
+                    ws.send(payload, opcode=0xA)
+                    continue
+                if opcode not in (0x1, 0x2):
+                    continue
+
+                try:
+                    msg = json.loads(payload)
+                except ValueError:
+                    continue
+
+                if msg.get("action") in ("auth", "authenticate"):
+                    authed = self.authorized(msg.get("key"), msg.get("secret"))
+                    status = "authorized" if authed else "unauthorized"
+                    ws.send(json.dumps({"stream": "authorization",
+                                        "data": {"action": "authenticate", "status": status}}).encode(), opcode=0x2)
+                    if not authed:
+                        break
+                elif msg.get("action") == "listen" and authed:
+                    streams = [s for s in msg.get("data", {}).get("streams", []) if s == "trade_updates"]
+                    with self.broker.lock:
+                        if streams and ws not in self.broker.streams:
+                            self.broker.streams.append(ws)
+                        elif not streams and ws in self.broker.streams:
+                            self.broker.streams.remove(ws)
+                    ws.send(json.dumps({"stream": "listening", "data": {"streams": streams}}).encode(), opcode=0x2)
+        except (ConnectionError, OSError):
+            pass
+        finally:
+            with self.broker.lock:
+                if ws in self.broker.streams:
+                    self.broker.streams.remove(ws)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--port", type=int, default=8790)
+    parser.add_argument("--key", default="", help="required key, any key when empty")
+    parser.add_argument("--secret", default="", help="required secret, any secret when empty")
+    parser.add_argument("--cash", type=float, default=100000.0)
+    parser.add_argument("--fill-delay", type=float, default=0.2, help="seconds between new and fill")
+    parser.add_argument("--reject", nargs="*", default=[], help="symbols whose orders get rejected")
+    parser.add_argument("--tick-interval", type=float, default=0.5, help="seconds between market data trades")
+    parser.add_argument("--verbose", action="store_true")
+    args = parser.parse_args()
+    args.reject = set(args.reject)
+
+    Handler.broker = Broker(args)
+    server = ThreadingHTTPServer(("127.0.0.1", args.port), Handler)
+    server.daemon_threads = True
+    print(f"Mock Alpaca on http://127.0.0.1:{args.port}/v2, streams on ws://127.0.0.1:{args.port}/stream"
+          f" and ws://127.0.0.1:{args.port}/v2/iex", flush=True)
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
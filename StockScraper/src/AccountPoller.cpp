@@ -0,0 +1,94 @@
+#include "pch.h"
+
+#include "AccountPoller.hpp"
+
+namespace StockyBoy {
+	namespace Scraper {
+		namespace Alpaca {
+			AccountPoller::AccountPoller(const Account& account, std::chrono::milliseconds period)
+				: account(account), period(period)
+			{
+				worker = std::thread(&AccountPoller::Poll, this);
+			}
+
+			AccountPoller::~AccountPoller()
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					stopping = true;
+				}
+				wake.notify_all();
+
+				worker.join();
+			}
+
+			Result AccountPoller::Snapshot(AlpacaAccountDetails& out_Details, Clock::time_point* out_Updated) const
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				if (updated == Clock::time_point{}) {
+					return last;
+				}
+
+				out_Details = snapshot;
+				if (out_Updated) {
+					*out_Updated = updated;
+				}
+				return Result::Ok();
+			}
+
+			Result AccountPoller::LastResult() const
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				return last;
+			}
+
+			void AccountPoller::RefreshNow()
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					refreshRequested = true;
+				}
+				wake.notify_all();
+			}
+
+			void AccountPoller::SetPeriod(std::chrono::milliseconds newPeriod)
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					period = newPeriod;
+				}
+				wake.notify_all();
+			}
+
+			void AccountPoller::Poll()
+			{
+				while (true) {
+					// The request runs without the lock, readers keep getting the previous snapshot meanwhile
+					Result result = account.Refresh();
+
+					AlpacaAccountDetails details;
+					if (result.succeeded) {
+						account.GetDetails(details);
+					}
+
+					std::unique_lock<std::mutex> lock(mutex);
+					last = result;
+					if (result.succeeded) {
+						snapshot = std::move(details);
+						updated = Clock::now();
+					}
+
+					refreshRequested = false;
+					const Clock::time_point due = Clock::now() + period;
+					wake.wait_until(lock, due, [this, &due] {
+						return stopping || refreshRequested || Clock::now() >= due;
+						});
+
+					if (stopping) {
+						return;
+					}
+				}
+			}
+		}
+	}
+}
@@ -4,6 +4,15 @@
 
 #include "Result.hpp"
 #include "Fetch.hpp"
+#include "RateLimiter.hpp"
+#include "ConnectionPool.hpp"
+
+#include <array>
+#include <chrono>
+#include <thread>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
 
 static std::string Trim(const std::string& s) {
 	size_t start = s.find_first_not_of(" \t");
@@ -14,6 +23,191 @@ static std::string Trim(const std::string& s) {
 namespace StockyBoy {
 	namespace Scraper {
 		namespace Alpaca {
+			// First try plus retries, only for orders that carry a client order id. A dropped connection or a 429 usually
+			// needs a moment, so the attempts are spaced out with jittered backoff.
+			static constexpr RetryPolicy ORDER_RETRY{ .maxAttempts = 3, .baseDelay = std::chrono::milliseconds(250), .maxDelay = std::chrono::milliseconds(2000) };
+
+			// JSON string literal: quotes, backslashes and control characters escaped, other bytes (UTF-8) as they are
+			static void AppendJsonString(std::string& out, const std::string& value) {
+				out += '"';
+				for (char c : value) {
+					switch (c) {
+					case '"':  out += "\\\""; break;
+					case '\\': out += "\\\\"; break;
+					case '\n': out += "\\n"; break;
+					case '\r': out += "\\r"; break;
+					case '\t': out += "\\t"; break;
+					case '\b': out += "\\b"; break;
+					case '\f': out += "\\f"; break;
+					default:
+						if (static_cast<unsigned char>(c) < 0x20) {
+							char escaped[8];
+							std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(static_cast<unsigned char>(c)));
+							out += escaped;
+						}
+						else {
+							out += c;
+						}
+					}
+				}
+				out += '"';
+			}
+
+			static void SerializeOrder(const Order& order, std::string& out_Body) {
+				char notional[32];
+				std::snprintf(notional, sizeof(notional), "%f", order.value);
+
+				out_Body.clear();
+				out_Body += "{\"type\":\"";
+				out_Body += (order.type == OrderType::MARKET) ? "market" : "limit";
+				out_Body += "\",\"time_in_force\":\"day\",\"symbol\":";
+				AppendJsonString(out_Body, order.label);
+				if (order.qty.empty()) {
+					out_Body += ",\"notional\":\"";
+					out_Body += notional;
+					out_Body += '"';
+				}
+				else {
+					out_Body += ",\"qty\":";
+					AppendJsonString(out_Body, order.qty);
+				}
+				out_Body += ",\"side\":\"";
+				out_Body += (order.action == Action::BUY) ? "buy" : "sell";
+				out_Body += '"';
+				if (!order.clientOrderId.empty()) {
+					out_Body += ",\"client_order_id\":";
+					AppendJsonString(out_Body, order.clientOrderId);
+				}
+				out_Body += '}';
+			}
+
+			static bool IsDuplicateClientOrderId(long httpCode, const std::string& response) {
+				return httpCode == 422 && response.find("client_order_id must be unique") != std::string::npos;
+			}
+
+			static std::shared_ptr<curl_slist> BuildHeaders(const std::string& key, const std::string& secret, bool json) {
+				struct curl_slist* headers = nullptr;
+				headers = curl_slist_append(headers, ("APCA-API-KEY-ID: " + key).c_str());
+				headers = curl_slist_append(headers, ("APCA-API-SECRET-KEY: " + secret).c_str());
+				headers = curl_slist_append(headers, "accept: application/json");
+				if (json) {
+					headers = curl_slist_append(headers, "content-type: application/json");
+				}
+				return std::shared_ptr<curl_slist>(headers, curl_slist_free_all);
+			}
+
+			// Keeps the named string fields of every object at `rowDepth` (1: the top-level object, 2: the elements
+			// of a top-level array), `keys.size()` values per row. Missing and null fields stay empty, the rest is skipped.
+			class FieldsSaxHandler : public nlohmann::json_sax<nlohmann::json> {
+			private:
+				std::span<const std::string_view> keys;
+				size_t rowDepth;
+
+				size_t depth = 0;
+				std::string* target = nullptr;
+
+			public:
+				std::vector<std::string> values{};
+				size_t rows = 0;
+				std::string parseError{};
+
+			public:
+				FieldsSaxHandler(std::span<const std::string_view> keys, size_t rowDepth) : keys(keys), rowDepth(rowDepth) {}
+
+				const std::string& at(size_t row, size_t field) const { return values[row * keys.size() + field]; }
+
+				bool null() override { target = nullptr; return true; }
+				bool boolean(bool) override { target = nullptr; return true; }
+				bool number_integer(number_integer_t) override { target = nullptr; return true; }
+				bool number_unsigned(number_unsigned_t) override { target = nullptr; return true; }
+				bool number_float(number_float_t, const string_t&) override { target = nullptr; return true; }
+				bool binary(binary_t&) override { target = nullptr; return true; }
+
+				bool string(string_t& val) override {
+					if (target) {
+						*target = std::move(val);
+						target = nullptr;
+					}
+					return true;
+				}
+
+				bool start_object(std::size_t) override {
+					target = nullptr;
+					if (++depth == rowDepth) {
+						++rows;
+						values.resize(rows * keys.size());
+					}
+					return true;
+				}
+
+				bool key(string_t& val) override {
+					target = nullptr;
+					if (depth != rowDepth) return true;
+
+					for (size_t i = 0; i < keys.size(); ++i) {
+						if (val == keys[i]) {
+							target = &values[(rows - 1) * keys.size() + i];
+							break;
+						}
+					}
+					return true;
+				}
+
+				bool end_object() override {
+					--depth;
+					return true;
+				}
+
+				bool start_array(std::size_t) override {
+					target = nullptr;
+					++depth;
+					return true;
+				}
+
+				bool end_array() override {
+					--depth;
+					return true;
+				}
+
+				bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+					parseError = ex.what();
+					return false;
+				}
+			};
+
+			static Result ParseFields(const std::string& response, FieldsSaxHandler& handler) {
+				try {
+					if (!nlohmann::json::sax_parse(response, &handler)) {
+						return Result::Fail("[StockyBoy][Alpaca] Failed to parse JSON: " + handler.parseError);
+					}
+				}
+				catch (const std::exception& ex) {
+					return Result::Fail("[StockyBoy][Alpaca] Failed to parse JSON: " + std::string(ex.what()));
+				}
+				return Result::Ok();
+			}
+
+			// Alpaca sends quantities and prices as strings, empty (null) reads as 0
+			static float ToFloat(const std::string& value) {
+				return value.empty() ? 0.0f : std::strtof(value.c_str(), nullptr);
+			}
+
+			static constexpr std::array<std::string_view, 4> ACCOUNT_FIELDS = { "id", "account_number", "cash", "equity" };
+			static constexpr std::array<std::string_view, 5> POSITION_FIELDS = { "symbol", "qty", "avg_entry_price", "current_price", "market_value" };
+			static constexpr std::array<std::string_view, 7> ORDER_FIELDS = { "id", "client_order_id", "symbol", "side", "notional", "qty", "filled_qty" };
+
+			void LimitRequests(const std::string& host)
+			{
+				// Refill rate leaves room for the burst, so no 60s window exceeds REQUESTS_PER_MINUTE.
+				// The ceiling is the budget itself: successes never push the rate past it.
+				const double perSecond = (REQUESTS_PER_MINUTE - REQUEST_BURST) / 60.0;
+				RateGovernor::Get().SetLimits(host, RateGovernor::Limits{
+					.burst = REQUEST_BURST,
+					.initialRate = perSecond,
+					.minRate = 0.5,
+					.maxRate = perSecond
+					});
+			}
 
 			Account::Account(const std::string& endPoint, const std::string& key, const std::string& secret)
 			{
@@ -24,63 +218,171 @@ namespace StockyBoy {
 			{
 				this->Key = key;
 				this->EndPoint = endPoint;
+				this->Host = ConnectionPool::HostOf(endPoint);
 				this->Secret = secret;
 
-				CURL* curl = curl_easy_init();
-				if (!curl) {
+				LimitRequests(Host);
+
+				this->Headers = BuildHeaders(Key, Secret, false);
+				this->JsonHeaders = BuildHeaders(Key, Secret, true);
+
+				return this->Refresh();
+			}
+
+			Result Account::Get(const std::string& path, std::string& out_Response)
+			{
+				if (this->empty() || !Headers) {
+					return Result::Fail("[StockyBoy][Alapaca] Account Wrongly/Not fully initialized");
+				}
+
+				RateGovernor& governor = RateGovernor::Get();
+
+				ConnectionPool::Handle handle = ConnectionPool::Get().Acquire(Host);
+				if (!handle) {
 					return Result::Fail("[StockyBoy][Alapaca] Failed to init Curl");
 				}
 
-				struct curl_slist* headers = nullptr;
-				headers = curl_slist_append(headers, ("APCA-API-KEY-ID: " + Key).c_str());
-				headers = curl_slist_append(headers, ("APCA-API-SECRET-KEY: " + Secret).c_str());
-				headers = curl_slist_append(headers, "accept: application/json");
+				CURL* curl = handle.get();
 
-				auto cleanup = [&]() {
-					curl_slist_free_all(headers);
-					curl_easy_cleanup(curl);
-					};
+				const std::string url = EndPoint + path;
 
-				std::string response;
-				curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-				curl_easy_setopt(curl, CURLOPT_URL, (EndPoint + "/account").c_str());
+				out_Response.clear();
+				curl_easy_setopt(curl, CURLOPT_HTTPHEADER, Headers.get());
+				curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
 				curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-				curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+				curl_easy_setopt(curl, CURLOPT_WRITEDATA, &out_Response);
 				curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L); // 10-second timeout
 
+				governor.Acquire(Host);
+
+				Result result = Result::Ok();
+				std::chrono::milliseconds retryAfter{ 0 };
+
 				CURLcode res = curl_easy_perform(curl);
 				if (res != CURLE_OK) {
-					cleanup();
-					return Result::Fail("[StockyBoy][Alpaca] request failed: Curl error Code " + std::to_string(res));
+					result = Result::Fail("[StockyBoy][Alpaca] request failed: Curl error Code " + std::to_string(res), ErrorKind::NETWORK);
+				}
+				else {
+					long httpCode = 0;
+					curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
+					if (httpCode != 200) {
+						result = Result::Fail("[StockyBoy][Alpaca] HTTP error code: " + std::to_string(httpCode) + " for " + path, HttpErrorKind(httpCode));
+
+						curl_off_t seconds = 0;
+						if (curl_easy_getinfo(curl, CURLINFO_RETRY_AFTER, &seconds) == CURLE_OK && seconds > 0) {
+							retryAfter = std::chrono::seconds(seconds);
+						}
+					}
 				}
 
-				long httpCode = 0;
-				curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
-				if (httpCode != 200) {
-					cleanup();
-					return Result::Fail("[StockyBoy][Alpaca] HTTP error code: " + std::to_string(httpCode));
+				governor.OnResult(Host, result, retryAfter);
+				return result;
+			}
+
+			Result Account::Refresh()
+			{
+				std::string response;
+				response.reserve(2048);
+
+				Result result = this->Get("/account", response);
+				if (!result.succeeded) {
+					return result;
 				}
 
-				try {
-					nlohmann::json j = nlohmann::json::parse(response);
+				FieldsSaxHandler handler(ACCOUNT_FIELDS, 1);
+				result = ParseFields(response, handler);
+				if (!result.succeeded) {
+					return result;
+				}
 
-					this->details = AlpacaAccountDetails{
-						.uuid = j.at("id").get<std::string>(),
-						.accountNumber = j.at("account_number").get<std::string>(),
-						.cashBalance = std::stof(j.at("cash").get<std::string>()),
-						.portfolioValue = std::stof(j.at("equity").get<std::string>())
-					};
+				if (handler.rows != 1 || handler.at(0, 0).empty() || handler.at(0, 1).empty() || handler.at(0, 2).empty() || handler.at(0, 3).empty()) {
+					return Result::Fail("[StockyBoy][Alpaca] Account response is missing id, account_number, cash or equity");
 				}
-				catch (const std::exception& ex) {
-					cleanup();
-					return Result::Fail("Failed to parse JSON: " + std::string(ex.what()));
+
+				char* cashEnd = nullptr;
+				char* equityEnd = nullptr;
+				const std::string& cash = handler.at(0, 2);
+				const std::string& equity = handler.at(0, 3);
+				const float cashBalance = std::strtof(cash.c_str(), &cashEnd);
+				const float portfolioValue = std::strtof(equity.c_str(), &equityEnd);
+				if (cashEnd == cash.c_str() || equityEnd == equity.c_str()) {
+					return Result::Fail("[StockyBoy][Alpaca] Can't read cash/equity: " + cash + " / " + equity);
 				}
 
-				cleanup();
+				this->details = AlpacaAccountDetails{
+					.uuid = handler.at(0, 0),
+					.accountNumber = handler.at(0, 1),
+					.cashBalance = cashBalance,
+					.portfolioValue = portfolioValue
+				};
 
 				return Result::Ok(); // everything went fine
 			}
 
+			Result Account::GetPositions(std::vector<Position>& out_Positions)
+			{
+				std::string response;
+				Result result = this->Get("/positions", response);
+				if (!result.succeeded) {
+					return result;
+				}
+
+				FieldsSaxHandler handler(POSITION_FIELDS, 2);
+				result = ParseFields(response, handler);
+				if (!result.succeeded) {
+					return result;
+				}
+
+				out_Positions.clear();
+				out_Positions.reserve(handler.rows);
+				for (size_t row = 0; row < handler.rows; ++row) {
+					if (handler.at(row, 0).empty()) continue;
+
+					out_Positions.push_back(Position{
+						.symbol = handler.at(row, 0),
+						.qty = ToFloat(handler.at(row, 1)),
+						.qtyText = handler.at(row, 1),
+						.avgEntryPrice = ToFloat(handler.at(row, 2)),
+						.currentPrice = ToFloat(handler.at(row, 3)),
+						.marketValue = ToFloat(handler.at(row, 4))
+						});
+				}
+
+				return Result::Ok();
+			}
+
+			Result Account::GetOpenOrders(std::vector<OpenOrder>& out_Orders)
+			{
+				std::string response;
+				Result result = this->Get("/orders?status=open&limit=500", response);
+				if (!result.succeeded) {
+					return result;
+				}
+
+				FieldsSaxHandler handler(ORDER_FIELDS, 2);
+				result = ParseFields(response, handler);
+				if (!result.succeeded) {
+					return result;
+				}
+
+				out_Orders.clear();
+				out_Orders.reserve(handler.rows);
+				for (size_t row = 0; row < handler.rows; ++row) {
+					if (handler.at(row, 0).empty()) continue;
+
+					out_Orders.push_back(OpenOrder{
+						.id = handler.at(row, 0),
+						.clientOrderId = handler.at(row, 1),
+						.symbol = handler.at(row, 2),
+						.action = (handler.at(row, 3) == "sell") ? Action::SELL : Action::BUY,
+						.notional = ToFloat(handler.at(row, 4)),
+						.qty = ToFloat(handler.at(row, 5)),
+						.filledQty = ToFloat(handler.at(row, 6))
+						});
+				}
+
+				return Result::Ok();
+			}
 
 			Result Account::Load(ACCOUNTS account)
 			{
@@ -133,64 +435,109 @@ namespace StockyBoy {
 
 			Result Account::SubmitOrder(Order order)
 			{
-				if (this->empty()) {
-					return Result::Fail("[StockyBoy][Alapaca] Account Wrongly/Not fully initialized");
+				return SubmitOrders(std::span<const Order>(&order, 1)).front();
+			}
+
+			std::vector<Result> Account::SubmitOrders(std::span<const Order> orders)
+			{
+				std::vector<Result> results(orders.size());
+
+				auto failAll = [&](const std::string& error) {
+					for (Result& result : results) {
+						result = Result::Fail(error);
+					}
+					return results;
+					};
+
+				if (this->empty() || !JsonHeaders) {
+					return failAll("[StockyBoy][Alapaca] Account Wrongly/Not fully initialized");
 				}
 
-				CURL* curl = curl_easy_init();
-				if (!curl) {
-					return Result::Fail("[StockyBoy][Alapaca] Failed to init Curl");
+				if (orders.empty()) {
+					return results;
 				}
 
-				struct curl_slist* headers = nullptr;
-				headers = curl_slist_append(headers, ("APCA-API-KEY-ID: " + Key).c_str());
-				headers = curl_slist_append(headers, ("APCA-API-SECRET-KEY: " + Secret).c_str());
-				headers = curl_slist_append(headers, "accept: application/json");
-				headers = curl_slist_append(headers, "content-type: application/json");
+				RateGovernor& governor = RateGovernor::Get();
 
-				auto cleanup = [&]() {
-					curl_slist_free_all(headers);
-					curl_easy_cleanup(curl);
-					};
+				ConnectionPool::Handle handle = ConnectionPool::Get().Acquire(Host);
+				if (!handle) {
+					return failAll("[StockyBoy][Alapaca] Failed to init Curl");
+				}
+
+				CURL* curl = handle.get();
 
-				// Build JSON body
-				std::string body = "{";
-				body += "\"type\":\"" + std::string(order.type == OrderType::MARKET ? "market" : "limit") + "\",";
-				body += "\"time_in_force\":\"day\",";
-				body += "\"symbol\":\"" + order.label + "\",";
-				body += "\"notional\":\"" + std::to_string(order.value) + "\",";
-				body += "\"side\":\"" + std::string(order.action == Action::BUY ? "buy" : "sell") + "\"";
-				body += "}";
+				const std::string url = EndPoint + "/orders";
 
+				// Reused for every order, so after the first one nothing is allocated per request
+				std::string body;
 				std::string response;
+				body.reserve(256);
+				response.reserve(2048);
 
-				curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
-				curl_easy_setopt(curl, CURLOPT_URL, (EndPoint + "/orders").c_str());
+				curl_easy_setopt(curl, CURLOPT_HTTPHEADER, JsonHeaders.get());
+				curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
 				curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
 				curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
 				curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);
 
 				// POST setup
 				curl_easy_setopt(curl, CURLOPT_POST, 1L);
-				curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body.c_str());
 
-				CURLcode res = curl_easy_perform(curl);
-				if (res != CURLE_OK) {
-					cleanup();
-					return Result::Fail("[StockyBoy][Alpaca] Curl error: " + std::string(curl_easy_strerror(res)));
-				}
-
-				long httpCode = 0;
-				curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
-
-				if (httpCode < 200 || httpCode >= 300) {
-					cleanup();
-					return Result::Fail("[StockyBoy][Alpaca] HTTP error " + std::to_string(httpCode) +
-						" | Response: " + response);
+				for (size_t i = 0; i < orders.size(); ++i) {
+					const Order& order = orders[i];
+					Result& result = results[i];
+
+					SerializeOrder(order, body);
+					curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body.c_str());
+					curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, static_cast<long>(body.size()));
+
+					// Without a client order id a retry could place the order twice
+					const uint32_t attempts = order.clientOrderId.empty() ? 1 : ORDER_RETRY.maxAttempts;
+					for (uint32_t attempt = 0; ; ++attempt) {
+						response.clear();
+						governor.Acquire(Host);
+
+						std::chrono::milliseconds retryAfter{ 0 };
+
+						CURLcode res = curl_easy_perform(curl);
+						if (res != CURLE_OK) {
+							result = Result::Fail("[StockyBoy][Alpaca] Curl error: " + std::string(curl_easy_strerror(res)), ErrorKind::NETWORK);
+						}
+						else {
+							long httpCode = 0;
+							curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
+
+							if (httpCode >= 200 && httpCode < 300) {
+								result = Result::Ok();
+							}
+							else if (attempt > 0 && IsDuplicateClientOrderId(httpCode, response)) {
+								result = Result::Ok(); // the attempt that timed out did go through
+							}
+							else {
+								result = Result::Fail("[StockyBoy][Alpaca] HTTP error " + std::to_string(httpCode) +
+									" | Response: " + response, HttpErrorKind(httpCode));
+
+								curl_off_t seconds = 0;
+								if (curl_easy_getinfo(curl, CURLINFO_RETRY_AFTER, &seconds) == CURLE_OK && seconds > 0) {
+									retryAfter = std::chrono::seconds(seconds);
+								}
+							}
+						}
+
+						governor.OnResult(Host, result, retryAfter);
+
+						// A lost connection or a 429 is worth another try, the client order id makes a repeat safe
+						const bool retryable = result.kind == ErrorKind::NETWORK || result.kind == ErrorKind::THROTTLED;
+						if (result.succeeded || !retryable || attempt + 1 >= attempts || RetryAfterTooLong(ORDER_RETRY, retryAfter)) {
+							break;
+						}
+
+						governor.OnRetry(Host);
+						std::this_thread::sleep_for(RetryDelay(ORDER_RETRY, attempt, retryAfter));
+					}
 				}
 
-				cleanup();
-				return Result::Ok();
+				return results;
 			}
 
 			Result Account::GetBalance(float& balance)
@@ -215,6 +562,17 @@ namespace StockyBoy {
 				return Result::Ok();
 			}
 
+			Result Account::GetDetails(AlpacaAccountDetails& out_Details)
+			{
+				if (this->empty()) {
+					return Result::Fail("[StockyBoy][Alapaca] Account Wrongly/Not fully initialized");
+				}
+
+				out_Details = this->details;
+
+				return Result::Ok();
+			}
+
 			Result Account::GetName(std::string& name)
 			{
 				if (this->empty()) {
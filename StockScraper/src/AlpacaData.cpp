@@ -0,0 +1,256 @@
+#include "pch.h"
+
+#include "AlpacaData.hpp"
+#include "WireFormat.hpp"
+#include "ConnectionPool.hpp"
+
+#include <chrono>
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		namespace Alpaca {
+			// Bar/trade time in Unix seconds, -1 when missing or malformed
+			static int64_t JsonTime(const nlohmann::json& object) {
+				auto it = object.find("t");
+				const int64_t epochMs = (it != object.end() && it->is_string()) ? ParseTimestampMs(it->get_ref<const std::string&>()) : -1;
+				return (epochMs < 0) ? -1 : epochMs / 1000;
+			}
+
+			// Appends the bars of one page and hands back its next_page_token (empty on the last page)
+			static Result ParseBarsPage(const std::string& data, StockTable& table, std::string& out_NextPage) {
+				out_NextPage.clear();
+
+				nlohmann::json root = nlohmann::json::parse(data, nullptr, false);
+				if (root.is_discarded() || !root.is_object()) {
+					return Result::Fail("[StockyBoy][Alpaca] Malformed bars response", ErrorKind::INVALID);
+				}
+
+				auto barsIt = root.find("bars");
+				if (barsIt != root.end() && barsIt->is_array()) {
+					for (const nlohmann::json& bar : *barsIt) {
+						if (!bar.is_object()) continue;
+
+						const int64_t epoch = JsonTime(bar);
+						if (epoch < 0) continue;
+
+						table.epochs.push_back(epoch);
+						table.open.push_back(JsonNumber(bar, "o"));
+						table.high.push_back(JsonNumber(bar, "h"));
+						table.low.push_back(JsonNumber(bar, "l"));
+						table.close.push_back(JsonNumber(bar, "c"));
+						table.volume.push_back(JsonNumber(bar, "v"));
+					}
+				}
+
+				auto pageIt = root.find("next_page_token");
+				if (pageIt != root.end() && pageIt->is_string()) {
+					out_NextPage = pageIt->get<std::string>();
+				}
+
+				return Result::Ok();
+			}
+
+			DataProvider::DataProvider(const Account& account, std::string feed, std::string url)
+				: Url(std::move(url)), Feed(std::move(feed))
+			{
+				struct curl_slist* headers = nullptr;
+				headers = curl_slist_append(headers, ("APCA-API-KEY-ID: " + account.Key).c_str());
+				headers = curl_slist_append(headers, ("APCA-API-SECRET-KEY: " + account.Secret).c_str());
+				headers = curl_slist_append(headers, "accept: application/json");
+				Headers = std::shared_ptr<curl_slist>(headers, curl_slist_free_all);
+
+				// Market data counts against the same per-key budget as trading, paced before the first 429 and not after
+				LimitRequests(ConnectionPool::HostOf(Url));
+			}
+
+			bool DataProvider::Timeframe(INTERVAL interval, std::string& out_Timeframe)
+			{
+				switch (interval) {
+				case MINUTES_1:  out_Timeframe = "1Min"; return true;
+				case MINUTES_2:  out_Timeframe = "2Min"; return true;
+				case MINUTES_5:  out_Timeframe = "5Min"; return true;
+				case MINUTES_15: out_Timeframe = "15Min"; return true;
+				case MINUTES_30: out_Timeframe = "30Min"; return true;
+				case MINUTES_60: out_Timeframe = "1Hour"; return true;
+				case DAYS_1:     out_Timeframe = "1Day"; return true;
+				case WEEK_1:     out_Timeframe = "1Week"; return true;
+				case MONTH_1:    out_Timeframe = "1Month"; return true;
+				case MONTH_3:    out_Timeframe = "3Month"; return true;
+				default:         return false;
+				}
+			}
+
+			std::vector<BarResponse> DataProvider::FetchBars(const std::vector<FetchRequest>& requests, size_t maxConcurrent)
+			{
+				std::vector<BarResponse> responses(requests.size());
+
+				const int64_t now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+				// --- First page URL of every request ---
+				std::vector<std::string> baseUrls(requests.size());
+				for (size_t i = 0; i < requests.size(); ++i) {
+					const FetchRequest& request = requests[i];
+
+					std::string timeframe;
+					if (request.label.empty() || !Timeframe(request.interval, timeframe)) {
+						responses[i].result = Result::Fail("[StockyBoy][Alpaca] No bars for " + request.label + " at " + ToString(request.interval), ErrorKind::INVALID);
+						continue;
+					}
+
+					int64_t start = request.period1;
+					int64_t end = request.period2;
+					if (end <= 0) {
+						end = now;
+						if (request.range == RANGE_YTD) {
+							const std::chrono::year_month_day today{ std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now()) };
+							start = std::chrono::sys_seconds{ std::chrono::sys_days{ today.year() / std::chrono::January / 1 } }.time_since_epoch().count();
+						}
+						else {
+							start = (request.range == RANGE_MAX) ? 0 : now - ToSeconds(request.range);
+						}
+					}
+
+					std::string& url = baseUrls[i];
+					url = Url + "/v2/stocks/";
+					AppendEncoded(url, request.label);
+					url += "/bars?timeframe=" + timeframe + "&start=" + FormatTimestamp(start) + "&end=" + FormatTimestamp(end) +
+						"&limit=10000&adjustment=split&feed=" + Feed;
+				}
+
+				// --- Pages, one round of FetchUrls per page depth ---
+				struct Page {
+					size_t index;
+					std::string token;
+				};
+
+				std::vector<Page> pages;
+				for (size_t i = 0; i < requests.size(); ++i) {
+					if (baseUrls[i].empty()) continue;
+
+					responses[i].result = Result::Ok(); // until one of its pages fails
+					pages.push_back(Page{ .index = i, .token = {} });
+				}
+
+				ResponseArena& arena = ResponseArena::ForThread();
+				std::vector<std::string> urls;
+				std::vector<Page> nextPages;
+
+				for (uint32_t round = 0; round < MAX_PAGES && !pages.empty(); ++round) {
+					urls.clear();
+					for (const Page& page : pages) {
+						std::string url = baseUrls[page.index];
+						if (!page.token.empty()) {
+							url += "&page_token=";
+							AppendEncoded(url, page.token);
+						}
+						urls.push_back(std::move(url));
+					}
+
+					std::vector<FetchResponse> downloads = FetchUrls(urls, maxConcurrent, Retry, Headers.get());
+
+					nextPages.clear();
+					for (size_t p = 0; p < pages.size(); ++p) {
+						BarResponse& response = responses[pages[p].index];
+
+						Result result = downloads[p].result;
+						std::string token;
+						if (result.succeeded) {
+							result = ParseBarsPage(downloads[p].data, response.table, token);
+						}
+						arena.Recycle(std::move(downloads[p].data));
+
+						if (!result.succeeded) {
+							response.result = result;
+						}
+						else if (!token.empty()) {
+							nextPages.push_back(Page{ .index = pages[p].index, .token = std::move(token) });
+						}
+					}
+
+					std::swap(pages, nextPages);
+				}
+
+				for (const Page& page : pages) {
+					responses[page.index].result = Result::Fail("[StockyBoy][Alpaca] Too many pages of bars for " + requests[page.index].label, ErrorKind::INVALID);
+				}
+
+				// --- Wrap up: a cold request with no bars at all means the symbol has none ---
+				for (size_t i = 0; i < requests.size(); ++i) {
+					BarResponse& response = responses[i];
+					if (!response.result.succeeded) {
+						response.table = StockTable{};
+						continue;
+					}
+
+					if (response.table.empty() && requests[i].period2 <= 0) {
+						response.result = Result::Fail("[StockyBoy][Alpaca] No bars for " + requests[i].label, ErrorKind::NO_DATA);
+						continue;
+					}
+
+					IndexTimeAxis(response.table);
+				}
+
+				return responses;
+			}
+
+			Result DataProvider::FetchQuotes(std::span<const std::string> symbols, std::vector<Quote>& out_Quotes)
+			{
+				out_Quotes.clear();
+				if (symbols.empty()) {
+					return Result::Ok();
+				}
+
+				std::vector<std::string> urls;
+				for (size_t first = 0; first < symbols.size(); first += QUOTE_BATCH_SIZE) {
+					const size_t last = std::min(symbols.size(), first + QUOTE_BATCH_SIZE);
+
+					std::string url = Url + "/v2/stocks/trades/latest?feed=" + Feed + "&symbols=";
+					for (size_t i = first; i < last; ++i) {
+						if (i > first) url += "%2C";
+						AppendEncoded(url, symbols[i]);
+					}
+					urls.push_back(std::move(url));
+				}
+
+				std::vector<FetchResponse> downloads = FetchUrls(urls, 16, Retry, Headers.get());
+
+				// {"trades":{"AAPL":{"t":"...","p":123.45,...},...}}
+				ResponseArena& arena = ResponseArena::ForThread();
+				Result firstError = Result::Ok();
+				size_t answered = 0;
+
+				for (FetchResponse& download : downloads) {
+					Result result = download.result;
+					if (result.succeeded) {
+						nlohmann::json root = nlohmann::json::parse(download.data, nullptr, false);
+						auto tradesIt = root.is_object() ? root.find("trades") : root.end();
+						if (root.is_discarded() || !root.is_object() || tradesIt == root.end() || !tradesIt->is_object()) {
+							result = Result::Fail("[StockyBoy][Alpaca] Malformed latest trades response", ErrorKind::INVALID);
+						}
+						else {
+							for (auto it = tradesIt->begin(); it != tradesIt->end(); ++it) {
+								if (!it->is_object()) continue;
+
+								const double price = JsonNumber(*it, "p");
+								if (price > 0.0) {
+									out_Quotes.push_back(Quote{ .symbol = it.key(), .price = price, .time = std::max<int64_t>(JsonTime(*it), 0) });
+								}
+							}
+						}
+					}
+					arena.Recycle(std::move(download.data));
+
+					if (result.succeeded) {
+						++answered;
+					}
+					else if (firstError.succeeded) {
+						firstError = result;
+					}
+				}
+
+				return (answered > 0) ? Result::Ok() : firstError;
+			}
+		}
+	}
+}
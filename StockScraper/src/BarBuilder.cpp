@@ -0,0 +1,182 @@
+#include "pch.h"
+
+#include "BarBuilder.hpp"
+
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		// ====================
+		// BarRing
+		// ====================
+
+		BarRing::BarRing(size_t capacity, int64_t seconds)
+			: Bars(std::max<size_t>(capacity, 1)), Seconds(std::max<int64_t>(seconds, 1))
+		{
+		}
+
+		bool BarRing::Add(int64_t epoch, double price, double size)
+		{
+			// Floor, also for epochs before 1970
+			const int64_t start = epoch - ((epoch % Seconds) + Seconds) % Seconds;
+
+			auto update = [&](Bar& bar, bool isLatest) {
+				bar.high = std::max(bar.high, price);
+				bar.low = std::min(bar.low, price);
+				bar.volume += size;
+				if (isLatest) bar.close = price; // a late tick is older than the close we have
+				};
+
+			if (Count > 0) {
+				Bar& newest = At(Count - 1);
+				if (start == newest.epoch) {
+					update(newest, true);
+					return true;
+				}
+
+				if (start < newest.epoch) {
+					for (size_t i = Count - 1; i-- > 0;) {
+						Bar& bar = At(i);
+						if (bar.epoch == start) {
+							update(bar, false);
+							return true;
+						}
+						if (bar.epoch < start) break;
+					}
+					return false;
+				}
+			}
+
+			if (Count < Bars.size()) {
+				++Count;
+			}
+			else {
+				Head = (Head + 1) % Bars.size();
+			}
+
+			At(Count - 1) = Bar{ .epoch = start, .open = price, .high = price, .low = price, .close = price, .volume = size };
+			return true;
+		}
+
+		// ====================
+		// BarBuilder
+		// ====================
+
+		BarBuilder::BarBuilder(size_t capacity) : Capacity(capacity)
+		{
+		}
+
+		int BarBuilder::IntervalSlot(INTERVAL interval)
+		{
+			for (size_t i = 0; i < INTERVALS.size(); ++i) {
+				if (INTERVALS[i] == interval) return static_cast<int>(i);
+			}
+			return -1;
+		}
+
+		void BarBuilder::Track(const std::string& symbol)
+		{
+			std::lock_guard<std::mutex> lock(Mutex);
+			if (Symbols.contains(symbol)) return;
+
+			Symbols.emplace(symbol, std::make_unique<Series>(Series{ .rings = {
+				BarRing(Capacity, ToSeconds(INTERVALS[0])),
+				BarRing(Capacity, ToSeconds(INTERVALS[1]))
+			} }));
+		}
+
+		bool BarBuilder::Tracks(std::string_view symbol) const
+		{
+			std::lock_guard<std::mutex> lock(Mutex);
+			return Symbols.find(symbol) != Symbols.end();
+		}
+
+		std::vector<std::string> BarBuilder::symbols() const
+		{
+			std::lock_guard<std::mutex> lock(Mutex);
+
+			std::vector<std::string> out;
+			out.reserve(Symbols.size());
+			for (const auto& [symbol, series] : Symbols) {
+				out.push_back(symbol);
+			}
+			return out;
+		}
+
+		bool BarBuilder::OnTick(std::string_view symbol, int64_t epochMs, double price, double size)
+		{
+			if (!(price > 0.0)) return false;
+
+			// Floor to seconds
+			const int64_t epoch = (epochMs >= 0) ? epochMs / 1000 : -((-epochMs + 999) / 1000);
+
+			bool added = false;
+			{
+				std::lock_guard<std::mutex> lock(Mutex);
+				auto it = Symbols.find(symbol);
+				if (it == Symbols.end()) return false;
+
+				for (BarRing& ring : it->second->rings) {
+					added |= ring.Add(epoch, price, size);
+				}
+			}
+
+			if (added) {
+				Version.fetch_add(1, std::memory_order_release);
+			}
+			return added;
+		}
+
+		Result BarBuilder::Snapshot(std::string_view symbol, INTERVAL interval, StockTable& out) const
+		{
+			const int slot = IntervalSlot(interval);
+			if (slot < 0) {
+				return Result::Fail("[StockyBoy][BarBuilder] Live bars are 1m or 5m, not " + ToString(interval));
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(Mutex);
+				auto it = Symbols.find(symbol);
+				if (it == Symbols.end()) {
+					return Result::Fail("[StockyBoy][BarBuilder] Not tracking " + std::string(symbol));
+				}
+
+				const BarRing& ring = it->second->rings[slot];
+				const size_t count = ring.size();
+
+				out.epochs.resize(count);
+				out.open.resize(count);
+				out.high.resize(count);
+				out.low.resize(count);
+				out.close.resize(count);
+				out.volume.resize(count);
+
+				for (size_t i = 0; i < count; ++i) {
+					const Bar& bar = ring[i];
+					out.epochs[i] = bar.epoch;
+					out.open[i] = bar.open;
+					out.high[i] = bar.high;
+					out.low[i] = bar.low;
+					out.close[i] = bar.close;
+					out.volume[i] = bar.volume;
+				}
+			}
+
+			IndexTimeAxis(out);
+			return Result::Ok();
+		}
+
+		bool BarBuilder::Latest(std::string_view symbol, INTERVAL interval, Bar& out_Bar) const
+		{
+			const int slot = IntervalSlot(interval);
+			if (slot < 0) return false;
+
+			std::lock_guard<std::mutex> lock(Mutex);
+			auto it = Symbols.find(symbol);
+			if (it == Symbols.end() || it->second->rings[slot].size() == 0) return false;
+
+			out_Bar = it->second->rings[slot].back();
+			return true;
+		}
+	}
+}
@@ -0,0 +1,267 @@
+#include "pch.h"
+
+#include "BarCache.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		// File layout: header, then `rows` epochs (int64) followed by the open/high/low/close/volume columns.
+		// Every column is 8-byte wide and starts 8-byte aligned, so a mapping can be read in place.
+		static constexpr char BAR_CACHE_MAGIC[4] = { 'S', 'B', 'B', 'C' };
+		static constexpr uint32_t BAR_CACHE_VERSION = 2;
+
+		struct BarCacheHeader {
+			char magic[4];
+			uint32_t version;
+			uint32_t interval;
+			uint32_t valueBytes; // width of the OHLCV values, sizeof(double)
+			uint64_t rows;
+		};
+		static_assert(sizeof(BarCacheHeader) % alignof(double) == 0);
+
+		static std::string SanitizeFileName(const std::string& label) {
+			std::string out;
+			out.reserve(label.size());
+
+			for (unsigned char c : label) {
+				out.push_back((std::isalnum(c) || c == '.' || c == '-') ? static_cast<char>(c) : '_');
+			}
+
+			return out;
+		}
+
+		template <typename T>
+		static std::span<const T> NextColumn(const std::byte*& cursor, size_t rows) {
+			std::span<const T> column(reinterpret_cast<const T*>(cursor), rows);
+			cursor += rows * sizeof(T);
+			return column;
+		}
+
+		BarCache::BarCache(const std::filesystem::path& directory)
+			: Directory(directory)
+		{
+		}
+
+		BarCache::BarCache(const std::filesystem::path& directory, MarketDataProvider& provider)
+			: Directory(directory), Provider(&provider)
+		{
+		}
+
+		std::filesystem::path BarCache::directory() const
+		{
+			return Directory / provider().name();
+		}
+
+		std::filesystem::path BarCache::PathFor(const std::string& label, INTERVAL interval) const
+		{
+			return directory() / (SanitizeFileName(label) + "_" + ToString(interval) + ".bars");
+		}
+
+		Result BarCache::Map(const std::string& label, INTERVAL interval, MappedBars& out_Bars) const
+		{
+			const std::filesystem::path path = PathFor(label, interval);
+
+			MappedFile file;
+			Result result = file.Open(path);
+			if (!result.succeeded) {
+				return Result::Fail("[StockyBoy][BarCache] No cached bars for: " + label);
+			}
+
+			if (file.size() < sizeof(BarCacheHeader)) {
+				return Result::Fail("[StockyBoy][BarCache] Invalid cache file: " + path.string());
+			}
+
+			BarCacheHeader header{};
+			std::memcpy(&header, file.data(), sizeof(header));
+
+			if (!std::equal(std::begin(BAR_CACHE_MAGIC), std::end(BAR_CACHE_MAGIC), header.magic) ||
+				header.version != BAR_CACHE_VERSION ||
+				header.interval != static_cast<uint32_t>(interval) ||
+				header.valueBytes != sizeof(double)) {
+				return Result::Fail("[StockyBoy][BarCache] Invalid cache file: " + path.string());
+			}
+
+			const uint64_t expectedSize = sizeof(header) + header.rows * (sizeof(int64_t) + 5 * sizeof(double));
+			if (file.size() != expectedSize) {
+				return Result::Fail("[StockyBoy][BarCache] Truncated cache file: " + path.string());
+			}
+
+			const size_t rowNum = static_cast<size_t>(header.rows);
+			const std::byte* cursor = file.data() + sizeof(header);
+
+			out_Bars.Bars.epochs = NextColumn<int64_t>(cursor, rowNum);
+			out_Bars.Bars.open = NextColumn<double>(cursor, rowNum);
+			out_Bars.Bars.high = NextColumn<double>(cursor, rowNum);
+			out_Bars.Bars.low = NextColumn<double>(cursor, rowNum);
+			out_Bars.Bars.close = NextColumn<double>(cursor, rowNum);
+			out_Bars.Bars.volume = NextColumn<double>(cursor, rowNum);
+			out_Bars.File = std::move(file);
+
+			return Result::Ok();
+		}
+
+		Result BarCache::Load(const std::string& label, INTERVAL interval, StockTable& out_Table) const
+		{
+			MappedBars mapped;
+			Result result = Map(label, interval, mapped);
+			if (!result.succeeded) {
+				return result;
+			}
+
+			const StockTableView& bars = mapped.view();
+
+			StockTable table;
+			table.epochs.assign(bars.epochs.begin(), bars.epochs.end());
+			table.open.assign(bars.open.begin(), bars.open.end());
+			table.high.assign(bars.high.begin(), bars.high.end());
+			table.low.assign(bars.low.begin(), bars.low.end());
+			table.close.assign(bars.close.begin(), bars.close.end());
+			table.volume.assign(bars.volume.begin(), bars.volume.end());
+
+			IndexTimeAxis(table);
+
+			out_Table = std::move(table);
+
+			return Result::Ok();
+		}
+
+		Result BarCache::Store(const std::string& label, INTERVAL interval, const StockTable& table) const
+		{
+			std::error_code ec;
+			std::filesystem::create_directories(directory(), ec);
+			if (ec) {
+				return Result::Fail("[StockyBoy][BarCache] Can't create cache directory: " + directory().string());
+			}
+
+			const std::filesystem::path path = PathFor(label, interval);
+			std::filesystem::path tempPath = path;
+			tempPath += ".tmp";
+
+			{
+				std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+				if (!file) {
+					return Result::Fail("[StockyBoy][BarCache] Can't write cache file: " + tempPath.string());
+				}
+
+				BarCacheHeader header{};
+				std::copy(std::begin(BAR_CACHE_MAGIC), std::end(BAR_CACHE_MAGIC), header.magic);
+				header.version = BAR_CACHE_VERSION;
+				header.interval = static_cast<uint32_t>(interval);
+				header.valueBytes = sizeof(double);
+				header.rows = table.epochs.size();
+
+				auto writeColumn = [&](const auto& column) {
+					file.write(reinterpret_cast<const char*>(column.data()), header.rows * sizeof(column[0]));
+					};
+
+				file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+				writeColumn(table.epochs);
+				writeColumn(table.open);
+				writeColumn(table.high);
+				writeColumn(table.low);
+				writeColumn(table.close);
+				writeColumn(table.volume);
+
+				if (!file) {
+					return Result::Fail("[StockyBoy][BarCache] Failed writing cache file: " + tempPath.string());
+				}
+			}
+
+			// Swap the new file in so readers never see a half-written one
+			if (!SwapInTempFile(tempPath, path)) {
+				return Result::Fail("[StockyBoy][BarCache] Can't replace cache file: " + path.string());
+			}
+
+			return Result::Ok();
+		}
+
+		FetchRequest BarCache::RefreshRequest(const std::string& label, INTERVAL interval, RANGE coldRange, const StockTable& cached) const
+		{
+			if (cached.epochs.empty()) {
+				return FetchRequest{ .label = label, .interval = interval, .range = coldRange };
+			}
+
+			const int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+				std::chrono::system_clock::now().time_since_epoch()).count();
+
+			// Start one bar early: the last cached bar may be stamped mid-bar if it was still forming
+			const int64_t period1 = cached.epochs.back() - ToSeconds(interval);
+
+			return FetchRequest{
+				.label = label,
+				.interval = interval,
+				.range = coldRange,
+				.period1 = period1,
+				.period2 = std::max(now, period1 + 1)
+			};
+		}
+
+		Result BarCache::Update(const std::string& label, INTERVAL interval, StockTable& cached, const std::string& freshData) const
+		{
+			StockTable fresh;
+			Result result = getStockTable(freshData, fresh);
+			if (!result.succeeded) {
+				return result;
+			}
+
+			return Update(label, interval, cached, fresh);
+		}
+
+		Result BarCache::Update(const std::string& label, INTERVAL interval, StockTable& cached, const StockTable& fresh) const
+		{
+			Merge(cached, fresh, interval);
+
+			return Store(label, interval, cached);
+		}
+
+		Result BarCache::Refresh(const std::string& label, INTERVAL interval, RANGE coldRange, StockTable& out_Table) const
+		{
+			StockTable cached;
+			this->Load(label, interval, cached); // cold start if missing or unreadable
+
+			const FetchRequest request = RefreshRequest(label, interval, coldRange, cached);
+
+			StockTable fresh;
+			Result result = provider().FetchBars(request, fresh);
+			if (!result.succeeded) {
+				out_Table = std::move(cached); // possibly stale, the failure says so
+				return result;
+			}
+
+			Merge(cached, fresh, interval);
+			Store(label, interval, cached); // an unwritable cache only makes the next refresh download more
+
+			out_Table = std::move(cached);
+			return Result::Ok();
+		}
+
+		void BarCache::Merge(StockTable& cached, const StockTable& fresh, INTERVAL interval)
+		{
+			if (fresh.epochs.empty()) {
+				return;
+			}
+
+			// Any cached bar less than one interval before the first fresh bar is the same bar (or a partial of it)
+			const int64_t cutoff = fresh.epochs.front() - ToSeconds(interval);
+			const size_t keep = static_cast<size_t>(
+				std::upper_bound(cached.epochs.begin(), cached.epochs.end(), cutoff) - cached.epochs.begin());
+
+			auto splice = [keep](auto& dst, const auto& src) {
+				dst.resize(keep);
+				dst.insert(dst.end(), src.begin(), src.end());
+				};
+
+			splice(cached.open, fresh.open);
+			splice(cached.high, fresh.high);
+			splice(cached.low, fresh.low);
+			splice(cached.close, fresh.close);
+			splice(cached.volume, fresh.volume);
+			splice(cached.epochs, fresh.epochs);
+
+			IndexTimeAxis(cached);
+		}
+	}
+}
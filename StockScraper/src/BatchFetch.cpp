@@ -0,0 +1,312 @@
+#include "pch.h"
+
+#include "BatchFetch.hpp"
+#include "Fetch.hpp"
+#include "RateLimiter.hpp"
+#include "ConnectionPool.hpp"
+
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <unordered_map>
+
+namespace StockyBoy {
+    namespace Scraper {
+        // Downloads urls[i] into responses[i]. Responses that already hold an error (a URL that couldn't be built) are skipped.
+        static void TransferAll(const std::vector<std::string>& urls, std::vector<FetchResponse>& responses, size_t maxConcurrent, const RetryPolicy& retry, curl_slist* headers)
+        {
+            using Clock = RateGovernor::Clock;
+
+            if (urls.empty()) {
+                return;
+            }
+
+            if (maxConcurrent == 0) {
+                maxConcurrent = 1;
+            }
+
+            CURLM* multi = curl_multi_init();
+            if (!multi) {
+                for (FetchResponse& response : responses) {
+                    if (response.result.error.empty()) {
+                        response.result = Result::Fail("[StockyBoy][FetchBatch] Failed to initialize CURL multi handle");
+                    }
+                }
+                return;
+            }
+
+            // Keep the connection count in line with the concurrency cap so handles queue instead of opening new sockets
+            curl_multi_setopt(multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, static_cast<long>(maxConcurrent));
+            curl_multi_setopt(multi, CURLMOPT_MAX_HOST_CONNECTIONS, static_cast<long>(maxConcurrent));
+            curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+
+            // Handles are leased from the shared pool and recycled between transfers, so connections stay warm
+            // for the next batch and for Fetch calls on other threads
+            ConnectionPool& pool = ConnectionPool::Get();
+            std::vector<ConnectionPool::Handle> leases;
+            std::vector<CURL*> idleHandles;
+
+            RateGovernor& governor = RateGovernor::Get();
+
+            auto cleanup = [&]() {
+                for (const ConnectionPool::Handle& lease : leases) {
+                    curl_multi_remove_handle(multi, lease.get());
+                }
+                curl_multi_cleanup(multi);
+                leases.clear();
+                };
+
+            std::vector<std::string> hosts(urls.size());
+            std::vector<uint32_t> attempts(urls.size(), 0);
+            std::vector<ResponseSink> sinks(urls.size());
+            ResponseArena& arena = ResponseArena::ForThread();
+
+            // Requests waiting for their (first or next) attempt, by index
+            struct Pending {
+                size_t index;
+                Clock::time_point notBefore;
+            };
+            std::vector<Pending> retries;
+
+            // Hosts that asked for a longer pause than the policy waits: the rest of their requests fail with the same answer
+            std::unordered_map<std::string, Result> refused;
+
+            size_t next = 0;
+            size_t active = 0;
+            size_t remaining = 0;
+
+            for (size_t i = 0; i < urls.size(); ++i) {
+                if (responses[i].result.error.empty()) {
+                    hosts[i] = ConnectionPool::HostOf(urls[i]);
+                    ++remaining;
+                }
+            }
+
+            // --- Queue one attempt, returns false if no transfer was started ---
+            auto startTransfer = [&](size_t index) -> bool {
+                FetchResponse& response = responses[index];
+                if (response.data.capacity() == 0) {
+                    response.data = arena.Acquire();
+                }
+                response.data.clear();
+                sinks[index] = ResponseSink{ .out = &response.data };
+
+                CURL* curl = nullptr;
+                if (!idleHandles.empty()) {
+                    curl = idleHandles.back();
+                    idleHandles.pop_back();
+                    curl_easy_reset(curl);
+                    pool.Configure(curl);
+                }
+                else {
+                    ConnectionPool::Handle lease = pool.Acquire(hosts[index]);
+                    if (!lease) {
+                        response.result = Result::Fail("[StockyBoy][FetchBatch] Failed to initialize CURL");
+                        return false;
+                    }
+                    curl = lease.get();
+                    leases.push_back(std::move(lease));
+                }
+
+                curl_easy_setopt(curl, CURLOPT_URL, urls[index].c_str());
+                curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, SinkWriteCallback);
+                curl_easy_setopt(curl, CURLOPT_WRITEDATA, &sinks[index]);
+                curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, SinkHeaderCallback);
+                curl_easy_setopt(curl, CURLOPT_HEADERDATA, &sinks[index]);
+                curl_easy_setopt(curl, CURLOPT_PRIVATE, reinterpret_cast<void*>(index));
+                curl_easy_setopt(curl, CURLOPT_USERAGENT, "Mozilla/5.0");
+                curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 5L);
+                curl_easy_setopt(curl, CURLOPT_TIMEOUT, 60L);
+                curl_easy_setopt(curl, CURLOPT_LOW_SPEED_LIMIT, 1024L);
+                curl_easy_setopt(curl, CURLOPT_LOW_SPEED_TIME, 10L);
+                curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+                if (headers) {
+                    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+                }
+
+                CURLMcode code = curl_multi_add_handle(multi, curl);
+                if (code != CURLM_OK) {
+                    idleHandles.push_back(curl);
+                    response.result = Result::Fail("[StockyBoy][FetchBatch] Failed to queue transfer: " + std::string(curl_multi_strerror(code)));
+                    return false;
+                }
+
+                ++attempts[index];
+                ++active;
+                return true;
+                };
+
+            while (remaining > 0) {
+                // --- Top up the in-flight window: due retries first, then new requests, as fast as the governor allows ---
+                Clock::time_point now = Clock::now();
+                Clock::duration wait = std::chrono::seconds(1);
+
+                while (active < maxConcurrent) {
+                    while (next < urls.size() && hosts[next].empty()) {
+                        ++next; // failed while building its URL
+                    }
+                    auto due = std::find_if(retries.begin(), retries.end(), [&](const Pending& pending) { return pending.notBefore <= now; });
+
+                    size_t index;
+                    if (due != retries.end()) index = due->index;
+                    else if (next < urls.size()) index = next;
+                    else break;
+
+                    auto refusal = refused.find(hosts[index]);
+                    if (refusal != refused.end()) {
+                        if (due != retries.end()) retries.erase(due);
+                        else ++next;
+
+                        responses[index].result = refusal->second;
+                        --remaining;
+                        continue;
+                    }
+
+                    Clock::duration hostWait;
+                    if (!governor.TryAcquire(hosts[index], hostWait)) {
+                        wait = std::min(wait, hostWait);
+                        break;
+                    }
+
+                    if (due != retries.end()) retries.erase(due);
+                    else ++next;
+
+                    if (!startTransfer(index)) {
+                        --remaining;
+                    }
+                }
+
+                for (const Pending& pending : retries) {
+                    wait = std::min(wait, std::max<Clock::duration>(pending.notBefore - now, Clock::duration::zero()));
+                }
+
+                if (active == 0) {
+                    if (remaining > 0) {
+                        std::this_thread::sleep_for(std::max<Clock::duration>(wait, std::chrono::milliseconds(1)));
+                    }
+                    continue;
+                }
+
+                int stillRunning = 0;
+                CURLMcode code = curl_multi_perform(multi, &stillRunning);
+                if (code != CURLM_OK) {
+                    const Result error = Result::Fail("[StockyBoy][FetchBatch] CURL multi failed: " + std::string(curl_multi_strerror(code)), ErrorKind::NETWORK);
+                    // Anything neither finished nor rejected up front is still pending
+                    for (FetchResponse& response : responses) {
+                        if (!response.result.succeeded && response.result.error.empty()) {
+                            response.result = error;
+                        }
+                    }
+                    cleanup();
+                    return;
+                }
+
+                // --- Collect finished transfers ---
+                int queued = 0;
+                while (CURLMsg* msg = curl_multi_info_read(multi, &queued)) {
+                    if (msg->msg != CURLMSG_DONE) {
+                        continue;
+                    }
+
+                    CURL* curl = msg->easy_handle;
+
+                    char* privateData = nullptr;
+                    curl_easy_getinfo(curl, CURLINFO_PRIVATE, &privateData);
+                    const size_t index = reinterpret_cast<size_t>(privateData);
+                    FetchResponse& response = responses[index];
+
+                    std::chrono::milliseconds retryAfter{ 0 };
+                    if (msg->data.result != CURLE_OK) {
+                        response.result = Result::Fail("[StockyBoy][FetchBatch] CURL request failed: " + std::string(curl_easy_strerror(msg->data.result)), ErrorKind::NETWORK);
+                    }
+                    else {
+                        long httpCode = 0;
+                        curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
+                        if (httpCode != 200) {
+                            response.result = Result::Fail("[StockyBoy][FetchBatch] HTTP error code: " + std::to_string(httpCode), HttpErrorKind(httpCode));
+
+                            curl_off_t seconds = 0;
+                            if (curl_easy_getinfo(curl, CURLINFO_RETRY_AFTER, &seconds) == CURLE_OK && seconds > 0) {
+                                retryAfter = std::chrono::seconds(seconds);
+                            }
+                        }
+                        else {
+                            response.result = Result::Ok();
+                        }
+                    }
+
+                    curl_multi_remove_handle(multi, curl);
+                    idleHandles.push_back(curl);
+                    --active;
+
+                    // The host pauses no longer than the policy would wait either
+                    governor.OnResult(hosts[index], response.result, std::min(retryAfter, retry.maxDelay));
+
+                    if (!response.result.succeeded && RetryAfterTooLong(retry, retryAfter)) {
+                        response.result = Result::Fail(response.result.error + ", retry after " + std::to_string(retryAfter.count() / 1000) + "s", ErrorKind::THROTTLED);
+                        refused.emplace(hosts[index], response.result);
+                        --remaining;
+
+                        // Retries already waiting on that host won't get a better answer
+                        std::erase_if(retries, [&](const Pending& pending) {
+                            if (hosts[pending.index] != hosts[index]) return false;
+                            responses[pending.index].result = response.result;
+                            --remaining;
+                            return true;
+                            });
+                        continue;
+                    }
+
+                    // --- Retry transient failures later, the slot goes to the next request meanwhile ---
+                    if (!response.result.succeeded && IsRetryable(response.result.kind) && attempts[index] < retry.maxAttempts) {
+                        governor.OnRetry(hosts[index]);
+                        retries.push_back(Pending{ .index = index, .notBefore = Clock::now() + RetryDelay(retry, attempts[index] - 1, retryAfter) });
+                        continue;
+                    }
+
+                    --remaining;
+                }
+
+                if (active > 0 && stillRunning > 0) {
+                    const auto pollMs = std::chrono::duration_cast<std::chrono::milliseconds>(wait).count();
+                    curl_multi_poll(multi, nullptr, 0, static_cast<int>(std::clamp<int64_t>(pollMs, 1, 1000)), nullptr);
+                }
+            }
+
+            cleanup();
+        }
+
+        std::vector<FetchResponse> FetchBatch(const std::vector<FetchRequest>& requests, size_t maxConcurrent, const RetryPolicy& retry)
+        {
+            std::vector<FetchResponse> responses(requests.size());
+            std::vector<std::string> urls(requests.size());
+
+            // --- Build every URL up front, a request that can't be built fails right away ---
+            for (size_t i = 0; i < requests.size(); ++i) {
+                const FetchRequest& request = requests[i];
+                const Result built = (request.period2 > 0)
+                    ? GetChartURL(request.label, request.interval, request.period1, request.period2, urls[i])
+                    : GetChartURL(request.label, request.interval, request.range, urls[i]);
+                if (!built.succeeded) {
+                    responses[i].result = built;
+                }
+            }
+
+            TransferAll(urls, responses, maxConcurrent, retry, nullptr);
+            return responses;
+        }
+
+        std::vector<FetchResponse> FetchUrls(const std::vector<std::string>& urls, size_t maxConcurrent, const RetryPolicy& retry, curl_slist* headers)
+        {
+            std::vector<FetchResponse> responses(urls.size());
+            for (size_t i = 0; i < urls.size(); ++i) {
+                if (urls[i].empty()) {
+                    responses[i].result = Result::Fail("[StockyBoy][FetchBatch] Empty URL", ErrorKind::INVALID);
+                }
+            }
+
+            TransferAll(urls, responses, maxConcurrent, retry, headers);
+            return responses;
+        }
+    }
+}
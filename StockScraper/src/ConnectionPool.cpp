@@ -0,0 +1,165 @@
+#include "pch.h"
+
+#include "ConnectionPool.hpp"
+
+namespace StockyBoy {
+    namespace Scraper {
+        // ====================
+        // Handle
+        // ====================
+
+        ConnectionPool::Handle::Handle(ConnectionPool* pool, std::string host, CURL* curl)
+            : pool(pool), host(std::move(host)), curl(curl)
+        {
+        }
+
+        ConnectionPool::Handle::Handle(Handle&& other) noexcept
+            : pool(other.pool), host(std::move(other.host)), curl(other.curl)
+        {
+            other.pool = nullptr;
+            other.curl = nullptr;
+        }
+
+        ConnectionPool::Handle& ConnectionPool::Handle::operator=(Handle&& other) noexcept
+        {
+            if (this != &other) {
+                Release();
+
+                pool = other.pool;
+                host = std::move(other.host);
+                curl = other.curl;
+
+                other.pool = nullptr;
+                other.curl = nullptr;
+            }
+            return *this;
+        }
+
+        ConnectionPool::Handle::~Handle()
+        {
+            Release();
+        }
+
+        void ConnectionPool::Handle::Release()
+        {
+            if (pool && curl) {
+                pool->Release(host, curl);
+            }
+            pool = nullptr;
+            curl = nullptr;
+        }
+
+        // ====================
+        // Pool
+        // ====================
+
+        ConnectionPool& ConnectionPool::Get()
+        {
+            static ConnectionPool instance;
+            return instance;
+        }
+
+        ConnectionPool::ConnectionPool()
+        {
+            curl_global_init(CURL_GLOBAL_DEFAULT);
+
+            share = curl_share_init();
+            if (share) {
+                curl_share_setopt(share, CURLSHOPT_LOCKFUNC, &ConnectionPool::LockShare);
+                curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, &ConnectionPool::UnlockShare);
+                curl_share_setopt(share, CURLSHOPT_USERDATA, this);
+                curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+                curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+                curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+            }
+        }
+
+        ConnectionPool::~ConnectionPool()
+        {
+            // Handles must go before the share they point to
+            for (auto& [host, handles] : idle) {
+                for (CURL* curl : handles) {
+                    curl_easy_cleanup(curl);
+                }
+            }
+            idle.clear();
+
+            if (share) {
+                curl_share_cleanup(share);
+            }
+        }
+
+        ConnectionPool::Handle ConnectionPool::Acquire(const std::string& host)
+        {
+            CURL* curl = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(poolMutex);
+                auto it = idle.find(host);
+                if (it != idle.end() && !it->second.empty()) {
+                    curl = it->second.back();
+                    it->second.pop_back();
+                }
+            }
+
+            if (curl) {
+                // Drops the previous request's options but keeps its live connection
+                curl_easy_reset(curl);
+            }
+            else {
+                curl = curl_easy_init();
+                if (!curl) {
+                    return Handle{};
+                }
+            }
+
+            Configure(curl);
+            return Handle(this, host, curl);
+        }
+
+        void ConnectionPool::Configure(CURL* curl)
+        {
+            if (share) {
+                curl_easy_setopt(curl, CURLOPT_SHARE, share);
+            }
+
+            curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+            curl_easy_setopt(curl, CURLOPT_TCP_KEEPIDLE, 60L);
+            curl_easy_setopt(curl, CURLOPT_TCP_KEEPINTVL, 30L);
+            curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS); // falls back to HTTP/1.1 when not negotiated
+            curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);                        // handles are used from several threads
+            curl_easy_setopt(curl, CURLOPT_ACCEPT_ENCODING, "");                 // every decoder this curl was built with (gzip, deflate, br, zstd)
+        }
+
+        std::string ConnectionPool::HostOf(const std::string& url)
+        {
+            const size_t schemeEnd = url.find("://");
+            const size_t authorityStart = (schemeEnd == std::string::npos) ? 0 : schemeEnd + 3;
+            const size_t authorityEnd = url.find_first_of("/?#", authorityStart);
+            return url.substr(0, authorityEnd);
+        }
+
+        void ConnectionPool::Release(const std::string& host, CURL* curl)
+        {
+            {
+                std::lock_guard<std::mutex> lock(poolMutex);
+                std::vector<CURL*>& handles = idle[host];
+                if (handles.size() < MAX_IDLE_PER_HOST) {
+                    handles.push_back(curl);
+                    return;
+                }
+            }
+
+            curl_easy_cleanup(curl);
+        }
+
+        void ConnectionPool::LockShare(CURL*, curl_lock_data data, curl_lock_access, void* userp)
+        {
+            static_cast<ConnectionPool*>(userp)->shareLocks[static_cast<size_t>(data)].lock();
+        }
+
+        void ConnectionPool::UnlockShare(CURL*, curl_lock_data data, void* userp)
+        {
+            static_cast<ConnectionPool*>(userp)->shareLocks[static_cast<size_t>(data)].unlock();
+        }
+    }
+}
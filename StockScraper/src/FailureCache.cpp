@@ -0,0 +1,175 @@
+#include "pch.h"
+
+#include "FailureCache.hpp"
+#include "MappedFile.hpp"
+
+#include <sstream>
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		static constexpr int64_t MINUTE = 60;
+		static constexpr int64_t HOUR = 60 * MINUTE;
+		static constexpr int64_t DAY = 24 * HOUR;
+
+		struct BackoffRule {
+			ErrorKind kind;
+			const char* name; // as written to the file
+			int64_t first;    // wait after the first failure
+			int64_t cap;
+		};
+
+		// A 404 is Yahoo saying the symbol is unknown or delisted. No bars can also be a quiet stretch, so it comes back sooner.
+		// Other HTTP errors (401/403/400) and malformed answers are what a blocked client gets for every symbol, they aren't cached.
+		static constexpr BackoffRule BACKOFF_RULES[] = {
+			{ ErrorKind::NOT_FOUND, "not_found", DAY, 30 * DAY },
+			{ ErrorKind::NO_DATA, "no_data", 6 * HOUR, 7 * DAY },
+		};
+
+		static const BackoffRule* RuleFor(ErrorKind kind) {
+			auto it = std::find_if(std::begin(BACKOFF_RULES), std::end(BACKOFF_RULES), [&](const BackoffRule& rule) { return rule.kind == kind; });
+			return (it != std::end(BACKOFF_RULES)) ? it : nullptr;
+		}
+
+		static const BackoffRule* RuleFor(const std::string& name) {
+			auto it = std::find_if(std::begin(BACKOFF_RULES), std::end(BACKOFF_RULES), [&](const BackoffRule& rule) { return name == rule.name; });
+			return (it != std::end(BACKOFF_RULES)) ? it : nullptr;
+		}
+
+		FailureCache::FailureCache(const std::filesystem::path& path)
+			: Path(path)
+		{
+		}
+
+		int64_t FailureCache::Backoff(ErrorKind kind, uint32_t failures)
+		{
+			const BackoffRule* rule = RuleFor(kind);
+			if (!rule || failures == 0) return 0;
+
+			int64_t wait = rule->first;
+			for (uint32_t i = 1; i < failures && wait < rule->cap; ++i) {
+				wait *= 2;
+			}
+			return std::min(wait, rule->cap);
+		}
+
+		bool FailureCache::Blocked(const std::string& label, int64_t now) const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			auto it = Entries.find(label);
+			return it != Entries.end() && now < it->second.retryAt;
+		}
+
+		void FailureCache::RecordFailure(const std::string& label, ErrorKind kind, int64_t now)
+		{
+			if (!IsSymbolError(kind)) return;
+
+			std::lock_guard<std::mutex> lock(mutex);
+			Entry& entry = Entries[label];
+			entry.kind = kind;
+			entry.failures += 1;
+			entry.retryAt = now + Backoff(kind, entry.failures);
+			dirty = true;
+		}
+
+		void FailureCache::RecordSuccess(const std::string& label)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (Entries.erase(label) > 0) {
+				dirty = true;
+			}
+		}
+
+		bool FailureCache::Find(const std::string& label, Entry& out_Entry) const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			auto it = Entries.find(label);
+			if (it == Entries.end()) return false;
+
+			out_Entry = it->second;
+			return true;
+		}
+
+		size_t FailureCache::size() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return Entries.size();
+		}
+
+		// File layout: a "label,kind,failures,retry_at" header, then one line per symbol
+		Result FailureCache::Load()
+		{
+			std::unordered_map<std::string, Entry> entries;
+
+			std::ifstream file(Path);
+			if (file) {
+				std::string line;
+				std::getline(file, line); // header
+
+				while (std::getline(file, line)) {
+					std::istringstream fields(line);
+					std::string label, kind, failures, retryAt;
+					if (!std::getline(fields, label, ',') || !std::getline(fields, kind, ',') ||
+						!std::getline(fields, failures, ',') || !std::getline(fields, retryAt)) {
+						continue;
+					}
+
+					const BackoffRule* rule = RuleFor(kind);
+					if (label.empty() || !rule) continue;
+
+					try {
+						entries[label] = Entry{ .kind = rule->kind, .failures = static_cast<uint32_t>(std::stoul(failures)), .retryAt = std::stoll(retryAt) };
+					}
+					catch (const std::exception&) {
+						continue; // a damaged line only loses that symbol's backoff
+					}
+				}
+			}
+
+			std::lock_guard<std::mutex> lock(mutex);
+			Entries = std::move(entries);
+			dirty = false;
+
+			return Result::Ok();
+		}
+
+		Result FailureCache::Save()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (!dirty) {
+				return Result::Ok();
+			}
+
+			if (Path.has_parent_path()) {
+				std::error_code ec;
+				std::filesystem::create_directories(Path.parent_path(), ec);
+			}
+
+			std::filesystem::path tempPath = Path;
+			tempPath += ".tmp";
+
+			{
+				std::ofstream file(tempPath, std::ios::trunc);
+				if (!file) {
+					return Result::Fail("[StockyBoy][FailureCache] Can't write failure cache: " + tempPath.string());
+				}
+
+				file << "label,kind,failures,retry_at\n";
+				for (const auto& [label, entry] : Entries) {
+					file << label << ',' << RuleFor(entry.kind)->name << ',' << entry.failures << ',' << entry.retryAt << '\n';
+				}
+
+				if (!file) {
+					return Result::Fail("[StockyBoy][FailureCache] Failed writing failure cache: " + tempPath.string());
+				}
+			}
+
+			if (!SwapInTempFile(tempPath, Path)) {
+				return Result::Fail("[StockyBoy][FailureCache] Can't replace failure cache: " + Path.string());
+			}
+
+			dirty = false;
+			return Result::Ok();
+		}
+	}
+}
@@ -1,7 +1,15 @@
 #include "pch.h"
 
 #include <iostream>
+#include <random>
+#include <thread>
+#include <cctype>
+#include <charconv>
+#include <algorithm>
+#include <string_view>
 #include "Fetch.hpp"
+#include "RateLimiter.hpp"
+#include "ConnectionPool.hpp"
 
 namespace StockyBoy {
     namespace Scraper {
@@ -10,6 +18,116 @@ namespace StockyBoy {
             return size * nmemb;
         }
 
+        // JSON usually shrinks 5-10x under gzip/brotli
+        static constexpr int64_t DECODED_SIZE_RATIO = 8;
+        // A bogus Content-Length shouldn't reserve more than this
+        static constexpr int64_t MAX_RESERVE = 64 << 20;
+
+        static bool HeaderIs(std::string_view line, std::string_view name) {
+            if (line.size() <= name.size() || line[name.size()] != ':') return false;
+            for (size_t i = 0; i < name.size(); ++i) {
+                if (std::tolower(static_cast<unsigned char>(line[i])) != name[i]) return false;
+            }
+            return true;
+        }
+
+        static std::string_view HeaderValue(std::string_view line, size_t nameSize) {
+            line.remove_prefix(nameSize + 1);
+            while (!line.empty() && (line.front() == ' ' || line.front() == '\t')) line.remove_prefix(1);
+            while (!line.empty() && (line.back() == '\r' || line.back() == '\n' || line.back() == ' ')) line.remove_suffix(1);
+            return line;
+        }
+
+        size_t SinkHeaderCallback(char* buffer, size_t size, size_t nitems, void* userp) {
+            ResponseSink& sink = *static_cast<ResponseSink*>(userp);
+            const std::string_view line(buffer, size * nitems);
+
+            if (line.starts_with("HTTP/")) {
+                // A new response (redirect, 100 Continue), forget the last one's headers
+                sink.contentLength = -1;
+                sink.encoded = false;
+            }
+            else if (HeaderIs(line, "content-length")) {
+                const std::string_view value = HeaderValue(line, std::string_view("content-length").size());
+                int64_t length = 0;
+                auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), length);
+                if (error == std::errc{}) sink.contentLength = length;
+            }
+            else if (HeaderIs(line, "content-encoding")) {
+                const std::string_view value = HeaderValue(line, std::string_view("content-encoding").size());
+                sink.encoded = !value.empty() && value != "identity";
+            }
+
+            return size * nitems;
+        }
+
+        size_t SinkWriteCallback(void* contents, size_t size, size_t nmemb, void* userp) {
+            ResponseSink& sink = *static_cast<ResponseSink*>(userp);
+
+            if (!sink.sized) {
+                sink.sized = true;
+                if (sink.contentLength > 0) {
+                    const int64_t expected = sink.encoded ? sink.contentLength * DECODED_SIZE_RATIO : sink.contentLength;
+                    sink.out->reserve(sink.out->size() + static_cast<size_t>(std::min(expected, MAX_RESERVE)));
+                }
+            }
+
+            sink.out->append(static_cast<const char*>(contents), size * nmemb);
+            return size * nmemb;
+        }
+
+        ResponseArena& ResponseArena::ForThread() {
+            static thread_local ResponseArena arena;
+            return arena;
+        }
+
+        std::string ResponseArena::Acquire() {
+            if (Free.empty()) {
+                return {};
+            }
+
+            std::string buffer = std::move(Free.back());
+            Free.pop_back();
+            return buffer;
+        }
+
+        void ResponseArena::Recycle(std::string&& buffer) {
+            if (buffer.capacity() == 0 || buffer.capacity() > MAX_KEPT_CAPACITY || Free.size() >= MAX_BUFFERS) {
+                return;
+            }
+
+            buffer.clear();
+            Free.push_back(std::move(buffer));
+        }
+
+        ErrorKind HttpErrorKind(long httpCode) {
+            if (httpCode == 404) return ErrorKind::NOT_FOUND;
+            if (httpCode == 429) return ErrorKind::THROTTLED;
+            if (httpCode >= 500) return ErrorKind::SERVER;
+            return ErrorKind::HTTP;
+        }
+
+        bool IsRetryable(ErrorKind kind) {
+            return kind == ErrorKind::NETWORK || kind == ErrorKind::THROTTLED || kind == ErrorKind::SERVER;
+        }
+
+        std::chrono::milliseconds RetryDelay(const RetryPolicy& policy, uint32_t attempt, std::chrono::milliseconds retryAfter) {
+            static thread_local std::mt19937 rng(std::random_device{}());
+
+            int64_t ceiling = policy.baseDelay.count();
+            for (uint32_t i = 0; i < attempt && ceiling < policy.maxDelay.count(); ++i) {
+                ceiling *= 2;
+            }
+            ceiling = std::min<int64_t>(ceiling, policy.maxDelay.count());
+
+            const int64_t jittered = std::uniform_int_distribution<int64_t>(0, std::max<int64_t>(ceiling, 0))(rng);
+            return std::max(std::chrono::milliseconds(jittered), std::min(retryAfter, policy.maxDelay));
+        }
+
+        bool RetryAfterTooLong(const RetryPolicy& policy, std::chrono::milliseconds retryAfter) {
+            return retryAfter > policy.maxDelay;
+        }
+
         static std::string SanitizeLabel(const std::string& s)
         {
             std::string out;
@@ -25,64 +143,146 @@ namespace StockyBoy {
             return out;
         }
 
-        Result Fetch(const std::string& label, INTERVAL interval, RANGE range, std::string& out_Data)
+        Result GetChartURL(const std::string& label, INTERVAL interval, RANGE range, std::string& out_URL)
         {
             // --- Validate inputs ---
             if (label.empty()) {
-                return Result::Fail("[StockyBoy][Fetch] Stock label is empty.");
+                return Result::Fail("[StockyBoy][Fetch] Stock label is empty.", ErrorKind::INVALID);
             }
 
             if (!StockyBoy::IsValidCombo(interval, range)) {
                 return Result::Fail("[StockyBoy][Fetch] Invalid interval-range combo: " +
-                    StockyBoy::ToString(interval) + " / " + StockyBoy::ToString(range));
+                    StockyBoy::ToString(interval) + " / " + StockyBoy::ToString(range), ErrorKind::INVALID);
             }
 
             // --- Build URL ---
             const std::string base = "https://query1.finance.yahoo.com";
             const std::string path = "/v8/finance/chart/";
-            const std::string url = base + path + SanitizeLabel(label) + "?interval=" + StockyBoy::ToString(interval) + "&range=" + StockyBoy::ToString(range); 
+            out_URL = base + path + SanitizeLabel(label) + "?interval=" + StockyBoy::ToString(interval) + "&range=" + StockyBoy::ToString(range); 
+
+            return Result::Ok();
+        }
+
+        Result GetChartURL(const std::string& label, INTERVAL interval, int64_t period1, int64_t period2, std::string& out_URL)
+        {
+            // --- Validate inputs ---
+            if (label.empty()) {
+                return Result::Fail("[StockyBoy][Fetch] Stock label is empty.", ErrorKind::INVALID);
+            }
+
+            if (interval < 0 || interval >= INTERVAL_COUNT) {
+                return Result::Fail("[StockyBoy][Fetch] Invalid interval.", ErrorKind::INVALID);
+            }
+
+            if (period1 < 0 || period2 <= period1) {
+                return Result::Fail("[StockyBoy][Fetch] Invalid period: " + std::to_string(period1) + " - " + std::to_string(period2), ErrorKind::INVALID);
+            }
+
+            // --- Build URL ---
+            const std::string base = "https://query1.finance.yahoo.com";
+            const std::string path = "/v8/finance/chart/";
+            out_URL = base + path + SanitizeLabel(label) + "?interval=" + StockyBoy::ToString(interval) +
+                "&period1=" + std::to_string(period1) + "&period2=" + std::to_string(period2);
+
+            return Result::Ok();
+        }
 
+        static Result FetchURL(const std::string& url, std::string& out_Data, const RetryPolicy& retry)
+        {
             std::cout << url << std::endl;
 
-            // --- Initialize CURL ---
-            CURL* curl = curl_easy_init();
-            if (!curl) {
+            const std::string host = ConnectionPool::HostOf(url);
+            RateGovernor& governor = RateGovernor::Get();
+
+            // --- Lease a pooled CURL handle (returned to the pool on scope exit) ---
+            ConnectionPool::Handle handle = ConnectionPool::Get().Acquire(host);
+            if (!handle) {
                 return Result::Fail("[StockyBoy][Fetch] Failed to initialize CURL");
             }
 
-            std::cout << curl_version() << std::endl;
+            CURL* curl = handle.get();
 
-            // --- Cleanup scope ---
-            auto cleanup = [&]() {
-                curl_easy_cleanup(curl);
-                };
+            if (out_Data.capacity() == 0) {
+                out_Data = ResponseArena::ForThread().Acquire();
+            }
+            ResponseSink sink;
 
             // --- Configure CURL ---
             curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-            curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
-            curl_easy_setopt(curl, CURLOPT_WRITEDATA, &out_Data);
+            curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, SinkWriteCallback);
+            curl_easy_setopt(curl, CURLOPT_WRITEDATA, &sink);
+            curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, SinkHeaderCallback);
+            curl_easy_setopt(curl, CURLOPT_HEADERDATA, &sink);
             curl_easy_setopt(curl, CURLOPT_USERAGENT, "Mozilla/5.0"); // Some APIs block curls default UA
-            curl_easy_setopt(curl, CURLOPT_TIMEOUT, 10L);              // 10s timeout
+            curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, 5L);
+            curl_easy_setopt(curl, CURLOPT_TIMEOUT, 60L);              // Hard cap, a daily/max chart can take a while
+            curl_easy_setopt(curl, CURLOPT_LOW_SPEED_LIMIT, 1024L);    // but a stalled transfer is dropped after 10s
+            curl_easy_setopt(curl, CURLOPT_LOW_SPEED_TIME, 10L);
             curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);        // Handle redirects
 
-            // --- Perform request ---
-            CURLcode res = curl_easy_perform(curl);
-            if (res != CURLE_OK) {
-                cleanup();
-                return Result::Fail("[StockyBoy][Fetch] CURL request failed: " + std::string(curl_easy_strerror(res)));
+            for (uint32_t attempt = 0; ; ++attempt) {
+                out_Data.clear();
+                sink = ResponseSink{ .out = &out_Data };
+                governor.Acquire(host);
+
+                // --- Perform request ---
+                Result result = Result::Ok();
+                std::chrono::milliseconds retryAfter{ 0 };
+
+                CURLcode res = curl_easy_perform(curl);
+                if (res != CURLE_OK) {
+                    result = Result::Fail("[StockyBoy][Fetch] CURL request failed: " + std::string(curl_easy_strerror(res)), ErrorKind::NETWORK);
+                }
+                else {
+                    // --- Check HTTP response ---
+                    long httpCode = 0;
+                    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
+                    if (httpCode != 200) {
+                        result = Result::Fail("[StockyBoy][Fetch] HTTP error code: " + std::to_string(httpCode), HttpErrorKind(httpCode));
+
+                        curl_off_t seconds = 0;
+                        if (curl_easy_getinfo(curl, CURLINFO_RETRY_AFTER, &seconds) == CURLE_OK && seconds > 0) {
+                            retryAfter = std::chrono::seconds(seconds);
+                        }
+                    }
+                }
+
+                // The host pauses no longer than the policy would wait either
+                governor.OnResult(host, result, std::min(retryAfter, retry.maxDelay));
+
+                if (!result.succeeded && RetryAfterTooLong(retry, retryAfter)) {
+                    return Result::Fail(result.error + ", retry after " + std::to_string(retryAfter.count() / 1000) + "s", ErrorKind::THROTTLED);
+                }
+
+                if (result.succeeded || !IsRetryable(result.kind) || attempt + 1 >= retry.maxAttempts) {
+                    return result;
+                }
+
+                governor.OnRetry(host);
+                std::this_thread::sleep_for(RetryDelay(retry, attempt, retryAfter));
             }
+        }
 
-            // --- Check HTTP response ---
-            long httpCode = 0;
-            curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &httpCode);
-            if (httpCode != 200) {
-                cleanup();
-                return Result::Fail("[StockyBoy][Fetch] HTTP error code: " + std::to_string(httpCode));
+        Result Fetch(const std::string& label, INTERVAL interval, RANGE range, std::string& out_Data, const RetryPolicy& retry)
+        {
+            std::string url;
+            Result urlResult = GetChartURL(label, interval, range, url);
+            if (!urlResult.succeeded) {
+                return urlResult;
             }
 
-            // --- Everything succeeded ---
-            cleanup();
-            return Result::Ok();
+            return FetchURL(url, out_Data, retry);
+        }
+
+        Result Fetch(const std::string& label, INTERVAL interval, int64_t period1, int64_t period2, std::string& out_Data, const RetryPolicy& retry)
+        {
+            std::string url;
+            Result urlResult = GetChartURL(label, interval, period1, period2, url);
+            if (!urlResult.succeeded) {
+                return urlResult;
+            }
+
+            return FetchURL(url, out_Data, retry);
         }
 
     }
@@ -0,0 +1,391 @@
+#include "pch.h"
+
+#include "Utils/Indicators.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Maths {
+		// ====================
+		// RollingWindow
+		// ====================
+
+		RollingWindow::RollingWindow(uint32_t window)
+			: Values(window)
+		{
+		}
+
+		bool RollingWindow::Push(double value, double& out_Evicted)
+		{
+			if (Values.empty()) {
+				return false;
+			}
+
+			const bool evicting = full();
+			if (evicting) {
+				out_Evicted = Values[Head];
+			}
+			else {
+				++Count;
+			}
+
+			Values[Head] = value;
+			Head = (Head + 1) % Values.size();
+
+			return evicting;
+		}
+
+		void RollingWindow::Reset()
+		{
+			Head = 0;
+			Count = 0;
+		}
+
+		// ====================
+		// SMA / EMA / WMA
+		// ====================
+
+		double RollingSMA::Push(double value)
+		{
+			double evicted = 0.0;
+			if (!Window.Push(value, evicted)) {
+				Sum += value;
+			}
+			else if (++SinceRecompute >= Window.capacity()) {
+				Sum = 0.0;
+				for (double kept : Window.values()) Sum += kept;
+				SinceRecompute = 0;
+			}
+			else {
+				Sum += value - evicted;
+			}
+			return this->value();
+		}
+
+		void RollingSMA::Reset()
+		{
+			Window.Reset();
+			Sum = 0.0;
+			SinceRecompute = 0;
+		}
+
+		RollingEMA::RollingEMA(uint32_t window)
+			: Window(window), Alpha(2.0 / (static_cast<double>(window) + 1.0))
+		{
+		}
+
+		double RollingEMA::Push(double value)
+		{
+			if (Window == 0) return WARMUP;
+
+			if (Seen < Window) {
+				// Warm-up accumulates the seed SMA
+				Value += value;
+				++Seen;
+				if (Seen == Window) Value /= Window;
+			}
+			else {
+				Value += Alpha * (value - Value);
+			}
+			return this->value();
+		}
+
+		void RollingEMA::Reset()
+		{
+			Seen = 0;
+			Value = 0.0;
+		}
+
+		double RollingWMA::Push(double value)
+		{
+			const uint32_t window = static_cast<uint32_t>(Window.capacity());
+			if (window == 0) return WARMUP;
+
+			double evicted = 0.0;
+			if (!Window.Push(value, evicted)) {
+				// Filling up: the new value gets the next weight
+				++Seen;
+				WeightedSum += Seen * value;
+				Sum += value;
+			}
+			else {
+				// Every weight drops by one, the evicted value (weight 1) leaves, the new one enters at `window`
+				WeightedSum += window * value - Sum;
+				Sum += value - evicted;
+			}
+			return this->value();
+		}
+
+		void RollingWMA::Reset()
+		{
+			Window.Reset();
+			Sum = 0.0;
+			WeightedSum = 0.0;
+			Seen = 0;
+		}
+
+		double RollingWMA::value() const
+		{
+			if (!ready()) return WARMUP;
+
+			const double n = static_cast<double>(Window.capacity());
+			return WeightedSum / (n * (n + 1.0) / 2.0);
+		}
+
+		// ====================
+		// StdDev / Bollinger
+		// ====================
+
+		void RollingStdDev::Recompute()
+		{
+			const std::span<const double> values = Window.values();
+
+			double sum = 0.0;
+			for (double value : values) sum += value;
+			Mean = sum / static_cast<double>(values.size());
+
+			SquaredDeviations = 0.0;
+			for (double value : values) SquaredDeviations += (value - Mean) * (value - Mean);
+
+			SinceRecompute = 0;
+		}
+
+		double RollingStdDev::Push(double value)
+		{
+			double evicted = 0.0;
+			if (!Window.Push(value, evicted)) {
+				if (Window.capacity() == 0) return WARMUP;
+
+				// Filling up: Welford's running mean and squared deviations
+				const double delta = value - Mean;
+				Mean += delta / static_cast<double>(Window.size());
+				SquaredDeviations += delta * (value - Mean);
+			}
+			else if (++SinceRecompute >= Window.capacity()) {
+				Recompute();
+			}
+			else {
+				// Same count: `value` replaces `evicted`
+				const double previousMean = Mean;
+				Mean += (value - evicted) / static_cast<double>(Window.capacity());
+				SquaredDeviations += (value - evicted) * (value - Mean + evicted - previousMean);
+			}
+			return this->value();
+		}
+
+		void RollingStdDev::Reset()
+		{
+			Window.Reset();
+			Mean = 0.0;
+			SquaredDeviations = 0.0;
+			SinceRecompute = 0;
+		}
+
+		double RollingStdDev::value() const
+		{
+			if (!ready()) return WARMUP;
+
+			const double variance = SquaredDeviations / static_cast<double>(Window.capacity());
+			return std::sqrt(std::max(variance, 0.0)); // the sliding update can dip just under 0
+		}
+
+		Band RollingBollinger::Push(double value)
+		{
+			Deviation.Push(value);
+			return this->value();
+		}
+
+		Band RollingBollinger::value() const
+		{
+			if (!ready()) return Band{};
+
+			const double middle = Deviation.mean();
+			const double width = K * Deviation.value();
+			return Band{ .middle = middle, .upper = middle + width, .lower = middle - width };
+		}
+
+		// ====================
+		// RSI / ATR / VWAP
+		// ====================
+
+		double RollingRSI::Push(double close)
+		{
+			if (Window == 0) return WARMUP;
+
+			if (!HasPrevious) {
+				PreviousClose = close;
+				HasPrevious = true;
+				return WARMUP;
+			}
+
+			const double change = close - PreviousClose;
+			const double gain = std::max(change, 0.0);
+			const double loss = std::max(-change, 0.0);
+			PreviousClose = close;
+
+			if (Changes < Window) {
+				// Seed with the simple average of the first `window` changes
+				AverageGain += gain / Window;
+				AverageLoss += loss / Window;
+				++Changes;
+			}
+			else {
+				AverageGain = (AverageGain * (Window - 1) + gain) / Window;
+				AverageLoss = (AverageLoss * (Window - 1) + loss) / Window;
+			}
+			return this->value();
+		}
+
+		void RollingRSI::Reset()
+		{
+			Changes = 0;
+			PreviousClose = 0.0;
+			HasPrevious = false;
+			AverageGain = 0.0;
+			AverageLoss = 0.0;
+		}
+
+		double RollingRSI::value() const
+		{
+			if (!ready()) return WARMUP;
+			if (AverageLoss == 0.0) return (AverageGain == 0.0) ? 50.0 : 100.0;
+
+			const double rs = AverageGain / AverageLoss;
+			return 100.0 - 100.0 / (1.0 + rs);
+		}
+
+		double RollingATR::Push(double high, double low, double close)
+		{
+			if (Window == 0) return WARMUP;
+
+			double trueRange = high - low;
+			if (Seen > 0) {
+				trueRange = std::max({ trueRange, std::abs(high - PreviousClose), std::abs(low - PreviousClose) });
+			}
+			PreviousClose = close;
+
+			if (Seen < Window) {
+				Value += trueRange / Window;
+				++Seen;
+			}
+			else {
+				Value = (Value * (Window - 1) + trueRange) / Window;
+			}
+			return this->value();
+		}
+
+		void RollingATR::Reset()
+		{
+			Seen = 0;
+			PreviousClose = 0.0;
+			Value = 0.0;
+		}
+
+		double RollingVWAP::Push(double high, double low, double close, double volume)
+		{
+			PriceVolume += (high + low + close) / 3.0 * volume;
+			Volume += volume;
+			return this->value();
+		}
+
+		void RollingVWAP::Reset()
+		{
+			PriceVolume = 0.0;
+			Volume = 0.0;
+		}
+
+		// ====================
+		// Batch
+		// ====================
+
+		template <typename Indicator>
+		static std::vector<double> RunSeries(std::span<const double> values, Indicator indicator)
+		{
+			std::vector<double> out(values.size());
+			for (size_t i = 0; i < values.size(); ++i) {
+				out[i] = indicator.Push(values[i]);
+			}
+			return out;
+		}
+
+		std::vector<double> SMA(std::span<const double> values, uint32_t window)
+		{
+			return RunSeries(values, RollingSMA(window));
+		}
+
+		std::vector<double> EMA(std::span<const double> values, uint32_t window)
+		{
+			return RunSeries(values, RollingEMA(window));
+		}
+
+		std::vector<double> WMA(std::span<const double> values, uint32_t window)
+		{
+			return RunSeries(values, RollingWMA(window));
+		}
+
+		std::vector<double> MovingMin(std::span<const double> values, uint32_t window)
+		{
+			return RunSeries(values, RollingMin(window));
+		}
+
+		std::vector<double> MovingMax(std::span<const double> values, uint32_t window)
+		{
+			return RunSeries(values, RollingMax(window));
+		}
+
+		std::vector<double> StdDev(std::span<const double> values, uint32_t window)
+		{
+			return RunSeries(values, RollingStdDev(window));
+		}
+
+		Bands Bollinger(std::span<const double> values, uint32_t window, double k)
+		{
+			Bands bands;
+			bands.middle.resize(values.size());
+			bands.upper.resize(values.size());
+			bands.lower.resize(values.size());
+
+			RollingBollinger bollinger(window, k);
+			for (size_t i = 0; i < values.size(); ++i) {
+				const Band band = bollinger.Push(values[i]);
+				bands.middle[i] = band.middle;
+				bands.upper[i] = band.upper;
+				bands.lower[i] = band.lower;
+			}
+			return bands;
+		}
+
+		std::vector<double> RSI(std::span<const double> close, uint32_t window)
+		{
+			return RunSeries(close, RollingRSI(window));
+		}
+
+		std::vector<double> ATR(const Scraper::StockTableView& bars, uint32_t window)
+		{
+			std::vector<double> out(bars.size());
+
+			RollingATR atr(window);
+			for (size_t i = 0; i < bars.size(); ++i) {
+				out[i] = atr.Push(bars.high[i], bars.low[i], bars.close[i]);
+			}
+			return out;
+		}
+
+		std::vector<double> VWAP(const Scraper::StockTableView& bars, std::span<const uint32_t> sessionStarts)
+		{
+			std::vector<double> out(bars.size());
+
+			RollingVWAP vwap;
+			size_t nextSession = 0;
+			for (size_t i = 0; i < bars.size(); ++i) {
+				if (nextSession < sessionStarts.size() && sessionStarts[nextSession] == i) {
+					vwap.Reset();
+					++nextSession;
+				}
+				out[i] = vwap.Push(bars.high[i], bars.low[i], bars.close[i], bars.volume[i]);
+			}
+			return out;
+		}
+	}
+}
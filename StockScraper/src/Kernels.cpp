@@ -0,0 +1,407 @@
+#include "pch.h"
+
+#include "Utils/Kernels.hpp"
+
+#include <cmath>
+#include <atomic>
+#include <limits>
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define STOCKYBOY_X64 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC compiles intrinsics for any instruction set without flags, GCC/Clang need the function to opt in
+#if defined(STOCKYBOY_X64) && (defined(__GNUC__) || defined(__clang__))
+#define STOCKYBOY_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define STOCKYBOY_TARGET_AVX2
+#endif
+
+namespace StockyBoy {
+	namespace Maths {
+		static constexpr double NEG_INF = -std::numeric_limits<double>::infinity();
+		static constexpr double POS_INF = std::numeric_limits<double>::infinity();
+
+		// ====================
+		// Dispatch
+		// ====================
+
+		static SimdLevel DetectSimdLevel()
+		{
+#if defined(STOCKYBOY_X64)
+#if defined(_MSC_VER) && !defined(__clang__)
+			int info[4] = {};
+			__cpuid(info, 0);
+			if (info[0] >= 7) {
+				__cpuid(info, 1);
+				const bool osxsave = (info[2] & (1 << 27)) != 0;
+				const bool avx = (info[2] & (1 << 28)) != 0;
+				// The OS must save the YMM registers on context switches
+				const bool ymmEnabled = osxsave && avx && ((_xgetbv(0) & 0x6) == 0x6);
+
+				__cpuidex(info, 7, 0);
+				const bool avx2 = (info[1] & (1 << 5)) != 0;
+				if (ymmEnabled && avx2) return SimdLevel::AVX2;
+			}
+#else
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+#endif
+			return SimdLevel::SSE2; // part of the x86-64 baseline
+#else
+			return SimdLevel::Scalar;
+#endif
+		}
+
+		static std::atomic<SimdLevel>& ActiveLevel()
+		{
+			static std::atomic<SimdLevel> level{ DetectSimdLevel() };
+			return level;
+		}
+
+		SimdLevel ActiveSimdLevel()
+		{
+			return ActiveLevel().load(std::memory_order_relaxed);
+		}
+
+		SimdLevel SetSimdLevel(SimdLevel level)
+		{
+			static const SimdLevel supported = DetectSimdLevel();
+			const SimdLevel active = std::min(level, supported);
+			ActiveLevel().store(active, std::memory_order_relaxed);
+			return active;
+		}
+
+		const char* ToString(SimdLevel level)
+		{
+			switch (level) {
+			case SimdLevel::AVX2: return "AVX2";
+			case SimdLevel::SSE2: return "SSE2";
+			default: return "Scalar";
+			}
+		}
+
+		// ====================
+		// Scalar
+		// ====================
+
+		// The comparison is false for NaN, so NaN never replaces the running extreme
+		static double MaxScalar(const double* values, size_t count, double acc)
+		{
+			for (size_t i = 0; i < count; ++i) acc = (values[i] > acc) ? values[i] : acc;
+			return acc;
+		}
+
+		static double MinScalar(const double* values, size_t count, double acc)
+		{
+			for (size_t i = 0; i < count; ++i) acc = (values[i] < acc) ? values[i] : acc;
+			return acc;
+		}
+
+		static double SumScalar(const double* values, size_t count, double acc)
+		{
+			for (size_t i = 0; i < count; ++i) acc += values[i];
+			return acc;
+		}
+
+		static void ScaleScalar(const double* values, double* out, size_t count, double factor)
+		{
+			for (size_t i = 0; i < count; ++i) out[i] = values[i] * factor;
+		}
+
+		static void DivideScalar(const double* values, double* out, size_t count, double divisor)
+		{
+			for (size_t i = 0; i < count; ++i) out[i] = values[i] / divisor;
+		}
+
+		static void PercentChangeScalar(const double* from, const double* to, double* out, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i) out[i] = (to[i] - from[i]) / from[i] * 100.0;
+		}
+
+		static void RatioScalar(const double* from, const double* to, double* out, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i) out[i] = to[i] / from[i];
+		}
+
+#if defined(STOCKYBOY_X64)
+		// ====================
+		// SSE2
+		// ====================
+
+		// maxpd/minpd return the second operand when either is NaN: keep the accumulator second so NaN inputs are skipped
+
+		static double MaxSSE2(const double* values, size_t count)
+		{
+			__m128d acc0 = _mm_set1_pd(NEG_INF);
+			__m128d acc1 = acc0;
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4) {
+				acc0 = _mm_max_pd(_mm_loadu_pd(values + i), acc0);
+				acc1 = _mm_max_pd(_mm_loadu_pd(values + i + 2), acc1);
+			}
+			acc0 = _mm_max_pd(acc0, acc1);
+			acc0 = _mm_max_pd(acc0, _mm_unpackhi_pd(acc0, acc0));
+			return MaxScalar(values + i, count - i, _mm_cvtsd_f64(acc0));
+		}
+
+		static double MinSSE2(const double* values, size_t count)
+		{
+			__m128d acc0 = _mm_set1_pd(POS_INF);
+			__m128d acc1 = acc0;
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4) {
+				acc0 = _mm_min_pd(_mm_loadu_pd(values + i), acc0);
+				acc1 = _mm_min_pd(_mm_loadu_pd(values + i + 2), acc1);
+			}
+			acc0 = _mm_min_pd(acc0, acc1);
+			acc0 = _mm_min_pd(acc0, _mm_unpackhi_pd(acc0, acc0));
+			return MinScalar(values + i, count - i, _mm_cvtsd_f64(acc0));
+		}
+
+		static double SumSSE2(const double* values, size_t count)
+		{
+			__m128d acc0 = _mm_setzero_pd();
+			__m128d acc1 = _mm_setzero_pd();
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4) {
+				acc0 = _mm_add_pd(acc0, _mm_loadu_pd(values + i));
+				acc1 = _mm_add_pd(acc1, _mm_loadu_pd(values + i + 2));
+			}
+			acc0 = _mm_add_pd(acc0, acc1);
+			acc0 = _mm_add_sd(acc0, _mm_unpackhi_pd(acc0, acc0));
+			return SumScalar(values + i, count - i, _mm_cvtsd_f64(acc0));
+		}
+
+		static void ScaleSSE2(const double* values, double* out, size_t count, double factor)
+		{
+			const __m128d f = _mm_set1_pd(factor);
+			size_t i = 0;
+			for (; i + 2 <= count; i += 2) {
+				_mm_storeu_pd(out + i, _mm_mul_pd(_mm_loadu_pd(values + i), f));
+			}
+			ScaleScalar(values + i, out + i, count - i, factor);
+		}
+
+		static void DivideSSE2(const double* values, double* out, size_t count, double divisor)
+		{
+			const __m128d d = _mm_set1_pd(divisor);
+			size_t i = 0;
+			for (; i + 2 <= count; i += 2) {
+				_mm_storeu_pd(out + i, _mm_div_pd(_mm_loadu_pd(values + i), d));
+			}
+			DivideScalar(values + i, out + i, count - i, divisor);
+		}
+
+		static void PercentChangeSSE2(const double* from, const double* to, double* out, size_t count)
+		{
+			const __m128d hundred = _mm_set1_pd(100.0);
+			size_t i = 0;
+			for (; i + 2 <= count; i += 2) {
+				const __m128d a = _mm_loadu_pd(from + i);
+				const __m128d b = _mm_loadu_pd(to + i);
+				_mm_storeu_pd(out + i, _mm_mul_pd(_mm_div_pd(_mm_sub_pd(b, a), a), hundred));
+			}
+			PercentChangeScalar(from + i, to + i, out + i, count - i);
+		}
+
+		static void RatioSSE2(const double* from, const double* to, double* out, size_t count)
+		{
+			size_t i = 0;
+			for (; i + 2 <= count; i += 2) {
+				_mm_storeu_pd(out + i, _mm_div_pd(_mm_loadu_pd(to + i), _mm_loadu_pd(from + i)));
+			}
+			RatioScalar(from + i, to + i, out + i, count - i);
+		}
+
+		// ====================
+		// AVX2
+		// ====================
+
+		STOCKYBOY_TARGET_AVX2 static double MaxAVX2(const double* values, size_t count)
+		{
+			__m256d acc0 = _mm256_set1_pd(NEG_INF);
+			__m256d acc1 = acc0;
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8) {
+				acc0 = _mm256_max_pd(_mm256_loadu_pd(values + i), acc0);
+				acc1 = _mm256_max_pd(_mm256_loadu_pd(values + i + 4), acc1);
+			}
+			acc0 = _mm256_max_pd(acc0, acc1);
+			__m128d half = _mm_max_pd(_mm256_castpd256_pd128(acc0), _mm256_extractf128_pd(acc0, 1));
+			half = _mm_max_pd(half, _mm_unpackhi_pd(half, half));
+			return MaxScalar(values + i, count - i, _mm_cvtsd_f64(half));
+		}
+
+		STOCKYBOY_TARGET_AVX2 static double MinAVX2(const double* values, size_t count)
+		{
+			__m256d acc0 = _mm256_set1_pd(POS_INF);
+			__m256d acc1 = acc0;
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8) {
+				acc0 = _mm256_min_pd(_mm256_loadu_pd(values + i), acc0);
+				acc1 = _mm256_min_pd(_mm256_loadu_pd(values + i + 4), acc1);
+			}
+			acc0 = _mm256_min_pd(acc0, acc1);
+			__m128d half = _mm_min_pd(_mm256_castpd256_pd128(acc0), _mm256_extractf128_pd(acc0, 1));
+			half = _mm_min_pd(half, _mm_unpackhi_pd(half, half));
+			return MinScalar(values + i, count - i, _mm_cvtsd_f64(half));
+		}
+
+		STOCKYBOY_TARGET_AVX2 static double SumAVX2(const double* values, size_t count)
+		{
+			__m256d acc0 = _mm256_setzero_pd();
+			__m256d acc1 = _mm256_setzero_pd();
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8) {
+				acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(values + i));
+				acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(values + i + 4));
+			}
+			acc0 = _mm256_add_pd(acc0, acc1);
+			__m128d half = _mm_add_pd(_mm256_castpd256_pd128(acc0), _mm256_extractf128_pd(acc0, 1));
+			half = _mm_add_sd(half, _mm_unpackhi_pd(half, half));
+			return SumScalar(values + i, count - i, _mm_cvtsd_f64(half));
+		}
+
+		STOCKYBOY_TARGET_AVX2 static void ScaleAVX2(const double* values, double* out, size_t count, double factor)
+		{
+			const __m256d f = _mm256_set1_pd(factor);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4) {
+				_mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_loadu_pd(values + i), f));
+			}
+			ScaleScalar(values + i, out + i, count - i, factor);
+		}
+
+		STOCKYBOY_TARGET_AVX2 static void DivideAVX2(const double* values, double* out, size_t count, double divisor)
+		{
+			const __m256d d = _mm256_set1_pd(divisor);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4) {
+				_mm256_storeu_pd(out + i, _mm256_div_pd(_mm256_loadu_pd(values + i), d));
+			}
+			DivideScalar(values + i, out + i, count - i, divisor);
+		}
+
+		STOCKYBOY_TARGET_AVX2 static void PercentChangeAVX2(const double* from, const double* to, double* out, size_t count)
+		{
+			const __m256d hundred = _mm256_set1_pd(100.0);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4) {
+				const __m256d a = _mm256_loadu_pd(from + i);
+				const __m256d b = _mm256_loadu_pd(to + i);
+				_mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_div_pd(_mm256_sub_pd(b, a), a), hundred));
+			}
+			PercentChangeScalar(from + i, to + i, out + i, count - i);
+		}
+
+		STOCKYBOY_TARGET_AVX2 static void RatioAVX2(const double* from, const double* to, double* out, size_t count)
+		{
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4) {
+				_mm256_storeu_pd(out + i, _mm256_div_pd(_mm256_loadu_pd(to + i), _mm256_loadu_pd(from + i)));
+			}
+			RatioScalar(from + i, to + i, out + i, count - i);
+		}
+#endif
+
+		// ====================
+		// Public kernels
+		// ====================
+
+		// SetSimdLevel can select Scalar on x86-64 too, so every path stays reachable
+		double Max(std::span<const double> values)
+		{
+#if defined(STOCKYBOY_X64)
+			const SimdLevel level = ActiveSimdLevel();
+			if (level == SimdLevel::AVX2) return MaxAVX2(values.data(), values.size());
+			if (level == SimdLevel::SSE2) return MaxSSE2(values.data(), values.size());
+#endif
+			return MaxScalar(values.data(), values.size(), NEG_INF);
+		}
+
+		double Min(std::span<const double> values)
+		{
+#if defined(STOCKYBOY_X64)
+			const SimdLevel level = ActiveSimdLevel();
+			if (level == SimdLevel::AVX2) return MinAVX2(values.data(), values.size());
+			if (level == SimdLevel::SSE2) return MinSSE2(values.data(), values.size());
+#endif
+			return MinScalar(values.data(), values.size(), POS_INF);
+		}
+
+		double Sum(std::span<const double> values)
+		{
+#if defined(STOCKYBOY_X64)
+			const SimdLevel level = ActiveSimdLevel();
+			if (level == SimdLevel::AVX2) return SumAVX2(values.data(), values.size());
+			if (level == SimdLevel::SSE2) return SumSSE2(values.data(), values.size());
+#endif
+			return SumScalar(values.data(), values.size(), 0.0);
+		}
+
+		void Scale(std::span<double> values, double factor)
+		{
+			ScaleInto(values, values, factor);
+		}
+
+		void ScaleInto(std::span<const double> values, std::span<double> out, double factor)
+		{
+			const size_t count = std::min(values.size(), out.size());
+#if defined(STOCKYBOY_X64)
+			const SimdLevel level = ActiveSimdLevel();
+			if (level == SimdLevel::AVX2) return ScaleAVX2(values.data(), out.data(), count, factor);
+			if (level == SimdLevel::SSE2) return ScaleSSE2(values.data(), out.data(), count, factor);
+#endif
+			ScaleScalar(values.data(), out.data(), count, factor);
+		}
+
+		void Divide(std::span<double> values, double divisor)
+		{
+			DivideInto(values, values, divisor);
+		}
+
+		void DivideInto(std::span<const double> values, std::span<double> out, double divisor)
+		{
+			const size_t count = std::min(values.size(), out.size());
+#if defined(STOCKYBOY_X64)
+			const SimdLevel level = ActiveSimdLevel();
+			if (level == SimdLevel::AVX2) return DivideAVX2(values.data(), out.data(), count, divisor);
+			if (level == SimdLevel::SSE2) return DivideSSE2(values.data(), out.data(), count, divisor);
+#endif
+			DivideScalar(values.data(), out.data(), count, divisor);
+		}
+
+		void PercentChange(std::span<const double> from, std::span<const double> to, std::span<double> out)
+		{
+			const size_t count = std::min({ from.size(), to.size(), out.size() });
+#if defined(STOCKYBOY_X64)
+			const SimdLevel level = ActiveSimdLevel();
+			if (level == SimdLevel::AVX2) return PercentChangeAVX2(from.data(), to.data(), out.data(), count);
+			if (level == SimdLevel::SSE2) return PercentChangeSSE2(from.data(), to.data(), out.data(), count);
+#endif
+			PercentChangeScalar(from.data(), to.data(), out.data(), count);
+		}
+
+		void LogReturn(std::span<const double> from, std::span<const double> to, std::span<double> out)
+		{
+			const size_t count = std::min({ from.size(), to.size(), out.size() });
+#if defined(STOCKYBOY_X64)
+			const SimdLevel level = ActiveSimdLevel();
+			if (level == SimdLevel::AVX2) RatioAVX2(from.data(), to.data(), out.data(), count);
+			else if (level == SimdLevel::SSE2) RatioSSE2(from.data(), to.data(), out.data(), count);
+			else RatioScalar(from.data(), to.data(), out.data(), count);
+#else
+			RatioScalar(from.data(), to.data(), out.data(), count);
+#endif
+
+			// No vector log without an SVML-style library, the divides above are the part worth vectorizing
+			for (size_t i = 0; i < count; ++i) out[i] = std::log(out[i]);
+		}
+	}
+}
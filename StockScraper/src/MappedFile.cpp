@@ -0,0 +1,152 @@
+#include "pch.h"
+
+#include "MappedFile.hpp"
+
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h> // WIN32_LEAN_AND_MEAN and NOMINMAX are set for the target in CMakeLists.txt
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace StockyBoy {
+	namespace Scraper {
+		bool SwapInTempFile(const std::filesystem::path& tempPath, const std::filesystem::path& path)
+		{
+			std::error_code ec;
+			std::filesystem::rename(tempPath, path, ec);
+			if (ec) {
+				std::filesystem::remove(path, ec);
+				std::filesystem::rename(tempPath, path, ec);
+			}
+			return !ec;
+		}
+
+		MappedFile::MappedFile(MappedFile&& other) noexcept
+		{
+			*this = std::move(other);
+		}
+
+		MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+		{
+			if (this != &other) {
+				Close();
+
+				Data = std::exchange(other.Data, nullptr);
+				Size = std::exchange(other.Size, 0);
+#ifdef _WIN32
+				FileHandle = std::exchange(other.FileHandle, nullptr);
+				MappingHandle = std::exchange(other.MappingHandle, nullptr);
+#else
+				FileDescriptor = std::exchange(other.FileDescriptor, -1);
+#endif
+			}
+			return *this;
+		}
+
+		MappedFile::~MappedFile()
+		{
+			Close();
+		}
+
+#ifdef _WIN32
+		Result MappedFile::Open(const std::filesystem::path& path)
+		{
+			Close();
+
+			HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+				OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+			if (file == INVALID_HANDLE_VALUE) {
+				return Result::Fail("[StockyBoy][MappedFile] Can't open: " + path.string());
+			}
+			FileHandle = file;
+
+			LARGE_INTEGER fileSize{};
+			if (!GetFileSizeEx(file, &fileSize)) {
+				Close();
+				return Result::Fail("[StockyBoy][MappedFile] Can't read size of: " + path.string());
+			}
+
+			if (fileSize.QuadPart == 0) {
+				return Result::Ok(); // nothing to map, empty view
+			}
+
+			HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (!mapping) {
+				Close();
+				return Result::Fail("[StockyBoy][MappedFile] Can't create mapping for: " + path.string());
+			}
+			MappingHandle = mapping;
+
+			void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			if (!view) {
+				Close();
+				return Result::Fail("[StockyBoy][MappedFile] Can't map view of: " + path.string());
+			}
+
+			Data = static_cast<const std::byte*>(view);
+			Size = static_cast<size_t>(fileSize.QuadPart);
+
+			return Result::Ok();
+		}
+
+		void MappedFile::Close()
+		{
+			if (Data) UnmapViewOfFile(Data);
+			if (MappingHandle) CloseHandle(MappingHandle);
+			if (FileHandle) CloseHandle(FileHandle);
+
+			Data = nullptr;
+			Size = 0;
+			MappingHandle = nullptr;
+			FileHandle = nullptr;
+		}
+#else
+		Result MappedFile::Open(const std::filesystem::path& path)
+		{
+			Close();
+
+			int fd = ::open(path.c_str(), O_RDONLY);
+			if (fd < 0) {
+				return Result::Fail("[StockyBoy][MappedFile] Can't open: " + path.string());
+			}
+			FileDescriptor = fd;
+
+			struct stat st {};
+			if (::fstat(fd, &st) != 0) {
+				Close();
+				return Result::Fail("[StockyBoy][MappedFile] Can't read size of: " + path.string());
+			}
+
+			if (st.st_size == 0) {
+				return Result::Ok(); // nothing to map, empty view
+			}
+
+			void* view = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+			if (view == MAP_FAILED) {
+				Close();
+				return Result::Fail("[StockyBoy][MappedFile] Can't map: " + path.string());
+			}
+
+			Data = static_cast<const std::byte*>(view);
+			Size = static_cast<size_t>(st.st_size);
+
+			return Result::Ok();
+		}
+
+		void MappedFile::Close()
+		{
+			if (Data) ::munmap(const_cast<std::byte*>(Data), Size);
+			if (FileDescriptor >= 0) ::close(FileDescriptor);
+
+			Data = nullptr;
+			Size = 0;
+			FileDescriptor = -1;
+		}
+#endif
+	}
+}
@@ -0,0 +1,289 @@
+#include "pch.h"
+
+#include "MarketDataProvider.hpp"
+#include "BarCache.hpp"
+#include "MappedFile.hpp"
+
+#include <cmath>
+#include <chrono>
+#include <mutex>
+#include <cctype>
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		Result MarketDataProvider::FetchBars(const FetchRequest& request, StockTable& out_Table)
+		{
+			std::vector<BarResponse> responses = FetchBars(std::vector<FetchRequest>{ request }, 1);
+			if (responses.empty()) {
+				return Result::Fail("[StockyBoy][MarketData] No response");
+			}
+
+			if (responses.front().result.succeeded) {
+				out_Table = std::move(responses.front().table);
+			}
+			return responses.front().result;
+		}
+
+		// ====================
+		// Yahoo
+		// ====================
+
+		YahooProvider& YahooProvider::Default()
+		{
+			static YahooProvider provider;
+			return provider;
+		}
+
+		std::vector<BarResponse> YahooProvider::FetchBars(const std::vector<FetchRequest>& requests, size_t maxConcurrent)
+		{
+			std::vector<FetchResponse> downloads = FetchBatch(requests, maxConcurrent, Retry);
+			std::vector<BarResponse> responses(downloads.size());
+
+			ResponseArena& arena = ResponseArena::ForThread();
+			for (size_t i = 0; i < downloads.size(); ++i) {
+				responses[i].result = downloads[i].result;
+				if (responses[i].result.succeeded) {
+					responses[i].result = getStockTable(downloads[i].data, responses[i].table);
+				}
+				arena.Recycle(std::move(downloads[i].data));
+			}
+
+			return responses;
+		}
+
+		Result YahooProvider::FetchQuotes(std::span<const std::string> symbols, std::vector<Quote>& out_Quotes)
+		{
+			return Scraper::FetchQuotes(symbols, out_Quotes, Retry);
+		}
+
+		// ====================
+		// Recordings
+		// ====================
+
+		static std::string SanitizeFileName(const std::string& label) {
+			std::string out;
+			out.reserve(label.size());
+
+			for (unsigned char c : label) {
+				out.push_back((std::isalnum(c) || c == '.' || c == '-') ? static_cast<char>(c) : '_');
+			}
+
+			return out;
+		}
+
+		// Record merges into the file that FetchBars may be reading on another thread
+		static std::mutex& RecordingMutex() {
+			static std::mutex mutex;
+			return mutex;
+		}
+
+		static Result ReadRecording(const std::filesystem::path& path, StockTable& out_Table) {
+			std::ifstream file(path, std::ios::binary);
+			if (!file) {
+				return Result::Fail("[StockyBoy][Replay] No recording: " + path.string(), ErrorKind::NOT_FOUND);
+			}
+
+			const std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+			return getStockTable(data, out_Table);
+		}
+
+		// Keeps the bars with first <= epoch < last
+		static void Trim(StockTable& table, int64_t first, int64_t last) {
+			const size_t begin = static_cast<size_t>(std::lower_bound(table.epochs.begin(), table.epochs.end(), first) - table.epochs.begin());
+			const size_t end = static_cast<size_t>(std::lower_bound(table.epochs.begin(), table.epochs.end(), last) - table.epochs.begin());
+			if (begin == 0 && end == table.epochs.size()) {
+				return;
+			}
+
+			auto slice = [begin, end](auto& column) {
+				column.erase(column.begin() + end, column.end());
+				column.erase(column.begin(), column.begin() + begin);
+				};
+
+			slice(table.epochs);
+			slice(table.open);
+			slice(table.high);
+			slice(table.low);
+			slice(table.close);
+			slice(table.volume);
+
+			IndexTimeAxis(table);
+		}
+
+		// First epoch a range covers, counting back from `last`
+		static int64_t RangeStart(RANGE range, int64_t last) {
+			if (range == RANGE_MAX) {
+				return INT64_MIN;
+			}
+
+			if (range == RANGE_YTD) {
+				const std::chrono::sys_days day = std::chrono::floor<std::chrono::days>(std::chrono::sys_seconds{ std::chrono::seconds{ last } });
+				const std::chrono::year_month_day date{ day };
+				return std::chrono::sys_seconds{ std::chrono::sys_days{ date.year() / std::chrono::January / 1 } }.time_since_epoch().count();
+			}
+
+			return last - ToSeconds(range);
+		}
+
+		ReplayProvider::ReplayProvider(const std::filesystem::path& directory)
+			: Directory(directory)
+		{
+		}
+
+		std::filesystem::path ReplayProvider::PathFor(const std::filesystem::path& directory, const std::string& label, INTERVAL interval)
+		{
+			return directory / (SanitizeFileName(label) + "_" + ToString(interval) + ".json");
+		}
+
+		std::vector<BarResponse> ReplayProvider::FetchBars(const std::vector<FetchRequest>& requests, size_t)
+		{
+			std::vector<BarResponse> responses(requests.size());
+
+			std::lock_guard<std::mutex> lock(RecordingMutex());
+			for (size_t i = 0; i < requests.size(); ++i) {
+				const FetchRequest& request = requests[i];
+				BarResponse& response = responses[i];
+
+				response.result = ReadRecording(PathFor(Directory, request.label, request.interval), response.table);
+				if (!response.result.succeeded || response.table.empty()) {
+					continue;
+				}
+
+				if (request.period2 > 0) {
+					Trim(response.table, request.period1, request.period2);
+				}
+				else {
+					Trim(response.table, RangeStart(request.range, response.table.epochs.back()), INT64_MAX);
+				}
+			}
+
+			return responses;
+		}
+
+		Result ReplayProvider::FetchQuotes(std::span<const std::string> symbols, std::vector<Quote>& out_Quotes)
+		{
+			out_Quotes.clear();
+
+			std::lock_guard<std::mutex> lock(RecordingMutex());
+			for (const std::string& symbol : symbols) {
+				for (int interval = 0; interval < INTERVAL_COUNT; ++interval) {
+					StockTable table;
+					if (!ReadRecording(PathFor(Directory, symbol, static_cast<INTERVAL>(interval)), table).succeeded || table.empty()) {
+						continue;
+					}
+
+					// A recorded null reads back as 0, like the live providers the last real close is the price
+					size_t last = table.size();
+					while (last > 0 && !(std::isfinite(table.close[last - 1]) && table.close[last - 1] > 0.0)) {
+						--last;
+					}
+					if (last == 0) {
+						continue;
+					}
+
+					out_Quotes.push_back(Quote{ .symbol = symbol, .price = table.close[last - 1], .time = table.epochs[last - 1] });
+					break;
+				}
+			}
+
+			return Result::Ok();
+		}
+
+		std::string ReplayProvider::ToChartJson(const StockTable& table)
+		{
+			nlohmann::json quote = {
+				{ "open", table.open },
+				{ "high", table.high },
+				{ "low", table.low },
+				{ "close", table.close },
+				{ "volume", table.volume }
+			};
+
+			nlohmann::json result = {
+				{ "timestamp", table.epochs },
+				{ "indicators", { { "quote", nlohmann::json::array({ std::move(quote) }) } } }
+			};
+
+			nlohmann::json chart = { { "chart", { { "result", nlohmann::json::array({ std::move(result) }) }, { "error", nullptr } } } };
+			return chart.dump();
+		}
+
+		Result ReplayProvider::Record(const std::filesystem::path& directory, const std::string& label, INTERVAL interval, const StockTable& table)
+		{
+			const std::filesystem::path path = PathFor(directory, label, interval);
+
+			std::lock_guard<std::mutex> lock(RecordingMutex());
+
+			StockTable recorded;
+			ReadRecording(path, recorded); // a new recording when missing
+			BarCache::Merge(recorded, table, interval);
+
+			std::error_code ec;
+			std::filesystem::create_directories(directory, ec);
+
+			std::filesystem::path tempPath = path;
+			tempPath += ".tmp";
+
+			{
+				std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+				if (!file) {
+					return Result::Fail("[StockyBoy][Replay] Can't write recording: " + tempPath.string());
+				}
+
+				file << ToChartJson(recorded);
+
+				if (!file) {
+					return Result::Fail("[StockyBoy][Replay] Failed writing recording: " + tempPath.string());
+				}
+			}
+
+			if (!SwapInTempFile(tempPath, path)) {
+				return Result::Fail("[StockyBoy][Replay] Can't replace recording: " + path.string());
+			}
+
+			return Result::Ok();
+		}
+
+		RecordingProvider::RecordingProvider(MarketDataProvider& source, const std::filesystem::path& directory)
+			: Source(source), Directory(directory)
+		{
+		}
+
+		std::vector<BarResponse> RecordingProvider::FetchBars(const std::vector<FetchRequest>& requests, size_t maxConcurrent)
+		{
+			std::vector<BarResponse> responses = Source.FetchBars(requests, maxConcurrent);
+
+			for (size_t i = 0; i < responses.size(); ++i) {
+				if (!responses[i].result.succeeded || responses[i].table.empty()) {
+					continue;
+				}
+
+				const Result recorded = ReplayProvider::Record(Directory, requests[i].label, requests[i].interval, responses[i].table);
+				if (!recorded.succeeded) {
+					std::lock_guard<std::mutex> lock(mutex);
+					if (Failures++ == 0) {
+						FirstFailure = recorded;
+					}
+				}
+			}
+
+			return responses;
+		}
+
+		Result RecordingProvider::recordResult() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (Failures == 0) {
+				return Result::Ok();
+			}
+
+			return Result::Fail(FirstFailure.error + " (" + std::to_string(Failures) + " recordings not written)", FirstFailure.kind);
+		}
+
+		Result RecordingProvider::FetchQuotes(std::span<const std::string> symbols, std::vector<Quote>& out_Quotes)
+		{
+			return Source.FetchQuotes(symbols, out_Quotes);
+		}
+	}
+}
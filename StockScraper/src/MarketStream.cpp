@@ -0,0 +1,159 @@
+#include "pch.h"
+
+#include "MarketStream.hpp"
+#include "WebSocket.hpp"
+#include "WireFormat.hpp"
+
+#include <chrono>
+#include <algorithm>
+#include <unordered_set>
+
+namespace StockyBoy {
+	namespace Scraper {
+		namespace Alpaca {
+			// How long one wait on the socket lasts, which bounds how late Stop and new subscriptions are noticed
+			static constexpr long POLL_INTERVAL_MS = 250;
+
+			// Alpaca's "auth failed" error code, reconnecting won't fix it
+			static constexpr int AUTH_FAILED = 402;
+
+			MarketStream::MarketStream(const Account& account, BarBuilder& bars, std::string url, bool quotes)
+				: StreamClient(std::move(url)), Key(account.Key), Secret(account.Secret), Quotes(quotes), Bars(bars)
+			{
+			}
+
+			MarketStream::~MarketStream()
+			{
+				Stop();
+			}
+
+			void MarketStream::Subscribe(const std::vector<std::string>& symbols)
+			{
+				for (const std::string& symbol : symbols) {
+					Bars.Track(symbol);
+				}
+
+				std::lock_guard<std::mutex> lock(mutex);
+				for (const std::string& symbol : symbols) {
+					if (std::find(Wanted.begin(), Wanted.end(), symbol) == Wanted.end()) {
+						Wanted.push_back(symbol);
+						wantedChanged = true;
+					}
+				}
+			}
+
+			Result MarketStream::Session(bool& out_Retry)
+			{
+				if (Key.empty() || Secret.empty()) {
+					out_Retry = false;
+					return Result::Fail("[StockyBoy][MarketStream] Account Wrongly/Not fully initialized");
+				}
+
+				WebSocket socket;
+				Result result = socket.Connect(Url);
+				if (!result.succeeded) {
+					return result;
+				}
+
+				bool authenticated = false;
+				std::unordered_set<std::string> subscribed; // per connection, a reconnect subscribes everything again
+
+				std::string message;
+				while (true) {
+					if (Stopping()) {
+						return Result::Ok();
+					}
+
+					// --- Subscribe whatever was added since the last pass ---
+					if (authenticated) {
+						std::vector<std::string> added;
+						{
+							std::lock_guard<std::mutex> lock(mutex);
+							if (wantedChanged || subscribed.size() < Wanted.size()) {
+								for (const std::string& symbol : Wanted) {
+									if (!subscribed.contains(symbol)) added.push_back(symbol);
+								}
+								wantedChanged = false;
+							}
+						}
+
+						if (!added.empty()) {
+							nlohmann::json subscribe = { { "action", "subscribe" }, { "trades", added } };
+							if (Quotes) subscribe["quotes"] = added;
+
+							result = socket.SendText(subscribe.dump());
+							if (!result.succeeded) {
+								return result;
+							}
+							subscribed.insert(added.begin(), added.end());
+						}
+					}
+
+					result = socket.Receive(message, POLL_INTERVAL_MS);
+					if (!result.succeeded) {
+						return result;
+					}
+					if (message.empty()) {
+						continue;
+					}
+
+					// Every message is an array, trades of several symbols come batched
+					nlohmann::json json = nlohmann::json::parse(message, nullptr, false);
+					if (json.is_discarded() || !json.is_array()) {
+						continue;
+					}
+
+					for (const nlohmann::json& item : json) {
+						if (!item.is_object()) continue;
+
+						auto typeIt = item.find("T");
+						if (typeIt == item.end() || !typeIt->is_string()) continue;
+						const std::string& type = typeIt->get_ref<const std::string&>();
+
+						if (type == "t" || type == "q") {
+							auto symbolIt = item.find("S");
+							auto timeIt = item.find("t");
+							if (symbolIt == item.end() || !symbolIt->is_string() || timeIt == item.end() || !timeIt->is_string()) continue;
+
+							const int64_t epochMs = ParseTimestampMs(timeIt->get_ref<const std::string&>());
+							if (epochMs < 0) continue;
+
+							const std::string& symbol = symbolIt->get_ref<const std::string&>();
+							if (type == "t") {
+								Bars.OnTick(symbol, epochMs, JsonNumber(item, "p"), JsonNumber(item, "s"));
+							}
+							else {
+								const double bid = JsonNumber(item, "bp");
+								const double ask = JsonNumber(item, "ap");
+								if (bid > 0.0 && ask > 0.0) {
+									Bars.OnTick(symbol, epochMs, (bid + ask) / 2.0, 0.0);
+								}
+							}
+						}
+						else if (type == "success") {
+							const std::string msg = item.value("msg", "");
+							if (msg == "connected") {
+								nlohmann::json auth = { { "action", "auth" }, { "key", Key }, { "secret", Secret } };
+								result = socket.SendText(auth.dump());
+								if (!result.succeeded) {
+									return result;
+								}
+							}
+							else if (msg == "authenticated") {
+								authenticated = true;
+								SetReady(true);
+							}
+						}
+						else if (type == "error") {
+							const int code = item.value("code", 0);
+							if (code == AUTH_FAILED) {
+								out_Retry = false;
+							}
+							return Result::Fail("[StockyBoy][MarketStream] Error " + std::to_string(code) + ": " + item.value("msg", ""));
+						}
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,104 @@
+#include "pch.h"
+
+#include "OrderQueue.hpp"
+
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		namespace Alpaca {
+			OrderQueue::OrderQueue(Account& account, size_t maxInFlight)
+				: account(account)
+			{
+				maxInFlight = std::max<size_t>(maxInFlight, 1);
+				for (size_t i = 0; i < maxInFlight; ++i) {
+					workers.emplace_back(&OrderQueue::Work, this);
+				}
+			}
+
+			OrderQueue::~OrderQueue()
+			{
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					stopping = true;
+				}
+				wake.notify_all();
+
+				for (std::thread& worker : workers) {
+					worker.join();
+				}
+			}
+
+			std::future<Result> OrderQueue::Submit(Order order, OnResult onResult)
+			{
+				std::future<Result> future;
+				{
+					std::lock_guard<std::mutex> lock(mutex);
+					Pending& entry = pending.emplace_back(Pending{ .order = std::move(order), .promise = {}, .onResult = std::move(onResult) });
+					future = entry.promise.get_future();
+				}
+				wake.notify_one();
+
+				return future;
+			}
+
+			std::vector<Result> OrderQueue::SubmitAll(const std::vector<Order>& orders)
+			{
+				std::vector<std::future<Result>> futures;
+				futures.reserve(orders.size());
+				for (const Order& order : orders) {
+					futures.push_back(Submit(order));
+				}
+
+				std::vector<Result> results;
+				results.reserve(orders.size());
+				for (std::future<Result>& future : futures) {
+					results.push_back(future.get());
+				}
+				return results;
+			}
+
+			void OrderQueue::Work()
+			{
+				std::vector<Pending> taken;
+				std::vector<Order> batch;
+
+				while (true) {
+					{
+						std::unique_lock<std::mutex> lock(mutex);
+						wake.wait(lock, [this] { return stopping || !pending.empty(); });
+
+						// Drain before stopping: every submitted future gets a result
+						if (pending.empty()) {
+							return;
+						}
+
+						// An even share of the backlog, so every worker has a batch in flight on its own connection
+						const size_t share = (pending.size() + workers.size() - 1) / workers.size();
+
+						taken.clear();
+						for (size_t i = 0; i < share; ++i) {
+							taken.push_back(std::move(pending.front()));
+							pending.pop_front();
+						}
+					}
+
+					batch.clear();
+					for (Pending& entry : taken) {
+						batch.push_back(std::move(entry.order));
+					}
+
+					// One leased handle for the whole batch
+					std::vector<Result> results = account.SubmitOrders(batch);
+
+					for (size_t i = 0; i < taken.size(); ++i) {
+						if (taken[i].onResult) {
+							taken[i].onResult(batch[i], results[i]);
+						}
+						taken[i].promise.set_value(std::move(results[i]));
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,121 @@
+#include "pch.h"
+
+#include "PositionBook.hpp"
+
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		namespace Alpaca {
+			// Fractional shares: anything below this is a closed position
+			static constexpr float MIN_QTY = 1e-6f;
+
+			Result PositionBook::SyncPositions(Account& account)
+			{
+				std::vector<Position> positions;
+				Result result = account.GetPositions(positions);
+				if (!result.succeeded) {
+					return result;
+				}
+
+				SetPositions(std::move(positions));
+				return Result::Ok();
+			}
+
+			Result PositionBook::SyncOpenOrders(Account& account)
+			{
+				std::vector<OpenOrder> orders;
+				Result result = account.GetOpenOrders(orders);
+				if (!result.succeeded) {
+					return result;
+				}
+
+				SetOpenOrders(std::move(orders));
+				return Result::Ok();
+			}
+
+			void PositionBook::SetPositions(std::vector<Position> positions)
+			{
+				Positions.clear();
+				Positions.reserve(positions.size());
+				for (Position& position : positions) {
+					std::string symbol = position.symbol;
+					Positions.insert_or_assign(std::move(symbol), std::move(position));
+				}
+			}
+
+			void PositionBook::SetOpenOrders(std::vector<OpenOrder> orders)
+			{
+				Orders = std::move(orders);
+			}
+
+			void PositionBook::ApplyFill(const std::string& symbol, Action action, float qty, float price)
+			{
+				if (qty <= 0.0f) return;
+
+				auto it = Positions.find(symbol);
+
+				if (action == Action::BUY) {
+					if (it == Positions.end()) {
+						it = Positions.emplace(symbol, Position{ .symbol = symbol }).first;
+					}
+
+					Position& position = it->second;
+					const float total = position.qty + qty;
+					position.qtyText.clear();
+					position.avgEntryPrice = (position.avgEntryPrice * position.qty + price * qty) / total;
+					position.qty = total;
+					position.currentPrice = price;
+					position.marketValue = total * price;
+					return;
+				}
+
+				if (it == Positions.end()) return;
+
+				Position& position = it->second;
+				position.qty -= qty;
+				position.qtyText.clear();
+				if (position.qty <= MIN_QTY) {
+					Positions.erase(it);
+					return;
+				}
+				position.currentPrice = price;
+				position.marketValue = position.qty * price;
+			}
+
+			void PositionBook::Upsert(Position position)
+			{
+				std::string symbol = position.symbol;
+				Positions.insert_or_assign(std::move(symbol), std::move(position));
+			}
+
+			void PositionBook::Erase(const std::string& symbol)
+			{
+				Positions.erase(symbol);
+			}
+
+			void PositionBook::AddOpenOrder(OpenOrder order)
+			{
+				Orders.push_back(std::move(order));
+			}
+
+			void PositionBook::RemoveOpenOrder(const std::string& id)
+			{
+				std::erase_if(Orders, [&id](const OpenOrder& order) { return order.id == id; });
+			}
+
+			const Position* PositionBook::Find(const std::string& symbol) const
+			{
+				auto it = Positions.find(symbol);
+				return (it == Positions.end()) ? nullptr : &it->second;
+			}
+
+			bool PositionBook::HasOpenOrder(const std::string& symbol, Action action) const
+			{
+				return std::any_of(Orders.begin(), Orders.end(), [&](const OpenOrder& order) {
+					return order.symbol == symbol && order.action == action;
+					});
+			}
+		}
+	}
+}
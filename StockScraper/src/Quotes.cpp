@@ -0,0 +1,190 @@
+#include "pch.h"
+
+#include "Quotes.hpp"
+#include "BatchFetch.hpp"
+#include "WireFormat.hpp"
+
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		Result GetQuoteURL(std::span<const std::string> symbols, std::string& out_URL)
+		{
+			if (symbols.empty()) {
+				return Result::Fail("[StockyBoy][Quotes] No symbols.", ErrorKind::INVALID);
+			}
+			if (symbols.size() > QUOTE_BATCH_SIZE) {
+				return Result::Fail("[StockyBoy][Quotes] Too many symbols for one request: " + std::to_string(symbols.size()), ErrorKind::INVALID);
+			}
+
+			// Symbols like ^GSPC or BRK-B go into the query string percent-encoded
+			out_URL = "https://query1.finance.yahoo.com/v7/finance/spark?symbols=";
+			for (size_t i = 0; i < symbols.size(); ++i) {
+				if (i > 0) out_URL += "%2C";
+				AppendEncoded(out_URL, symbols[i]);
+			}
+			out_URL += "&range=1d&interval=5m";
+
+			return Result::Ok();
+		}
+
+		// --- Spark parsing ---
+
+		// Last non-null close and its timestamp; keeps `price`/`time` when the series has none
+		static void LastClose(const nlohmann::json& closes, const nlohmann::json* timestamps, double& price, int64_t& time) {
+			if (!closes.is_array()) return;
+
+			for (size_t i = closes.size(); i-- > 0; ) {
+				if (!closes[i].is_number()) continue;
+
+				price = closes[i].get<double>();
+				if (timestamps && timestamps->is_array() && i < timestamps->size() && (*timestamps)[i].is_number()) {
+					time = (*timestamps)[i].get<int64_t>();
+				}
+				return;
+			}
+		}
+
+		static void AddQuote(std::vector<Quote>& out_Quotes, std::string symbol, double price, int64_t time) {
+			if (symbol.empty() || !(price > 0.0)) return;
+			out_Quotes.push_back(Quote{ .symbol = std::move(symbol), .price = price, .time = time });
+		}
+
+		// {"spark":{"result":[{"symbol":..,"response":[{"meta":{..},"timestamp":[..],"indicators":{"quote":[{"close":[..]}]}}]}]}}
+		static void ParseSparkResult(const nlohmann::json& results, std::vector<Quote>& out_Quotes) {
+			if (!results.is_array()) return;
+
+			for (const nlohmann::json& result : results) {
+				if (!result.is_object()) continue;
+
+				auto symbolIt = result.find("symbol");
+				auto responseIt = result.find("response");
+				if (symbolIt == result.end() || !symbolIt->is_string() ||
+					responseIt == result.end() || !responseIt->is_array() || responseIt->empty()) {
+					continue;
+				}
+
+				const nlohmann::json& chart = responseIt->front();
+				if (!chart.is_object()) continue;
+
+				double price = 0.0;
+				int64_t time = 0;
+
+				auto metaIt = chart.find("meta");
+				if (metaIt != chart.end() && metaIt->is_object()) {
+					price = JsonNumber(*metaIt, "regularMarketPrice", JsonNumber(*metaIt, "chartPreviousClose", 0.0));
+					time = static_cast<int64_t>(JsonNumber(*metaIt, "regularMarketTime", 0.0));
+				}
+
+				auto timestampIt = chart.find("timestamp");
+				const nlohmann::json* timestamps = (timestampIt != chart.end()) ? &*timestampIt : nullptr;
+
+				auto indicatorsIt = chart.find("indicators");
+				if (indicatorsIt != chart.end() && indicatorsIt->is_object()) {
+					auto quoteIt = indicatorsIt->find("quote");
+					if (quoteIt != indicatorsIt->end() && quoteIt->is_array() && !quoteIt->empty() && quoteIt->front().is_object()) {
+						auto closeIt = quoteIt->front().find("close");
+						if (closeIt != quoteIt->front().end()) {
+							LastClose(*closeIt, timestamps, price, time);
+						}
+					}
+				}
+
+				AddQuote(out_Quotes, symbolIt->get<std::string>(), price, time);
+			}
+		}
+
+		// {"AAPL":{"symbol":"AAPL","timestamp":[..],"close":[..],"chartPreviousClose":..}, ...}
+		static void ParseSparkMap(const nlohmann::json& root, std::vector<Quote>& out_Quotes) {
+			for (auto it = root.begin(); it != root.end(); ++it) {
+				const nlohmann::json& entry = it.value();
+				if (!entry.is_object()) continue;
+
+				double price = JsonNumber(entry, "chartPreviousClose", JsonNumber(entry, "previousClose", 0.0));
+				int64_t time = 0;
+
+				auto timestampIt = entry.find("timestamp");
+				auto closeIt = entry.find("close");
+				if (closeIt != entry.end()) {
+					LastClose(*closeIt, (timestampIt != entry.end()) ? &*timestampIt : nullptr, price, time);
+				}
+
+				auto symbolIt = entry.find("symbol");
+				AddQuote(out_Quotes, (symbolIt != entry.end() && symbolIt->is_string()) ? symbolIt->get<std::string>() : it.key(), price, time);
+			}
+		}
+
+		Result ParseQuotes(const std::string& data, std::vector<Quote>& out_Quotes)
+		{
+			nlohmann::json root = nlohmann::json::parse(data, nullptr, false);
+			if (root.is_discarded() || !root.is_object()) {
+				return Result::Fail("[StockyBoy][Quotes] Malformed spark response", ErrorKind::INVALID);
+			}
+
+			auto sparkIt = root.find("spark");
+			if (sparkIt != root.end()) {
+				if (!sparkIt->is_object()) {
+					return Result::Fail("[StockyBoy][Quotes] Malformed spark response", ErrorKind::INVALID);
+				}
+
+				auto resultIt = sparkIt->find("result");
+				if (resultIt == sparkIt->end() || !resultIt->is_array()) {
+					auto errorIt = sparkIt->find("error");
+					const std::string error = (errorIt != sparkIt->end() && !errorIt->is_null()) ? errorIt->dump() : "no result";
+					return Result::Fail("[StockyBoy][Quotes] Spark error: " + error, ErrorKind::NO_DATA);
+				}
+
+				ParseSparkResult(*resultIt, out_Quotes);
+				return Result::Ok();
+			}
+
+			ParseSparkMap(root, out_Quotes);
+			return Result::Ok();
+		}
+
+		Result FetchQuotes(std::span<const std::string> symbols, std::vector<Quote>& out_Quotes, const RetryPolicy& retry)
+		{
+			out_Quotes.clear();
+			if (symbols.empty()) {
+				return Result::Ok();
+			}
+
+			// --- One URL per batch of symbols ---
+			std::vector<std::string> urls;
+			urls.reserve((symbols.size() + QUOTE_BATCH_SIZE - 1) / QUOTE_BATCH_SIZE);
+			for (size_t first = 0; first < symbols.size(); first += QUOTE_BATCH_SIZE) {
+				std::string url;
+				Result result = GetQuoteURL(symbols.subspan(first, std::min(QUOTE_BATCH_SIZE, symbols.size() - first)), url);
+				if (!result.succeeded) {
+					return result;
+				}
+				urls.push_back(std::move(url));
+			}
+
+			std::vector<FetchResponse> responses = FetchUrls(urls, 16, retry);
+
+			// --- Parse what came back, one failed batch only loses its own symbols ---
+			out_Quotes.reserve(symbols.size());
+			ResponseArena& arena = ResponseArena::ForThread();
+			Result firstError = Result::Ok();
+			size_t answered = 0;
+
+			for (FetchResponse& response : responses) {
+				Result result = response.result;
+				if (result.succeeded) {
+					result = ParseQuotes(response.data, out_Quotes);
+				}
+				arena.Recycle(std::move(response.data));
+
+				if (result.succeeded) {
+					++answered;
+				}
+				else if (firstError.succeeded) {
+					firstError = result;
+				}
+			}
+
+			return (answered > 0) ? Result::Ok() : firstError;
+		}
+	}
+}
@@ -0,0 +1,214 @@
+#include "pch.h"
+
+#include "RateLimiter.hpp"
+
+#include <thread>
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		TokenBucket::TokenBucket(double burst, double perSecond)
+			: Burst(std::max(burst, 1.0)), PerSecond(std::max(perSecond, 1e-6)), Tokens(Burst), Last(Clock::now())
+		{
+		}
+
+		void TokenBucket::RefillLocked(Clock::time_point now)
+		{
+			const double elapsed = std::chrono::duration<double>(now - Last).count();
+			Tokens = std::min(Burst, Tokens + elapsed * PerSecond);
+			Last = now;
+		}
+
+		void TokenBucket::Acquire()
+		{
+			while (true) {
+				Clock::duration wait;
+				{
+					std::lock_guard<std::mutex> lock(Mutex);
+					RefillLocked(Clock::now());
+					if (Tokens >= 1.0) {
+						Tokens -= 1.0;
+						return;
+					}
+					wait = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>((1.0 - Tokens) / PerSecond));
+				}
+				std::this_thread::sleep_for(wait);
+			}
+		}
+
+		bool TokenBucket::TryAcquire()
+		{
+			std::lock_guard<std::mutex> lock(Mutex);
+			RefillLocked(Clock::now());
+			if (Tokens < 1.0) {
+				return false;
+			}
+			Tokens -= 1.0;
+			return true;
+		}
+
+		TokenBucket::Clock::duration TokenBucket::Wait()
+		{
+			std::lock_guard<std::mutex> lock(Mutex);
+			RefillLocked(Clock::now());
+			if (Tokens >= 1.0) {
+				return Clock::duration::zero();
+			}
+			return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>((1.0 - Tokens) / PerSecond));
+		}
+
+		void TokenBucket::SetRate(double perSecond)
+		{
+			std::lock_guard<std::mutex> lock(Mutex);
+			RefillLocked(Clock::now()); // tokens earned so far at the old rate
+			PerSecond = std::max(perSecond, 1e-6);
+		}
+
+		double TokenBucket::rate()
+		{
+			std::lock_guard<std::mutex> lock(Mutex);
+			return PerSecond;
+		}
+
+		// ====================
+		// RateGovernor
+		// ====================
+
+		RateGovernor::Host::Host(const Limits& limits)
+			: limits(limits), bucket(limits.burst, limits.initialRate), rate(limits.initialRate)
+		{
+		}
+
+		RateGovernor& RateGovernor::Get()
+		{
+			static RateGovernor governor;
+			return governor;
+		}
+
+		RateGovernor::Host& RateGovernor::HostLocked(const std::string& host)
+		{
+			auto it = Hosts.find(host);
+			if (it == Hosts.end()) {
+				auto limits = HostLimits.find(host);
+				it = Hosts.emplace(host, std::make_unique<Host>((limits != HostLimits.end()) ? limits->second : DefaultLimits)).first;
+			}
+			return *it->second;
+		}
+
+		RateGovernor::Second& RateGovernor::SecondLocked(Host& state, Clock::time_point now)
+		{
+			const int64_t stamp = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+			Second& second = state.window[static_cast<size_t>(stamp) % WINDOW_SECONDS];
+			if (second.stamp != stamp) {
+				second = Second{ .stamp = stamp };
+			}
+			return second;
+		}
+
+		void RateGovernor::SetLimits(const std::string& host, const Limits& limits)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			HostLimits[host] = limits;
+		}
+
+		void RateGovernor::Acquire(const std::string& host)
+		{
+			Clock::duration wait;
+			while (!TryAcquire(host, wait)) {
+				std::this_thread::sleep_for(wait);
+			}
+		}
+
+		bool RateGovernor::TryAcquire(const std::string& host, Clock::duration& out_Wait)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			Host& state = HostLocked(host);
+
+			const Clock::time_point now = Clock::now();
+			if (now < state.pausedUntil) {
+				out_Wait = state.pausedUntil - now;
+				return false;
+			}
+
+			if (!state.bucket.TryAcquire()) {
+				out_Wait = std::max<Clock::duration>(state.bucket.Wait(), std::chrono::milliseconds(1));
+				return false;
+			}
+
+			++state.requests;
+			++SecondLocked(state, now).requests;
+			out_Wait = Clock::duration::zero();
+			return true;
+		}
+
+		void RateGovernor::OnResult(const std::string& host, const Result& result, Clock::duration retryAfter)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			Host& state = HostLocked(host);
+			const Clock::time_point now = Clock::now();
+
+			if (result.succeeded) {
+				state.rate = std::min(state.limits.maxRate, state.rate + state.limits.increase);
+				state.bucket.SetRate(state.rate);
+				return;
+			}
+
+			++state.failures;
+			++SecondLocked(state, now).failures;
+
+			if (result.kind == ErrorKind::THROTTLED) {
+				++state.throttled;
+				state.rate = std::max(state.limits.minRate, state.rate * state.limits.decrease);
+				state.bucket.SetRate(state.rate);
+
+				// Without a Retry-After, at least let the halved rate show before the next one goes out
+				const Clock::duration pause = std::max<Clock::duration>(retryAfter, std::chrono::seconds(1));
+				state.pausedUntil = std::max(state.pausedUntil, now + pause);
+			}
+		}
+
+		void RateGovernor::OnRetry(const std::string& host)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			++HostLocked(host).retries;
+		}
+
+		HostStats RateGovernor::StatsLocked(const std::string& name, const Host& state, Clock::time_point now)
+		{
+			HostStats stats{
+				.host = name,
+				.requests = state.requests,
+				.failures = state.failures,
+				.retries = state.retries,
+				.throttled = state.throttled,
+				.allowedRate = state.rate
+			};
+
+			const int64_t current = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+			uint64_t requests = 0, failures = 0;
+			for (const Second& second : state.window) {
+				if (second.stamp >= 0 && current - second.stamp < static_cast<int64_t>(WINDOW_SECONDS)) {
+					requests += second.requests;
+					failures += second.failures;
+				}
+			}
+
+			stats.requestRate = static_cast<double>(requests) / WINDOW_SECONDS;
+			stats.errorRate = (requests > 0) ? static_cast<double>(failures) / requests : 0.0;
+			return stats;
+		}
+
+		std::vector<HostStats> RateGovernor::Stats() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			const Clock::time_point now = Clock::now();
+
+			std::vector<HostStats> out;
+			out.reserve(Hosts.size());
+			for (const auto& [name, state] : Hosts) {
+				out.push_back(StatsLocked(name, *state, now));
+			}
+			return out;
+		}
+	}
+}
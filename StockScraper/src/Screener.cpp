@@ -0,0 +1,136 @@
+#include "pch.h"
+
+#include "Screener.hpp"
+#include "Utils/Kernels.hpp"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		static constexpr double MISSING = std::numeric_limits<double>::quiet_NaN();
+
+		// The parser stores a null close as 0, which is no price: it must stay NaN so the bar never screens as a -100% drop
+		static double ClosePrice(double close) {
+			return (std::isfinite(close) && close > 0.0) ? close : MISSING;
+		}
+
+		// ====================
+		// CloseMatrix
+		// ====================
+
+		CloseMatrix::CloseMatrix(size_t symbols, uint32_t depth)
+			: Labels(symbols), Values(symbols * depth, MISSING), Depth(depth)
+		{
+		}
+
+		CloseMatrix::CloseMatrix(std::vector<std::string> labels, uint32_t depth)
+			: Labels(std::move(labels)), Values(Labels.size() * depth, MISSING), Depth(depth)
+		{
+		}
+
+		void CloseMatrix::Set(size_t symbol, const std::string& label, std::span<const double> close)
+		{
+			Labels[symbol] = label;
+
+			const size_t symbolNum = Labels.size();
+			const size_t available = std::min<size_t>(close.size(), Depth);
+			for (size_t barsAgo = 0; barsAgo < Depth; ++barsAgo) {
+				Values[barsAgo * symbolNum + symbol] = (barsAgo < available) ? ClosePrice(close[close.size() - 1 - barsAgo]) : MISSING;
+			}
+		}
+
+		void CloseMatrix::SetRow(uint32_t barsAgo, std::span<const double> closes)
+		{
+			if (barsAgo >= Depth) {
+				return;
+			}
+
+			const size_t symbolNum = Labels.size();
+			double* row = Values.data() + barsAgo * symbolNum;
+			const size_t count = std::min(closes.size(), symbolNum);
+			std::transform(closes.begin(), closes.begin() + count, row, ClosePrice);
+			std::fill(row + count, row + symbolNum, MISSING);
+		}
+
+		std::span<const double> CloseMatrix::row(uint32_t barsAgo) const
+		{
+			if (barsAgo >= Depth) {
+				return {};
+			}
+			return std::span<const double>(Values).subspan(barsAgo * Labels.size(), Labels.size());
+		}
+
+		// ====================
+		// Screener
+		// ====================
+
+		Screener& Screener::Where(Metric metric, Predicate predicate)
+		{
+			Rules.push_back(Rule{ std::move(metric), std::move(predicate) });
+			return *this;
+		}
+
+		std::vector<ScreenHit> Screener::Run(const CloseMatrix& matrix) const
+		{
+			const size_t symbolNum = matrix.symbols();
+
+			std::vector<ScreenHit> hits;
+			if (symbolNum == 0) {
+				return hits;
+			}
+
+			std::vector<uint8_t> passing(symbolNum, 1);
+			std::vector<double> first(symbolNum, MISSING);
+			std::vector<double> values(symbolNum);
+
+			for (size_t r = 0; r < Rules.size(); ++r) {
+				std::fill(values.begin(), values.end(), MISSING);
+				Rules[r].metric(matrix, values);
+
+				for (size_t s = 0; s < symbolNum; ++s) {
+					passing[s] &= Rules[r].predicate(values[s]) ? 1 : 0;
+				}
+
+				if (r == 0) {
+					first.swap(values);
+				}
+			}
+
+			for (size_t s = 0; s < symbolNum; ++s) {
+				if (passing[s]) {
+					hits.push_back(ScreenHit{ .symbol = s, .value = first[s] });
+				}
+			}
+
+			return hits;
+		}
+
+		Screener::Metric Screener::PercentChange(uint32_t window)
+		{
+			return [window](const CloseMatrix& matrix, std::span<double> out) {
+				if (window == 0 || window >= matrix.depth()) return; // not enough bars kept, stays NaN
+				Maths::PercentChange(matrix.row(window), matrix.latest(), out);
+				};
+		}
+
+		Screener::Metric Screener::LogReturn(uint32_t window)
+		{
+			return [window](const CloseMatrix& matrix, std::span<double> out) {
+				if (window == 0 || window >= matrix.depth()) return;
+				Maths::LogReturn(matrix.row(window), matrix.latest(), out);
+				};
+		}
+
+		Screener::Predicate Screener::AtMost(double threshold)
+		{
+			return [threshold](double value) { return value <= threshold; };
+		}
+
+		Screener::Predicate Screener::AtLeast(double threshold)
+		{
+			return [threshold](double value) { return value >= threshold; };
+		}
+	}
+}
@@ -3,93 +3,306 @@
 #include "StockData.hpp"
 #include "Utils/StockMath.hpp"
 
+#include <chrono>
+#include <cstdio>
+#include <algorithm>
+
 namespace StockyBoy {
 	namespace Scraper {
-        Result getStockTable(const std::string& data, StockTable& table, bool normalize) {
-            using json = nlohmann::json;
-            json j;
-            try {
-                j = json::parse(data);
+        static constexpr int64_t SECONDS_PER_DAY = 24 * 60 * 60;
+
+        // Intraday bars further apart than this belong to different sessions (covers overnight, not lunch breaks)
+        static constexpr int64_t INTRADAY_SESSION_GAP = 4 * 60 * 60;
+
+        static int64_t DayNumber(int64_t epoch) {
+            return (epoch >= 0) ? epoch / SECONDS_PER_DAY : -((-epoch + SECONDS_PER_DAY - 1) / SECONDS_PER_DAY);
+        }
+
+        static std::string FormatDay(int64_t dayNumber) {
+            const std::chrono::year_month_day ymd{ std::chrono::sys_days{ std::chrono::days{ dayNumber } } };
+
+            char buf[16];
+            std::snprintf(buf, sizeof(buf), "%04d-%02u-%02u",
+                static_cast<int>(ymd.year()), static_cast<unsigned>(ymd.month()), static_cast<unsigned>(ymd.day()));
+            return buf;
+        }
+
+        std::string FormatDate(int64_t epoch) {
+            return FormatDay(DayNumber(epoch));
+        }
+
+        const std::string& DateLabels::Day(int64_t epoch) {
+            const int64_t dayNumber = DayNumber(epoch);
+
+            auto it = Days.find(dayNumber);
+            if (it == Days.end()) {
+                it = Days.emplace(dayNumber, FormatDay(dayNumber)).first;
             }
-            catch (const json::parse_error& e) {
-                return Result::Fail("[StockyBoy] JSON parse error: " + std::string(e.what()));
+            return it->second;
+        }
+
+        const std::string& DateLabels::Format(int64_t epoch, bool withTime) {
+            const std::string& day = Day(epoch);
+            if (!withTime) {
+                return day;
             }
 
-            try {
-                if (!j.contains("chart") || !j["chart"].contains("result") || j["chart"]["result"].empty()) {
-                    return Result::Fail("[StockyBoy] Missing chart/result in JSON.");
+            const int64_t secondOfDay = epoch - DayNumber(epoch) * SECONDS_PER_DAY;
+
+            char time[8];
+            std::snprintf(time, sizeof(time), " %02d:%02d",
+                static_cast<int>(secondOfDay / 3600), static_cast<int>((secondOfDay % 3600) / 60));
+
+            Scratch.assign(day);
+            Scratch.append(time);
+            return Scratch;
+        }
+
+        void IndexTimeAxis(StockTable& table) {
+            const size_t rowNum = table.epochs.size();
+
+            table.timeStamps.resize(rowNum);
+            std::iota(table.timeStamps.begin(), table.timeStamps.end(), 0.0);
+
+            table.barSpacing = 0;
+            for (size_t i = 1; i < rowNum; ++i) {
+                const int64_t delta = table.epochs[i] - table.epochs[i - 1];
+                if (delta > 0 && (table.barSpacing == 0 || delta < table.barSpacing)) {
+                    table.barSpacing = delta;
                 }
+            }
 
-                const auto& result = j["chart"]["result"][0];
+            // Daily and longer bars: anything over 1.5 bars apart is a gap (weekend, holiday)
+            const int64_t gap = table.intraday()
+                ? std::max(INTRADAY_SESSION_GAP, table.barSpacing)
+                : table.barSpacing + table.barSpacing / 2;
 
-                if (!result.contains("timestamp") || !result.contains("indicators")) {
-                    return Result::Fail("[StockyBoy] Missing timestamp or indicators.");
+            table.sessionStarts.clear();
+            if (rowNum > 0) {
+                table.sessionStarts.push_back(0);
+            }
+            for (size_t i = 1; i < rowNum; ++i) {
+                if (table.epochs[i] - table.epochs[i - 1] > gap) {
+                    table.sessionStarts.push_back(static_cast<uint32_t>(i));
                 }
+            }
+        }
+
+        StockTableView View(const StockTable& table) {
+            return StockTableView{
+                .epochs = table.epochs,
+                .open = table.open,
+                .high = table.high,
+                .low = table.low,
+                .close = table.close,
+                .volume = table.volume
+            };
+        }
+
+        // Streams the Yahoo chart JSON and appends the numbers of chart.result[0] straight into the table columns,
+        // without building a DOM. Everything outside the timestamp and indicators.quote[0] arrays is skipped.
+        class ChartSaxHandler : public nlohmann::json_sax<nlohmann::json> {
+        private:
+            struct Frame {
+                bool isArray = false;
+                size_t children = 0;  // array elements started so far
+                std::string key{};    // current key, for objects
+            };
+
+            std::vector<Frame> frames;
 
-                const auto& timestamps = result["timestamp"];
-                const auto& quote = result["indicators"]["quote"][0];
-
-                const auto& openPrices = quote.value("open", json::array());
-                const auto& highPrices = quote.value("high", json::array());
-                const auto& lowPrices = quote.value("low", json::array());
-                const auto& closePrices = quote.value("close", json::array());
-                const auto& volume = quote.value("volume", json::array());
-
-                if (timestamps.size() != openPrices.size() ||
-                    timestamps.size() != highPrices.size() ||
-                    timestamps.size() != lowPrices.size() ||
-                    timestamps.size() != closePrices.size() ||
-                    timestamps.size() != volume.size()) {
-                    return Result::Fail("[StockyBoy] Mismatched array sizes in JSON data.");
+            std::vector<double>* targetColumn = nullptr;
+            std::vector<int64_t>* targetEpochs = nullptr;
+            size_t targetDepth = 0;
+
+            StockTable& table;
+
+        public:
+            bool foundResult = false;
+            bool foundTimestamps = false;
+            bool foundIndicators = false;
+            std::string parseError{};
+
+        public:
+            explicit ChartSaxHandler(StockTable& table) : table(table) {
+                frames.reserve(16);
+            }
+
+        private:
+            bool KeyAt(size_t depth, const char* key) const {
+                return !frames[depth].isArray && frames[depth].key == key;
+            }
+
+            bool FirstElementAt(size_t depth) const {
+                return frames[depth].isArray && frames[depth].children == 1;
+            }
+
+            // Marks the start of a value inside the current container
+            void BeginValue() {
+                if (!frames.empty() && frames.back().isArray) {
+                    ++frames.back().children;
                 }
+            }
+
+            // Decides where the elements of an array that is about to open should go
+            void SelectTarget() {
+                const size_t depth = frames.size();
 
-                const size_t rowNum = timestamps.size();
-
-                table.data.resize(rowNum);
-                table.date.resize(rowNum);
-                table.open.resize(rowNum);
-                table.high.resize(rowNum);
-                table.low.resize(rowNum);
-                table.close.resize(rowNum);
-                table.volume.resize(rowNum);
-                table.timeStamps.resize(rowNum);
-
-                for (size_t i = 0; i < rowNum; ++i) {
-                    time_t ts = timestamps[i];
-                    struct tm tmStruct;
-                    gmtime_s(&tmStruct, &ts);
-
-                    char buf[64];
-                    strftime(buf, sizeof(buf), "%Y-%m-%d", &tmStruct);
-
-                    table.data[i] = {
-                        .date = buf,
-                        .open = openPrices[i].is_null() ? 0.0 : openPrices[i].get<double>(),
-                        .high = highPrices[i].is_null() ? 0.0 : highPrices[i].get<double>(),
-                        .low = lowPrices[i].is_null() ? 0.0 : lowPrices[i].get<double>(),
-                        .close = closePrices[i].is_null() ? 0.0 : closePrices[i].get<double>(),
-                        .volume = volume[i].is_null() ? 0.0 : volume[i].get<double>()
-                        };
-
-                    table.date[i] = table.data[i].date;
-                    table.open[i] = table.data[i].open;
-                    table.high[i] = table.data[i].high;
-                    table.low[i] = table.data[i].low;
-                    table.close[i] = table.data[i].close;
-                    table.volume[i] = table.data[i].volume;
-
-                    table.timeStamps[i] = static_cast<double>(i);
+                // inside chart.result[0]
+                if (depth < 4 || !KeyAt(0, "chart") || !KeyAt(1, "result") || !FirstElementAt(2)) {
+                    return;
                 }
 
-                if (normalize) {
-                    Maths::normalize(table.volume);
+                // chart.result[0].timestamp
+                if (depth == 4 && KeyAt(3, "timestamp")) {
+                    foundTimestamps = true;
+                    targetEpochs = &table.epochs;
+                    targetDepth = depth + 1;
+                    return;
                 }
 
+                // chart.result[0].indicators.quote[0].<column>
+                if (depth == 7 && KeyAt(3, "indicators") && KeyAt(4, "quote") && FirstElementAt(5) && !frames[6].isArray) {
+                    const std::string& column = frames[6].key;
+                    if (column == "open") targetColumn = &table.open;
+                    else if (column == "high") targetColumn = &table.high;
+                    else if (column == "low") targetColumn = &table.low;
+                    else if (column == "close") targetColumn = &table.close;
+                    else if (column == "volume") targetColumn = &table.volume;
+                    else return;
+
+                    targetColumn->clear();
+                    targetColumn->reserve(table.epochs.size());
+                    targetDepth = depth + 1;
+                }
+            }
+
+            bool PushNumber(double value, int64_t integer) {
+                BeginValue();
+                if (frames.size() != targetDepth) return true;
+
+                if (targetColumn) targetColumn->push_back(value);
+                else if (targetEpochs) targetEpochs->push_back(integer);
+                return true;
+            }
+
+        public:
+            bool null() override {
+                return PushNumber(0.0, 0);
+            }
+
+            bool boolean(bool) override {
+                BeginValue();
+                return true;
+            }
+
+            bool number_integer(number_integer_t val) override {
+                return PushNumber(static_cast<double>(val), static_cast<int64_t>(val));
+            }
+
+            bool number_unsigned(number_unsigned_t val) override {
+                return PushNumber(static_cast<double>(val), static_cast<int64_t>(val));
+            }
+
+            bool number_float(number_float_t val, const string_t&) override {
+                return PushNumber(val, static_cast<int64_t>(val));
+            }
+
+            bool string(string_t&) override {
+                BeginValue();
+                return true;
+            }
+
+            bool binary(binary_t&) override {
+                BeginValue();
+                return true;
+            }
+
+            bool start_object(std::size_t) override {
+                BeginValue();
+                if (frames.size() == 3 && KeyAt(0, "chart") && KeyAt(1, "result") && FirstElementAt(2)) {
+                    foundResult = true;
+                }
+                frames.push_back(Frame{ .isArray = false });
+                return true;
+            }
+
+            bool key(string_t& val) override {
+                frames.back().key = val;
+
+                if (frames.size() == 4 && val == "indicators" && KeyAt(0, "chart") && KeyAt(1, "result") && FirstElementAt(2)) {
+                    foundIndicators = true;
+                }
+                return true;
+            }
+
+            bool end_object() override {
+                frames.pop_back();
+                return true;
+            }
+
+            bool start_array(std::size_t) override {
+                BeginValue();
+                SelectTarget();
+                frames.push_back(Frame{ .isArray = true });
+                return true;
+            }
+
+            bool end_array() override {
+                if (frames.size() == targetDepth) {
+                    targetColumn = nullptr;
+                    targetEpochs = nullptr;
+                    targetDepth = 0;
+                }
+                frames.pop_back();
+                return true;
+            }
+
+            bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+                parseError = ex.what();
+                return false;
+            }
+        };
+
+        Result getStockTable(const std::string& data, StockTable& table, bool normalize) {
+            StockTable parsed;
+            ChartSaxHandler handler(parsed);
+
+            try {
+                if (!nlohmann::json::sax_parse(data, &handler)) {
+                    return Result::Fail("[StockyBoy] JSON parse error: " + handler.parseError, ErrorKind::INVALID);
+                }
             }
             catch (const std::exception& e) {
-                return Result::Fail("[StockyBoy] Error processing JSON: " + std::string(e.what()));
+                return Result::Fail("[StockyBoy] Error processing JSON: " + std::string(e.what()), ErrorKind::INVALID);
             }
 
+            if (!handler.foundResult) {
+                return Result::Fail("[StockyBoy] Missing chart/result in JSON.", ErrorKind::NO_DATA);
+            }
+
+            if (!handler.foundTimestamps || !handler.foundIndicators) {
+                return Result::Fail("[StockyBoy] Missing timestamp or indicators.", ErrorKind::NO_DATA);
+            }
+
+            const size_t rowNum = parsed.epochs.size();
+
+            if (rowNum != parsed.open.size() ||
+                rowNum != parsed.high.size() ||
+                rowNum != parsed.low.size() ||
+                rowNum != parsed.close.size() ||
+                rowNum != parsed.volume.size()) {
+                return Result::Fail("[StockyBoy] Mismatched array sizes in JSON data.", ErrorKind::INVALID);
+            }
+
+            IndexTimeAxis(parsed);
+
+            if (normalize) {
+                Maths::normalize(parsed.volume);
+            }
+
+            table = std::move(parsed);
+
             return Result::Ok();
         }
 
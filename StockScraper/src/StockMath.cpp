@@ -1,33 +1,42 @@
 #include "pch.h"
 
 #include "Utils/StockMath.hpp"
+#include "Utils/Indicators.hpp"
+#include "Utils/Kernels.hpp"
+
+#include <cmath>
 
 namespace StockyBoy {
 	namespace Maths {
+		// Normalizing needs the max before the first divide, so it is one max reduction plus one divide pass.
+		// A true divide, not a multiply by 1 / max, so every SIMD path matches the plain loop bit for bit.
+		// Nothing to do for an empty column, and a zero or all-NaN column is left as is.
+		static bool NormalizeDivisor(std::span<const double> data, double& out_Divisor) {
+			const double maxVal = Max(data);
+			if (maxVal == 0.0 || !std::isfinite(maxVal)) return false; // avoid division by zero
+			out_Divisor = maxVal;
+			return true;
+		}
+
 		std::vector<double> normalizeCopy(const std::vector<double>& data) {
-			std::vector<double> result = data;
-			double maxVal = *std::max_element(result.begin(), result.end());
-			if (maxVal == 0.0) return result; // avoid division by zero
-			for (double& val : result) val /= maxVal;
+			double divisor = 1.0;
+			if (!NormalizeDivisor(data, divisor)) return data;
+
+			// Divide straight into the result instead of copying and then dividing in place
+			std::vector<double> result(data.size());
+			DivideInto(data, result, divisor);
 			return result;
 		}
 
 		void normalize(std::vector<double>& data) {
-			double maxVal = *std::max_element(data.begin(), data.end());
-			if (maxVal == 0.0) return; // avoid division by zero
-			for (double& val : data) val /= maxVal;
+			double divisor = 1.0;
+			if (!NormalizeDivisor(data, divisor)) return;
+			Divide(data, divisor);
 		}
 
-		std::vector<double> SMA(const StockTable& table, uint32_t window)
+		std::vector<double> SMA(const Scraper::StockTable& table, uint32_t window)
 		{
-			std::vector<double> SMAs(table.close.size());
-
-			for (size_t i = static_cast<size_t>(window) - 1; i < table.close.size(); ++i) {
-				double total = std::accumulate(table.close.begin() + (i - window + 1), table.close.begin() + i + 1, 0.0);
-				SMAs[i] = total / window;
-			}
-
-			return SMAs;
+			return SMA(std::span<const double>(table.close), window);
 		}
 	}
 }
\ No newline at end of file
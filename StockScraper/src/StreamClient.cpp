@@ -0,0 +1,111 @@
+#include "pch.h"
+
+#include "StreamClient.hpp"
+
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		static constexpr std::chrono::seconds MIN_BACKOFF{ 1 };
+		static constexpr std::chrono::seconds MAX_BACKOFF{ 30 };
+
+		StreamClient::~StreamClient()
+		{
+			Stop(); // no-op when the derived destructor already stopped it
+		}
+
+		Result StreamClient::Start(std::chrono::milliseconds timeout)
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			if (finished && worker.joinable()) {
+				lock.unlock();
+				worker.join();
+				lock.lock();
+			}
+			if (!worker.joinable()) {
+				stopping = false;
+				finished = false;
+				last = Result::Fail("[StockyBoy][Stream] Connecting to " + Url);
+				worker = std::thread(&StreamClient::Work, this);
+			}
+
+			// Also wakes when the thread gives up, `last` then holds why
+			const bool woke = wake.wait_for(lock, timeout, [this] { return ready || finished; });
+
+			if (woke && ready) {
+				return Result::Ok();
+			}
+			return woke ? last : Result::Fail("[StockyBoy][Stream] Timed out waiting for " + Url + " | " + last.error);
+		}
+
+		void StreamClient::Stop()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				stopping = true;
+			}
+			wake.notify_all();
+
+			if (worker.joinable()) {
+				worker.join();
+			}
+		}
+
+		bool StreamClient::isReady() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return ready;
+		}
+
+		Result StreamClient::LastResult() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return last;
+		}
+
+		bool StreamClient::Stopping() const
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return stopping;
+		}
+
+		void StreamClient::SetReady(bool value)
+		{
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				ready = value;
+				if (value) last = Result::Ok();
+			}
+			wake.notify_all();
+		}
+
+		void StreamClient::Work()
+		{
+			std::chrono::seconds backoff = MIN_BACKOFF;
+
+			while (true) {
+				bool retry = true;
+				Result result = Session(retry);
+
+				std::unique_lock<std::mutex> lock(mutex);
+				if (ready) backoff = MIN_BACKOFF; // the connection worked, this is a fresh drop
+				ready = false;
+				last = result;
+				finished = stopping || !retry;
+				wake.notify_all();
+
+				if (finished) {
+					return;
+				}
+
+				wake.wait_for(lock, backoff, [this] { return stopping; });
+				if (stopping) {
+					finished = true;
+					return;
+				}
+
+				backoff = std::min(backoff * 2, MAX_BACKOFF);
+			}
+		}
+	}
+}
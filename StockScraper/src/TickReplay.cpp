@@ -0,0 +1,93 @@
+#include "pch.h"
+
+#include "TickReplay.hpp"
+
+#include <chrono>
+#include <thread>
+#include <charconv>
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		// Splits off the text before the next comma, false when there is none
+		static bool NextField(std::string_view& line, std::string_view& out_Field) {
+			const size_t comma = line.find(',');
+			if (comma == std::string_view::npos) return false;
+			out_Field = line.substr(0, comma);
+			line.remove_prefix(comma + 1);
+			return true;
+		}
+
+		static bool ParseTick(std::string_view line, std::string_view& out_Symbol, int64_t& out_EpochMs, double& out_Price, double& out_Size) {
+			std::string_view epoch, price;
+			if (!NextField(line, epoch) || !NextField(line, out_Symbol) || !NextField(line, price)) return false;
+
+			while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) line.remove_suffix(1);
+
+			// std::from_chars for doubles needs a recent standard library, strtod is enough for a few fields
+			const std::string priceText(price), sizeText(line);
+			char* priceEnd = nullptr;
+			char* sizeEnd = nullptr;
+			out_Price = std::strtod(priceText.c_str(), &priceEnd);
+			out_Size = std::strtod(sizeText.c_str(), &sizeEnd);
+
+			auto [end, error] = std::from_chars(epoch.data(), epoch.data() + epoch.size(), out_EpochMs);
+			return error == std::errc{} && priceEnd != priceText.c_str() && sizeEnd != sizeText.c_str() && !out_Symbol.empty();
+		}
+
+		void WriteTick(std::ostream& out, std::string_view symbol, int64_t epochMs, double price, double size)
+		{
+			out << epochMs << ',' << symbol << ',' << price << ',' << size << '\n';
+		}
+
+		Result ReplayTicks(std::istream& in, BarBuilder& bars, double speed, const std::atomic<bool>* stop)
+		{
+			using Clock = std::chrono::steady_clock;
+
+			std::string line;
+			size_t lineNumber = 0;
+
+			int64_t firstEpochMs = 0;
+			Clock::time_point started{};
+			bool first = true;
+
+			while (std::getline(in, line)) {
+				++lineNumber;
+				if (line.empty() || line[0] == '#') continue;
+
+				if (stop && stop->load(std::memory_order_relaxed)) {
+					return Result::Ok();
+				}
+
+				std::string_view symbol;
+				int64_t epochMs;
+				double price, size;
+				if (!ParseTick(line, symbol, epochMs, price, size)) {
+					return Result::Fail("[StockyBoy][TickReplay] Malformed tick on line " + std::to_string(lineNumber) + ": " + line);
+				}
+
+				if (speed > 0.0) {
+					if (first) {
+						firstEpochMs = epochMs;
+						started = Clock::now();
+						first = false;
+					}
+
+					const auto due = started + std::chrono::duration_cast<Clock::duration>(
+						std::chrono::duration<double, std::milli>((epochMs - firstEpochMs) / speed));
+					// In short steps, so a stop request doesn't wait out a long quiet stretch
+					while (Clock::now() < due) {
+						if (stop && stop->load(std::memory_order_relaxed)) {
+							return Result::Ok();
+						}
+						std::this_thread::sleep_until(std::min(due, Clock::now() + std::chrono::milliseconds(100)));
+					}
+				}
+
+				bars.OnTick(symbol, epochMs, price, size);
+			}
+
+			return Result::Ok();
+		}
+	}
+}
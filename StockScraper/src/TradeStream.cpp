@@ -0,0 +1,214 @@
+#include "pch.h"
+
+#include "TradeStream.hpp"
+#include "WebSocket.hpp"
+
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		namespace Alpaca {
+			// How long one wait on the socket lasts, which bounds how late Stop is noticed
+			static constexpr long POLL_INTERVAL_MS = 250;
+
+			// --- Message parsing ---
+
+			static std::string JsonString(const nlohmann::json& object, const char* key) {
+				auto it = object.find(key);
+				return (it != object.end() && it->is_string()) ? it->get<std::string>() : std::string{};
+			}
+
+			// Alpaca sends numbers as strings, missing and null read as 0
+			static float JsonFloat(const nlohmann::json& object, const char* key) {
+				auto it = object.find(key);
+				if (it == object.end()) return 0.0f;
+				if (it->is_number()) return it->get<float>();
+				if (it->is_string()) return std::strtof(it->get_ref<const std::string&>().c_str(), nullptr);
+				return 0.0f;
+			}
+
+			static TradeEventType ToEventType(const std::string& event) {
+				if (event == "new") return TradeEventType::NEW;
+				if (event == "fill") return TradeEventType::FILL;
+				if (event == "partial_fill") return TradeEventType::PARTIAL_FILL;
+				if (event == "canceled") return TradeEventType::CANCELED;
+				if (event == "expired") return TradeEventType::EXPIRED;
+				if (event == "rejected") return TradeEventType::REJECTED;
+				return TradeEventType::OTHER;
+			}
+
+			static TradeEvent ToTradeEvent(const nlohmann::json& data) {
+				static const nlohmann::json empty = nlohmann::json::object();
+
+				auto orderIt = data.find("order");
+				const nlohmann::json& order = (orderIt != data.end() && orderIt->is_object()) ? *orderIt : empty;
+
+				return TradeEvent{
+					.type = ToEventType(JsonString(data, "event")),
+					.orderId = JsonString(order, "id"),
+					.clientOrderId = JsonString(order, "client_order_id"),
+					.symbol = JsonString(order, "symbol"),
+					.action = (JsonString(order, "side") == "sell") ? Action::SELL : Action::BUY,
+					.qty = JsonFloat(data, "qty"),
+					.price = JsonFloat(data, "price"),
+					.filledQty = JsonFloat(order, "filled_qty"),
+					.filledAvgPrice = JsonFloat(order, "filled_avg_price"),
+					.positionQty = JsonFloat(data, "position_qty")
+				};
+			}
+
+			// ====================
+			// TradeStream
+			// ====================
+
+			std::string TradeStream::StreamUrl(const std::string& endPoint)
+			{
+				std::string url = endPoint;
+				while (!url.empty() && url.back() == '/') url.pop_back();
+
+				if (url.ends_with("/v2")) url.resize(url.size() - 3);
+
+				if (url.starts_with("https://")) url = "wss://" + url.substr(8);
+				else if (url.starts_with("http://")) url = "ws://" + url.substr(7);
+
+				return url + "/stream";
+			}
+
+			TradeStream::TradeStream(const Account& account, size_t capacity)
+				: StreamClient(StreamUrl(account.EndPoint)), Key(account.Key), Secret(account.Secret), Events(capacity)
+			{
+			}
+
+			TradeStream::~TradeStream()
+			{
+				Stop();
+			}
+
+			bool TradeStream::Poll(TradeEvent& out_Event)
+			{
+				return Events.TryPop(out_Event);
+			}
+
+			bool TradeStream::Push(TradeEvent event)
+			{
+				// A fill must not be dropped: when the consumer falls behind, wait for room instead
+				while (!Events.TryPush(std::move(event))) {
+					if (Stopping()) return false;
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+				return true;
+			}
+
+			Result TradeStream::Session(bool& out_Retry)
+			{
+				if (Key.empty() || Secret.empty()) {
+					out_Retry = false;
+					return Result::Fail("[StockyBoy][TradeStream] Account Wrongly/Not fully initialized");
+				}
+
+				WebSocket socket;
+				Result result = socket.Connect(Url);
+				if (!result.succeeded) {
+					return result;
+				}
+
+				nlohmann::json auth = { { "action", "auth" }, { "key", Key }, { "secret", Secret } };
+				result = socket.SendText(auth.dump());
+				if (!result.succeeded) {
+					return result;
+				}
+
+				std::string message;
+				while (true) {
+					if (Stopping()) {
+						return Result::Ok();
+					}
+
+					result = socket.Receive(message, POLL_INTERVAL_MS);
+					if (!result.succeeded) {
+						return result;
+					}
+					if (message.empty()) {
+						continue;
+					}
+
+					nlohmann::json json = nlohmann::json::parse(message, nullptr, false);
+					if (json.is_discarded() || !json.is_object()) {
+						continue;
+					}
+
+					const std::string stream = JsonString(json, "stream");
+					auto dataIt = json.find("data");
+					if (dataIt == json.end() || !dataIt->is_object()) {
+						continue;
+					}
+					const nlohmann::json& data = *dataIt;
+
+					if (stream == "authorization") {
+						if (JsonString(data, "status") != "authorized") {
+							out_Retry = false;
+							return Result::Fail("[StockyBoy][TradeStream] Login refused: " + json.dump());
+						}
+
+						nlohmann::json listen = { { "action", "listen" }, { "data", { { "streams", { "trade_updates" } } } } };
+						result = socket.SendText(listen.dump());
+						if (!result.succeeded) {
+							return result;
+						}
+					}
+					else if (stream == "listening") {
+						auto streams = data.find("streams");
+						const bool subscribed = streams != data.end() && streams->is_array() &&
+							std::find(streams->begin(), streams->end(), "trade_updates") != streams->end();
+						SetReady(subscribed);
+					}
+					else if (stream == "trade_updates") {
+						if (!Push(ToTradeEvent(data))) {
+							return Result::Ok(); // stopping
+						}
+					}
+				}
+			}
+
+			// ====================
+			// Fills
+			// ====================
+
+			void RecordFills(TradeStream& stream, std::unordered_set<std::string> pending, PositionBook& book,
+				std::ostream& fills, std::ostream& log, std::chrono::seconds timeout)
+			{
+				fills << "client_order_id,symbol,side,qty,price\n";
+
+				const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+				TradeEvent event;
+				while (!pending.empty() && std::chrono::steady_clock::now() < deadline) {
+					if (!stream.Poll(event)) {
+						std::this_thread::sleep_for(std::chrono::milliseconds(50));
+						continue;
+					}
+
+					if (!pending.contains(event.clientOrderId)) continue;
+
+					const char* side = (event.action == Action::BUY) ? "buy" : "sell";
+
+					if (event.type == TradeEventType::FILL || event.type == TradeEventType::PARTIAL_FILL) {
+						book.ApplyFill(event.symbol, event.action, event.qty, event.price);
+						fills << event.clientOrderId << ',' << event.symbol << ',' << side << ',' << event.qty << ',' << event.price << '\n';
+					}
+					else if (event.type == TradeEventType::CANCELED || event.type == TradeEventType::EXPIRED || event.type == TradeEventType::REJECTED) {
+						log << "Order to " << side << ' ' << event.symbol << " ended without a fill\n";
+					}
+
+					if (IsTerminal(event.type)) {
+						pending.erase(event.clientOrderId);
+					}
+				}
+
+				if (!pending.empty()) {
+					log << pending.size() << " orders still open after " << timeout.count() << "s\n";
+				}
+			}
+		}
+	}
+}
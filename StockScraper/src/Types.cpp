@@ -37,4 +37,41 @@ namespace StockyBoy {
         const auto& validRanges = it->second;
         return std::find(validRanges.begin(), validRanges.end(), range) != validRanges.end();
     }
-}
\ No newline at end of file
+
+    int64_t ToSeconds(INTERVAL interval) {
+        constexpr int64_t MINUTE = 60;
+        constexpr int64_t DAY = 24 * 60 * MINUTE;
+
+        switch (interval) {
+        case MINUTES_1:  return MINUTE;
+        case MINUTES_2:  return 2 * MINUTE;
+        case MINUTES_5:  return 5 * MINUTE;
+        case MINUTES_15: return 15 * MINUTE;
+        case MINUTES_30: return 30 * MINUTE;
+        case MINUTES_60: return 60 * MINUTE;
+        case DAYS_1:     return DAY;
+        case DAYS_5:     return 5 * DAY;
+        case WEEK_1:     return 7 * DAY;
+        case MONTH_1:    return 30 * DAY;
+        case MONTH_3:    return 91 * DAY;
+        default:         return 0;
+        }
+    }
+
+    int64_t ToSeconds(RANGE range) {
+        constexpr int64_t DAY = 24 * 60 * 60;
+
+        switch (range) {
+        case RANGE_1D:  return DAY;
+        case RANGE_5D:  return 5 * DAY;
+        case RANGE_1MO: return 30 * DAY;
+        case RANGE_3MO: return 91 * DAY;
+        case RANGE_6MO: return 182 * DAY;
+        case RANGE_1Y:  return 365 * DAY;
+        case RANGE_2Y:  return 2 * 365 * DAY;
+        case RANGE_5Y:  return 5 * 365 * DAY;
+        case RANGE_10Y: return 10 * 365 * DAY;
+        default:        return 0;
+        }
+    }
+}
@@ -0,0 +1,378 @@
+#include "pch.h"
+
+#include "Universe.hpp"
+
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+
+namespace StockyBoy {
+	namespace Scraper {
+		// File layout: header, `count` records in label order, the liquid and unknown index (uint32 ids),
+		// then every label back to back. Records start 8-byte aligned, so a mapping can be read in place.
+		static constexpr char UNIVERSE_MAGIC[4] = { 'S', 'B', 'U', 'V' };
+		static constexpr uint32_t UNIVERSE_VERSION = 1;
+
+		static constexpr uint8_t RECORD_ACTIVE = 1;
+
+		struct UniverseHeader {
+			char magic[4];
+			uint32_t version;
+			uint32_t count;
+			uint32_t liquidCount;
+			uint32_t unknownCount;
+			uint32_t labelBytes;
+		};
+		static_assert(sizeof(UniverseHeader) % alignof(int64_t) == 0);
+
+		struct UniverseRecord {
+			int64_t lastBar;
+			uint32_t labelOffset;
+			uint16_t labelLength;
+			uint8_t exchange;
+			uint8_t flags;
+			float lastPrice;
+			float avgVolume;
+			uint32_t misses;
+			uint32_t reserved;
+		};
+		static_assert(sizeof(UniverseRecord) == 32);
+
+		static constexpr const char* EXCHANGE_NAMES[] = { "", "NYSE", "NASDAQ", "AMEX", "ARCA", "OTHER" };
+		static_assert(std::size(EXCHANGE_NAMES) == static_cast<size_t>(Exchange::COUNT));
+
+		std::string_view ToString(Exchange exchange)
+		{
+			const size_t index = static_cast<size_t>(exchange);
+			return (index < std::size(EXCHANGE_NAMES)) ? EXCHANGE_NAMES[index] : "";
+		}
+
+		Exchange ExchangeFromString(std::string_view name)
+		{
+			if (name.empty() || name == "null") return Exchange::UNKNOWN;
+			if (name == "NYSEARCA" || name == "NYSE ARCA") return Exchange::ARCA;
+			if (name == "NYSEMKT" || name == "NYSE MKT" || name == "NYSE American") return Exchange::AMEX;
+
+			for (size_t i = 1; i < std::size(EXCHANGE_NAMES); ++i) {
+				if (name == EXCHANGE_NAMES[i]) return static_cast<Exchange>(i);
+			}
+			return Exchange::OTHER;
+		}
+
+		static double DollarVolume(const UniverseRecord& record) {
+			return static_cast<double>(record.lastPrice) * record.avgVolume;
+		}
+
+		// Splits one CSV line into fields, with "quoted, fields" and "" for a quote inside them
+		static void SplitCsvLine(std::string_view line, std::vector<std::string>& out_Fields) {
+			out_Fields.clear();
+			std::string field;
+			bool quoted = false;
+
+			for (size_t i = 0; i < line.size(); ++i) {
+				const char c = line[i];
+				if (quoted) {
+					if (c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+						field.push_back('"');
+						++i;
+					}
+					else if (c == '"') {
+						quoted = false;
+					}
+					else {
+						field.push_back(c);
+					}
+				}
+				else if (c == '"') {
+					quoted = true;
+				}
+				else if (c == ',') {
+					out_Fields.push_back(std::move(field));
+					field.clear();
+				}
+				else if (c != '\r') {
+					field.push_back(c);
+				}
+			}
+			out_Fields.push_back(std::move(field));
+		}
+
+		// ====================
+		// Reading
+		// ====================
+
+		Result Universe::Open(const std::filesystem::path& path)
+		{
+			Close();
+
+			MappedFile file;
+			Result result = file.Open(path);
+			if (!result.succeeded) {
+				return Result::Fail("[StockyBoy][Universe] Can't open universe file: " + path.string());
+			}
+
+			if (file.size() < sizeof(UniverseHeader)) {
+				return Result::Fail("[StockyBoy][Universe] Invalid universe file: " + path.string());
+			}
+
+			UniverseHeader header{};
+			std::memcpy(&header, file.data(), sizeof(header));
+
+			if (!std::equal(std::begin(UNIVERSE_MAGIC), std::end(UNIVERSE_MAGIC), header.magic) || header.version != UNIVERSE_VERSION) {
+				return Result::Fail("[StockyBoy][Universe] Invalid universe file: " + path.string());
+			}
+
+			const uint64_t expectedSize = sizeof(header) + uint64_t(header.count) * sizeof(UniverseRecord) +
+				(uint64_t(header.liquidCount) + header.unknownCount) * sizeof(uint32_t) + header.labelBytes;
+			if (file.size() != expectedSize || uint64_t(header.liquidCount) + header.unknownCount > header.count) {
+				return Result::Fail("[StockyBoy][Universe] Truncated universe file: " + path.string());
+			}
+
+			const std::byte* cursor = file.data() + sizeof(header);
+			const UniverseRecord* records = reinterpret_cast<const UniverseRecord*>(cursor);
+			cursor += header.count * sizeof(UniverseRecord);
+
+			const uint32_t* index = reinterpret_cast<const uint32_t*>(cursor);
+			cursor += (header.liquidCount + header.unknownCount) * sizeof(uint32_t);
+
+			// Checked once here so the accessors can trust the file
+			for (uint32_t i = 0; i < header.count; ++i) {
+				if (uint64_t(records[i].labelOffset) + records[i].labelLength > header.labelBytes || records[i].exchange >= static_cast<uint8_t>(Exchange::COUNT)) {
+					return Result::Fail("[StockyBoy][Universe] Corrupt universe file: " + path.string());
+				}
+			}
+			for (uint32_t i = 0; i < header.liquidCount + header.unknownCount; ++i) {
+				if (index[i] >= header.count) {
+					return Result::Fail("[StockyBoy][Universe] Corrupt universe file: " + path.string());
+				}
+			}
+
+			Records = records;
+			Count = header.count;
+			Liquid = std::span<const uint32_t>(index, header.liquidCount);
+			Unknown = std::span<const uint32_t>(index + header.liquidCount, header.unknownCount);
+			Labels = reinterpret_cast<const char*>(cursor);
+			File = std::move(file);
+
+			return Result::Ok();
+		}
+
+		void Universe::Close()
+		{
+			File.Close();
+			Records = nullptr;
+			Count = 0;
+			Liquid = {};
+			Unknown = {};
+			Labels = nullptr;
+		}
+
+		std::string_view Universe::label(uint32_t symbol) const
+		{
+			return std::string_view(Labels + Records[symbol].labelOffset, Records[symbol].labelLength);
+		}
+
+		UniverseEntry Universe::entry(uint32_t symbol) const
+		{
+			const UniverseRecord& record = Records[symbol];
+			return UniverseEntry{
+				.label = std::string(label(symbol)),
+				.exchange = static_cast<Exchange>(record.exchange),
+				.lastPrice = record.lastPrice,
+				.avgVolume = record.avgVolume,
+				.lastBar = record.lastBar,
+				.misses = record.misses,
+				.active = (record.flags & RECORD_ACTIVE) != 0
+			};
+		}
+
+		std::vector<UniverseEntry> Universe::entries() const
+		{
+			std::vector<UniverseEntry> out;
+			out.reserve(Count);
+			for (uint32_t i = 0; i < Count; ++i) {
+				out.push_back(entry(i));
+			}
+			return out;
+		}
+
+		bool Universe::Find(std::string_view label, uint32_t& out_Symbol) const
+		{
+			size_t low = 0, high = Count;
+			while (low < high) {
+				const size_t middle = (low + high) / 2;
+				if (this->label(static_cast<uint32_t>(middle)) < label) low = middle + 1;
+				else high = middle;
+			}
+
+			if (low == Count || this->label(static_cast<uint32_t>(low)) != label) return false;
+
+			out_Symbol = static_cast<uint32_t>(low);
+			return true;
+		}
+
+		std::vector<uint32_t> Universe::Select(const UniverseFilter& filter) const
+		{
+			std::vector<uint32_t> out;
+
+			// Everything past this point trades less than the filter wants
+			auto end = std::partition_point(Liquid.begin(), Liquid.end(),
+				[&](uint32_t symbol) { return DollarVolume(Records[symbol]) >= filter.minDollarVolume; });
+
+			for (auto it = Liquid.begin(); it != end; ++it) {
+				const UniverseRecord& record = Records[*it];
+				if (record.lastPrice < filter.minPrice || record.avgVolume < filter.minAvgVolume) continue;
+				if (!(filter.exchanges & ExchangeBit(static_cast<Exchange>(record.exchange)))) continue;
+				out.push_back(*it);
+			}
+
+			if (filter.includeUnknown) {
+				for (uint32_t symbol : Unknown) {
+					if (filter.exchanges & ExchangeBit(static_cast<Exchange>(Records[symbol].exchange))) out.push_back(symbol);
+				}
+			}
+
+			std::sort(out.begin(), out.end());
+			return out;
+		}
+
+		// ====================
+		// Writing
+		// ====================
+
+		Result Universe::Write(const std::filesystem::path& path, std::vector<UniverseEntry> entries)
+		{
+			std::erase_if(entries, [](const UniverseEntry& entry) { return entry.label.empty() || entry.label.size() > UINT16_MAX; });
+			std::stable_sort(entries.begin(), entries.end(), [](const UniverseEntry& a, const UniverseEntry& b) { return a.label < b.label; });
+			entries.erase(std::unique(entries.begin(), entries.end(), [](const UniverseEntry& a, const UniverseEntry& b) { return a.label == b.label; }), entries.end());
+
+			std::vector<UniverseRecord> records(entries.size());
+			std::vector<uint32_t> liquid, unknown;
+			std::string labels;
+
+			for (size_t i = 0; i < entries.size(); ++i) {
+				const UniverseEntry& entry = entries[i];
+				UniverseRecord& record = records[i];
+
+				record.lastBar = entry.lastBar;
+				record.labelOffset = static_cast<uint32_t>(labels.size());
+				record.labelLength = static_cast<uint16_t>(entry.label.size());
+				record.exchange = static_cast<uint8_t>(entry.exchange);
+				record.flags = entry.active ? RECORD_ACTIVE : 0;
+				record.lastPrice = std::isfinite(entry.lastPrice) ? entry.lastPrice : 0.0f;
+				record.avgVolume = std::isfinite(entry.avgVolume) ? entry.avgVolume : 0.0f;
+				record.misses = entry.misses;
+				labels += entry.label;
+
+				if (!entry.active) continue;
+				(entry.known() ? liquid : unknown).push_back(static_cast<uint32_t>(i));
+			}
+
+			std::stable_sort(liquid.begin(), liquid.end(),
+				[&](uint32_t a, uint32_t b) { return DollarVolume(records[a]) > DollarVolume(records[b]); });
+
+			if (labels.size() > UINT32_MAX) {
+				return Result::Fail("[StockyBoy][Universe] Too many labels for one file");
+			}
+
+			if (path.has_parent_path()) {
+				std::error_code ec;
+				std::filesystem::create_directories(path.parent_path(), ec);
+			}
+
+			std::filesystem::path tempPath = path;
+			tempPath += ".tmp";
+
+			{
+				std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+				if (!file) {
+					return Result::Fail("[StockyBoy][Universe] Can't write universe file: " + tempPath.string());
+				}
+
+				UniverseHeader header{};
+				std::copy(std::begin(UNIVERSE_MAGIC), std::end(UNIVERSE_MAGIC), header.magic);
+				header.version = UNIVERSE_VERSION;
+				header.count = static_cast<uint32_t>(records.size());
+				header.liquidCount = static_cast<uint32_t>(liquid.size());
+				header.unknownCount = static_cast<uint32_t>(unknown.size());
+				header.labelBytes = static_cast<uint32_t>(labels.size());
+
+				file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+				file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(UniverseRecord));
+				file.write(reinterpret_cast<const char*>(liquid.data()), liquid.size() * sizeof(uint32_t));
+				file.write(reinterpret_cast<const char*>(unknown.data()), unknown.size() * sizeof(uint32_t));
+				file.write(labels.data(), labels.size());
+
+				if (!file) {
+					return Result::Fail("[StockyBoy][Universe] Failed writing universe file: " + tempPath.string());
+				}
+			}
+
+			// On Windows the old file must not be mapped anymore
+			if (!SwapInTempFile(tempPath, path)) {
+				return Result::Fail("[StockyBoy][Universe] Can't replace universe file: " + path.string());
+			}
+
+			return Result::Ok();
+		}
+
+		Result Universe::ReadListing(std::istream& in, std::vector<UniverseEntry>& out_Entries)
+		{
+			std::string line;
+			std::vector<std::string> fields;
+
+			if (!std::getline(in, line)) {
+				return Result::Fail("[StockyBoy][Universe] Empty listing");
+			}
+
+			SplitCsvLine(line, fields);
+			size_t tickerColumn = fields.size(), exchangeColumn = fields.size();
+			for (size_t i = 0; i < fields.size(); ++i) {
+				if (fields[i] == "ticker" || fields[i] == "symbol") tickerColumn = i;
+				else if (fields[i] == "exchange") exchangeColumn = i;
+			}
+			if (tickerColumn == fields.size()) {
+				return Result::Fail("[StockyBoy][Universe] Listing has no \"ticker\" column");
+			}
+
+			std::vector<UniverseEntry> entries;
+			while (std::getline(in, line)) {
+				SplitCsvLine(line, fields);
+				if (tickerColumn >= fields.size()) continue;
+
+				UniverseEntry entry;
+				entry.label = fields[tickerColumn];
+				entry.label.erase(0, entry.label.find_first_not_of(' '));
+				entry.label.erase(entry.label.find_last_not_of(' ') + 1);
+				if (entry.label.empty()) continue;
+
+				if (exchangeColumn < fields.size()) {
+					entry.exchange = ExchangeFromString(fields[exchangeColumn]);
+				}
+				entries.push_back(std::move(entry));
+			}
+
+			out_Entries = std::move(entries);
+			return Result::Ok();
+		}
+
+		void Universe::Describe(const StockTableView& daily, UniverseEntry& entry)
+		{
+			// Walk back over trailing bars with no close (a session still forming can come back empty).
+			// The parser stores a null close as 0, so anything but a positive price counts as missing.
+			size_t last = daily.size();
+			while (last > 0 && !(std::isfinite(daily.close[last - 1]) && daily.close[last - 1] > 0.0)) --last;
+			if (last == 0) return;
+
+			entry.lastPrice = static_cast<float>(daily.close[last - 1]);
+			entry.lastBar = daily.epochs[last - 1];
+
+			double volume = 0.0;
+			size_t bars = 0;
+			for (size_t i = last; i > 0 && bars < AVG_VOLUME_BARS; --i, ++bars) {
+				if (std::isfinite(daily.volume[i - 1])) volume += daily.volume[i - 1];
+			}
+			entry.avgVolume = static_cast<float>(volume / bars);
+		}
+	}
+}
@@ -0,0 +1,163 @@
+#include "pch.h"
+
+#include "WebSocket.hpp"
+
+#include <chrono>
+
+#ifndef _WIN32
+#include <sys/select.h>
+#endif
+
+namespace StockyBoy {
+	namespace Scraper {
+		// Longest a send waits for room in a full socket buffer before giving up on the connection
+		static constexpr long SEND_TIMEOUT_MS = 10000;
+
+		// Blocks until the socket is readable (or writable) or `timeoutMs` passed, false if there is no socket to wait on
+		static bool WaitSocket(CURL* curl, long timeoutMs, bool writable) {
+			curl_socket_t socket = CURL_SOCKET_BAD;
+			if (curl_easy_getinfo(curl, CURLINFO_ACTIVESOCKET, &socket) != CURLE_OK || socket == CURL_SOCKET_BAD) {
+				return false;
+			}
+
+			fd_set ready;
+			FD_ZERO(&ready);
+			FD_SET(socket, &ready);
+
+			timeval timeout{};
+			timeout.tv_sec = timeoutMs / 1000;
+			timeout.tv_usec = (timeoutMs % 1000) * 1000;
+
+			return select(static_cast<int>(socket) + 1, writable ? nullptr : &ready, writable ? &ready : nullptr, nullptr, &timeout) >= 0;
+		}
+
+		static bool WaitReadable(CURL* curl, long timeoutMs) {
+			return WaitSocket(curl, timeoutMs, false);
+		}
+
+		static bool WaitWritable(CURL* curl, long timeoutMs) {
+			return WaitSocket(curl, timeoutMs, true);
+		}
+
+		WebSocket::~WebSocket()
+		{
+			Close();
+		}
+
+		Result WebSocket::Connect(const std::string& url, long connectTimeoutSeconds)
+		{
+			Close();
+
+			CURL* curl = curl_easy_init();
+			if (!curl) {
+				return Result::Fail("[StockyBoy][WebSocket] Failed to init Curl");
+			}
+
+			curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
+			curl_easy_setopt(curl, CURLOPT_CONNECT_ONLY, 2L); // upgrade, then curl_ws_send/recv
+			curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT, connectTimeoutSeconds);
+			curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+
+			CURLcode res = curl_easy_perform(curl);
+			if (res != CURLE_OK) {
+				curl_easy_cleanup(curl);
+				return Result::Fail("[StockyBoy][WebSocket] Connect failed: " + std::string(curl_easy_strerror(res)));
+			}
+
+			Curl = curl;
+			return Result::Ok();
+		}
+
+		void WebSocket::Close()
+		{
+			if (Curl) {
+				size_t sent = 0;
+				curl_ws_send(static_cast<CURL*>(Curl), "", 0, &sent, 0, CURLWS_CLOSE); // best effort
+				curl_easy_cleanup(static_cast<CURL*>(Curl));
+				Curl = nullptr;
+			}
+			Partial.clear();
+		}
+
+		Result WebSocket::SendText(const std::string& text)
+		{
+			if (!Curl) {
+				return Result::Fail("[StockyBoy][WebSocket] Not connected");
+			}
+
+			CURL* curl = static_cast<CURL*>(Curl);
+
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(SEND_TIMEOUT_MS);
+
+			size_t offset = 0;
+			while (offset < text.size()) {
+				size_t sent = 0;
+				CURLcode res = curl_ws_send(curl, text.data() + offset, text.size() - offset, &sent, 0, CURLWS_TEXT);
+				if (res == CURLE_AGAIN) {
+					// The send buffer is full: wait for the peer to drain it
+					const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+					if (left <= 0) {
+						return Result::Fail("[StockyBoy][WebSocket] Send timed out");
+					}
+					if (!WaitWritable(curl, static_cast<long>(left))) {
+						return Result::Fail("[StockyBoy][WebSocket] Lost the socket");
+					}
+					continue;
+				}
+				if (res != CURLE_OK) {
+					return Result::Fail("[StockyBoy][WebSocket] Send failed: " + std::string(curl_easy_strerror(res)));
+				}
+				offset += sent;
+			}
+			return Result::Ok();
+		}
+
+		Result WebSocket::Receive(std::string& out_Message, long timeoutMs)
+		{
+			out_Message.clear();
+			if (!Curl) {
+				return Result::Fail("[StockyBoy][WebSocket] Not connected");
+			}
+
+			CURL* curl = static_cast<CURL*>(Curl);
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+
+			char buffer[4096];
+			while (true) {
+				size_t received = 0;
+				const struct curl_ws_frame* frame = nullptr;
+				CURLcode res = curl_ws_recv(curl, buffer, sizeof(buffer), &received, &frame);
+
+				if (res == CURLE_AGAIN) {
+					const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+					if (left <= 0) {
+						return Result::Ok();
+					}
+					if (!WaitReadable(curl, static_cast<long>(left))) {
+						return Result::Fail("[StockyBoy][WebSocket] Lost the socket");
+					}
+					continue;
+				}
+				if (res != CURLE_OK) {
+					return Result::Fail("[StockyBoy][WebSocket] Receive failed: " + std::string(curl_easy_strerror(res)));
+				}
+
+				if (frame->flags & CURLWS_CLOSE) {
+					return Result::Fail("[StockyBoy][WebSocket] Server closed the connection");
+				}
+				if (!(frame->flags & (CURLWS_TEXT | CURLWS_BINARY))) {
+					continue; // ping/pong
+				}
+
+				Partial.append(buffer, received);
+				if (frame->bytesleft > 0 || (frame->flags & CURLWS_CONT)) {
+					continue;
+				}
+
+				out_Message.swap(Partial);
+				Partial.clear();
+				return Result::Ok();
+			}
+		}
+	}
+}
@@ -0,0 +1,79 @@
+#include "pch.h"
+
+#include "WireFormat.hpp"
+
+#include <chrono>
+#include <cctype>
+#include <cstdio>
+#include <charconv>
+
+namespace StockyBoy {
+	namespace Scraper {
+		static bool ReadInt(std::string_view text, size_t offset, size_t length, int& out_Value) {
+			if (offset + length > text.size()) return false;
+			const char* begin = text.data() + offset;
+			auto [end, error] = std::from_chars(begin, begin + length, out_Value);
+			return error == std::errc{} && end == begin + length;
+		}
+
+		int64_t ParseTimestampMs(std::string_view text)
+		{
+			int year, month, day, hour, minute, second;
+			if (!ReadInt(text, 0, 4, year) || !ReadInt(text, 5, 2, month) || !ReadInt(text, 8, 2, day) ||
+				!ReadInt(text, 11, 2, hour) || !ReadInt(text, 14, 2, minute) || !ReadInt(text, 17, 2, second)) {
+				return -1;
+			}
+
+			int millis = 0;
+			if (text.size() > 19 && text[19] == '.') {
+				size_t digits = 0;
+				while (digits < 3 && 20 + digits < text.size() && text[20 + digits] >= '0' && text[20 + digits] <= '9') {
+					millis = millis * 10 + (text[20 + digits] - '0');
+					++digits;
+				}
+				for (; digits < 3; ++digits) millis *= 10;
+			}
+
+			const std::chrono::year_month_day date{ std::chrono::year{ year }, std::chrono::month{ static_cast<unsigned>(month) }, std::chrono::day{ static_cast<unsigned>(day) } };
+			if (!date.ok()) return -1;
+
+			const int64_t days = std::chrono::sys_days{ date }.time_since_epoch().count();
+			return ((days * 24 + hour) * 60 + minute) * 60000LL + second * 1000LL + millis;
+		}
+
+		std::string FormatTimestamp(int64_t epoch)
+		{
+			const std::chrono::sys_seconds time{ std::chrono::seconds{ epoch } };
+			const std::chrono::sys_days day = std::chrono::floor<std::chrono::days>(time);
+			const std::chrono::year_month_day date{ day };
+			const int64_t secondOfDay = (time - day).count();
+
+			char buffer[32];
+			std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02uT%02d:%02d:%02dZ",
+				static_cast<int>(date.year()), static_cast<unsigned>(date.month()), static_cast<unsigned>(date.day()),
+				static_cast<int>(secondOfDay / 3600), static_cast<int>(secondOfDay / 60 % 60), static_cast<int>(secondOfDay % 60));
+			return buffer;
+		}
+
+		void AppendEncoded(std::string& out, std::string_view text)
+		{
+			static constexpr char HEX[] = "0123456789ABCDEF";
+			for (unsigned char c : text) {
+				if (std::isalnum(c) || c == '.' || c == '-' || c == '_' || c == '~') {
+					out.push_back(static_cast<char>(c));
+				}
+				else {
+					out.push_back('%');
+					out.push_back(HEX[c >> 4]);
+					out.push_back(HEX[c & 0xF]);
+				}
+			}
+		}
+
+		double JsonNumber(const nlohmann::json& object, const char* key, double fallback)
+		{
+			auto it = object.find(key);
+			return (it != object.end() && it->is_number()) ? it->get<double>() : fallback;
+		}
+	}
+}
@@ -0,0 +1,166 @@
+#include "Check.hpp"
+
+#include "Alpaca.hpp"
+#include "OrderQueue.hpp"
+#include "PositionBook.hpp"
+#include "TradeStream.hpp"
+
+#include <cmath>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unordered_set>
+
+using namespace StockyBoy::Scraper;
+using namespace StockyBoy::Scraper::Alpaca;
+
+// Run by RunWithMock.py against Tools/MockAlpaca.py started with `--reject REJ`: every other order fills in full at a
+// fixed price per symbol, REJ's orders are rejected over the stream.
+
+static constexpr std::chrono::seconds FILL_TIMEOUT{ 10 };
+
+static Order MarketOrder(Action action, const std::string& label, float value, std::string clientOrderId, std::string qty = {}) {
+	return Order{ .action = action, .type = OrderType::MARKET, .value = value, .label = label, .qty = std::move(qty), .clientOrderId = std::move(clientOrderId) };
+}
+
+// Rows of the fills CSV after its header, split on commas
+static std::vector<std::vector<std::string>> FillRows(const std::string& csv) {
+	std::vector<std::vector<std::string>> rows;
+
+	std::istringstream lines(csv);
+	std::string line;
+	std::getline(lines, line);
+	CHECK(line == "client_order_id,symbol,side,qty,price", "header '%s'", line.c_str());
+
+	while (std::getline(lines, line)) {
+		std::vector<std::string> row;
+		std::istringstream cells(line);
+		std::string cell;
+		while (std::getline(cells, cell, ',')) row.push_back(cell);
+		rows.push_back(std::move(row));
+	}
+	return rows;
+}
+
+static bool Near(double a, double b) {
+	return std::fabs(a - b) <= 1e-4 * std::max(1.0, std::fabs(b));
+}
+
+// The local book, built only from streamed fills, against what the broker reports
+static void CheckBookMatchesBroker(Account& account, const PositionBook& book) {
+	PositionBook broker;
+	const Result synced = broker.SyncPositions(account);
+	CHECK(synced.succeeded, "SyncPositions: %s", synced.error.c_str());
+
+	CHECK(book.size() == broker.size(), "book holds %zu symbols, broker %zu", book.size(), broker.size());
+	for (const auto& [symbol, position] : broker.positions()) {
+		const Position* local = book.Find(symbol);
+		CHECK(local != nullptr, "%s missing from the book", symbol.c_str());
+		if (!local) continue;
+
+		CHECK(Near(local->qty, position.qty), "%s qty %f, broker %f", symbol.c_str(), local->qty, position.qty);
+		CHECK(Near(local->avgEntryPrice, position.avgEntryPrice), "%s entry %f, broker %f", symbol.c_str(), local->avgEntryPrice, position.avgEntryPrice);
+	}
+}
+
+int main(int argc, char** argv) {
+	if (argc < 2) {
+		std::printf("usage: AlpacaMockTest <endpoint, e.g. http://127.0.0.1:8790/v2>\n");
+		return 2;
+	}
+
+	Account account;
+	const Result init = account.Init(argv[1], "key", "secret");
+	CHECK(init.succeeded, "Init: %s", init.error.c_str());
+	if (!init.succeeded) return g_CheckFailures;
+
+	// --- Stream, subscribed before the first order ---
+	CHECK(TradeStream::StreamUrl("https://paper-api.alpaca.markets/v2") == "wss://paper-api.alpaca.markets/stream", "StreamUrl");
+
+	TradeStream stream(account);
+	const Result started = stream.Start();
+	CHECK(started.succeeded, "Start: %s", started.error.c_str());
+	if (!started.succeeded) return g_CheckFailures;
+
+	PositionBook book;
+
+	// --- Buys by notional through the queue: two fill, one is rejected, a reused client order id is refused ---
+	{
+		OrderQueue orders(account, 2);
+		const std::vector<Order> buys = {
+			MarketOrder(Action::BUY, "AAPL", 500.0f, "test-buy-AAPL"),
+			MarketOrder(Action::BUY, "MSFT", 250.0f, "test-buy-MSFT"),
+			MarketOrder(Action::BUY, "REJ", 100.0f, "test-buy-REJ")
+		};
+
+		const std::vector<Result> results = orders.SubmitAll(buys);
+		CHECK(results.size() == buys.size(), "%zu results for %zu orders", results.size(), buys.size());
+		for (size_t i = 0; i < results.size(); ++i) {
+			CHECK(results[i].succeeded, "%s: %s", buys[i].label.c_str(), results[i].error.c_str());
+		}
+
+		const Result again = orders.Submit(MarketOrder(Action::BUY, "AAPL", 500.0f, "test-buy-AAPL")).get();
+		CHECK(!again.succeeded, "a second order with the same client order id went through");
+
+		// Control characters in a string field must be escaped, or the body isn't JSON
+		const Result escaped = orders.Submit(MarketOrder(Action::BUY, "REJ", 100.0f, "test-\t\x01\"\\-REJ")).get();
+		CHECK(escaped.succeeded, "order with control characters in its client order id: %s", escaped.error.c_str());
+	}
+
+	std::ostringstream fills, log;
+	RecordFills(stream, { "test-buy-AAPL", "test-buy-MSFT", "test-buy-REJ", "test-\t\x01\"\\-REJ" }, book, fills, log, FILL_TIMEOUT);
+
+	std::vector<std::vector<std::string>> rows = FillRows(fills.str());
+	CHECK(rows.size() == 2, "%zu buy fills, expected 2", rows.size());
+	for (const std::vector<std::string>& row : rows) {
+		CHECK(row.size() == 5, "fill row with %zu cells", row.size());
+		if (row.size() != 5) continue;
+
+		CHECK(row[0] == "test-buy-" + row[1], "fill of %s for order %s", row[1].c_str(), row[0].c_str());
+		CHECK(row[2] == "buy", "side %s", row[2].c_str());
+
+		// Notional orders: qty * price is the dollars asked for
+		const double dollars = std::stod(row[3]) * std::stod(row[4]);
+		const double expected = (row[1] == "AAPL") ? 500.0 : 250.0;
+		CHECK(std::fabs(dollars - expected) < 0.05, "%s filled for $%f, expected $%f", row[1].c_str(), dollars, expected);
+	}
+
+	CHECK(log.str().find("Order to buy REJ ended without a fill") != std::string::npos, "log '%s'", log.str().c_str());
+	CHECK(log.str().find("still open") == std::string::npos, "log '%s'", log.str().c_str());
+	CHECK(book.Holds("AAPL") && book.Holds("MSFT") && !book.Holds("REJ"), "book after the buys");
+	CheckBookMatchesBroker(account, book);
+
+	// --- Sell all of AAPL by its exact qty, as the bot does ---
+	PositionBook broker;
+	broker.SyncPositions(account);
+	const Position* held = broker.Find("AAPL");
+	CHECK(held && !held->qtyText.empty(), "no AAPL qty to sell");
+	if (held) {
+		OrderQueue orders(account);
+		const Result sold = orders.Submit(MarketOrder(Action::SELL, "AAPL", 0.0f, "test-sell-AAPL", held->qtyText)).get();
+		CHECK(sold.succeeded, "sell: %s", sold.error.c_str());
+
+		std::ostringstream sellFills, sellLog;
+		RecordFills(stream, { "test-sell-AAPL" }, book, sellFills, sellLog, FILL_TIMEOUT);
+
+		rows = FillRows(sellFills.str());
+		CHECK(rows.size() == 1 && rows[0].size() == 5 && rows[0][2] == "sell", "sell fills '%s'", sellFills.str().c_str());
+		CHECK(sellLog.str().empty(), "sell log '%s'", sellLog.str().c_str());
+		CHECK(!book.Holds("AAPL") && book.Holds("MSFT"), "book after the sell");
+		CheckBookMatchesBroker(account, book);
+	}
+
+	// --- An order that never reports back is given up on at the timeout ---
+	{
+		std::ostringstream ignored, timeoutLog;
+		RecordFills(stream, { "test-never-sent" }, book, ignored, timeoutLog, std::chrono::seconds(1));
+		CHECK(timeoutLog.str() == "1 orders still open after 1s\n", "timeout log '%s'", timeoutLog.str().c_str());
+	}
+
+	stream.Stop();
+
+	if (g_CheckFailures == 0) {
+		std::printf("AlpacaMockTest: all checks passed\n");
+	}
+	return g_CheckFailures;
+}
@@ -0,0 +1,171 @@
+#include "Check.hpp"
+
+#include <5PercentRule-Bot/Headers/Backtest.hpp>
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <filesystem>
+
+using namespace StockyBoy::Bots::FivePercentRule;
+using namespace StockyBoy::Scraper;
+
+static constexpr int64_t SECONDS_PER_DAY = 24 * 60 * 60;
+
+// Monday 2024-01-01, days since the Unix epoch
+static constexpr int64_t FIRST_MONDAY = 19723;
+
+// Weekday `n` from FIRST_MONDAY, skipping weekends, at 14:30 UTC like a daily bar stamp
+static int64_t WeekdayEpoch(size_t n) {
+	const int64_t day = FIRST_MONDAY + static_cast<int64_t>(n / 5) * 7 + static_cast<int64_t>(n % 5);
+	return day * SECONDS_PER_DAY + 14 * 3600 + 1800;
+}
+
+static StockTable DailyBars(const std::vector<double>& closes) {
+	StockTable table;
+	for (size_t i = 0; i < closes.size(); ++i) {
+		table.epochs.push_back(WeekdayEpoch(i));
+		table.open.push_back(closes[i]);
+		table.high.push_back(closes[i]);
+		table.low.push_back(closes[i]);
+		table.close.push_back(closes[i]);
+		table.volume.push_back(1000.0);
+	}
+	IndexTimeAxis(table);
+	return table;
+}
+
+static History BuildHistory(const std::vector<std::string>& labels, const std::vector<StockTable>& tables) {
+	std::vector<StockTableView> views;
+	for (const StockTable& table : tables) views.push_back(View(table));
+	return History::Build(labels, views);
+}
+
+// Ten weekdays, default Params (3-bar window, buy at -4.9%, sell at +4.9%), $5 per trade:
+//   DIP  drops 10% on day 4 (bought at 90), is up 10% on day 5 (sold at 99)
+//   SLOW drops 6% on day 6 (bought at 47), ends at 48 and is still held
+//   ZERO has a null (0) close on day 4, which is no price and must not screen as a -100% drop
+//   FLAT never moves
+static const std::vector<std::string> LABELS = { "DIP", "SLOW", "ZERO", "FLAT" };
+static const std::vector<std::vector<double>> CLOSES = {
+	{ 100, 100, 100, 100, 90, 99, 99, 99, 99, 99 },
+	{ 50, 50, 50, 50, 50, 50, 47, 47, 47, 48 },
+	{ 30, 30, 30, 30, 0, 30, 30, 30, 30, 30 },
+	{ 20, 20, 20, 20, 20, 20, 20, 20, 20, 20 }
+};
+
+static void CheckKnownDips(const History& history) {
+	CHECK(history.days() == 10, "%zu days in the history", history.days());
+	CHECK(history.symbols() == LABELS.size(), "%zu symbols in the history", history.symbols());
+
+	// --- Session by session, the positions held after each one ---
+	const std::vector<std::vector<std::string>> expectedHoldings = {
+		{}, {}, {}, {}, { "DIP" }, {}, { "SLOW" }, { "SLOW" }, { "SLOW" }, { "SLOW" }
+	};
+
+	ReplayMarket market(history);
+	InMemoryPortfolio portfolio(1000.0);
+	std::mt19937_64 rng(1);
+	std::ostringstream log;
+	const Params params{};
+
+	for (size_t day = 0; day < history.days(); ++day) {
+		market.SetDay(day);
+		if (day < params.window) continue;
+
+		RunSession(Session{ .params = params, .budget = 50.0f, .checkBalance = day > params.window }, market, portfolio, rng, log);
+
+		std::vector<std::string> held;
+		for (const auto& [label, price] : portfolio.holdings()) held.push_back(label);
+		CHECK(held == expectedHoldings[day], "day %zu: %zu positions held", day, held.size());
+	}
+
+	CHECK(portfolio.holdings().contains("SLOW") && portfolio.holdings().at("SLOW") == 47.0f, "SLOW entry price");
+	CHECK(log.str().empty(), "session log '%s'", log.str().c_str());
+
+	// --- The whole run through Backtest: two buys, one sell, and the equity each session day ---
+	const BacktestResult result = Backtest(history, BacktestConfig{ .params = params, .dailyBudget = 50.0f, .startingCash = 1000.0, .seed = 1 });
+	CHECK(result.buys == 2 && result.sells == 1, "%zu buys, %zu sells", result.buys, result.sells);
+
+	const double soldDip = 995.0 + 5.0 / 90.0 * 99.0;  // cash after selling DIP
+	const double boughtSlow = soldDip - 5.0;           // and buying $5 of SLOW
+	const std::vector<double> expectedEquity = {
+		1000.0, 1000.0, soldDip, soldDip, soldDip, soldDip, boughtSlow + 5.0 / 47.0 * 48.0
+	};
+
+	CHECK(result.days.size() == expectedEquity.size() && result.equity.size() == expectedEquity.size(), "%zu session days", result.days.size());
+	for (size_t i = 0; i < result.equity.size() && i < expectedEquity.size(); ++i) {
+		CHECK(std::abs(result.equity[i] - expectedEquity[i]) < 1e-4, "equity on session %zu: %.6f, expected %.6f", i, result.equity[i], expectedEquity[i]);
+		CHECK(result.days[i] == WeekdayEpoch(i + params.window) / SECONDS_PER_DAY, "session %zu day %lld", i, static_cast<long long>(result.days[i]));
+	}
+}
+
+// Random walks over many symbols, volatile enough that the daily budget runs out and the shuffle decides the buys
+static History RandomHistory(size_t symbols, size_t days, uint32_t seed) {
+	std::mt19937 rng(seed);
+	std::normal_distribution<double> move(0.0, 0.03);
+
+	std::vector<std::string> labels;
+	std::vector<StockTable> tables;
+	for (size_t s = 0; s < symbols; ++s) {
+		std::vector<double> closes(days);
+		double price = 20.0 + static_cast<double>(s);
+		for (double& close : closes) {
+			price *= std::exp(move(rng));
+			close = price;
+		}
+		labels.push_back("SYM" + std::to_string(s));
+		tables.push_back(DailyBars(closes));
+	}
+	return BuildHistory(labels, tables);
+}
+
+static bool SameRun(const BacktestResult& a, const BacktestResult& b) {
+	return a.days == b.days && a.equity == b.equity && a.buys == b.buys && a.sells == b.sells;
+}
+
+int main() {
+	std::vector<StockTable> tables;
+	for (const std::vector<double>& closes : CLOSES) tables.push_back(DailyBars(closes));
+
+	CheckKnownDips(BuildHistory(LABELS, tables));
+
+	// --- Same history through a bar cache on disk ---
+	{
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / "StockyBoyBacktestTest";
+		std::filesystem::remove_all(directory);
+
+		const BarCache cache(directory);
+		for (size_t s = 0; s < LABELS.size(); ++s) {
+			const Result stored = cache.Store(LABELS[s], StockyBoy::DAYS_1, tables[s]);
+			CHECK(stored.succeeded, "Store %s: %s", LABELS[s].c_str(), stored.error.c_str());
+		}
+
+		const std::vector<const char*> labels = { "DIP", "SLOW", "ZERO", "FLAT", "MISSING" };
+		const History loaded = History::Load(cache, labels);
+
+		uint32_t symbol = 0;
+		CHECK(!loaded.Find("MISSING", symbol), "a label with no cache file was loaded");
+		CheckKnownDips(loaded);
+
+		std::filesystem::remove_all(directory);
+	}
+
+	// --- A seed decides the run: same seed, same result ---
+	const History history = RandomHistory(300, 120, 42);
+	const BacktestConfig config{ .dailyBudget = 50.0f, .startingCash = 1000.0, .seed = 7 };
+
+	const BacktestResult first = Backtest(history, config);
+	const BacktestResult second = Backtest(history, config);
+	CHECK(first.buys > 0 && first.sells > 0, "random run traded %zu/%zu", first.buys, first.sells);
+	CHECK(SameRun(first, second), "two runs with seed 7 differ");
+
+	BacktestConfig reseeded = config;
+	reseeded.seed = 8;
+	CHECK(!SameRun(first, Backtest(history, reseeded)), "seeds 7 and 8 gave the same run, the shuffle isn't used");
+
+	if (g_CheckFailures == 0) std::printf("BacktestTest: all checks passed\n");
+	return g_CheckFailures;
+}
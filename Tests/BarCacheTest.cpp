@@ -0,0 +1,126 @@
+#include "Check.hpp"
+#include "ScriptedProvider.hpp"
+
+#include "BarCache.hpp"
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <filesystem>
+
+using namespace StockyBoy;
+using namespace StockyBoy::Scraper;
+
+// Bars at the given epochs with the given closes, the other columns follow the close
+static StockTable Bars(const std::vector<int64_t>& epochs, const std::vector<double>& closes) {
+	StockTable table;
+	table.epochs = epochs;
+	table.open = closes;
+	table.high = closes;
+	table.low = closes;
+	table.close = closes;
+	table.volume.assign(closes.size(), 100.0);
+	IndexTimeAxis(table);
+	return table;
+}
+
+static void CheckTable(const char* name, const StockTable& table, const std::vector<int64_t>& epochs, const std::vector<double>& closes) {
+	CHECK(table.epochs == epochs, "%s: %zu epochs, expected %zu", name, table.epochs.size(), epochs.size());
+	CHECK(table.close == closes, "%s: closes differ", name);
+
+	const size_t rows = table.epochs.size();
+	CHECK(table.open.size() == rows && table.high.size() == rows && table.low.size() == rows && table.volume.size() == rows,
+		"%s: columns of different lengths", name);
+	CHECK(table.timeStamps.size() == rows, "%s: time axis not rebuilt", name);
+}
+
+static void CheckMerge() {
+	// One-minute bars 0..240, the last one stamped at 205 while it was still forming
+	const StockTable forming = Bars({ 0, 60, 120, 180, 205 }, { 1, 2, 3, 4, 5 });
+
+	// Fresh bars from the forming one on: it and anything within an interval before the first fresh bar are replaced
+	StockTable cached = forming;
+	BarCache::Merge(cached, Bars({ 180, 240, 300 }, { 40, 50, 60 }), MINUTES_1);
+	CheckTable("overlap", cached, { 0, 60, 120, 180, 240, 300 }, { 1, 2, 3, 40, 50, 60 });
+
+	// Starting exactly on the last cached bar replaces only that bar
+	cached = Bars({ 0, 60, 120, 180, 240 }, { 1, 2, 3, 4, 5 });
+	BarCache::Merge(cached, Bars({ 240, 300 }, { 50, 60 }), MINUTES_1);
+	CheckTable("same last bar", cached, { 0, 60, 120, 180, 240, 300 }, { 1, 2, 3, 4, 50, 60 });
+
+	// A gap after the cache keeps every cached bar
+	cached = forming;
+	BarCache::Merge(cached, Bars({ 600, 660 }, { 7, 8 }), MINUTES_1);
+	CheckTable("disjoint", cached, { 0, 60, 120, 180, 205, 600, 660 }, { 1, 2, 3, 4, 5, 7, 8 });
+
+	// Nothing new leaves the cache as it was
+	cached = forming;
+	BarCache::Merge(cached, StockTable{}, MINUTES_1);
+	CheckTable("empty fresh", cached, forming.epochs, forming.close);
+
+	// Cold cache: the fresh bars are the table
+	cached = StockTable{};
+	BarCache::Merge(cached, Bars({ 0, 60 }, { 9, 10 }), MINUTES_1);
+	CheckTable("cold", cached, { 0, 60 }, { 9, 10 });
+
+	// A full re-download from before the first cached bar replaces everything
+	cached = forming;
+	BarCache::Merge(cached, Bars({ -60, 0, 60 }, { 11, 12, 13 }), MINUTES_1);
+	CheckTable("re-download", cached, { -60, 0, 60 }, { 11, 12, 13 });
+
+	// The cutoff is one interval of the table's own interval: daily bars keep yesterday, replace today
+	constexpr int64_t DAY = 86400;
+	cached = Bars({ 0, DAY, 2 * DAY }, { 1, 2, 3 });
+	BarCache::Merge(cached, Bars({ 2 * DAY, 3 * DAY }, { 30, 40 }), DAYS_1);
+	CheckTable("daily", cached, { 0, DAY, 2 * DAY, 3 * DAY }, { 1, 2, 30, 40 });
+}
+
+static void CheckRefresh() {
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "StockyBoyBarCacheTest";
+	std::filesystem::remove_all(directory);
+
+	ScriptedProvider provider;
+	const BarCache cache(directory, provider);
+
+	// --- Cold: the whole range is requested and stored ---
+	CHECK(cache.RefreshRequest("AAA", MINUTES_1, RANGE_5D, StockTable{}).period2 == 0, "cold request has a period");
+
+	provider.next = Bars({ 0, 60, 120, 180, 205 }, { 1, 2, 3, 4, 5 });
+	StockTable table;
+	Result result = cache.Refresh("AAA", MINUTES_1, RANGE_5D, table);
+	CHECK(result.succeeded, "cold refresh: %s", result.error.c_str());
+	CHECK(provider.requests.size() == 1 && provider.requests[0].range == RANGE_5D && provider.requests[0].period2 == 0, "cold request");
+	CheckTable("cold refresh", table, { 0, 60, 120, 180, 205 }, { 1, 2, 3, 4, 5 });
+
+	// --- Warm: only from one interval before the last cached bar, merged and stored ---
+	const int64_t before = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	provider.next = Bars({ 180, 240 }, { 40, 50 });
+	result = cache.Refresh("AAA", MINUTES_1, RANGE_5D, table);
+	CHECK(result.succeeded, "warm refresh: %s", result.error.c_str());
+	CHECK(provider.requests.size() == 2 && provider.requests[1].period1 == 205 - 60 && provider.requests[1].period2 >= before, "warm request");
+	CheckTable("warm refresh", table, { 0, 60, 120, 180, 240 }, { 1, 2, 3, 40, 50 });
+
+	StockTable stored;
+	CHECK(cache.Load("AAA", MINUTES_1, stored).succeeded, "merged bars not stored");
+	CheckTable("stored", stored, { 0, 60, 120, 180, 240 }, { 1, 2, 3, 40, 50 });
+
+	// --- Failed fetch: the cached bars come back with the failure, the file is untouched ---
+	provider.nextResult = Result::Fail("offline", ErrorKind::NETWORK);
+	result = cache.Refresh("AAA", MINUTES_1, RANGE_5D, table);
+	CHECK(!result.succeeded && result.kind == ErrorKind::NETWORK, "failed refresh returned %s", result.succeeded ? "Ok" : result.error.c_str());
+	CheckTable("failed refresh", table, { 0, 60, 120, 180, 240 }, { 1, 2, 3, 40, 50 });
+
+	// Cold and failed: nothing at all
+	result = cache.Refresh("BBB", MINUTES_1, RANGE_5D, table);
+	CHECK(!result.succeeded && table.empty(), "cold failed refresh");
+
+	std::filesystem::remove_all(directory);
+}
+
+int main() {
+	CheckMerge();
+	CheckRefresh();
+
+	if (g_CheckFailures == 0) std::printf("BarCacheTest: all checks passed\n");
+	return g_CheckFailures;
+}
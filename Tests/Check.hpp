@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdio>
+
+// Minimal assertions for the standalone tests: a failed CHECK prints where and why, and the test's main
+// returns the failure count, so ctest reports it.
+inline int g_CheckFailures = 0;
+
+#define CHECK(condition, ...)                                                  \
+    do {                                                                       \
+        if (!(condition)) {                                                    \
+            ++g_CheckFailures;                                                 \
+            std::printf("%s:%d: CHECK(%s) failed: ", __FILE__, __LINE__, #condition); \
+            std::printf(__VA_ARGS__);                                          \
+            std::printf("\n");                                                 \
+        }                                                                      \
+    } while (0)
@@ -0,0 +1,156 @@
+#include "Check.hpp"
+
+#include "Utils/Indicators.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include <cstdint>
+
+using namespace StockyBoy::Maths;
+
+// Two-pass standard deviation of every full window, O(n * window)
+static std::vector<double> NaiveStdDev(const std::vector<double>& values, uint32_t window) {
+	std::vector<double> out(values.size(), WARMUP);
+	for (size_t end = window; window > 0 && end <= values.size(); ++end) {
+		double sum = 0.0;
+		for (size_t i = end - window; i < end; ++i) sum += values[i];
+		const double mean = sum / window;
+
+		double squares = 0.0;
+		for (size_t i = end - window; i < end; ++i) squares += (values[i] - mean) * (values[i] - mean);
+		out[end - 1] = std::sqrt(squares / window);
+	}
+	return out;
+}
+
+// Mean of every full window summed from scratch, O(n * window)
+static std::vector<double> NaiveSMA(const std::vector<double>& values, uint32_t window) {
+	std::vector<double> out(values.size(), WARMUP);
+	for (size_t end = window; window > 0 && end <= values.size(); ++end) {
+		double sum = 0.0;
+		for (size_t i = end - window; i < end; ++i) sum += values[i];
+		out[end - 1] = sum / window;
+	}
+	return out;
+}
+
+static std::vector<double> RandomWalk(size_t count, double start, double step, uint32_t seed) {
+	std::mt19937 rng(seed);
+	std::normal_distribution<double> noise(0.0, step);
+
+	std::vector<double> values(count);
+	double price = start;
+	for (double& value : values) {
+		price += noise(rng);
+		value = price;
+	}
+	return values;
+}
+
+// Incremental (RollingStdDev) and batch (StdDev) results against the naive reference, within `relative` of the reference
+static void CompareStdDev(const char* name, const std::vector<double>& values, uint32_t window, double relative) {
+	const std::vector<double> expected = NaiveStdDev(values, window);
+	const std::vector<double> batch = StdDev(values, window);
+
+	RollingStdDev rolling(window);
+	double worstBatch = 0.0, worstRolling = 0.0;
+	for (size_t i = 0; i < values.size(); ++i) {
+		const double incremental = rolling.Push(values[i]);
+
+		if (std::isnan(expected[i])) {
+			CHECK(std::isnan(batch[i]) && std::isnan(incremental), "%s: bar %zu should still be warming up", name, i);
+			continue;
+		}
+
+		// Relative to the deviation, with a floor for flat windows
+		const double scale = std::max(expected[i], 1e-12 * std::abs(values[i]));
+		worstBatch = std::max(worstBatch, std::abs(batch[i] - expected[i]) / scale);
+		worstRolling = std::max(worstRolling, std::abs(incremental - expected[i]) / scale);
+	}
+
+	CHECK(worstBatch <= relative, "%s: batch off by %g (relative)", name, worstBatch);
+	CHECK(worstRolling <= relative, "%s: incremental off by %g (relative)", name, worstRolling);
+}
+
+// Incremental (RollingSMA) and batch (SMA) results against the naive reference, within `relative` of the reference
+static void CompareSMA(const char* name, const std::vector<double>& values, uint32_t window, double relative) {
+	const std::vector<double> expected = NaiveSMA(values, window);
+	const std::vector<double> batch = SMA(values, window);
+
+	RollingSMA rolling(window);
+	double worstBatch = 0.0, worstRolling = 0.0;
+	for (size_t i = 0; i < values.size(); ++i) {
+		const double incremental = rolling.Push(values[i]);
+
+		if (std::isnan(expected[i])) {
+			CHECK(std::isnan(batch[i]) && std::isnan(incremental), "%s: bar %zu should still be warming up", name, i);
+			continue;
+		}
+
+		const double scale = std::max(std::abs(expected[i]), 1e-12);
+		worstBatch = std::max(worstBatch, std::abs(batch[i] - expected[i]) / scale);
+		worstRolling = std::max(worstRolling, std::abs(incremental - expected[i]) / scale);
+	}
+
+	CHECK(worstBatch <= relative, "%s: batch SMA off by %g (relative)", name, worstBatch);
+	CHECK(worstRolling <= relative, "%s: incremental SMA off by %g (relative)", name, worstRolling);
+}
+
+int main() {
+	// SMA over a long run: the sliding sum is re-summed every window, so neither path drifts from the reference
+	CompareSMA("sma random walk", RandomWalk(5000, 100.0, 1.0, 1), 20, 1e-12);
+	CompareSMA("sma long run", RandomWalk(500000, 1e6, 50.0, 8), 50, 1e-12);
+	// One huge bar: its rounding error is summed away at most a window after it leaves, not kept for the rest of the series
+	std::vector<double> spike = RandomWalk(2000, 100.0, 1.0, 9);
+	spike[100] = 1e15;
+	const std::vector<double> spikeSMA = SMA(spike, 20);
+	const std::vector<double> spikeExpected = NaiveSMA(spike, 20);
+	double worstAfterSpike = 0.0;
+	for (size_t i = 100 + 2 * 20; i < spike.size(); ++i) {
+		worstAfterSpike = std::max(worstAfterSpike, std::abs(spikeSMA[i] - spikeExpected[i]) / std::abs(spikeExpected[i]));
+	}
+	CHECK(worstAfterSpike <= 1e-12, "sma spike: off by %g (relative) once it has left the window", worstAfterSpike);
+
+	CompareSMA("sma window 1", RandomWalk(100, 10.0, 1.0, 5), 1, 1e-15);
+	CompareSMA("sma window longer than series", RandomWalk(10, 10.0, 1.0, 6), 20, 1e-12);
+
+	// Everyday prices
+	CompareStdDev("random walk", RandomWalk(5000, 100.0, 1.0, 1), 20, 1e-9);
+
+	// A large level with tiny moves: a raw sum of squares loses every digit of the variance here
+	CompareStdDev("large level", RandomWalk(5000, 1e6, 0.01, 2), 20, 1e-6);
+
+	// Long run, where an unchecked sliding update would drift
+	CompareStdDev("long run", RandomWalk(200000, 500.0, 2.0, 3), 50, 1e-9);
+
+	// Flat stretch, the deviation must come back as 0 and not as sqrt(rounding)
+	std::vector<double> flat = RandomWalk(300, 50.0, 1.0, 4);
+	flat.insert(flat.end(), 200, 1234.5678);
+	const std::vector<double> flatDeviation = StdDev(flat, 30);
+	CHECK(flatDeviation.back() < 1e-9, "flat window: deviation %g", flatDeviation.back());
+
+	CompareStdDev("window 1", RandomWalk(100, 10.0, 1.0, 5), 1, 1e-12);
+	CompareStdDev("window longer than series", RandomWalk(10, 10.0, 1.0, 6), 20, 1e-12);
+
+	// Reset starts over
+	RollingStdDev rolling(3);
+	for (double value : { 1.0, 2.0, 3.0, 100.0 }) rolling.Push(value);
+	rolling.Reset();
+	for (double value : { 1.0, 2.0, 3.0 }) rolling.Push(value);
+	CHECK(std::abs(rolling.value() - std::sqrt(2.0 / 3.0)) < 1e-12, "after reset: %g", rolling.value());
+	CHECK(std::abs(rolling.mean() - 2.0) < 1e-12, "mean after reset: %g", rolling.mean());
+
+	// Bollinger's middle band is the SMA and its width comes from the same deviation
+	const std::vector<double> closes = RandomWalk(500, 100.0, 1.0, 7);
+	const Bands bands = Bollinger(closes, 20, 2.0);
+	const std::vector<double> sma = SMA(closes, 20);
+	const std::vector<double> deviation = NaiveStdDev(closes, 20);
+	for (size_t i = 19; i < closes.size(); ++i) {
+		CHECK(std::abs(bands.middle[i] - sma[i]) < 1e-9, "bollinger middle at %zu", i);
+		CHECK(std::abs(bands.upper[i] - bands.middle[i] - 2.0 * deviation[i]) < 1e-9, "bollinger width at %zu", i);
+	}
+
+	if (g_CheckFailures == 0) std::printf("IndicatorsTest: all checks passed\n");
+	return g_CheckFailures;
+}
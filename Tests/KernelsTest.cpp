@@ -0,0 +1,105 @@
+#include "Check.hpp"
+
+#include "Utils/Kernels.hpp"
+#include "Utils/StockMath.hpp"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include <cstring>
+
+using namespace StockyBoy::Maths;
+
+static constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+static bool SameBits(double a, double b) {
+	return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+// Every lane count and tail length the vector loops can end on, plus a long column
+static const size_t LENGTHS[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 2520 };
+
+static std::vector<double> Prices(size_t count, uint32_t seed) {
+	std::mt19937 rng(seed);
+	std::uniform_real_distribution<double> price(0.5, 900.0);
+
+	std::vector<double> values(count);
+	for (double& value : values) value = price(rng);
+	return values;
+}
+
+// Runs the kernels on the active path and compares them with the plain loops
+static void CheckActivePath() {
+	const char* path = ToString(ActiveSimdLevel());
+
+	for (size_t length : LENGTHS) {
+		const std::vector<double> from = Prices(length, 11 + static_cast<uint32_t>(length));
+		const std::vector<double> to = Prices(length, 97 + static_cast<uint32_t>(length));
+
+		// --- Reductions: max/min are exact, a sum only up to reassociation ---
+		double max = -std::numeric_limits<double>::infinity(), min = std::numeric_limits<double>::infinity(), sum = 0.0, magnitude = 0.0;
+		for (double value : from) {
+			max = std::max(max, value);
+			min = std::min(min, value);
+			sum += value;
+			magnitude += std::abs(value);
+		}
+		CHECK(Max(from) == max, "%s: Max over %zu", path, length);
+		CHECK(Min(from) == min, "%s: Min over %zu", path, length);
+		CHECK(std::abs(Sum(from) - sum) <= 1e-12 * magnitude, "%s: Sum over %zu off by %g", path, length, Sum(from) - sum);
+
+		// --- Element-wise: the same operations per element, bit for bit ---
+		const double divisor = (length > 0) ? max : 1.0;
+		std::vector<double> divided(length), scaled(length), change(length), logs(length);
+		DivideInto(from, divided, divisor);
+		ScaleInto(from, scaled, 0.37);
+		PercentChange(from, to, change);
+		LogReturn(from, to, logs);
+
+		for (size_t i = 0; i < length; ++i) {
+			CHECK(SameBits(divided[i], from[i] / divisor), "%s: DivideInto[%zu] of %zu", path, i, length);
+			CHECK(SameBits(scaled[i], from[i] * 0.37), "%s: ScaleInto[%zu] of %zu", path, i, length);
+			CHECK(SameBits(change[i], (to[i] - from[i]) / from[i] * 100.0), "%s: PercentChange[%zu] of %zu", path, i, length);
+			CHECK(SameBits(logs[i], std::log(to[i] / from[i])), "%s: LogReturn[%zu] of %zu", path, i, length);
+		}
+
+		// normalize divides by the max, exactly what the pre-SIMD loop did
+		std::vector<double> normalized = from;
+		normalize(normalized);
+		const std::vector<double> copied = normalizeCopy(from);
+		for (size_t i = 0; i < length; ++i) {
+			CHECK(SameBits(normalized[i], from[i] / max), "%s: normalize[%zu] of %zu", path, i, length);
+			CHECK(SameBits(copied[i], from[i] / max), "%s: normalizeCopy[%zu] of %zu", path, i, length);
+		}
+	}
+
+	// NaN is skipped by the extremes and an empty column has none
+	const std::vector<double> gappy = { NaN, 3.0, NaN, -2.0, 7.5, NaN, 1.0, NaN, 0.5 };
+	CHECK(Max(gappy) == 7.5, "%s: Max with NaN gave %g", path, Max(gappy));
+	CHECK(Min(gappy) == -2.0, "%s: Min with NaN gave %g", path, Min(gappy));
+	CHECK(Max(std::vector<double>{}) == -std::numeric_limits<double>::infinity(), "%s: Max of nothing", path);
+
+	// All-NaN and all-zero columns are left alone
+	std::vector<double> allNaN(5, NaN), zeros(6, 0.0);
+	normalize(allNaN);
+	normalize(zeros);
+	CHECK(std::isnan(allNaN[0]) && zeros[0] == 0.0, "%s: degenerate columns changed", path);
+}
+
+int main() {
+	const SimdLevel detected = ActiveSimdLevel();
+
+	for (SimdLevel level : { SimdLevel::AVX2, SimdLevel::SSE2, SimdLevel::Scalar }) {
+		if (SetSimdLevel(level) != level) {
+			std::printf("KernelsTest: %s not supported here, skipped\n", ToString(level));
+			continue;
+		}
+		CheckActivePath();
+	}
+
+	SetSimdLevel(detected);
+
+	if (g_CheckFailures == 0) std::printf("KernelsTest: all checks passed\n");
+	return g_CheckFailures;
+}
@@ -0,0 +1,160 @@
+#include "Check.hpp"
+#include "ScriptedProvider.hpp"
+
+#include "MarketDataProvider.hpp"
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+
+using namespace StockyBoy;
+using namespace StockyBoy::Scraper;
+
+static constexpr int64_t DAY = 86400;
+static constexpr int64_t FIRST_BAR = 1704205800; // 2024-01-02 14:30 UTC
+
+// One daily bar per close, FIRST_BAR onwards
+static StockTable DailyBars(const std::vector<double>& closes, size_t firstDay = 0) {
+	StockTable table;
+	for (size_t i = 0; i < closes.size(); ++i) {
+		table.epochs.push_back(FIRST_BAR + static_cast<int64_t>(firstDay + i) * DAY);
+		table.open.push_back(closes[i] + 1.0);
+		table.high.push_back(closes[i] + 2.0);
+		table.low.push_back(closes[i] - 2.0);
+		table.close.push_back(closes[i]);
+		table.volume.push_back(1000.0 + static_cast<double>(i));
+	}
+	IndexTimeAxis(table);
+	return table;
+}
+
+static bool SameBars(const StockTable& a, const StockTable& b) {
+	return a.epochs == b.epochs && a.open == b.open && a.high == b.high && a.low == b.low && a.close == b.close && a.volume == b.volume;
+}
+
+// The bars of `table` between two indices, [first, last)
+static StockTable Slice(const StockTable& table, size_t first, size_t last) {
+	StockTable out;
+	out.epochs.assign(table.epochs.begin() + first, table.epochs.begin() + last);
+	out.open.assign(table.open.begin() + first, table.open.begin() + last);
+	out.high.assign(table.high.begin() + first, table.high.begin() + last);
+	out.low.assign(table.low.begin() + first, table.low.begin() + last);
+	out.close.assign(table.close.begin() + first, table.close.begin() + last);
+	out.volume.assign(table.volume.begin() + first, table.volume.begin() + last);
+	return out;
+}
+
+int main() {
+	const std::filesystem::path directory = std::filesystem::temp_directory_path() / "StockyBoyReplayTest";
+	std::filesystem::remove_all(directory);
+
+	// AAA: ten days of bars. NUL: its last bar is a null close (0). ZIP: nothing but nulls.
+	const StockTable aaa = DailyBars({ 10.5, 11.25, 12.0, 11.0, 10.0, 9.5, 9.75, 10.25, 10.5, 10.125 });
+	ScriptedProvider source;
+	source.tables["AAA"] = aaa;
+	source.tables["NUL"] = DailyBars({ 20.0, 21.0, 0.0 });
+	source.tables["ZIP"] = DailyBars({ 0.0, 0.0 });
+
+	// --- Record: the source's answers pass through unchanged and land on disk ---
+	{
+		RecordingProvider recording(source, directory);
+		const std::vector<FetchRequest> requests = {
+			{ .label = "AAA", .interval = DAYS_1, .range = RANGE_1MO },
+			{ .label = "NUL", .interval = DAYS_1, .range = RANGE_1MO },
+			{ .label = "ZIP", .interval = DAYS_1, .range = RANGE_1MO }
+		};
+		const std::vector<BarResponse> responses = recording.FetchBars(requests);
+
+		CHECK(responses.size() == 3 && responses[0].result.succeeded && SameBars(responses[0].table, aaa), "recording changed the answer");
+		CHECK(recording.recordResult().succeeded, "recording: %s", recording.recordResult().error.c_str());
+		CHECK(std::filesystem::exists(ReplayProvider::PathFor(directory, "AAA", DAYS_1)), "no recording file for AAA");
+		CHECK(std::string(recording.name()) == "scripted", "recording name %s", recording.name());
+	}
+
+	ReplayProvider replay(directory);
+
+	// --- Period request: the recorded bars inside [period1, period2) ---
+	{
+		StockTable table;
+		const FetchRequest request{ .label = "AAA", .interval = DAYS_1, .period1 = aaa.epochs[3], .period2 = aaa.epochs[7] };
+		const Result result = replay.FetchBars(request, table);
+		CHECK(result.succeeded, "period: %s", result.error.c_str());
+		CHECK(SameBars(table, Slice(aaa, 3, 7)), "period: %zu bars, expected 4", table.size());
+	}
+
+	// --- Range request: that much history back from the last recorded bar ---
+	{
+		StockTable table;
+		Result result = replay.FetchBars(FetchRequest{ .label = "AAA", .interval = DAYS_1, .range = RANGE_5D }, table);
+		CHECK(result.succeeded, "5d range: %s", result.error.c_str());
+		CHECK(SameBars(table, Slice(aaa, 4, 10)), "5d range: %zu bars, expected 6", table.size());
+
+		result = replay.FetchBars(FetchRequest{ .label = "AAA", .interval = DAYS_1, .range = RANGE_MAX }, table);
+		CHECK(result.succeeded && SameBars(table, aaa), "max range: %zu bars", table.size());
+		CHECK(table.timeStamps.size() == table.size(), "max range: time axis not indexed");
+	}
+
+	// --- Deterministic: the same requests give the same bars every time ---
+	{
+		const std::vector<FetchRequest> requests = {
+			{ .label = "AAA", .interval = DAYS_1, .range = RANGE_5D },
+			{ .label = "NUL", .interval = DAYS_1, .range = RANGE_MAX }
+		};
+		const std::vector<BarResponse> first = replay.FetchBars(requests);
+		const std::vector<BarResponse> second = replay.FetchBars(requests);
+		CHECK(SameBars(first[0].table, second[0].table) && SameBars(first[1].table, second[1].table), "two replays differ");
+	}
+
+	// --- Nothing recorded: not found, for bars and intervals alike ---
+	{
+		StockTable table;
+		Result result = replay.FetchBars(FetchRequest{ .label = "NONE", .interval = DAYS_1 }, table);
+		CHECK(!result.succeeded && result.kind == ErrorKind::NOT_FOUND, "unrecorded label");
+		result = replay.FetchBars(FetchRequest{ .label = "AAA", .interval = MINUTES_5 }, table);
+		CHECK(!result.succeeded && result.kind == ErrorKind::NOT_FOUND, "unrecorded interval");
+	}
+
+	// --- Quotes: the last positive recorded close, symbols without one are left out ---
+	{
+		const std::vector<std::string> symbols = { "AAA", "NUL", "ZIP", "NONE" };
+		std::vector<Quote> quotes;
+		CHECK(replay.FetchQuotes(symbols, quotes).succeeded, "quotes failed");
+		CHECK(quotes.size() == 2, "%zu quotes, expected 2", quotes.size());
+
+		for (const Quote& quote : quotes) {
+			CHECK(quote.price > 0.0, "%s quoted at %g", quote.symbol.c_str(), quote.price);
+			if (quote.symbol == "AAA") CHECK(quote.price == 10.125 && quote.time == aaa.epochs.back(), "AAA quote %g", quote.price);
+			if (quote.symbol == "NUL") CHECK(quote.price == 21.0 && quote.time == FIRST_BAR + DAY, "NUL quote %g", quote.price);
+		}
+	}
+
+	// --- Recording more bars merges them into the file, overlapping bars replaced ---
+	{
+		StockTable later = DailyBars({ 10.75, 11.5, 12.25 }, 9);
+		source.tables["AAA"] = later;
+		RecordingProvider recording(source, directory);
+		recording.FetchBars(std::vector<FetchRequest>{ { .label = "AAA", .interval = DAYS_1, .range = RANGE_5D } });
+
+		StockTable table;
+		replay.FetchBars(FetchRequest{ .label = "AAA", .interval = DAYS_1, .range = RANGE_MAX }, table);
+		CHECK(table.size() == 12, "merged recording has %zu bars, expected 12", table.size());
+		CHECK(table.size() == 12 && table.close[8] == 10.5 && table.close[9] == 10.75 && table.close[11] == 12.25, "merged closes");
+	}
+
+	// --- A recording that can't be written is reported, the bars still come through ---
+	{
+		const std::filesystem::path blocked = directory / "blocked";
+		std::ofstream(blocked) << "a file where the directory should be";
+
+		RecordingProvider recording(source, blocked);
+		const std::vector<BarResponse> responses = recording.FetchBars(std::vector<FetchRequest>{ { .label = "AAA", .interval = DAYS_1 } });
+		CHECK(responses.size() == 1 && responses[0].result.succeeded, "an unwritable recording failed the fetch");
+		CHECK(!recording.recordResult().succeeded, "an unwritable recording was not reported");
+	}
+
+	std::filesystem::remove_all(directory);
+
+	if (g_CheckFailures == 0) std::printf("ReplayTest: all checks passed\n");
+	return g_CheckFailures;
+}
@@ -0,0 +1,52 @@
+"""Runs a test executable against a fresh MockAlpaca on a free local port.
+
+    python RunWithMock.py <MockAlpaca.py> <test executable>
+
+The test gets the endpoint (http://127.0.0.1:<port>/v2) as its only argument and its exit code is returned.
+Orders for REJ are rejected by the mock. Standard library only.
+"""
+
+import socket
+import subprocess
+import sys
+import time
+
+
+def free_port():
+    with socket.socket() as sock:
+        sock.bind(("127.0.0.1", 0))
+        return sock.getsockname()[1]
+
+
+def wait_listening(port, timeout):
+    deadline = time.monotonic() + timeout
+    while time.monotonic() < deadline:
+        try:
+            with socket.create_connection(("127.0.0.1", port), timeout=0.5):
+                return True
+        except OSError:
+            time.sleep(0.1)
+    return False
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__)
+        return 2
+
+    mock, test = sys.argv[1], sys.argv[2]
+    port = free_port()
+
+    server = subprocess.Popen([sys.executable, mock, "--port", str(port), "--fill-delay", "0.1", "--reject", "REJ"])
+    try:
+        if not wait_listening(port, 10.0):
+            print(f"MockAlpaca didn't start on port {port}")
+            return 1
+        return subprocess.run([test, f"http://127.0.0.1:{port}/v2"], timeout=120).returncode
+    finally:
+        server.terminate()
+        server.wait()
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,68 @@
+#include "Check.hpp"
+
+#include "Screener.hpp"
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace StockyBoy::Scraper;
+
+// The bot's buy rule: down at least 5% over the last bar
+static Screener DipRule() {
+	Screener screener;
+	screener.Where(Screener::PercentChange(1), Screener::AtMost(-5.0));
+	return screener;
+}
+
+static std::vector<std::string> HitLabels(const CloseMatrix& matrix) {
+	std::vector<std::string> labels;
+	for (const ScreenHit& hit : DipRule().Run(matrix)) labels.push_back(matrix.label(hit.symbol));
+	return labels;
+}
+
+int main() {
+	const double nan = std::numeric_limits<double>::quiet_NaN();
+	const double inf = std::numeric_limits<double>::infinity();
+
+	// --- Set: per-symbol histories, right-aligned on the last bar ---
+	{
+		CloseMatrix matrix(6, 3);
+		matrix.Set(0, "DIP", std::vector<double>{ 50.0, 100.0, 90.0 });  // -10%, a real hit
+		matrix.Set(1, "NULL", std::vector<double>{ 50.0, 100.0, 0.0 });  // null latest bar, parsed as 0
+		matrix.Set(2, "NEG", std::vector<double>{ 50.0, 100.0, -3.0 });
+		matrix.Set(3, "INF", std::vector<double>{ 50.0, 100.0, inf });
+		matrix.Set(4, "PREV", std::vector<double>{ 50.0, 0.0, 40.0 });   // null bar before the latest one
+		matrix.Set(5, "SHORT", std::vector<double>{ 90.0 });              // one bar, nothing to compare with
+
+		const std::vector<std::string> hits = HitLabels(matrix);
+		CHECK(hits == std::vector<std::string>{ "DIP" }, "Set: %zu hits, first '%s'", hits.size(), hits.empty() ? "" : hits.front().c_str());
+
+		for (size_t symbol = 1; symbol <= 3; ++symbol) {
+			CHECK(std::isnan(matrix.latest()[symbol]), "Set: %s latest close %g should be missing", matrix.label(symbol).c_str(), matrix.latest()[symbol]);
+		}
+		CHECK(std::isnan(matrix.row(1)[4]), "Set: PREV's null close kept as %g", matrix.row(1)[4]);
+		CHECK(matrix.row(2)[4] == 50.0, "Set: PREV two bars ago %g", matrix.row(2)[4]);
+		CHECK(matrix.latest()[0] == 90.0 && matrix.row(1)[0] == 100.0, "Set: DIP closes");
+		CHECK(std::isnan(matrix.row(1)[5]), "Set: SHORT padding");
+	}
+
+	// --- SetRow: a date-aligned day per row ---
+	{
+		CloseMatrix matrix(std::vector<std::string>{ "DIP", "NULL", "NAN", "FLAT" }, 2);
+		matrix.SetRow(1, std::vector<double>{ 100.0, 100.0, 100.0, 100.0 });
+		matrix.SetRow(0, std::vector<double>{ 94.0, 0.0, nan, 100.0 });
+
+		const std::vector<std::string> hits = HitLabels(matrix);
+		CHECK(hits == std::vector<std::string>{ "DIP" }, "SetRow: %zu hits", hits.size());
+		CHECK(std::isnan(matrix.latest()[1]), "SetRow: 0 close kept as %g", matrix.latest()[1]);
+
+		// A short row leaves the remaining symbols missing
+		matrix.SetRow(0, std::vector<double>{ 94.0 });
+		CHECK(std::isnan(matrix.latest()[3]), "SetRow: short row padding");
+	}
+
+	if (g_CheckFailures == 0) std::printf("ScreenerTest: all checks passed\n");
+	return g_CheckFailures;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "MarketDataProvider.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+// Stands in for a network provider: answers each label with the table scripted for it (`next` when it has none),
+// or with `nextResult` when that is a failure, and remembers every request
+class ScriptedProvider : public StockyBoy::Scraper::MarketDataProvider {
+public:
+	std::vector<StockyBoy::Scraper::FetchRequest> requests;
+	std::map<std::string, StockyBoy::Scraper::StockTable> tables;
+	StockyBoy::Scraper::StockTable next;
+	StockyBoy::Scraper::Result nextResult = StockyBoy::Scraper::Result::Ok();
+
+	const char* name() const override { return "scripted"; }
+
+	std::vector<StockyBoy::Scraper::BarResponse> FetchBars(const std::vector<StockyBoy::Scraper::FetchRequest>& batch, size_t) override {
+		std::vector<StockyBoy::Scraper::BarResponse> responses;
+		for (const StockyBoy::Scraper::FetchRequest& request : batch) {
+			requests.push_back(request);
+
+			StockyBoy::Scraper::BarResponse& response = responses.emplace_back(StockyBoy::Scraper::BarResponse{ .result = nextResult });
+			if (nextResult.succeeded) {
+				auto it = tables.find(request.label);
+				response.table = (it != tables.end()) ? it->second : next;
+			}
+		}
+		return responses;
+	}
+
+	StockyBoy::Scraper::Result FetchQuotes(std::span<const std::string>, std::vector<StockyBoy::Scraper::Quote>&) override {
+		return StockyBoy::Scraper::Result::Ok();
+	}
+
+	using MarketDataProvider::FetchBars;
+};
@@ -0,0 +1,128 @@
+#include "Check.hpp"
+
+#include "StockData.hpp"
+
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include <nlohmann/json.hpp>
+
+using namespace StockyBoy::Scraper;
+
+// getStockTable (SAX, straight into the columns) against parsing the whole document into a nlohmann::json DOM first,
+// on Yahoo-shaped payloads. Not a ctest: run it by hand, optionally with the number of parses per payload.
+
+// The DOM parse getStockTable used before, down to the same table: nulls read as 0.0
+static Result ParseDom(const std::string& data, StockTable& table) {
+	const nlohmann::json root = nlohmann::json::parse(data, nullptr, false);
+	if (root.is_discarded()) {
+		return Result::Fail("[Bench] JSON parse error", ErrorKind::INVALID);
+	}
+
+	const nlohmann::json& result = root["chart"]["result"][0];
+	const nlohmann::json& quote = result["indicators"]["quote"][0];
+
+	auto column = [&quote](const char* key, std::vector<double>& out) {
+		for (const nlohmann::json& value : quote[key]) {
+			out.push_back(value.is_number() ? value.get<double>() : 0.0);
+		}
+		};
+
+	StockTable parsed;
+	for (const nlohmann::json& epoch : result["timestamp"]) {
+		parsed.epochs.push_back(epoch.get<int64_t>());
+	}
+	column("open", parsed.open);
+	column("high", parsed.high);
+	column("low", parsed.low);
+	column("close", parsed.close);
+	column("volume", parsed.volume);
+
+	IndexTimeAxis(parsed);
+	table = std::move(parsed);
+	return Result::Ok();
+}
+
+// A chart response with `bars` bars `spacing` seconds apart, the meta and adjclose noise Yahoo sends, and a null now and then
+static std::string ChartPayload(size_t bars, int64_t spacing) {
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<double> price(100.0, 200.0);
+
+	std::string out = R"({"chart":{"result":[{"meta":{"currency":"USD","symbol":"AAPL","validRanges":["1d","5d"],)"
+		R"("tradingPeriods":[[{"start":1,"end":2}]]},"timestamp":[)";
+	for (size_t i = 0; i < bars; ++i) {
+		if (i > 0) out += ',';
+		out += std::to_string(1'600'000'000 + static_cast<int64_t>(i) * spacing);
+	}
+	out += R"(],"indicators":{"quote":[{)";
+
+	const char* columns[] = { "volume", "open", "close", "high", "low" };
+	for (size_t c = 0; c < std::size(columns); ++c) {
+		if (c > 0) out += ',';
+		out += '"';
+		out += columns[c];
+		out += "\":[";
+
+		for (size_t i = 0; i < bars; ++i) {
+			if (i > 0) out += ',';
+
+			char number[32];
+			if (i % 97 == 5) std::snprintf(number, sizeof(number), "null");
+			else if (c == 0) std::snprintf(number, sizeof(number), "%lld", static_cast<long long>(price(rng) * 1000.0));
+			else std::snprintf(number, sizeof(number), "%.14g", price(rng));
+			out += number;
+		}
+		out += ']';
+	}
+
+	out += R"(}],"adjclose":[{"adjclose":[1.5,2.5]}]}}],"error":null}})";
+	return out;
+}
+
+// Mean milliseconds per parse
+template <typename Parse>
+static double TimeParse(const std::string& payload, int repeats, Parse parse) {
+	const auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < repeats; ++i) {
+		StockTable table;
+		parse(payload, table);
+	}
+	return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / repeats;
+}
+
+int main(int argc, char** argv) {
+	const int repeats = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 50;
+
+	struct Case {
+		const char* name;
+		size_t bars;
+		int64_t spacing;
+	};
+
+	const Case cases[] = {
+		{ "1m/5d", 1950, 60 },
+		{ "1d/max", 11100, 86400 }
+	};
+
+	for (const Case& test : cases) {
+		const std::string payload = ChartPayload(test.bars, test.spacing);
+
+		StockTable dom, sax;
+		const Result domResult = ParseDom(payload, dom);
+		const Result saxResult = getStockTable(payload, sax);
+		CHECK(domResult.succeeded && saxResult.succeeded, "%s: %s%s", test.name, domResult.error.c_str(), saxResult.error.c_str());
+		CHECK(dom.epochs == sax.epochs && dom.open == sax.open && dom.high == sax.high && dom.low == sax.low &&
+			dom.close == sax.close && dom.volume == sax.volume && dom.timeStamps == sax.timeStamps, "%s: tables differ", test.name);
+
+		const double domMs = TimeParse(payload, repeats, ParseDom);
+		const double saxMs = TimeParse(payload, repeats, [](const std::string& data, StockTable& table) { return getStockTable(data, table); });
+
+		std::printf("%-7s %6zu bars %5zu KB   DOM %7.3f ms   SAX %7.3f ms   %.2fx\n",
+			test.name, test.bars, payload.size() / 1024, domMs, saxMs, domMs / saxMs);
+	}
+
+	return g_CheckFailures;
+}
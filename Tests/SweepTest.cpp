@@ -0,0 +1,125 @@
+#include "Check.hpp"
+
+#include <5PercentRule-Bot/Headers/Sweep.hpp>
+
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+#include <sstream>
+
+using namespace StockyBoy::Bots::FivePercentRule;
+using namespace StockyBoy::Scraper;
+
+// Random walks on consecutive weekdays from Monday 2024-01-01, volatile enough for every grid point to trade
+static History RandomHistory(size_t symbols, size_t days, uint32_t seed) {
+	constexpr int64_t FIRST_MONDAY = 19723;
+	std::mt19937 rng(seed);
+	std::normal_distribution<double> move(0.0, 0.03);
+
+	std::vector<std::string> labels;
+	std::vector<StockTable> tables(symbols);
+	for (size_t s = 0; s < symbols; ++s) {
+		double price = 20.0 + static_cast<double>(s);
+		for (size_t i = 0; i < days; ++i) {
+			price *= std::exp(move(rng));
+			const int64_t day = FIRST_MONDAY + static_cast<int64_t>(i / 5) * 7 + static_cast<int64_t>(i % 5);
+			tables[s].epochs.push_back(day * 86400 + 52200);
+			for (std::vector<double>* column : { &tables[s].open, &tables[s].high, &tables[s].low, &tables[s].close }) column->push_back(price);
+			tables[s].volume.push_back(1000.0);
+		}
+		labels.push_back("SYM" + std::to_string(s));
+	}
+
+	std::vector<StockTableView> views;
+	for (const StockTable& table : tables) views.push_back(View(table));
+	return History::Build(labels, views);
+}
+
+static bool SameParams(const Params& a, const Params& b) {
+	return a.window == b.window && a.buyDrop == b.buyDrop && a.sellGain == b.sellGain &&
+		a.forgiveness == b.forgiveness && a.tradeValue == b.tradeValue;
+}
+
+static bool SameRow(const SweepRow& a, const SweepRow& b) {
+	return SameParams(a.params, b.params) && a.totalReturn == b.totalReturn && a.maxDrawdown == b.maxDrawdown && a.trades == b.trades;
+}
+
+static void CheckSummarize() {
+	BacktestResult result;
+	result.startingCash = 100.0;
+	result.equity = { 110.0, 90.0, 120.0, 60.0, 80.0 };
+	result.buys = 3;
+	result.sells = 2;
+
+	// Peaks 110 then 120, the deepest trough after a peak is 60: (120 - 60) / 120
+	SweepRow row = Summarize(Params{}, result);
+	CHECK(std::abs(row.maxDrawdown - 0.5) < 1e-12, "drawdown %g, expected 0.5", row.maxDrawdown);
+	CHECK(std::abs(row.totalReturn + 0.2) < 1e-12, "return %g, expected -0.2", row.totalReturn);
+	CHECK(row.trades == 5, "%zu trades", row.trades);
+
+	// Falling from the start counts from the starting cash
+	result.equity = { 80.0, 85.0 };
+	row = Summarize(Params{}, result);
+	CHECK(std::abs(row.maxDrawdown - 0.2) < 1e-12, "drawdown from the start %g, expected 0.2", row.maxDrawdown);
+
+	// Only rising: no drawdown
+	result.equity = { 100.0, 101.0, 105.0 };
+	row = Summarize(Params{}, result);
+	CHECK(row.maxDrawdown == 0.0, "rising curve drawdown %g", row.maxDrawdown);
+
+	// No session at all
+	result.equity.clear();
+	row = Summarize(Params{}, result);
+	CHECK(row.maxDrawdown == 0.0 && row.totalReturn == 0.0, "empty curve: drawdown %g, return %g", row.maxDrawdown, row.totalReturn);
+}
+
+int main() {
+	CheckSummarize();
+
+	// --- Grid expansion: every combination, last list varying fastest, unlisted knobs at their defaults ---
+	const SweepGrid grid{ .windows = { 2, 3, 5 }, .buyDrops = { 3.0f, 5.0f }, .sellGains = { 3.0f, 5.0f, 8.0f } };
+	const std::vector<Params> params = grid.Expand();
+	CHECK(params.size() == 18, "%zu grid points", params.size());
+	if (params.size() == 18) {
+		CHECK(SameParams(params.front(), Params{ .window = 2, .buyDrop = 3.0f, .sellGain = 3.0f }), "first grid point");
+		CHECK(SameParams(params[1], Params{ .window = 2, .buyDrop = 3.0f, .sellGain = 5.0f }), "second grid point");
+		CHECK(SameParams(params.back(), Params{ .window = 5, .buyDrop = 5.0f, .sellGain = 8.0f }), "last grid point");
+	}
+	CHECK(SweepGrid{}.Expand().size() == 1 && SameParams(SweepGrid{}.Expand().front(), Params{}), "empty grid is the defaults");
+
+	// --- Same rows whatever the number of workers, and the same as running each backtest on its own ---
+	const History history = RandomHistory(200, 80, 11);
+	const BacktestConfig base{ .dailyBudget = 50.0f, .startingCash = 1000.0, .seed = 3 };
+
+	const std::vector<SweepRow> serial = Sweep(history, params, base, 1);
+	const std::vector<SweepRow> parallel = Sweep(history, params, base, 4);
+	const std::vector<SweepRow> everyCore = Sweep(history, params, base, 0);
+
+	CHECK(serial.size() == params.size() && parallel.size() == params.size() && everyCore.size() == params.size(), "row counts");
+	for (size_t i = 0; i < serial.size() && i < parallel.size() && i < everyCore.size(); ++i) {
+		CHECK(SameRow(serial[i], parallel[i]), "row %zu differs between 1 and 4 workers", i);
+		CHECK(SameRow(serial[i], everyCore[i]), "row %zu differs between 1 worker and every core", i);
+		CHECK(SameParams(serial[i].params, params[i]), "row %zu is out of grid order", i);
+	}
+
+	for (size_t i : { size_t{ 0 }, params.size() / 2, params.size() - 1 }) {
+		BacktestConfig config = base;
+		config.params = params[i];
+		CHECK(SameRow(serial[i], Summarize(params[i], Backtest(history, config))), "row %zu differs from a lone backtest", i);
+	}
+
+	size_t trading = 0;
+	for (const SweepRow& row : serial) trading += (row.trades > 0) ? 1 : 0;
+	CHECK(trading == serial.size(), "only %zu of %zu grid points traded", trading, serial.size());
+
+	// --- CSV: a header and one line per row ---
+	std::ostringstream table;
+	WriteSweepTable(table, serial);
+	const std::string csv = table.str();
+	CHECK(csv.starts_with("window,buyDrop,sellGain,forgiveness,tradeValue,return,maxDrawdown,trades\n"), "CSV header");
+	CHECK(static_cast<size_t>(std::count(csv.begin(), csv.end(), '\n')) == serial.size() + 1, "CSV line count");
+
+	if (g_CheckFailures == 0) std::printf("SweepTest: all checks passed\n");
+	return g_CheckFailures;
+}